@@ -0,0 +1,415 @@
+"""
+STiC performance benchmark
+
+Runs a fixed set of small synthetic problems with STiC.x using a
+different number of MPI ranks and reports pixels per second, time per
+synth call and peak RSS as JSON. The results are compared against a
+stored baseline (baseline.json) to catch performance regressions.
+
+Cases (see cases/*/input.cfg):
+
+   lte_fe6302      : LTE inversion of Fe I 6301/6302, full Stokes
+   nlte_ca8542_crd : non-LTE inversion of Ca II 8542 (CRD atom)
+   nlte_cahk_prd   : non-LTE synthesis of Ca II H&K with PRD
+   rf_ca8542       : mode 4, response functions of Ca II 8542 (CRD atom)
+
+The models are generated from example/Atmos/FALC_82.atmos with
+deterministic pixel-to-pixel perturbations. The "observed" profiles of
+the inversion cases are a (not timed) mode 2 synthesis of those models,
+and the inversions start from the unperturbed FALC model.
+
+Usage:
+
+   python3 bench.py [--stic ../src/STiC.x] [--ranks 1,4,N] [--cases all]
+                    [--baseline baseline.json] [--tol 0.1] [--output bench.json]
+                    [--update-baseline]
+
+"N" in --ranks is replaced by the number of cores of the machine. Rank
+0 is the master, so the synthesis and RF cases use at least 2 ranks.
+The exit status is 1 if any metric is worse than the baseline by more
+than --tol (relative), or if there is no baseline to compare with (a
+missing or empty baseline.json, or one without any of the selected
+cases). Create it with --update-baseline on the reference machine.
+
+Dependencies: numpy and netCDF4.
+
+Modifications:
+                  2026-10-18: Created.
+                  2026-10-19: Fail when there is no baseline to compare with.
+
+"""
+import os
+import sys
+import json
+import time
+import shutil
+import socket
+import argparse
+import resource
+import subprocess
+import numpy as np
+
+BDIR = os.path.dirname(os.path.abspath(__file__))
+EXDIR = os.path.join(BDIR, '..', 'example')
+
+#-----------------------------------------------------------------------------------------
+# CASE DEFINITIONS
+#-----------------------------------------------------------------------------------------
+
+# nx, ny: size of the synthetic map
+# mode: STiC mode of the timed run
+# bfield: add a magnetic field to the models (full-Stokes LTE case)
+
+CASES = {
+    'lte_fe6302':      {'nx': 4, 'ny': 4, 'mode': 1, 'bfield': True},
+    'nlte_ca8542_crd': {'nx': 4, 'ny': 4, 'mode': 1, 'bfield': False},
+    'nlte_cahk_prd':   {'nx': 4, 'ny': 4, 'mode': 2, 'bfield': False},
+    'rf_ca8542':       {'nx': 2, 'ny': 2, 'mode': 4, 'bfield': False},
+}
+
+# Metrics compared with the baseline and whether larger is better
+
+METRICS = {'pix_per_s': True, 't_synth': False, 'maxrss_mb': False}
+
+# Files shared by all cases, copied from example/
+
+SHARED = ['keyword.input', 'kurucz.input', 'molecules.input']
+LINKS = ['Atoms', 'Atmos', 'Molecules']
+
+#-----------------------------------------------------------------------------------------
+# SOME DEFINITIONS
+#-----------------------------------------------------------------------------------------
+
+def readFALC(filename, tmax=2.0e4):
+    """
+    Reads a RH atmos file (column mass scale) and returns log cmass,
+    temp, nne and vturb. The transition region and corona (T > tmax)
+    are removed to keep the depth grid small.
+    """
+    f = open(filename, 'r')
+    li = [line for line in f if (line.strip() != '' and line.strip()[0] != '*')]
+    f.close()
+
+    grav = float(li[2])
+    ndep = int(li[3])
+    d = np.float64([line.split() for line in li[4:4+ndep]])
+
+    idx = np.where(d[:,1] <= tmax)[0]
+    return grav, d[idx,0], d[idx,1], d[idx,2], d[idx,4]
+
+#-----------------------------------------------------------------------------------------
+
+def writeModel(filename, grav, lcmass, temp, nne, vturb, nx, ny, perturb, bfield, seed=1234):
+    """
+    Writes a STiC model in column mass scale (depth_t = 1). If perturb
+    is True, each pixel gets a smooth temperature perturbation, a constant
+    line-of-sight velocity and a scaled micro-turbulence drawn from a fixed
+    seed, so the problem is identical in every run.
+    """
+    from netCDF4 import Dataset as nf
+
+    ndep = temp.size
+    shape = (1, ny, nx, ndep)
+    rs = np.random.RandomState(seed)
+
+    cmass = 10.0**lcmass
+
+    t  = np.zeros(shape); vl = np.zeros(shape); vt = np.zeros(shape)
+    bl = np.zeros(shape); bh = np.zeros(shape); az = np.zeros(shape)
+
+    for yy in range(ny):
+        for xx in range(nx):
+            t[0,yy,xx]  = temp
+            vt[0,yy,xx] = vturb * 1.e5
+
+            if(perturb):
+                c0 = rs.uniform(lcmass.min()+1.0, lcmass.max()-1.0)
+                t[0,yy,xx] += rs.uniform(-300., 300.) * np.exp(-0.5*((lcmass-c0)/0.7)**2)
+                vl[0,yy,xx] = rs.uniform(-1.5e5, 1.5e5)
+                vt[0,yy,xx] *= rs.uniform(0.8, 1.2)
+
+                if(bfield):
+                    bl[0,yy,xx] = rs.uniform(-800., 800.)
+                    bh[0,yy,xx] = rs.uniform(0., 600.)
+                    az[0,yy,xx] = rs.uniform(0., np.pi)
+
+    ncfile = nf(filename, 'w', format='NETCDF4', clobber=True)
+    ncfile.createDimension('y', ny)
+    ncfile.createDimension('x', nx)
+    ncfile.createDimension('ndep', ndep)
+    ncfile.createDimension('time')
+
+    var = {'temp': t, 'vlos': vl, 'vturb': vt, 'blong': bl, 'bhor': bh, 'azi': az,
+           'cmass': np.zeros(shape) + cmass, 'pgas': np.zeros(shape) + cmass * 10.0**grav,
+           'nne': np.zeros(shape) + nne}
+
+    for key in var:
+        par = ncfile.createVariable(key, 'f4', ('time','y','x','ndep'))
+        par[:] = var[key]
+
+    ncfile.close()
+
+#-----------------------------------------------------------------------------------------
+
+def addWeights(filename, noise=5.e-3):
+    """
+    Adds the noise estimate to the profiles of a mode 2 run, so the file
+    can be used as observations: noise * the mean Stokes I in each
+    wavelength point, the same for Q, U and V.
+    """
+    from netCDF4 import Dataset as nf
+
+    ncfile = nf(filename, 'a')
+    prof = ncfile.variables['profiles'][:]
+    nw, ns = prof.shape[-2:]
+
+    w = np.zeros((nw, ns))
+    mI = prof[...,0].reshape((-1,nw)).mean(axis=0)
+    for ss in range(ns): w[:,ss] = noise * mI
+
+    if('weights' not in ncfile.variables):
+        ncfile.createVariable('weights', 'f4', ('wav','stokes'))
+    ncfile.variables['weights'][:] = w
+    ncfile.close()
+
+#-----------------------------------------------------------------------------------------
+
+def readTelemetry(filename):
+    """
+    Returns (sum of wall time, sum of synth calls) from the per-pixel
+    telemetry of a mode 1 run, or None if not present.
+    """
+    from netCDF4 import Dataset as nf
+
+    ncfile = nf(filename, 'r')
+    res = None
+    if(('tel_wall' in ncfile.variables) and ('tel_nsynth' in ncfile.variables)):
+        res = (float(np.sum(ncfile.variables['tel_wall'][:])), float(np.sum(ncfile.variables['tel_nsynth'][:])))
+    ncfile.close()
+    return res
+
+#-----------------------------------------------------------------------------------------
+
+def substitute(template, dest, keys):
+    """
+    Copies a config file replacing @KEY@ by its value
+    """
+    f = open(template, 'r'); txt = f.read(); f.close()
+    for key in keys: txt = txt.replace('@'+key+'@', str(keys[key]))
+    f = open(dest, 'w'); f.write(txt); f.close()
+
+#-----------------------------------------------------------------------------------------
+
+def prepareCase(name, rundir, stic, mpiexec, nprep):
+    """
+    Creates the run directory of a case, the models and (for the
+    inversion cases) the observed profiles. Nothing here is timed.
+    """
+    case = CASES[name]
+    cdir = os.path.join(BDIR, 'cases', name)
+
+    if(os.path.isdir(rundir)): shutil.rmtree(rundir)
+    os.makedirs(rundir)
+
+    for ii in SHARED: shutil.copy(os.path.join(EXDIR, ii), rundir)
+    for ii in LINKS:  os.symlink(os.path.abspath(os.path.join(EXDIR, ii)), os.path.join(rundir, ii))
+    for ii in os.listdir(cdir):
+        if(ii != 'input.cfg'): shutil.copy(os.path.join(cdir, ii), rundir)
+
+    grav, lcmass, temp, nne, vturb = readFALC(os.path.join(EXDIR, 'Atmos', 'FALC_82.atmos'))
+    nx, ny = case['nx'], case['ny']
+
+    writeModel(os.path.join(rundir, 'bench_model.nc'), grav, lcmass, temp, nne, vturb, nx, ny, True, case['bfield'])
+
+    if(case['mode'] == 1):
+        writeModel(os.path.join(rundir, 'bench_guess.nc'), grav, lcmass, temp, nne, vturb, nx, ny, False, False)
+
+        # Observations: mode 2 synthesis of the perturbed models
+
+        substitute(os.path.join(cdir, 'input.cfg'), os.path.join(rundir, 'input.cfg'),
+                   {'MODE': 2, 'IMODEL': 'bench_model.nc', 'OPROF': 'bench_obs.nc'})
+        runSTiC(stic, mpiexec, max(nprep, 2), rundir, 'prepare.log')
+        addWeights(os.path.join(rundir, 'bench_obs.nc'))
+
+        imodel = 'bench_guess.nc'
+    else:
+        imodel = 'bench_model.nc'
+
+    substitute(os.path.join(cdir, 'input.cfg'), os.path.join(rundir, 'input.cfg'),
+               {'MODE': case['mode'], 'IMODEL': imodel, 'OPROF': 'bench_out.nc'})
+
+#-----------------------------------------------------------------------------------------
+
+def runSTiC(stic, mpiexec, nranks, rundir, log):
+    """
+    Runs STiC in rundir. The run is launched from a child python process
+    that reports the peak RSS of the MPI ranks, so each measurement only
+    contains the ranks of that run. Returns (wall time [s], peak RSS [MB]).
+    """
+    cmd = mpiexec.split() + ['-n', str(nranks), os.path.abspath(stic)]
+    wrap = [sys.executable, os.path.abspath(__file__), '--measure', '--'] + cmd
+
+    t0 = time.time()
+    with open(os.path.join(rundir, log), 'w') as f:
+        res = subprocess.run(wrap, cwd=rundir, stdout=subprocess.PIPE, stderr=f)
+    wall = time.time() - t0
+
+    if(res.returncode != 0):
+        sys.exit("bench: ERROR, STiC failed in {0}, see {1}".format(rundir, log))
+
+    return wall, float(res.stdout.decode().split()[-1])
+
+#-----------------------------------------------------------------------------------------
+
+def measure(cmd):
+    """
+    Runs cmd with its stdout sent to stderr and prints the peak RSS [MB] of
+    its children. ru_maxrss is in kB in Linux and in bytes in OSX.
+    """
+    res = subprocess.run(cmd, stdout=sys.stderr)
+    rss = resource.getrusage(resource.RUSAGE_CHILDREN).ru_maxrss
+
+    if(sys.platform == 'darwin'): rss /= 1024.0**2
+    else: rss /= 1024.0
+
+    print(rss)
+    return res.returncode
+
+#-----------------------------------------------------------------------------------------
+
+def loadBaseline(filename, names):
+    """
+    Reads the baseline and checks that it has measurements of at least one
+    of the selected cases. Exits with an error otherwise, so a run without
+    a baseline cannot pass as "no regressions".
+    """
+    if(not os.path.isfile(filename)):
+        sys.exit("bench: ERROR, baseline not found: {0}\n"
+                 "bench: create it with --update-baseline on the reference machine".format(filename))
+
+    with open(filename, 'r') as f: base = json.load(f)
+    cases = base.get('cases') or {}
+    if(base.get('host') is None or len([nn for nn in names if(len(cases.get(nn, {})) > 0)]) == 0):
+        sys.exit("bench: ERROR, the baseline {0} has no measurements of [{1}]\n"
+                 "bench: create it with --update-baseline on the reference machine".format(filename, ','.join(names)))
+    return base
+
+#-----------------------------------------------------------------------------------------
+
+def compare(res, base, tol):
+    """
+    Compares the metrics with the baseline. Returns a list of regressions
+    and the number of compared metrics.
+    """
+    bad, ncomp = [], 0
+    for name in res:
+        for nr in res[name]:
+            b = base.get(name, {}).get(nr)
+            if(b is None): continue
+
+            for key, larger in METRICS.items():
+                v0, v1 = b.get(key), res[name][nr].get(key)
+                if(v0 is None or v1 is None): continue
+
+                ncomp += 1
+                rel = (v1 - v0) / v0
+                if((larger and rel < -tol) or ((not larger) and rel > tol)):
+                    bad.append("{0} [{1} ranks] {2}: {3:.4g} -> {4:.4g} ({5:+.1f}%)".format(name, nr, key, v0, v1, rel*100))
+    return bad, ncomp
+
+#-----------------------------------------------------------------------------------------
+
+def getRanks(ranks):
+    ncpu = os.cpu_count() or 1
+    res = []
+    for ii in ranks.split(','):
+        nr = ncpu if(ii.strip().upper() == 'N') else int(ii)
+        if(nr not in res): res.append(nr)
+    return res
+
+#-----------------------------------------------------------------------------------------
+# MAIN PROGRAM
+#-----------------------------------------------------------------------------------------
+
+if __name__ == "__main__":
+
+    if(len(sys.argv) > 2 and sys.argv[1] == '--measure'):
+        sys.exit(measure(sys.argv[3:]))
+
+    parser = argparse.ArgumentParser(description='STiC performance benchmark')
+    parser.add_argument('--stic', default=os.path.join(BDIR, '..', 'src', 'STiC.x'))
+    parser.add_argument('--mpiexec', default='mpiexec')
+    parser.add_argument('--ranks', default='1,4,N')
+    parser.add_argument('--cases', default='all')
+    parser.add_argument('--rundir', default=os.path.join(BDIR, 'run'))
+    parser.add_argument('--baseline', default=os.path.join(BDIR, 'baseline.json'))
+    parser.add_argument('--output', default=os.path.join(BDIR, 'bench.json'))
+    parser.add_argument('--tol', type=float, default=0.10)
+    parser.add_argument('--update-baseline', action='store_true')
+    args = parser.parse_args()
+
+    if(not os.path.isfile(args.stic)):
+        sys.exit("bench: ERROR, cannot find STiC binary: "+args.stic)
+
+    names = list(CASES.keys()) if(args.cases == 'all') else args.cases.split(',')
+    ranks = getRanks(args.ranks)
+
+    # check the baseline before spending time on the runs
+    
+    base = None if(args.update_baseline) else loadBaseline(args.baseline, names)
+
+    out = {'host': socket.gethostname(), 'ncpu': os.cpu_count(), 'date': time.strftime('%Y-%m-%d %H:%M:%S'),
+           'stic': os.path.abspath(args.stic), 'cases': {}}
+
+    for name in names:
+        if(name not in CASES): sys.exit("bench: ERROR, unknown case: "+name)
+        case = CASES[name]
+        npix = case['nx'] * case['ny']
+        rundir = os.path.join(args.rundir, name)
+
+        print("bench: preparing [{0}]".format(name)); sys.stdout.flush()
+        prepareCase(name, rundir, args.stic, args.mpiexec, max(ranks))
+
+        out['cases'][name] = {}
+        for nr in ranks:
+            if(case['mode'] != 1): nr = max(nr, 2) # only mode 1 can run without slaves
+            if(str(nr) in out['cases'][name]): continue
+
+            wall, rss = runSTiC(args.stic, args.mpiexec, nr, rundir, 'run_{0}.log'.format(nr))
+
+            # time per synth: from the telemetry of the inversions, one synth per
+            # pixel in mode 2, not defined for the RFs.
+
+            tsyn = None
+            if(case['mode'] == 1):
+                tel = readTelemetry(os.path.join(rundir, 'bench_out.nc'))
+                if(tel is not None and tel[1] > 0): tsyn = tel[0] / tel[1]
+            elif(case['mode'] == 2):
+                tsyn = wall * max(nr-1, 1) / npix
+
+            res = {'ranks': nr, 'npix': npix, 'wall': wall, 'pix_per_s': npix / wall,
+                   't_synth': tsyn, 'maxrss_mb': rss}
+            out['cases'][name][str(nr)] = res
+
+            print("bench: {0:16s} ranks={1:3d} wall={2:9.3f} s  pix/s={3:9.4f}  t_synth={4}  maxrss={5:8.1f} MB".\
+                  format(name, nr, wall, res['pix_per_s'], 'n/a' if tsyn is None else '{0:.4g} s'.format(tsyn), rss))
+            sys.stdout.flush()
+
+    with open(args.output, 'w') as f: json.dump(out, f, indent=2, sort_keys=True)
+    print("bench: results written to "+args.output)
+
+    if(args.update_baseline):
+        with open(args.baseline, 'w') as f: json.dump(out, f, indent=2, sort_keys=True)
+        print("bench: baseline updated -> "+args.baseline)
+        sys.exit(0)
+
+    if(base.get('host') != out['host']):
+        print("bench: WARNING, the baseline was measured in a different machine [{0}]".format(base.get('host')))
+
+    bad, ncomp = compare(out['cases'], base.get('cases', {}), args.tol)
+    for ii in bad: print("bench: REGRESSION "+ii)
+    if(len(bad) > 0): sys.exit(1)
+    if(ncomp == 0):
+        sys.exit("bench: ERROR, none of the runs ({0} ranks) is in the baseline, nothing was compared".\
+                 format(','.join([str(nr) for nr in ranks])))
+    print("bench: no regressions with respect to the baseline (tol = {0:.0f}%)".format(args.tol*100))
@@ -0,0 +1,176 @@
+"""
+STiC regression checks
+
+Prepares small run directories from example/ and runs the check
+executables of src/checks (compiled with "make check" in src/). Each
+check compares two ways of computing the same quantity (e.g. double
+and single precision storage) on the example atmosphere (FAL-C) and
+returns a non-zero exit status if the difference is above its
+tolerance.
+
+Run directories (under --rundir):
+
+   ca : Ca II active (example/atoms.input), Ca II K, H-eps and 8542 regions
+   mg : Mg II active instead of Ca II, Mg II h&k regions
+   fe : LTE atmosphere, Fe I 6301/6302 (lines.cfg of cases/lte_fe6302)
+
+Usage:
+
+   python3 checks.py [--checks all] [--rundir run/checks] [--keep]
+
+The exit status is 1 if any check failed.
+
+Dependencies: none (python3 standard library).
+
+Modifications:
+                  2026-10-19: Created.
+
+"""
+import os
+import re
+import sys
+import shutil
+import argparse
+import subprocess
+
+BDIR = os.path.dirname(os.path.abspath(__file__))
+EXDIR = os.path.abspath(os.path.join(BDIR, '..', 'example'))
+CDIR = os.path.abspath(os.path.join(BDIR, '..', 'src', 'checks'))
+
+#-----------------------------------------------------------------------------------------
+# CHECK DEFINITIONS
+#-----------------------------------------------------------------------------------------
+
+# name: (executable in src/checks, run directory, arguments)
+
+CHECKS = [
+    ('profiles_ca', 'check_profiles.x', 'ca', []),
+    ('profiles_mg', 'check_profiles.x', 'mg', []),
+    ('eos',         'check_eos.x',      'ca', []),
+    ('lte_precision', 'check_lte.x',    'fe', []),
+    ('depth_grid',  'check_depth.x',    'ca', []),
+    ('chemeq_cache', 'check_chemeq.x',  'ca', []),
+    ('cop',         'check_cop.x',      'ca', []),
+    ('output_ray',  'check_ray.x',      'ca', []),
+]
+
+# Regions of each run directory (wavelength, step, npoints, continuum)
+
+REGIONS = {
+    'ca': [(3932.19227, 0.03913, 76, 2.443471e-05),
+           (3999.90646, 0.03913,  1, 2.443471e-05),
+           (8540.23102, 0.04267, 88, 4.227725e-05)],
+    'mg': [(2795.50000, 0.02000, 100, 1.0e-05),
+           (2802.70000, 0.02000, 100, 1.0e-05),
+           (2799.80000, 0.02000,   1, 1.0e-05)],
+    'fe': [(6301.24942, 0.01007,  46, 4.054384e-05),
+           (6302.12567, 0.01007,  49, 4.054384e-05)],
+}
+
+# Keywords of input.cfg changed (or added) in each run directory
+
+SETKEYS = {'fe': {'atmosphere_type': 'lte', 'lines': 'fe6301, fe6302'}}
+
+# Line list (lines.cfg) of the LTE run directories
+
+LINES = {'fe': os.path.join(BDIR, 'cases', 'lte_fe6302', 'lines.cfg')}
+
+# Active atom of each run directory, the others are set to PASSIVE/LTE
+
+ACTIVE = {'ca': 'CaII_bklm.atom', 'mg': 'MgII-11_bklm.atom'}
+
+SHARED = ['keyword.input', 'kurucz.input', 'molecules.input']
+LINKS = ['Atoms', 'Atmos', 'Molecules']
+
+#-----------------------------------------------------------------------------------------
+# SOME DEFINITIONS
+#-----------------------------------------------------------------------------------------
+
+def prepareDir(name, rundir):
+    """
+    Creates a run directory from example/: synthesis mode, no instrumental
+    profiles and the regions, keywords, lines and active atom of REGIONS,
+    SETKEYS, LINES and ACTIVE.
+    """
+    if(os.path.isdir(rundir)): shutil.rmtree(rundir)
+    os.makedirs(os.path.join(rundir, 'scratch'))
+
+    for f in SHARED: shutil.copy(os.path.join(EXDIR, f), rundir)
+    for f in LINKS: os.symlink(os.path.join(EXDIR, f), os.path.join(rundir, f))
+    if(name in LINES): shutil.copy(LINES[name], os.path.join(rundir, 'lines.cfg'))
+
+
+    # --- input.cfg ---
+
+    f = open(os.path.join(EXDIR, 'input.cfg'), 'r'); cfg = f.read().splitlines(); f.close()
+    keys = dict(SETKEYS.get(name, {}), mode='2')
+    out = []
+    for line in cfg:
+        if(line.strip().startswith('region')): continue
+        mm = re.match(r'^\s*(\w+)\s*=', line)
+        if(mm and mm.group(1) in keys): line = '{0} = {1}'.format(mm.group(1), keys.pop(mm.group(1)))
+        out.append(line)
+    for key in keys: out.append('{0} = {1}'.format(key, keys[key]))
+    for reg in REGIONS[name]:
+        out.append('region = {0:.5f}, {1:.5f}, {2:3d}, {3:e}, none, none'.format(*reg))
+
+    f = open(os.path.join(rundir, 'input.cfg'), 'w'); f.write('\n'.join(out)+'\n'); f.close()
+
+
+    # --- atoms.input ---
+
+    if(name not in ACTIVE): return
+
+    f = open(os.path.join(EXDIR, 'atoms.input'), 'r'); atoms = f.read().splitlines(); f.close()
+    out = []
+    for line in atoms:
+        ww = line.split()
+        if(len(ww) >= 3 and ww[0].startswith('Atoms/') and ww[1] in ('ACTIVE', 'PASSIVE')):
+            if(ww[0].endswith(ACTIVE[name])): ww[1], ww[2] = 'ACTIVE', 'ZERO_RADIATION'
+            else: ww[1], ww[2] = 'PASSIVE', 'LTE_POPULATIONS'
+            line = '  ' + '   '.join(ww)
+        out.append(line)
+
+    f = open(os.path.join(rundir, 'atoms.input'), 'w'); f.write('\n'.join(out)+'\n'); f.close()
+
+#-----------------------------------------------------------------------------------------
+# MAIN PROGRAM
+#-----------------------------------------------------------------------------------------
+
+if __name__ == "__main__":
+
+    parser = argparse.ArgumentParser(description='STiC regression checks')
+    parser.add_argument('--checks', default='all', help='comma-separated names or "all"')
+    parser.add_argument('--rundir', default=os.path.join(BDIR, 'run', 'checks'))
+    parser.add_argument('--keep', action='store_true', help='keep the run directories')
+    args = parser.parse_args()
+
+    todo = [cc for cc in CHECKS if(args.checks == 'all' or cc[0] in args.checks.split(','))]
+    if(len(todo) == 0):
+        sys.exit("checks: ERROR, no checks selected from: "+', '.join([cc[0] for cc in CHECKS]))
+
+    failed, prepared = [], []
+    for name, exe, dname, cargs in todo:
+        exe = os.path.join(CDIR, exe)
+        if(not os.path.isfile(exe)):
+            sys.exit("checks: ERROR, cannot find {0}, run make check in src/".format(exe))
+
+        rundir = os.path.join(args.rundir, dname)
+        if(dname not in prepared):
+            prepareDir(dname, rundir)
+            prepared.append(dname)
+
+        print("checks: running [{0}] in {1}".format(name, rundir)); sys.stdout.flush()
+        log = open(os.path.join(rundir, name+'.log'), 'w')
+        res = subprocess.run([exe] + cargs, cwd=rundir, stdout=subprocess.PIPE, stderr=log)
+        log.close()
+
+        sys.stdout.write(res.stdout.decode()); sys.stdout.flush()
+        if(res.returncode != 0): failed.append(name)
+
+    if(not args.keep): shutil.rmtree(args.rundir, ignore_errors=True)
+
+    if(len(failed) > 0):
+        print("checks: FAILED: "+', '.join(failed))
+        sys.exit(1)
+    print("checks: all {0} checks passed".format(len(todo)))
@@ -0,0 +1,114 @@
+"""
+STiC master scaling benchmark
+
+Runs a mode 2 synthesis of a large synthetic map (the lte_fe6302 case of
+bench.py) with many MPI ranks, with a flat master-slave layout and with
+the two-level layout of master_groups, and reports the wall time, pixels
+per second and the fraction of time that rank 0 was busy sending and
+receiving packages (the "master busy" line printed by slaveTimeSteps).
+
+A master that is busy close to 100% of the time is the bottleneck of the
+run: adding ranks does not make it faster. With master_groups, rank 0
+only talks to the sub-masters and its busy fraction should stay low.
+
+Usage:
+
+   python3 scaling.py [--stic ../src/STiC.x] [--mpiexec mpiexec]
+                      [--ranks 1024,4096,16384] [--groups 0,node,16]
+                      [--nx 256] [--ny 256] [--mpi_pack 1] [--output scaling.json]
+
+"0" in --groups is the flat layout, "node" uses one group per node and
+an integer is a fixed number of groups (master_groups in input.cfg).
+The default ranks need a cluster, use e.g. --ranks 8,16 --nx 32 --ny 32
+to try it in a workstation.
+
+Dependencies: numpy and netCDF4 (through bench.py).
+
+Modifications:
+                  2026-10-19: Created.
+
+"""
+import os
+import sys
+import json
+import time
+import socket
+import argparse
+import bench
+
+#-----------------------------------------------------------------------------------------
+
+def readBusy(filename):
+    """
+    Returns the master busy time and wall time of all the time steps in a
+    STiC log, or (None, None) if the log does not contain them.
+    """
+    busy, total = None, None
+    with open(filename, 'r') as f:
+        for line in f:
+            if('master busy' not in line): continue
+            ww = line.replace('(', ' ').split()
+            ii = ww.index('busy')
+            busy = (busy or 0.0) + float(ww[ii+1])
+            total = (total or 0.0) + float(ww[ii+4])
+    return busy, total
+
+#-----------------------------------------------------------------------------------------
+# MAIN PROGRAM
+#-----------------------------------------------------------------------------------------
+
+if __name__ == "__main__":
+
+    parser = argparse.ArgumentParser(description='STiC master scaling benchmark')
+    parser.add_argument('--stic', default=os.path.join(bench.BDIR, '..', 'src', 'STiC.x'))
+    parser.add_argument('--mpiexec', default='mpiexec')
+    parser.add_argument('--ranks', default='1024,4096,16384')
+    parser.add_argument('--groups', default='0,node,16')
+    parser.add_argument('--nx', type=int, default=256)
+    parser.add_argument('--ny', type=int, default=256)
+    parser.add_argument('--mpi_pack', type=int, default=1)
+    parser.add_argument('--rundir', default=os.path.join(bench.BDIR, 'run'))
+    parser.add_argument('--output', default=os.path.join(bench.BDIR, 'scaling.json'))
+    args = parser.parse_args()
+
+    if(not os.path.isfile(args.stic)):
+        sys.exit("scaling: ERROR, cannot find STiC binary: "+args.stic)
+
+    name = 'lte_fe6302'
+    bench.CASES[name] = {'nx': args.nx, 'ny': args.ny, 'mode': 2, 'bfield': True}
+    npix = args.nx * args.ny
+    rundir = os.path.join(args.rundir, 'scaling')
+
+    print("scaling: preparing [{0}], {1}x{2} pixels".format(name, args.nx, args.ny)); sys.stdout.flush()
+    bench.prepareCase(name, rundir, args.stic, args.mpiexec, 2)
+
+    f = open(os.path.join(rundir, 'input.cfg'), 'r'); cfg = f.read(); f.close()
+    cfg = cfg.replace('mpi_pack = 1', 'mpi_pack = {0}'.format(args.mpi_pack))
+
+    out = {'host': socket.gethostname(), 'date': time.strftime('%Y-%m-%d %H:%M:%S'),
+           'stic': os.path.abspath(args.stic), 'npix': npix, 'runs': {}}
+
+    for nr in bench.getRanks(args.ranks):
+        out['runs'][str(nr)] = {}
+        for grp in args.groups.split(','):
+            grp = grp.strip()
+
+            f = open(os.path.join(rundir, 'input.cfg'), 'w')
+            f.write(cfg + '\nmaster_groups = {0}\n'.format(grp)); f.close()
+
+            log = 'scaling_{0}_{1}.log'.format(nr, grp)
+            wall, rss = bench.runSTiC(args.stic, args.mpiexec, max(nr, 2), rundir, log)
+            busy, total = readBusy(os.path.join(rundir, log))
+
+            res = {'ranks': nr, 'master_groups': grp, 'wall': wall, 'pix_per_s': npix / wall,
+                   'master_busy': busy, 'master_total': total,
+                   'busy_frac': None if(busy is None or total <= 0) else busy / total}
+            out['runs'][str(nr)][grp] = res
+
+            print("scaling: ranks={0:6d} groups={1:5s} wall={2:9.3f} s  pix/s={3:10.3f}  master busy={4}".\
+                  format(nr, grp, wall, res['pix_per_s'],
+                         'n/a' if res['busy_frac'] is None else '{0:.1f}%'.format(res['busy_frac']*100)))
+            sys.stdout.flush()
+
+    with open(args.output, 'w') as f: json.dump(out, f, indent=2, sort_keys=True)
+    print("scaling: results written to "+args.output)
@@ -22,12 +22,16 @@
 #include "eoswrap.h"
 #include "ceos.h"
 #include "witt.h"
+#include "piskunov.h"
 #include "input.h"
 #include "physical_consts.h"
 #include "interpol.h"
 #include "clm.h"
 #include "math_tools.h"
 #include "mmem.h"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 //
 using namespace std;
 //
@@ -36,10 +40,15 @@ const double atmos::maxchange[9] = {7000., 7.0e5, 5.0e5, 600., 600., phyc::PI/5,
 inline double SQ(const double a){return a*a;};
 inline double CUB(const double a){return a*a*a;};
 
-atmos::atmos(iput_t &inpt, double grav): eos(NULL), inst(NULL)
+atmos::atmos(iput_t &inpt, double grav): inst(NULL), eos(NULL), grav(grav), lm(NULL)
 {
-  if(inpt.eos_type == 0) eos = new ceos(inpt.lines, inpt.abfile, grav);
-  else                   eos = new eos::witt(inpt.lines, inpt.abfile, grav);
+  if(inpt.eos_type == 0)      eos = new ceos(inpt.lines, inpt.abfile, grav);
+  else if(inpt.eos_type == 1) eos = new eos::witt(inpt.lines, inpt.abfile, grav);
+  else if(inpt.eos_type == 2) eos = new eos::piskunov(inpt.lines, inpt.abfile, grav);
+  else{
+    fprintf(stderr,"atmos::atmos: ERROR, wrong value of keyword [eos_type]: %d, use 0 (fortran), 1 (wittmann) or 2 (piskunov)\n", inpt.eos_type);
+    exit(1);
+  }
   
 }
 
@@ -73,6 +82,25 @@ vector<double> atmos::get_max_change(nodes_t &n, int mode){
 
 
 
+/* --- Hydrostatic eq. from inside responseFunction. The fortran EOS keeps
+   its state in COMMON blocks, so only one thread at the time can use it --- */
+
+static void pressureScale(mdepth_t &m, iput_t &input, eoswrap &eos, pixstat_t &st){
+  
+  if(eos.thread_safe){
+    double t0 = pixstat::getTime();
+    m.getPressureScale(input.nodes.depth_t, input.boundary, eos);
+    st[ps_t_eos] += pixstat::getTime(t0);
+  }else{
+#pragma omp critical(eos_call)
+    {
+      double t0 = pixstat::getTime();
+      m.getPressureScale(input.nodes.depth_t, input.boundary, eos);
+      st[ps_t_eos] += pixstat::getTime(t0);
+    }
+  }
+}
+
 void atmos::responseFunction(int npar, mdepth_t &m_in, double *pars, int nd, double *out, int pp, double *syn){
   
   if(npar != input.nodes.nnodes){
@@ -149,10 +177,11 @@ void atmos::responseFunction(int npar, mdepth_t &m_in, double *pars, int nd, dou
       recompute = (recompute || (input.nodes.ntype[pp] == tr_node_amp));
       recompute = (recompute || (input.nodes.ntype[pp] == tr_node_loc));
       if(recompute && (input.thydro == 1))
-	m.getPressureScale(input.nodes.depth_t, input.boundary, *eos);
+	pressureScale(m, input, *eos, stats);
 	//m.nne_enhance(input.nodes, npar, &ipars[0], eos);
 
 	synth(m, &out[0], 1, (cprof_solver)input.solver, store_pops);
+	stats[ps_nsynth] += 1;
     }
 
     
@@ -171,10 +200,11 @@ void atmos::responseFunction(int npar, mdepth_t &m_in, double *pars, int nd, dou
     recompute = (recompute || (input.nodes.ntype[pp] == tr_node_amp));
     recompute = (recompute || (input.nodes.ntype[pp] == tr_node_loc));
     if(recompute && (input.thydro == 1))
-      m.getPressureScale(input.nodes.depth_t, input.boundary, *eos);
+      pressureScale(m, input, *eos, stats);
     //m.nne_enhance(input.nodes, npar, &ipars[0], eos);
 
       synth(m, &spec[0], 1, (cprof_solver)input.solver, store_pops);
+      stats[ps_nsynth] += 1;
     }
 
     /* --- Compute finite difference --- */
@@ -223,10 +253,11 @@ void atmos::responseFunction(int npar, mdepth_t &m_in, double *pars, int nd, dou
     recompute = (recompute || (input.nodes.ntype[pp] == tr_node_loc));
 
     if(recompute &&  (input.thydro == 1))
-      m.getPressureScale(input.nodes.depth_t, input.boundary, *eos);
+      pressureScale(m, input, *eos, stats);
     //m.nne_enhance(input.nodes, npar, &ipars[0], eos);
       
     synth(m, &out[0], 1, (cprof_solver)input.solver, store_pops);
+    stats[ps_nsynth] += 1;
     
     /* --- Finite differences ---*/
     
@@ -241,6 +272,63 @@ void atmos::responseFunction(int npar, mdepth_t &m_in, double *pars, int nd, dou
     
 }
 
+void atmos::responseFunctions(int npar, mdepth_t &m, double *pars, int nd, double **out, double *syn){
+
+  
+  /* --- Create the workers the first time, if this atmosphere supports it --- */
+
+  int nt = std::min<int>(input.rf_threads, npar);
+  if((nt > 1) && ((int)workers.size() < nt)){
+    for(int ii = (int)workers.size(); ii < nt; ii++){
+      atmos *tmp = newWorker();
+      if(!tmp) break;
+      workers.push_back(tmp);
+    }
+  }
+  nt = std::min<int>(nt, (int)workers.size());
+
+  
+  /* --- Serial version, the same height scale and EOS buffer can be 
+     used for all parameters if we start from the last one --- */
+  
+  if(nt <= 1){
+    for(int pp = npar-1; pp >= 0; pp--)
+      if(out[pp]) responseFunction(npar, m, pars, nd, out[pp], pp, syn);
+    return;
+  }
+
+  
+  /* --- Each worker starts from the partial pressures of the unperturbed model 
+     and computes its own perturbations. Temperature nodes (first) are
+     the most expensive ones, so they are dispatched first --- */
+  
+  int pp = 0, tid = 0;
+#pragma omp parallel default(shared) private(pp, tid) num_threads(nt)
+  {
+#ifdef _OPENMP
+    tid = omp_get_thread_num();
+#endif
+    atmos &wrk = *workers[tid];
+    wrk.scal = scal, wrk.mmin = mmin, wrk.mmax = mmax;
+    wrk.input.nodes = input.nodes;
+    
+#pragma omp for schedule(dynamic,1)
+    for(pp = 0; pp < npar; pp++){
+      if(!out[pp]) continue;
+      wrk.eos->copy_partial_pressures(*eos);
+      wrk.responseFunction(npar, m, pars, nd, out[pp], pp, syn);
+    }
+  }
+
+  
+  /* --- Add the counters of the workers to this pixel --- */
+  
+  for(int ii = 0; ii < nt; ii++){
+    stats += workers[ii]->stats;
+    workers[ii]->stats.reset();
+  }
+}
+
 void atmos::randomizeParameters(const nodes_t &n, int npar, double *pars, const int rvel){
 
   static const double vtau[4] = {-7.0, -5.0, -3.0, 1.0};
@@ -868,7 +956,8 @@ int getChi2(int npar1, int nd, double *pars1, double *syn_in, double *dev, doubl
   /* --- Cast tmp1 into a double --- */
   
   atmos &atm = *((atmos*)tmp1); 
-  double *ipars = new double [npar1]();
+  if((int)atm.wpars.size() < npar1) atm.wpars.resize(npar1);
+  double *ipars = &atm.wpars[0];
   mdepth &m = *atm.imodel;
 
   int neff = 0;
@@ -888,8 +977,9 @@ int getChi2(int npar1, int nd, double *pars1, double *syn_in, double *dev, doubl
     mdepth &m1 = *atm.imodel->ref_m;
     m1.expand(atm.input.nodes, &ipars[0], atm.input.dint, atm.input.depth_model);
     atm.checkBounds(m1);
+    double t0 = pixstat::getTime();
     m1.getPressureScale(atm.input.nodes.depth_t, atm.input.boundary, *atm.eos);
-    delete [] ipars;
+    atm.stats[ps_t_eos] += pixstat::getTime(t0);
     
     return 0;
   }
@@ -899,7 +989,9 @@ int getChi2(int npar1, int nd, double *pars1, double *syn_in, double *dev, doubl
   
   m.expand(atm.input.nodes, &ipars[0], atm.input.dint, atm.input.depth_model);
   atm.checkBounds(m);
+  double t0 = pixstat::getTime();
   m.getPressureScale(atm.input.nodes.depth_t, atm.input.boundary, *atm.eos);
+  atm.stats[ps_t_eos] += pixstat::getTime(t0);
   
   
   
@@ -908,6 +1000,7 @@ int getChi2(int npar1, int nd, double *pars1, double *syn_in, double *dev, doubl
   memset(&atm.isyn[0], 0, nd*sizeof(double));
   //  for(int ii=0; ii<m.ndep;ii++) fprintf(stderr,"%e %e %e %e %e\n", m.cmass[ii], m.temp[ii], m.v[ii], m.vturb[ii], m.pgas[ii]);
   bool conv = atm.synth( m , &atm.isyn[0], 0, (cprof_solver)atm.input.solver, true);  
+  atm.stats[ps_nsynth] += 1;
   
   
   if(!conv){
@@ -919,16 +1012,17 @@ int getChi2(int npar1, int nd, double *pars1, double *syn_in, double *dev, doubl
   
   if(derivs){
     
+    /* --- Compute response functions, threaded for LTE if rf_threads > 1 ---*/
+
+    for(int pp = 0; pp<npar1; pp++)
+      if(derivs[pp]) memset(&derivs[pp][0], 0, nd*sizeof(double));
+    
+    atm.responseFunctions(npar1, m, &ipars[0], nd, derivs, &atm.isyn[0]);
+
+    
     for(int pp = npar1-1; pp >= 0; pp--){
       
       if(derivs[pp]){
-	//atm.cleanup();
-	/* --- Compute response function ---*/
-	
-	memset(&derivs[pp][0], 0, nd*sizeof(double));
-	atm.responseFunction(npar1, m, &ipars[0], nd,
-			      &derivs[pp][0], pp, &atm.isyn[0]);
-
 	
 	/* --- Degrade response function --- */
 	
@@ -981,10 +1075,6 @@ int getChi2(int npar1, int nd, double *pars1, double *syn_in, double *dev, doubl
     }
   }
   
-  /* --- clean up --- */
-  
-  delete [] ipars;
-
   return 0;
 }
 
@@ -1054,6 +1144,7 @@ reg_t init_dregul(int npar, nodes_t &n, double scl, double scl1, int ntrans)
 
 double atmos::fitModel2(mdepth_t &m, int npar, double *pars, int nobs, double *o, mat<double> &weights){
 
+  double tpix = pixstat::getTime();
 
     
   /* --- compute tau scale ---*/
@@ -1061,8 +1152,11 @@ double atmos::fitModel2(mdepth_t &m, int npar, double *pars, int nobs, double *o
   for(int k = 0; k < (int)m.ndep; k++) m.tau[k] = pow(10.0, m.ltau[k]);
   
   
-  /* --- point to obs and weights --- */
-  mdepth_t m1 = m, m2 = m, best_m = m;
+  /* --- point to obs and weights. The copies of the model are workspaces 
+     of this object, they are only reallocated if ndep changes --- */
+  
+  mdepth_t &m1 = fit_m1, &m2 = fit_m2, &best_m = fit_best;
+  m1 = m, m2 = m, best_m = m;
   bool depth_per = ((this->input.depth_model > 0) ? true : false);
 
   obs = &o[0];
@@ -1078,10 +1172,17 @@ double atmos::fitModel2(mdepth_t &m, int npar, double *pars, int nobs, double *o
   }else          imodel->ref_m = NULL;
 
 
-  /* --- get regularization --- */
-  reg_t regul;
-  if(input.nodes.regularize[0] >= 1.e-8)
-    regul = init_dregul(npar, input.nodes, input.nodes.regularize[0], input.nodes.regularize[1], input.nodes.nregul);
+  /* --- get regularization, the dimensions are the same for all pixels so the 
+     terms are only allocated once and zeroed for the next pixels --- */
+  
+  if(input.nodes.regularize[0] >= 1.e-8){
+    if(regul.npar != npar)
+      regul = init_dregul(npar, input.nodes, input.nodes.regularize[0], input.nodes.regularize[1], input.nodes.nregul);
+    else{
+      regul.zero();
+      regul.scl = regul.regularize[0];
+    }
+  }
 
   
   /* --- Invert pixel randomizing parameters if iter > 0 --- */
@@ -1089,13 +1190,19 @@ double atmos::fitModel2(mdepth_t &m, int npar, double *pars, int nobs, double *o
   int ndata = input.nw_tot * input.ns;
   double ipars[npar], bestPars[npar], ichi, bestChi = 1.e10;
   isyn.resize(ndata);
-  vector<double> bestSyn;
+  vector<double> &bestSyn = fit_syn;
   bestSyn.resize(ndata);
 
   
-  /* --- Init clm --- */
+  /* --- Init clm, only created again if the dimensions change --- */
 
-  clm lm = clm(ndata, npar);
+  if(lm && ((lm->getNd() != ndata) || (lm->getNpar() != npar))){
+    delete lm;
+    lm = NULL;
+  }
+  if(!lm) this->lm = new clm(ndata, npar);
+  clm &lm = *this->lm;
+  
   lm.xtol = 1.e-2;
   lm.verb = input.verbose;
   lm.use_geo_accel = input.use_geo_accel;
@@ -1110,6 +1217,17 @@ double atmos::fitModel2(mdepth_t &m, int npar, double *pars, int nobs, double *o
   lm.lfac = sqrt(10.);
   lm.proc = input.myrank;
   lm.delay_bracket = input.delay_bracket;
+  lm.broyden_n = input.broyden;
+  lm.broyden_thres = input.broyden_thres;
+  lm.svd_scaled = input.svd_scaled;
+
+  
+  /* --- Watchdog: wall-clock budget of this pixel, the fit is stopped
+     with the best model so far (pixel_timeout, 0 = no limit) --- */
+  
+  double const deadline = ((input.pixel_timeout > 0.0) ? tpix + input.pixel_timeout : 0.0);
+  lm.deadline = deadline;
+  setDeadline(deadline);
   
   if(input.nodes.regularize[0] >= 1.e-5){
     lm.regularize = true;
@@ -1158,7 +1276,9 @@ double atmos::fitModel2(mdepth_t &m, int npar, double *pars, int nobs, double *o
 
   
   /* --- Loop iters --- */
-  int do_vel_grad = -1;
+  int do_vel_grad = -1, njac = 0, nbroyden = 0;
+  resetStats();
+  stats.reset();
   
   for(int iter = 0; iter < input.nInv; iter++){
 
@@ -1194,6 +1314,10 @@ double atmos::fitModel2(mdepth_t &m, int npar, double *pars, int nobs, double *o
     /* --- Call clm --- */
 
     double chi2 = lm.fitdata(getChi2, &ipars[0], (void*)this, input.max_inv_iter, regul);
+    njac += lm.njac, nbroyden += lm.nbroyden;
+    stats[ps_ninv] += 1;
+    stats[ps_lm_iter] += lm.niter;
+    stats[ps_lm_reject] += lm.nreject;
 
     
     
@@ -1218,12 +1342,19 @@ double atmos::fitModel2(mdepth_t &m, int npar, double *pars, int nobs, double *o
       memcpy(&m1.cub.d[0], &m2.cub.d[0], m.ndep*12*sizeof(double));
     }
     
-    /* --- reached thresthold? ---*/
+    /* --- reached thresthold or out of time? ---*/
     
     if(bestChi <= input.chi2_thres) break;
+
+    if(lm.timedout || ((deadline > 0.0) && (pixstat::getTime() > deadline))){
+      stats[ps_timeout] = 1;
+      break;
+    }
     
   } // iter
 
+  setDeadline(0.0);
+
   
   double sum = 0.0;
   for(int ww = 0; ww<ndata;ww++){
@@ -1237,6 +1368,21 @@ double atmos::fitModel2(mdepth_t &m, int npar, double *pars, int nobs, double *o
   }
   
   //fprintf(stderr,"Recomp chi2=%13.5f\n", sum/ndata);
+  addSolverStats(stats);
+  if(input.verbose) printStats(input.myrank);
+
+  
+  /* --- Syntheses saved by the Broyden updates: each one replaces the response 
+     functions (1 or 2 syntheses per node) with a single synthesis --- */
+  
+  if(input.verbose && (input.broyden > 0)){
+    int nsyn_rf = 0;
+    for(int pp = 0; pp<npar; pp++)
+      nsyn_rf += (((input.nodes.ntype[pp] == azi_node) || (input.centder > 0)) ? 2 : 1);
+    
+    fprintf(stderr,"[p:%4d] broyden: jacobians=%d, updates=%d, syntheses saved=%d\n",
+	    input.myrank, njac, nbroyden, nbroyden * (nsyn_rf - 1));
+  }
   memcpy(&obs[0], &bestSyn[0], ndata*sizeof(double));
   memcpy(&m.cub.d[0], &best_m.cub.d[0], m.ndep*12*sizeof(double));
   if(input.fit_tr){
@@ -1246,9 +1392,8 @@ double atmos::fitModel2(mdepth_t &m, int npar, double *pars, int nobs, double *o
   
   /* --- Clean-up --- */
   
-  isyn.clear();
-  bestSyn.clear();
-
+  stats[ps_wall] = pixstat::getTime(tpix);
+  
   return bestChi;
 }
 
@@ -27,12 +27,26 @@ class atmos{
   double *w;
   mdepth_t *imodel;
   eoswrap *eos;
+  double grav;
+  std::vector<atmos*> workers; // private copies used to compute RFs in parallel
+  pixstat_t stats;             // telemetry of the last inverted pixel
+
+  /* --- Workspaces of fitModel2/getChi2, reused from pixel to pixel --- */
+
+  clm *lm;
+  reg_t regul;
+  mdepth_t fit_m1, fit_m2, fit_best;
+  std::vector<double> fit_syn, wpars;
   
-  atmos(){};
+  atmos(): lm(NULL){};
   //atmos(iput_t &inpt, double grav = 4.44): eos(inpt.lines, inpt.abfile, grav), inst(NULL){};
   atmos(iput_t &inpt, double grav = 4.44);
 
-  ~atmos(){if(eos) delete eos;}
+  virtual ~atmos(){
+    for(auto &it: workers) delete it;
+    if(eos) delete eos;
+    if(lm) delete lm;
+  }
   //virtual ~atmos(){};
   // virtual void init(iput_t &input) = 0;
   virtual bool synth(mdepth_t &m, double *out, int computing_derivatives = 0, cprof_solver sol = bez_ltau, bool store_pops = true) = 0;
@@ -45,6 +59,12 @@ class atmos{
   virtual std::vector<double> get_scaling(nodes_t &n, int mode = 1){return scal;};
   virtual void responseFunction(int npar, mdepth_t &m, double *pars, int nd, double *out, int pp, double *syn);
   virtual void responseFunctionFull(mdepth_t m, int nd, double *out, double *syn, int pp);
+  void responseFunctions(int npar, mdepth_t &m, double *pars, int nd, double **out, double *syn);
+
+  /* --- Independent copy of this object for the threaded RFs, NULL if the
+     solver cannot run concurrently (e.g., RH keeps global state) --- */
+  
+  virtual atmos *newWorker(){return NULL;};
 
   
   //virtual void getArea(int npar, double *pars, int ndep, double *ltau, nodes_t &no, int pp);
@@ -63,6 +83,17 @@ class atmos{
   }
   void spectralDegrade(int ns, int npix, int ndata, double *obs);
   virtual std::vector<double> get_max_change(nodes_t &n, int mode=1);
+
+  /* --- Per-pixel solver statistics, overloaded by the NLTE solver --- */
+  
+  virtual void resetStats(){};
+  virtual void printStats(int proc){};
+  virtual void addSolverStats(pixstat_t &st){};
+
+  /* --- Wall-clock time [s] at which the solver gives up (0 = never), 
+     only the NLTE solver has iterations to stop --- */
+
+  virtual void setDeadline(double t){};
 };
 //
 int getChi2(int nd, int npar1, double *pars1, double *syn_in, double *dev, double **derivs,
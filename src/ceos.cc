@@ -388,7 +388,7 @@ void ceos::unique(void){
   }
 }
 
-void ceos::store_partial_pressures(int ndep, int k, float na, float ne){
+void ceos::store_partial_pressures(int ndep, int k, double na, double ne){
 
   int nuspec = (int)uspec.size();
   
@@ -410,7 +410,7 @@ void ceos::store_partial_pressures(int ndep, int k, float na, float ne){
   buf(k,nuspec,1) = ne;
 }
 
-void ceos::read_partial_pressures(int k, std::vector<float> &frac, std::vector<float> &part, float &xa, float &xe){
+void ceos::read_partial_pressures(int k, std::vector<double> &frac, std::vector<double> &part, double &xa, double &xe){
 
   int ndep = (int)buf.size(0);
   
@@ -538,8 +538,8 @@ float ceos::nne_from_T_rho_old(float T, float &iPg, float rho, float tol){
 }
 
 void ceos::contOpacity(double T, int nw, double *w,
-		       double *opac, double *scattering, std::vector<float> &frac,
-		       float na, float ne){
+		       double *opac, double *scattering, std::vector<double> &frac,
+		       double na, double ne){
 
   
   double TKEV = 8.6171E-5*T;
@@ -85,7 +85,7 @@ class ceos: public eoswrap{
   std::vector<char> totallist;
   int ntotallist;
 
-  mat<float> buf;
+  mat<double> buf;
   
   // Functions
   
@@ -130,7 +130,7 @@ class ceos: public eoswrap{
 			  double *scattering, double Pe=-1.0);
 
   void contOpacity        (double T, int nw, double *w,
-			   double *opac, double *scattering, std::vector<float> &frac, float na, float ne);
+			   double *opac, double *scattering, std::vector<double> &frac, double na, double ne);
 
   void  hydrostatic      (int ndep, double *tau, double *t, double *Pg, double *rho,
 			  double *nel, double *pel,  double pgas_bound, float tol = 1.0e-5);
@@ -145,8 +145,9 @@ class ceos: public eoswrap{
 			  float *nel, float *pel, float pgas_bound, float tol = 1.0e-5);
 
   
-  void store_partial_pressures(int ndep, int k, float na, float ne);
-  void read_partial_pressures(int k, std::vector<float> &frac, std::vector<float> &part, float &xa, float &xe);
+  void store_partial_pressures(int ndep, int k, double na, double ne);
+  void read_partial_pressures(int k, std::vector<double> &frac, std::vector<double> &part, double &xa, double &xe);
+  void copy_partial_pressures(const eoswrap &in){buf = dynamic_cast<const ceos&>(in).buf;};
   void unique(void);
   void fill_densities(int ndep, double *t, double *pgas, double *rho, double *pel,
 		      double *nne, int touse, int keep_nne = 0, float tol = 1.0e-5);
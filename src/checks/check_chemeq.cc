@@ -0,0 +1,136 @@
+/* ---
+   Regression check of the chemical equilibrium cache of RH (keywords
+   CHEMEQ_CACHE and CHEMEQ_CACHE_TOL, see rh/chemequil.c).
+
+   Synthesizes FAL-C once to fill the cache, then a model with the gas
+   pressure (and so nHtot) increased by dp, with CHEMEQ_CACHE_TOL above
+   dp, so the cached solutions are taken over (scaled to the new nHtot).
+   The atomic, molecular and H- densities and the emergent Stokes I must
+   agree with the same model solved without the cache within the
+   tolerances. Without the scaling the densities are off by dp (atoms)
+   and 2 dp (diatomic molecules).
+
+   Usage (from a run directory prepared by bench/checks.py):
+
+      check_chemeq.x [tol_dens tol_I dp]
+
+   Modifications:
+           2026-10-19: Created.
+   --- */
+
+#include <cmath>
+#include <vector>
+#include <string>
+#include "input.h"
+#include "depthmodel.h"
+#include "crh.h"
+#include "checks.h"
+
+extern "C" {
+#include "rh/rh.h"
+#include "rh/atom.h"
+#include "rh/atmos.h"
+#include "rh/inputs.h"
+
+  extern Atmosphere atmos;
+  extern InputData input;
+}
+
+using namespace std;
+
+/* --- Total densities of the atoms not bound in molecules --- */
+
+static vector<double> getAtoms()
+{
+  vector<double> n;
+  for(int ii=0; ii<atmos.Natom; ii++)
+    if(atmos.atoms[ii].ntotal) n.insert(n.end(), atmos.atoms[ii].ntotal, atmos.atoms[ii].ntotal + atmos.Nspace);
+  return n;
+}
+
+/* --- Molecular densities followed by nH- at each depth point --- */
+
+static vector<double> getDens()
+{
+  vector<double> n;
+  for(int ii=0; ii<atmos.Nmolecule; ii++)
+    n.insert(n.end(), atmos.molecules[ii].n, atmos.molecules[ii].n + atmos.Nspace);
+  n.insert(n.end(), atmos.nHmin, atmos.nHmin + atmos.Nspace);
+  return n;
+}
+
+
+int main(int argc, char *argv[])
+{
+  double tol[2] = {2.e-3, 1.e-4};
+  for(int ii=0; ii<2; ii++) if(argc > ii+1) tol[ii] = atof(argv[ii+1]);
+  double dp = ((argc > 3) ? atof(argv[3]) : 5.e-3);
+
+  mdepth m;
+  double grav = checks::readFALC("Atmos/FALC_82.atmos", m);
+
+  iput_t iput = read_input("input.cfg", false);
+  iput.myrank = 0, iput.verbose = 0, iput.nlte_depth_tol = 0.0;
+
+  crh atm(iput, grav);
+  m.getPressureScale(1, 0, *atm.eos);
+
+  int nw = atm.nlambda;
+  vector<double> syn_c(nw*4), syn_r(nw*4);
+
+
+  /* --- Fill the cache. keyword.input is only parsed in the first call --- */
+
+  mdepth m0(m);
+  bool conv = atm.synth(m0, &syn_c[0], 0, bez_ltau, false);
+
+  mdepth mp(m);
+  for(int kk=0; kk<m.ndep; kk++) mp.pgas[kk] *= 1.0 + dp;
+
+
+  /* --- Perturbed model from the cache --- */
+
+  input.chemeq_cache = TRUE;
+  input.chemeq_cache_tol = 2.0 * dp;
+
+  chemstat cs;
+  getChemEquilStats(&cs, TRUE);
+
+  mdepth m1(mp);
+  conv &= atm.synth(m1, &syn_c[0], 0, bez_ltau, false);
+  vector<double> n_c = getDens(), a_c = getAtoms();
+  getChemEquilStats(&cs, TRUE);
+
+
+  /* --- Perturbed model solved again --- */
+
+  input.chemeq_cache = FALSE;
+
+  mdepth m2(mp);
+  conv &= atm.synth(m2, &syn_r[0], 0, bez_ltau, false);
+  vector<double> n_r = getDens(), a_r = getAtoms();
+
+  fprintf(stdout, "check_chemeq: %d molecules, %ld of %ld points taken from the cache\n",
+	  atmos.Nmolecule, cs.Nskip, cs.Npoint);
+
+  if(!conv || cs.Nskip == 0 || n_c.size() != n_r.size() || a_c.size() != a_r.size()){
+    fprintf(stdout, "check_chemeq: FAILED, converged=%d, cached points=%ld\n", (int)conv, cs.Nskip);
+    return 1;
+  }
+
+
+  /* --- Compare --- */
+
+  vector<double> I_c(nw), I_r(nw);
+  for(int ww=0; ww<nw; ww++) I_c[ww] = syn_c[ww*4], I_r[ww] = syn_r[ww*4];
+
+  int nfail = 0;
+  nfail += checks::report("atoms, cached vs solved",
+			  checks::maxrel((int)a_r.size(), &a_r[0], &a_c[0], true), tol[0]);
+  nfail += checks::report("molecules and H-, cached vs solved",
+			  checks::maxrel((int)n_r.size(), &n_r[0], &n_c[0], true), tol[0]);
+  nfail += checks::report("Stokes I, cached vs solved chemical equilibrium",
+			  checks::maxrel(nw, &I_r[0], &I_c[0]), tol[1]);
+
+  return nfail;
+}
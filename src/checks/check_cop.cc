@@ -0,0 +1,111 @@
+/* ---
+   Regression check of the tabulated background opacities (cop) against
+   the original per-wavelength evaluation (cop_direct).
+
+   The partial pressures of ceos at each depth point of FAL-C (up to
+   20 kK) are used on two wavelength grids, 1000-20000 A (across the
+   ionization edges) and the 3930-8545 A grid of the micro-benchmark.
+   The grids alternate, so the table of cop is rebuilt between calls.
+   The opacity and the scattering must agree within the tolerance,
+   relative at each wavelength.
+
+   Usage (from a run directory prepared by bench/checks.py):
+
+      check_cop.x [tol]
+
+   Modifications:
+           2026-10-19: Created.
+   --- */
+
+#include <cmath>
+#include <vector>
+#include <string>
+#include "depthmodel.h"
+#include "ceos.h"
+#include "cop.h"
+#include "checks.h"
+
+using namespace std;
+
+typedef void (*cop_fn)(double, double, double, double, double, double, double, double *, double *,
+		       double *, double, double, double, double, double, double, double, double,
+		       double, double, double, double, double, double, double, double, double, int, int, int);
+
+
+/* --- Same call as ceos::contOpacity, with the opacity routine as an argument --- */
+
+static void call_cop(cop_fn fn, ceos &eos, double T, int nw, double *w, double *opac, double *scat,
+		     vector<double> &frac, double na, double ne)
+{
+  double TKEV = 8.6171E-5*T;
+  double TK   = 1.38065E-16*T;
+  double HTK  = 6.6256E-27/TK;
+
+  fn(T, TKEV, TK, HTK, log(T), na, ne, w, opac, scat,
+     frac[eos.IXH1-1], frac[eos.IXH2-1], frac[eos.IXHMIN-1], frac[eos.IXHE1-1],
+     frac[eos.IXHE2-1], frac[eos.IXHE3-1], frac[eos.IXC1-1], frac[eos.IXAL1-1],
+     frac[eos.IXSI1-1], frac[eos.IXSI2-1], frac[eos.IXCA1-1], frac[eos.IXCA2-1],
+     frac[eos.IXMG1-1], frac[eos.IXMG2-1], frac[eos.IXFE1-1], frac[eos.IXN1-1],
+     frac[eos.IXO1-1], nw, (int)eos.idxspec.size(), eos.ntotallist);
+}
+
+
+int main(int argc, char *argv[])
+{
+  double tol = ((argc > 1) ? atof(argv[1]) : 1.e-10);
+
+  mdepth m;
+  double grav = checks::readFALC("Atmos/FALC_82.atmos", m, 2.e4);
+
+  vector<line_t> lines;
+  string abfile = "";
+  ceos fe(lines, abfile, grav);
+
+
+  /* --- Wavelength grids [A] --- */
+
+  const int nw[2] = {2000, 200};
+  vector<double> w[2];
+  for(int ii=0; ii<nw[0]; ii++) w[0].push_back(1000.0 + 19000.0 * ii / double(nw[0]-1));
+  for(int ii=0; ii<nw[1]; ii++) w[1].push_back(3930.0 + (8545.0 - 3930.0) * ii / double(nw[1]-1));
+
+  vector<double> op_t[2], op_d[2], sc_t[2], sc_d[2];
+
+
+  /* --- All depth points, alternating the grids --- */
+
+  vector<double> frac, part, opac(nw[0]), scat(nw[0]);
+  double rho = 0.0, na = 0.0, ne = 0.0;
+
+  for(int kk=0; kk<m.ndep; kk++){
+    fe.nne_from_T_Pg(m.temp[kk], pow(10.0, grav + m.cmass[kk]), rho);
+    fe.store_partial_pressures(1, 0, fe.xna, fe.xne);
+    fe.read_partial_pressures(0, frac, part, na, ne);
+
+    for(int gg=0; gg<2; gg++){
+      call_cop(cop, fe, m.temp[kk], nw[gg], &w[gg][0], &opac[0], &scat[0], frac, na, ne);
+      op_t[gg].insert(op_t[gg].end(), opac.begin(), opac.begin()+nw[gg]);
+      sc_t[gg].insert(sc_t[gg].end(), scat.begin(), scat.begin()+nw[gg]);
+
+      call_cop(cop_direct, fe, m.temp[kk], nw[gg], &w[gg][0], &opac[0], &scat[0], frac, na, ne);
+      op_d[gg].insert(op_d[gg].end(), opac.begin(), opac.begin()+nw[gg]);
+      sc_d[gg].insert(sc_d[gg].end(), scat.begin(), scat.begin()+nw[gg]);
+    }
+  }
+
+
+  /* --- Compare --- */
+
+  const char *gname[2] = {"1000-20000 A", "3930-8545 A"};
+  int nfail = 0;
+
+  for(int gg=0; gg<2; gg++){
+    int n = (int)op_d[gg].size();
+    nfail += checks::report(string("opacity ") + gname[gg] + ", tabulated vs direct",
+			    checks::maxrel(n, &op_d[gg][0], &op_t[gg][0], true), tol);
+    nfail += checks::report(string("scattering ") + gname[gg] + ", tabulated vs direct",
+			    checks::maxrel(n, &sc_d[gg][0], &sc_t[gg][0], true), tol);
+  }
+
+  return nfail;
+}
@@ -0,0 +1,125 @@
+/* ---
+   Regression check of the adaptive depth grid of the non-LTE synthesis
+   (keyword nlte_depth_tolerance, see crh::synth).
+
+   Synthesizes the regions of input.cfg in FAL-C with velocities and
+   magnetic field on the full grid, then with nlte_depth_tolerance set:
+   the first call calibrates the subset (full grid and trial subsets,
+   so the saved populations go from 82 points to fewer), the second one
+   takes the subset path, the third one validates the threshold again
+   (nlte_depth_check = 1) and the last one runs the full grid again from
+   the populations of the subset. The error of each spectrum relative to
+   Stokes I of the first full-grid synthesis must be below the tolerance.
+
+   Usage (from a run directory prepared by bench/checks.py):
+
+      check_depth.x [nlte_depth_tolerance [tol]]
+
+   The tolerance defaults to nlte_depth_tolerance (1e-2).
+
+   Modifications:
+           2026-10-19: Created.
+   --- */
+
+#include <cmath>
+#include <vector>
+#include <string>
+#include "input.h"
+#include "depthmodel.h"
+#include "crh.h"
+#include "checks.h"
+
+using namespace std;
+
+/* --- Maximum error of IQUV relative to the reference Stokes I, as in
+   crh::calibrateDepth --- */
+
+static double stokesErr(int nw, const vector<double> &ref, const vector<double> &syn)
+{
+  double err = 0.0;
+  for(int ww=0; ww<nw; ww++){
+    double iref = std::max(fabs(ref[ww*4]), 1.e-30);
+    for(int ss=0; ss<4; ss++) err = std::max(err, fabs(syn[ww*4+ss] - ref[ww*4+ss]) / iref);
+  }
+  return err;
+}
+
+
+int main(int argc, char *argv[])
+{
+  double dtol = ((argc > 1) ? atof(argv[1]) : 1.e-2);
+  double tol  = ((argc > 2) ? atof(argv[2]) : dtol);
+
+  mdepth m;
+  double grav = checks::readFALC("Atmos/FALC_82.atmos", m);
+  for(int kk=0; kk<m.ndep; kk++){
+    m.v[kk] = 2.e5 * sin(0.2*kk), m.bl[kk] = 500.0, m.bh[kk] = 300.0, m.azi[kk] = 0.5;
+  }
+
+  iput_t iput = read_input("input.cfg", false);
+  iput.myrank = 0, iput.verbose = 0, iput.mode = 2, iput.nlte_depth_tol = 0.0;
+
+  crh atm(iput, grav);
+  m.getPressureScale(1, 0, *atm.eos);
+
+  int nw = atm.nlambda;
+  vector<double> syn_ref(nw*4), syn_cal(nw*4), syn_sub(nw*4), syn_val(nw*4), syn_full(nw*4);
+
+
+  /* --- Full grid reference --- */
+
+  mdepth m0(m);
+  bool conv = atm.synth(m0, &syn_ref[0], 0, bez_ltau, true);
+
+
+  /* --- Calibration, then the subset path --- */
+
+  atm.input.nlte_depth_tol = dtol;
+
+  mdepth m1(m);
+  conv &= atm.synth(m1, &syn_cal[0], 0, bez_ltau, true);
+
+  int nsub = m.ndep;
+  if(atm.dthres > 0.0){
+    vector<int> idx;
+    atm.depthSubset(m, atm.dthres, idx);
+    nsub = (int)idx.size();
+  }
+
+  mdepth m2(m);
+  conv &= atm.synth(m2, &syn_sub[0], 0, bez_ltau, true);
+
+  atm.input.nlte_depth_check = 1;
+  
+  mdepth m4(m);
+  conv &= atm.synth(m4, &syn_val[0], 0, bez_ltau, true);
+  bool valid = (atm.dthres > 0.0);
+
+
+  /* --- Full grid from the populations of the subset --- */
+
+  atm.input.nlte_depth_tol = 0.0;
+
+  mdepth m3(m);
+  conv &= atm.synth(m3, &syn_full[0], 0, bez_ltau, true);
+
+  fprintf(stdout, "check_depth: nlte_depth_tolerance=%e, ndep=%d -> %d\n", dtol, m.ndep, nsub);
+
+  if(!conv || nsub >= m.ndep || !valid){
+    fprintf(stdout, "check_depth: FAILED, converged=%d, subset of %d points, validated=%d\n",
+	    (int)conv, nsub, (int)valid);
+    return 1;
+  }
+
+
+  /* --- Compare --- */
+
+  int nfail = 0;
+  nfail += checks::report("calibration, IQUV vs full grid", stokesErr(nw, syn_ref, syn_cal), tol);
+  nfail += checks::report("subset path, IQUV vs full grid", stokesErr(nw, syn_ref, syn_sub), tol);
+  nfail += checks::report("validated subset, IQUV vs full grid", stokesErr(nw, syn_ref, syn_val), tol);
+  nfail += checks::report("full grid from the subset populations, IQUV",
+			  stokesErr(nw, syn_ref, syn_full), tol);
+
+  return nfail;
+}
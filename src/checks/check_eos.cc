@@ -0,0 +1,90 @@
+/* ---
+   Regression check of the C++ port of the Piskunov EOS (eos::piskunov,
+   eos_type = 2) against the fortran routines (ceos, eos_type = 0).
+
+   For each atmosphere of the example (FAL A, C, F and XCO), the
+   electron density and the gas density are computed with both EOS from
+   T and Pg = g * cmass, and the hydrostatic equilibrium is integrated in
+   column mass and in tau500. The remaining differences come from the
+   Boltzmann constant in eV of the partition functions (CODATA in
+   partition.h, 8.6171e-5 in the fortran).
+
+   Usage (from a run directory prepared by bench/checks.py):
+
+      check_eos.x [tol_ne tol_rho tol_pgas_tau]
+
+   Modifications:
+           2026-10-19: Created.
+   --- */
+
+#include <cmath>
+#include <vector>
+#include <string>
+#include "depthmodel.h"
+#include "ceos.h"
+#include "piskunov.h"
+#include "checks.h"
+
+using namespace std;
+
+
+int main(int argc, char *argv[])
+{
+  double tol[3] = {1.e-3, 2.e-4, 5.e-4};
+  for(int ii=0; ii<3; ii++) if(argc > ii+1) tol[ii] = atof(argv[ii+1]);
+
+  const char *atmos[4] = {"FALA_80", "FALC_82", "FALF_80", "FALXCO_80"};
+
+  vector<line_t> lines;
+  string abfile = "";
+  int nfail = 0;
+
+  for(int aa=0; aa<4; aa++){
+    mdepth m;
+    double grav = checks::readFALC(string("Atmos/") + atmos[aa] + ".atmos", m);
+
+    ceos fe(lines, abfile, grav);
+    eos::piskunov pi(lines, abfile, grav);
+
+
+    /* --- ne and rho from T and Pg --- */
+
+    int ndep = m.ndep;
+    vector<double> ne_f(ndep), ne_p(ndep), rho_f(ndep), rho_p(ndep);
+    for(int kk=0; kk<ndep; kk++){
+      double pg = pow(10.0, grav + m.cmass[kk]);
+      ne_f[kk] = fe.nne_from_T_Pg(m.temp[kk], pg, rho_f[kk]);
+      ne_p[kk] = pi.nne_from_T_Pg(m.temp[kk], pg, rho_p[kk]);
+    }
+
+    string name = string(atmos[aa]) + ": ";
+    nfail += checks::report(name + "ne(T,Pg), piskunov vs ceos",
+			    checks::maxrel(ndep, &ne_f[0], &ne_p[0], true), tol[0]);
+    nfail += checks::report(name + "rho(T,Pg), piskunov vs ceos",
+			    checks::maxrel(ndep, &rho_f[0], &rho_p[0], true), tol[1]);
+
+
+    /* --- Hydrostatic equilibrium in column mass (batched, warm-started
+       solutions and tau500 from the continuum opacity), then in tau500
+       from the same tau scale and upper boundary --- */
+
+    m.pgas[0] = pow(10.0, grav + m.cmass[0]);
+    mdepth mf(m), mp(m);
+    mf.getPressureScale(1, 1, fe);
+    mp.getPressureScale(1, 1, pi);
+
+    nfail += checks::report(name + "hydrostatic(cmass) ne, piskunov vs ceos",
+			    checks::maxrel(ndep, &mf.nne[0], &mp.nne[0], true), tol[0]);
+    nfail += checks::report(name + "hydrostatic(cmass) tau500, piskunov vs ceos",
+			    checks::maxrel(ndep, &mf.tau[0], &mp.tau[0], true), tol[2]);
+
+    mdepth tf(mf), tp(mf);
+    tf.getPressureScale(0, 0, fe);
+    tp.getPressureScale(0, 0, pi);
+
+    nfail += checks::report(name + "hydrostatic(tau500) Pg, piskunov vs ceos",
+			    checks::maxrel(ndep, &tf.pgas[0], &tp.pgas[0], true), tol[2]);
+  }
+
+  return nfail;
+}
@@ -0,0 +1,92 @@
+/* ---
+   Regression check of the single-precision LTE syntheses (clte,
+   lte_precision = single) against the default double-precision ones.
+
+   Synthesizes the Fe I 6301/6302 regions of input.cfg (lines in
+   lines.cfg) in FAL-C with velocities and magnetic field with both
+   precisions. Each Stokes parameter must agree within the tolerance,
+   relative to the maximum of Stokes I.
+
+   Usage (from a run directory prepared by bench/checks.py):
+
+      check_lte.x [tol]
+
+   Modifications:
+           2026-10-19: Created.
+   --- */
+
+#include <cmath>
+#include <vector>
+#include <string>
+#include "input.h"
+#include "depthmodel.h"
+#include "clte.h"
+#include "checks.h"
+
+using namespace std;
+
+
+int main(int argc, char *argv[])
+{
+  double tol = ((argc > 1) ? atof(argv[1]) : 1.e-5);
+
+  mdepth m;
+  double grav = checks::readFALC("Atmos/FALC_82.atmos", m, 2.e4);
+  for(int kk=0; kk<m.ndep; kk++){
+    m.v[kk] = 2.e5 * sin(0.2*kk), m.bl[kk] = 800.0 - 5.0*kk, m.bh[kk] = 400.0, m.azi[kk] = 0.5;
+  }
+
+  iput_t iput = read_input("input.cfg", false);
+  read_lines("lines.cfg", iput, false);
+  iput.myrank = 0, iput.verbose = 0, iput.mode = 2;
+
+  if(iput.lines.size() == 0){
+    fprintf(stdout, "check_lte: FAILED, no lines in lines.cfg\n");
+    return 1;
+  }
+
+  iput.lte_precision = 0;
+  clte atm_d(iput, grav);
+  iput.lte_precision = 1;
+  clte atm_f(iput, grav);
+
+
+
+  /* --- Synthesize, lambda has an extra reference wavelength at the
+     end. Each EOS keeps the partial pressures of its last
+     getPressureScale --- */
+
+  int nw = atm_d.nlambda;
+  vector<double> syn_d((nw+1)*4), syn_f((nw+1)*4);
+
+  mdepth m1(m), m2(m);
+  m1.getPressureScale(1, 0, *atm_d.eos);
+  m2.getPressureScale(1, 0, *atm_f.eos);
+  bool conv = atm_d.synth(m1, &syn_d[0], 0, bez_ltau);
+  conv &= atm_f.synth(m2, &syn_f[0], 0, bez_ltau);
+
+  fprintf(stdout, "check_lte: %d lines, %d wavelengths\n", (int)iput.lines.size(), nw);
+  if(!conv){
+    fprintf(stdout, "check_lte: FAILED, synth returned an error\n");
+    return 1;
+  }
+
+
+  /* --- Compare each Stokes parameter, relative to max(I) --- */
+
+  double imax = 0.0;
+  for(int ww=0; ww<nw; ww++) imax = std::max(imax, fabs(syn_d[ww*4]));
+
+  const char *sname[4] = {"I", "Q", "U", "V"};
+  int nfail = 0;
+
+  for(int ss=0; ss<4; ss++){
+    double err = 0.0;
+    for(int ww=0; ww<nw; ww++) err = std::max(err, fabs(syn_f[ww*4+ss] - syn_d[ww*4+ss]));
+    err = ((imax > 0.0) ? err / imax : HUGE_VAL);
+
+    nfail += checks::report(string("Stokes ") + sname[ss] + ", single vs double precision", err, tol);
+  }
+
+  return nfail;
+}
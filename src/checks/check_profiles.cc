@@ -0,0 +1,121 @@
+/* ---
+   Regression check of the single-precision profile storage of RH
+   (keyword PROFILE_MEMORY, see rh/profile.c).
+
+   Solves the non-LTE problem of the active atoms of atoms.input in FAL-C
+   (with velocities and magnetic field, so the polarized profiles are
+   stored too) twice from the same initial solution: with all profiles
+   in double precision (PROFILE_MEMORY = 0) and with a budget so small
+   that all active lines are stored in float. The converged departure
+   coefficients and the emergent Stokes I must agree within the
+   tolerance.
+
+   Usage (from a run directory prepared by bench/checks.py):
+
+      check_profiles.x [tol]
+
+   Modifications:
+           2026-10-19: Created.
+   --- */
+
+#include <cmath>
+#include <vector>
+#include <string>
+#include "input.h"
+#include "depthmodel.h"
+#include "crh.h"
+#include "checks.h"
+
+extern "C" {
+#include "rh/rh.h"
+#include "rh/atom.h"
+#include "rh/atmos.h"
+#include "rh/inputs.h"
+
+  extern Atmosphere atmos;
+  extern InputData input;
+}
+
+using namespace std;
+
+/* --- Converged departure coefficients of all active atoms --- */
+
+static vector<double> getPops(crh &atm)
+{
+  vector<double> b;
+  for(int nn=0; nn<atm.save_pop.nactive; nn++){
+    int np = atm.save_pop.pop[nn].nlevel * atm.save_pop.ndep;
+    b.insert(b.end(), atm.save_pop.pop[nn].n, atm.save_pop.pop[nn].n + np);
+  }
+  return b;
+}
+
+
+int main(int argc, char *argv[])
+{
+  double tol = ((argc > 1) ? atof(argv[1]) : 1.e-5);
+
+  mdepth m;
+  double grav = checks::readFALC("Atmos/FALC_82.atmos", m);
+  for(int kk=0; kk<m.ndep; kk++){
+    m.v[kk] = 2.e5 * sin(0.2*kk), m.bl[kk] = 500.0, m.bh[kk] = 300.0, m.azi[kk] = 0.5;
+  }
+
+  iput_t iput = read_input("input.cfg", false);
+  iput.myrank = 0, iput.verbose = 0, iput.nlte_depth_tol = 0.0;
+
+  crh atm(iput, grav);
+  m.getPressureScale(1, 0, *atm.eos);
+
+  int nw = atm.nlambda * 4;
+  vector<double> syn_d(nw), syn_f(nw);
+
+
+  /* --- Double precision profiles (default of keyword.input) --- */
+
+  mdepth m1(m);
+  bool conv = atm.synth(m1, &syn_d[0], 0, bez_ltau, true);
+  vector<double> b_d = getPops(atm);
+  atm.cleanup();
+
+
+  /* --- All active lines in float. keyword.input is only parsed in
+     the first call, the budget is checked in every getProfiles --- */
+
+  input.profile_memory = 1.e-6;
+
+  mdepth m2(m);
+  conv &= atm.synth(m2, &syn_f[0], 0, bez_ltau, true);
+  vector<double> b_f = getPops(atm);
+
+  int nline = 0, nfloat = 0;
+  for(int nn=0; nn<atmos.Nactiveatom; nn++){
+    Atom *atom = atmos.activeatoms[nn];
+    for(int kr=0; kr<atom->Nline; kr++){
+      nline++;
+      if(atom->line[kr].storage == PROFILE_FLOAT) nfloat++;
+    }
+  }
+  fprintf(stdout, "check_profiles: %d active atoms, %d of %d lines stored in float\n",
+	  atmos.Nactiveatom, nfloat, nline);
+
+  if(!conv || nfloat == 0 || b_d.size() == 0 || b_d.size() != b_f.size()){
+    fprintf(stdout, "check_profiles: FAILED, converged=%d, float lines=%d, populations %d/%d\n",
+	    (int)conv, nfloat, (int)b_d.size(), (int)b_f.size());
+    return 1;
+  }
+
+
+  /* --- Compare --- */
+
+  vector<double> I_d(atm.nlambda), I_f(atm.nlambda);
+  for(int ww=0; ww<atm.nlambda; ww++) I_d[ww] = syn_d[ww*4], I_f[ww] = syn_f[ww*4];
+
+  int nfail = 0;
+  nfail += checks::report("departure coefficients, float vs double profiles",
+			  checks::maxrel((int)b_d.size(), &b_d[0], &b_f[0], true), tol);
+  nfail += checks::report("Stokes I, float vs double profiles",
+			  checks::maxrel(atm.nlambda, &I_d[0], &I_f[0]), tol);
+
+  return nfail;
+}
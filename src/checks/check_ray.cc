@@ -0,0 +1,114 @@
+/* ---
+   Regression check of the output-ray synthesis of RH (calculateRay):
+   the angle-dependent profiles and background records recomputed in
+   the arrays of the iterations (Background_ray_j) against the original
+   path that recomputes all profiles, the collisions and the whole
+   background (Background_j, keyword FULL_OUTPUT_RAY).
+
+   The regions of input.cfg are synthesized in FAL-C with velocities
+   and magnetic field, and in FAL-C with v = B = 0 (rhf1d always sets
+   atmos.moving, so the same records are recomputed). Both paths start
+   from the same cold populations, the error of IQUV relative to
+   Stokes I of the full path must be below the tolerance. The output-ray
+   path runs first, RH reads keyword.input (and resets FULL_OUTPUT_RAY)
+   in the first synthesis.
+
+   Usage (from a run directory prepared by bench/checks.py):
+
+      check_ray.x [tol]
+
+   Modifications:
+           2026-10-19: Created.
+   --- */
+
+#include <cmath>
+#include <vector>
+#include <string>
+#include "input.h"
+#include "depthmodel.h"
+#include "crh.h"
+#include "checks.h"
+
+extern "C" {
+#include "rh/rh.h"
+#include "rh/atom.h"
+#include "rh/atmos.h"
+#include "rh/inputs.h"
+  extern InputData input;
+}
+
+using namespace std;
+
+/* --- Maximum error of IQUV relative to the reference Stokes I --- */
+
+static double stokesErr(int nw, const vector<double> &ref, const vector<double> &syn)
+{
+  double err = 0.0;
+  for(int ww=0; ww<nw; ww++){
+    double iref = std::max(fabs(ref[ww*4]), 1.e-30);
+    for(int ss=0; ss<4; ss++) err = std::max(err, fabs(syn[ww*4+ss] - ref[ww*4+ss]) / iref);
+  }
+  return err;
+}
+
+
+/* --- Synthesis without saving the populations, so that every call
+   starts from the same cold populations --- */
+
+static bool synthRay(crh &atm, mdepth &m, bool full, vector<double> &syn)
+{
+  mdepth mm(m);
+  input.full_ray = (bool_t)full;
+  bool conv = atm.synth(mm, &syn[0], 0, bez_ltau, false);
+  input.full_ray = FALSE;
+
+  return conv;
+}
+
+
+int main(int argc, char *argv[])
+{
+  double tol = ((argc > 1) ? atof(argv[1]) : 1.e-10);
+
+  mdepth ms;
+  double grav = checks::readFALC("Atmos/FALC_82.atmos", ms);
+
+  mdepth mv(ms);
+  for(int kk=0; kk<mv.ndep; kk++){
+    mv.v[kk] = 2.e5 * sin(0.2*kk), mv.bl[kk] = 500.0, mv.bh[kk] = 300.0, mv.azi[kk] = 0.5;
+  }
+
+  iput_t iput = read_input("input.cfg", false);
+  iput.myrank = 0, iput.verbose = 0, iput.mode = 2, iput.nlte_depth_tol = 0.0;
+
+  crh atm(iput, grav);
+  ms.getPressureScale(1, 0, *atm.eos);
+  mv.getPressureScale(1, 0, *atm.eos);
+
+  int nw = atm.nlambda;
+  vector<double> syn_vf(nw*4), syn_vl(nw*4), syn_sf(nw*4), syn_sl(nw*4);
+
+
+  /* --- Output-ray path, then the full path --- */
+
+  bool conv = synthRay(atm, mv, false, syn_vl);
+  conv &= synthRay(atm, mv, true,  syn_vf);
+  conv &= synthRay(atm, ms, false, syn_sl);
+  conv &= synthRay(atm, ms, true,  syn_sf);
+
+  if(!conv){
+    fprintf(stdout, "check_ray: FAILED, not converged\n");
+    return 1;
+  }
+
+
+  /* --- Compare --- */
+
+  int nfail = 0;
+  nfail += checks::report("FAL-C with v and B, output ray vs full background, IQUV",
+			  stokesErr(nw, syn_vf, syn_vl), tol);
+  nfail += checks::report("FAL-C, v = B = 0, output ray vs full background, IQUV",
+			  stokesErr(nw, syn_sf, syn_sl), tol);
+
+  return nfail;
+}
@@ -0,0 +1,99 @@
+/* ---
+   Small helpers shared by the regression checks (make check).
+
+   The checks run in a directory prepared by bench/checks.py from
+   example/ (input.cfg in synthesis mode, keyword.input, atoms.input...),
+   print one line per comparison and return a non-zero exit status if
+   any difference is larger than its tolerance.
+
+   Modifications:
+           2026-10-19: Created.
+   --- */
+
+#ifndef CHECKS_H
+#define CHECKS_H
+
+#include <cmath>
+#include <vector>
+#include <string>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+#include "depthmodel.h"
+
+namespace checks{
+
+  /* --- Reads a RH atmos file in column mass scale (log cmass, T, ne, v, vturb
+     in km/s) into m. Points hotter than tmax (transition region and corona)
+     are skipped. Returns log(g) --- */
+
+  inline double readFALC(const std::string &filename, mdepth &m, double tmax = 1.e6)
+  {
+    std::ifstream in(filename.c_str());
+    if(!in.is_open()){
+      fprintf(stderr, "checks::readFALC: ERROR, cannot open %s\n", filename.c_str());
+      exit(2);
+    }
+
+    std::vector<std::string> li;
+    std::string line;
+    while(std::getline(in, line)){
+      size_t i0 = line.find_first_not_of(" \t");
+      if(i0 == std::string::npos || line[i0] == '*') continue;
+      li.push_back(line);
+    }
+
+    double grav = atof(li[2].c_str());
+    int ndep = atoi(li[3].c_str());
+
+    std::vector<double> cm, T, vt;
+    for(int kk=0; kk<ndep; kk++){
+      double a, b, c, d, e;
+      std::istringstream(li[4+kk]) >> a >> b >> c >> d >> e;
+      if(b > tmax) continue;
+      cm.push_back(a), T.push_back(b), vt.push_back(e);
+    }
+
+    m.setsize((int)T.size());
+    m.zero();
+    for(int kk=0; kk<m.ndep; kk++){
+      m.cmass[kk] = cm[kk], m.temp[kk] = T[kk], m.vturb[kk] = vt[kk] * 1.e5;
+    }
+
+    return grav;
+  }
+
+
+  /* --- Max. relative difference of b with respect to a, relative to the
+     largest absolute value of a (so values close to zero do not dominate)
+     unless local is true --- */
+
+  inline double maxrel(int n, const double *a, const double *b, bool local = false)
+  {
+    double amax = 0.0, err = 0.0;
+    for(int ii=0; ii<n; ii++) amax = std::max(amax, fabs(a[ii]));
+    for(int ii=0; ii<n; ii++){
+      double den = (local ? fabs(a[ii]) : amax);
+      if(den > 0.0) err = std::max(err, fabs(b[ii]-a[ii]) / den);
+      else if(b[ii] != 0.0) err = HUGE_VAL;
+    }
+    return err;
+  }
+
+
+  /* --- Prints the result of a comparison, returns 1 if it failed --- */
+
+  inline int report(const std::string &name, double err, double tol)
+  {
+    bool ok = (err <= tol); // NaN fails
+    fprintf(stdout, "%-58s max. rel. diff. %10.3e (tol %8.1e) %s\n", name.c_str(), err, tol,
+	    (ok ? "OK" : "FAILED"));
+    fflush(stdout);
+    return (ok ? 0 : 1);
+  }
+
+}
+
+#endif
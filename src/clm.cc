@@ -39,6 +39,31 @@
 	   2017-11-20, JdlCR: Fixed regularization, there was a small error on the right-hand 
 	                      side term of the linear system that is solved to get the corrections
 			      to the model. 
+
+	   2026-10-18: The normal equations are assembled and decomposed once per line 
+	               search (compute_hessian). The system is scaled by the damping 
+		       diagonal, so each lambda trial only needs a back-substitution 
+		       with the eigenvalues shifted by lambda.
+
+	   2026-10-19: The scaled decomposition is optional (svd_scaled = 1). By default
+	               the system is still assembled once per line search, but every
+		       trial damps it, updates the diagonal and thresholds the singular
+		       values of its own SVD, as before, so the default keeps the cost
+		       of one SVD per lambda trial.
+
+	   2026-10-18: Optional quasi-Newton mode (broyden_n > 0). After an accepted 
+	               step the Jacobian can be replaced by a rank-1 Broyden update 
+		       if the linear model predicted the chi2 reduction well enough.
+		       A full Jacobian is computed every broyden_n+1 iterations or 
+		       when a step fails with an updated one.
+
+	   2026-10-18: The arrays used by fitdata, the line search and the linear 
+	               solver are workspaces of the object, allocated on the first 
+		       call and reused. Compiling with -DCLM_CHECK_ALLOC asserts that
+		       they are not reallocated after the first iteration of fitdata.
+
+	   2026-10-19: Optional wall-clock deadline, fitdata stops after the 
+	               iteration that exceeds it and keeps the best model.
 */
 
 #include <algorithm>
@@ -48,6 +73,7 @@
 #include <iostream>
 #include <cstring>
 #include <cmath>
+#include <cassert>
 #include <eigen3/Eigen/Dense>
 #include <eigen3/Eigen/SVD>
 #include "clm.h"
@@ -292,7 +318,20 @@ reg_t::reg_t(const reg_t &in)
 
 reg_t &reg_t::operator=(const reg_t &in)
 {
-  set(in.npar, in.nreg, in.regularize[0], in.regularize[1], in.ntrans);
+  if(this == &in) return *this;
+
+  
+  /* --- Reuse the buffers if the dimensions are the same --- */
+  
+  if((in.npar > 0) && (npar == in.npar) && (nreg == in.nreg)){
+    to_reg = true;
+    scl = in.regularize[0];
+    regularize[0] = in.regularize[0], regularize[1] = in.regularize[1];
+    ntrans = in.ntrans;
+  }else{
+    del();
+    set(in.npar, in.nreg, in.regularize[0], in.regularize[1], in.ntrans);
+  }
   
   if(npar > 0){
     memcpy(reg, in.reg, nreg*sizeof(double));
@@ -311,6 +350,7 @@ void reg_t::del(){
   if(reg != NULL) delete [] reg;
   if(dreg != NULL) del_mat(dreg);
   if(LL != NULL) del_mat(LL);
+  reg = NULL, dreg = NULL, LL = NULL;
   to_reg = false;
   npar = 0;
   nreg = 0;
@@ -378,9 +418,18 @@ clm::clm(int ind, int inpar){
   regul_scal_in = 0.0;// scale factor for regularization terms input
   proc = 0;           // print-out processor number
   reset_par = false;  // If true, use perturbation approach
+  broyden_n = 0;      // Max. consecutive Broyden updates of the Jacobian (0 = off)
+  broyden_thres = 0.5;// Min. ratio of actual/predicted chi2 reduction to use them
+  svd_scaled = 0;     // SVD of the unscaled damped system in every lambda trial
+  njac = nbroyden = 0;
+  deadline = 0.0;     // No wall-clock limit
+  timedout = false;
 
   bestSyn.resize(nd, 0.0);
   iSyn.resize(nd, 0.0);
+
+  wrf = NULL;
+  nalloc = 0;
 }
 
 /* -------------------------------------------------------------------------------- */
@@ -389,6 +438,61 @@ clm::~clm()
 {
   fcnt.clear();
   diag.clear();
+  if(wrf != NULL) del_mat(wrf);
+}
+
+/* -------------------------------------------------------------------------------- */
+
+void clm::workspace(std::vector<double> &w, size_t n)
+{
+  if(w.capacity() < n) nalloc++;
+  w.resize(n);
+}
+
+/* -------------------------------------------------------------------------------- */
+
+void clm::workspace(reg_t &w, const reg_t &in)
+{
+  if((in.npar > 0) && ((w.npar != in.npar) || (w.nreg != in.nreg))) nalloc++;
+  w = in;
+}
+
+/* -------------------------------------------------------------------------------- */
+
+void clm::setWorkspace(reg_t &regul)
+{
+
+  /* --- Only the first call allocates, nd and npar are fixed --- */
+
+  if(wrf == NULL){
+    wrf = mat2d(npar, nd);
+    nalloc++;
+  }
+  
+  workspace(wres, nd), workspace(wbest, npar), workspace(wxnew, npar), workspace(wnres, nd);
+  workspace(wtrial, npar), workspace(wbx, npar), workspace(wbsyn, nd), workspace(wdx, npar);
+  workspace(wores, ((broyden_n > 0) ? nd : 0));
+  workspace(wtmp1, std::max(regul.nreg, 1));
+
+  
+  /* --- The line search tries at most ~12 values of lambda --- */
+
+  if(ilamb.capacity() < 16) ilamb.reserve(16), ichi.reserve(16), nalloc++;
+
+  
+  /* --- Linear system and its eigen-decomposition --- */
+
+  if(hess_A.rows() != npar){
+    hess_A.resize(npar, npar), hess_LL.resize(npar, npar), hess_Bv.resize(npar);
+    trial_W.resize(npar), trial_sgn.resize(npar);
+    hess_S.resize(npar), hess_B.resize(npar), hess_E.resize(npar), hess_V.resize(npar, npar);
+    hess_Ad.resize(npar, npar), hess_U.resize(npar, npar), hess_Vd.resize(npar, npar), hess_JJ.resize(npar);
+    hess_eig = SelfAdjointEigenSolver<MatrixXd>(npar);
+    hess_svd = BDCSVD<MatrixXd>(npar, npar, ComputeThinU | ComputeThinV);
+    nalloc++;
+  }
+  
+  workspace(wreg, regul), workspace(wreg_trial, regul), workspace(wreg_best, regul);
 }
 
 /* -------------------------------------------------------------------------------- */
@@ -496,13 +600,15 @@ double clm::getChi2Pars(double *res, double **rf, double lambda,
   /* --- Get new estimate of the model for the current lambda value --- */
   
   memset(xnew, 0, sizeof(double)*npar);
-  compute_trial3(res, rf, lambda, x, xnew, dregul, mydat, fx);
+  compute_trial3(lambda, x, xnew);
 
 
   /* --- Evaluate the new model, no response function is needed --- */
 
-  double *new_res = new double [nd]();
-  reg_t new_dregul = dregul;
+  double *new_res = &wnres[0];
+  memset(new_res, 0, nd*sizeof(double));
+  reg_t &new_dregul = wreg_trial;
+  workspace(new_dregul, dregul);
   
   int status = fx(npar, nd, xnew, &iSyn[0], new_res, NULL, mydat, new_dregul, false);
 
@@ -512,8 +618,6 @@ double clm::getChi2Pars(double *res, double **rf, double lambda,
     error = true;
     newchi2 = 1.e32;
   }else newchi2 = compute_chi2(new_res, new_dregul.getReg());
-
-  delete [] new_res;
     
     
   /* --- copy individual penalties and return chi2 --- */
@@ -579,11 +683,19 @@ double clm::getChi2ParsLineSearch(double *res, double **rf, double &lambda,
      that we copy again the original reg terms before calling getChi2Pars into dregul.
 
      --- */
+
+  
+  /* --- The Hessian and its decomposition do not depend on lambda: 
+     compute them once for all the trials of this line search --- */
+  
+  compute_hessian(res, rf, dregul_in);
+  
   
   /* --- If traditional LM iteration, without braketing --- */
 
   if(!braket){
-    reg_t dregul = dregul_in;
+    reg_t &dregul = wreg;
+    workspace(dregul, dregul_in);
     double chi2 = getChi2Pars(res, rf, lambda, x, xnew, mydat, fx, dregul);
     dregul_in.copyReg(dregul.reg);
     return chi2;
@@ -593,8 +705,10 @@ double clm::getChi2ParsLineSearch(double *res, double **rf, double &lambda,
   
   /* --- Braket lambda/chi2 --- */
 
-  vector<double> ilamb, ichi, tmp(npar, 0.0), bx(npar, 0.0), bsyn(nd, 0.0);
-  reg_t dregul = dregul_in, best_dregul = dregul_in;
+  vector<double> &tmp = wtrial, &bx = wbx, &bsyn = wbsyn;
+  reg_t &dregul = wreg, &best_dregul = wreg_best;
+  workspace(dregul, dregul_in), workspace(best_dregul, dregul_in);
+  ilamb.clear(), ichi.clear();
   ilamb.push_back(lambda);
   double bchi = rchi2, blambda = lambda;
   
@@ -617,7 +731,7 @@ double clm::getChi2ParsLineSearch(double *res, double **rf, double &lambda,
     while(((kk<1) || ((ichi[kk] < ichi[kk-1]) && (iter++ < 4))) && (ilamb[kk] > lmin)){
       double ilfac = lfac;//(ilamb[kk] > 0.1)? lfac : sqrt(lfac);
       ilamb.push_back(ilamb[kk] / ilfac);
-      dregul = dregul_in;
+      workspace(dregul, dregul_in);
       ichi.push_back(getChi2Pars(res, rf, ilamb[kk+1], x, &tmp[0], mydat, fx, dregul));
 
       
@@ -676,7 +790,7 @@ double clm::getChi2ParsLineSearch(double *res, double **rf, double &lambda,
     while((idx == 0) && (kk++ <= 4) && (ilamb[0] < lmax) && (ilamb[0] > lmin)){
       double ilfac = lfac;//(ilamb[0]  >= 0.1)? lfac : sqrt(lfac);
       ilamb.insert(ilamb.begin(), ilamb[0] * ilfac);
-      dregul = dregul_in;
+      workspace(dregul, dregul_in);
       ichi.insert(ichi.begin(), getChi2Pars(res, rf, ilamb[0], x, &tmp[0], mydat, fx, dregul));
       
       if(ichi[0] < ichi[1]){
@@ -728,7 +842,7 @@ double clm::getChi2ParsLineSearch(double *res, double **rf, double &lambda,
 					          (ichi[idxu]),     (ichi[idx0]),    (ichi[idxd]));
 	
 	double glamb = exp(-0.5 * cc[1]/cc[2]);
-	dregul = dregul_in;
+	workspace(dregul, dregul_in);
 	double gchi  = getChi2Pars(res, rf, glamb, x, &tmp[0], mydat, fx, dregul);
 	
 
@@ -810,22 +924,35 @@ double clm::fitdata(clm_func fx, double *x, void *mydat, int maxiter, reg_t &dre
   getParTypes();
   double chi2 = 1.e13, ochi2 = 1.e13, bestchi2 = 1.e13, olambda = 0.0, t0 = 0, t1 = 0;
   double orchi2=1.e13, rchi2=1.e13, reg = 0.0, tchi=0.0;
-  int iter = iit = 0, nretry = 0;
-  bool exitme = false, toolittle = false, dcreased = false;
+  int iter = iit = 0, nretry = 0, nbseq = 0;
+  bool exitme = false, toolittle = false, dcreased = false, broyden_rf = false, broyden_next = false;
   string rej = "";
   memset(&diag[0],0,npar*sizeof(double));
   error = false;
   miter = maxiter;
+  njac = 0, nbroyden = 0, niter = 0, nreject = 0;
+  timedout = false;
   //reg_t dregul;
   //if(regularize) dregul.set(npar, regul_scal); // To store derivatives of regularization terms
   
   
   /* --- Init array for residues and response function --- */
   
-  double **rf = mat2d(npar,nd);
-  double *res = new double [nd]();
-  double *bestpars = new double [nd]();
-  double *xnew = new double [nd]();
+  setWorkspace(dregul);
+  
+  double **rf = wrf;
+  double *res = &wres[0];
+  double *bestpars = &wbest[0];
+  double *xnew = &wxnew[0];
+  std::vector<double> &dx = wdx, &ores = wores;
+  
+  memset(rf[0], 0, npar*nd*sizeof(double));
+  memset(res, 0, nd*sizeof(double));
+  memset(xnew, 0, npar*sizeof(double));
+  memset(&dx[0], 0, npar*sizeof(double));
+#ifdef CLM_CHECK_ALLOC
+  long nalloc0 = -1;
+#endif
 
   
   /* --- check parameters --- */
@@ -849,6 +976,7 @@ double clm::fitdata(clm_func fx, double *x, void *mydat, int maxiter, reg_t &dre
     iter = maxiter+1;
   }else{
     scaleRF(rf);
+    njac++;
     memcpy(&bestpars[0], &x[0], npar*sizeof(double));
     //
     reg =  dregul.getReg();
@@ -919,6 +1047,15 @@ double clm::fitdata(clm_func fx, double *x, void *mydat, int maxiter, reg_t &dre
       dregul.printReg();
 
       
+      /* --- Quasi-Newton mode: decide if the next Jacobian can be a Broyden 
+	 update of the current one. The ratio between the actual and the 
+	 predicted (linear) reduction of chi2 tells how good rf still is.
+	 --- */
+      
+      if(broyden_n > 0)
+	broyden_next = checkBroyden(res, rf, x, xnew, &dx[0], orchi2, rchi2, nbseq);
+      
+
       /* --- Store new best guessed model --- */
       
       bestchi2 = chi2;
@@ -944,13 +1081,37 @@ double clm::fitdata(clm_func fx, double *x, void *mydat, int maxiter, reg_t &dre
 	memset(xnew, 0, npar*sizeof(double));
       }
       
+    }else if(broyden_rf){
+
+      /* --- The step failed with an approximated Jacobian, recompute it 
+	 at the current model before increasing lambda --- */
+      
+      lambda = olambda;
+      zero(res, rf);
+      if(dregul.to_reg) dregul.zero();
+      
+      status = fx(npar, nd, x, &iSyn[0], res, rf, mydat, dregul, false);
+      if(status){
+	if(verb)
+	  fprintf(stderr, "clm::fitdata: [p:%4d] ERROR in the evaluation of FX, aborting inversion\n", proc);
+	error = true;
+	break;
+      }
+      
+      scaleRF(rf);
+      njac++, nbseq = 0;
+      broyden_rf = false;
+      rej = " *";
+      
+      continue;
+      
     }else{
       
       /* --- Prep lambda for next trial --- */
       
       double ilfac = lfac;//(lambda >= 0.1)? lfac : sqrt(lfac);
       lambda = checkLambda(lambda * ilfac*ilfac);
-      nretry++;
+      nretry++, nreject++;
       rej = " *";
       
       if(nretry < maxreject){
@@ -970,6 +1131,7 @@ double clm::fitdata(clm_func fx, double *x, void *mydat, int maxiter, reg_t &dre
     /* --- printout --- */
     
     t1 = getTime();
+    niter++;
 
     if(verb)
       fprintf(stderr,"[p:%4d,i:%4d] chi2=%14.5f (%f, %f), dchi2=%e, lambda=%e, elapsed=%5.3fs %s\n",
@@ -998,6 +1160,13 @@ double clm::fitdata(clm_func fx, double *x, void *mydat, int maxiter, reg_t &dre
 	fprintf(stderr,"clm::fitdata:  [p:%4d] relative change in chi2 is too low, inversion finished\n", proc);
       break;
     }
+
+    if((deadline > 0.0) && (getTime() > deadline)){
+      if(verb) 
+	fprintf(stderr,"clm::fitdata: [p:%4d] wall-clock limit reached, keeping the best model so far\n", proc);
+      timedout = true;
+      break;
+    }
     
 
     /* --- prepare Jacobian for the next iteration --- */
@@ -1005,13 +1174,14 @@ double clm::fitdata(clm_func fx, double *x, void *mydat, int maxiter, reg_t &dre
     if((iter+1)>maxiter) break;
     
     t0 = t1;
-    zero(res, rf);
+    if(broyden_next) memcpy(&ores[0], res, nd*sizeof(double));
+    zero(res, (broyden_next) ? NULL : rf);
     if(dregul.to_reg){
       dregul.zero();
       dregul.updateScl(iter);
     }
     //
-    status = fx(npar, nd, x, &iSyn[0], res, rf, mydat, dregul, false);
+    status = fx(npar, nd, x, &iSyn[0], res, (broyden_next) ? NULL : rf, mydat, dregul, false);
     //
     if(status){
       if(verb)
@@ -1019,10 +1189,24 @@ double clm::fitdata(clm_func fx, double *x, void *mydat, int maxiter, reg_t &dre
       error = true;
       break;
     }
-    
-    scaleRF(rf);
+
+    if(broyden_next){
+      broydenUpdate(rf, &ores[0], res, &dx[0]);
+      nbroyden++, nbseq++;
+    }else{
+      scaleRF(rf);
+      njac++, nbseq = 0;
+    }
+    broyden_rf = broyden_next;
+    broyden_next = false;
     iter++;
 
+#ifdef CLM_CHECK_ALLOC
+    /* --- Nothing can be reallocated after the first iteration --- */
+    if(nalloc0 < 0) nalloc0 = nalloc;
+    else assert(nalloc == nalloc0);
+#endif
+
     
     /* --- Scale down the regularization term if needed --- */
 
@@ -1040,10 +1224,6 @@ double clm::fitdata(clm_func fx, double *x, void *mydat, int maxiter, reg_t &dre
     
   /* --- clean-up --- */
 
-  del_mat(rf);
-  delete [] res;
-  delete [] bestpars;
-  delete [] xnew;
   //delete [] dregul;
 
 
@@ -1135,8 +1315,68 @@ double clm::fitdata(clm_func fx, double *x, void *mydat, int maxiter, reg_t &dre
 
 /* -------------------------------------------------------------------------------- */
 
-void clm::compute_trial3(double *res, double **rf, double lambda,
-			 double *x, double *xnew, reg_t &dregul, void *mydat, clm_func fx)
+bool clm::checkBroyden(double *res, double **rf, double *x, double *xnew, double *dx,
+			double ochi2, double nchi2, int nbseq)
+{
+  if(nbseq >= broyden_n) return false;
+
+  
+  /* --- Actual step, cyclic parameters that have been wrapped 
+     around cannot be used to update the Jacobian --- */
+  
+  double dxdx = 0.0;
+  for(int pp = 0; pp<npar; pp++){
+    dx[pp] = xnew[pp] - x[pp];
+    if(fcnt[pp].cyclic && (fabs(dx[pp]) > 0.5*(fcnt[pp].limit[1] - fcnt[pp].limit[0])))
+      return false;
+    dxdx += dx[pp]*dx[pp];
+  }
+  if(dxdx <= 0.0) return false;
+
+  
+  /* --- Predicted residue with the linear model: res - J # dx --- */
+  
+  for(int ww = 0; ww<nd; ww++){
+    double sum = res[ww];
+    for(int pp = 0; pp<npar; pp++) sum -= rf[pp][ww] * dx[pp];
+    tmp[ww] = sum;
+  }
+
+  double pred = ochi2 - sumarr2_4(&tmp[0], nd);
+  double actual = ochi2 - nchi2;
+  
+  if(pred <= 0.0) return false;
+  
+  return ((actual / pred) >= broyden_thres);
+}
+
+/* -------------------------------------------------------------------------------- */
+
+void clm::broydenUpdate(double **rf, double *ores, double *res, double *dx)
+{
+  
+  /* --- 
+     Rank-1 (Broyden) update of the Jacobian with the last step:
+     J += (dy - J # dx) # dx.T / (dx.T # dx), where dy = ores - res 
+     is the change of the synthetic data.
+     --- */
+  
+  double dxdx = 0.0;
+  for(int pp = 0; pp<npar; pp++) dxdx += dx[pp]*dx[pp];
+  
+  for(int ww = 0; ww<nd; ww++){
+    double sum = ores[ww] - res[ww];
+    for(int pp = 0; pp<npar; pp++) sum -= rf[pp][ww] * dx[pp];
+    tmp[ww] = sum / dxdx;
+  }
+
+  for(int pp = 0; pp<npar; pp++)
+    for(int ww = 0; ww<nd; ww++) rf[pp][ww] += tmp[ww] * dx[pp];
+}
+
+/* -------------------------------------------------------------------------------- */
+
+void clm::compute_hessian(double *res, double **rf, reg_t &dregul)
 {
 
   /* --- 
@@ -1145,19 +1385,25 @@ void clm::compute_trial3(double *res, double **rf, double lambda,
 
      --- */
 
-  /* --- Init Eigen-3 arrays --- */
+  /* --- Init Eigen-3 arrays, all of them are workspaces (A is symmetric) --- */
+
+  if(hess_A.rows() != npar){
+    hess_A.resize(npar, npar), hess_LL.resize(npar, npar), hess_Bv.resize(npar);
+    hess_S.resize(npar), hess_B.resize(npar), hess_JJ.resize(npar);
+    nalloc++;
+  }
   
-  Matrix<double,Dynamic, Dynamic, RowMajor> A(npar, npar), LL(npar,npar);//, Ap(npar,npar);
-  A.Zero(npar, npar), LL.Zero(npar,npar);//, Ap.Zero(npar,npar);
+  MatrixXd &A = hess_A, &LL = hess_LL;
+  A.setZero(), LL.setZero();
   
-  VectorXd B(npar), TT(nd); B.Zero(npar), TT.Zero(nd);
-  Map<VectorXd> RES(xnew, npar), resi(res, nd);
+  VectorXd &B = hess_Bv; B.setZero();
   int npen = dregul.nreg;
 
     
   /* --- other arrays and constants --- */
 
-  double *tmp1 = new double [npen]();
+  workspace(wtmp1, std::max(npen, 1));
+  double *tmp1 = &wtmp1[0];
   
   /* --- 
      compute the Hessian matrix and the right-hand side of eq.: 
@@ -1192,15 +1438,12 @@ void clm::compute_trial3(double *res, double **rf, double lambda,
        --- */
 
     for(int yy = 0; yy<npar; yy++){
-      for(int xx = 0; xx<npar; xx++){
+      for(int xx = 0; xx<=yy; xx++){
 	
 	for(int jj=0; jj<npen; jj++)
 	  tmp1[jj] = dregul.dreg[jj][xx] * dregul.dreg[jj][yy]; // L.t # L = L # L.t
 	
-	LL(yy,xx) = sumarr(tmp1, npen);
-
-	//LL(yy,xx) = dregul.LL[yy][xx];//sumarr(tmp1, npen);
-
+	LL(yy,xx) = LL(xx,yy) = sumarr(tmp1, npen);
       }//xx
       
       for(int jj=0;jj<npen; jj++)
@@ -1209,6 +1452,7 @@ void clm::compute_trial3(double *res, double **rf, double lambda,
       B[yy] = -sumarr(tmp1, npen); 
     }//yy
   }
+
   
   for(int yy = 0; yy<npar; yy++){
 
@@ -1228,45 +1472,91 @@ void clm::compute_trial3(double *res, double **rf, double lambda,
     /* --- There are claims that it works better to store the 
        largest diagonal terms in this cycle and multiply lambda 
        by this value than the current estimate. Avoids parameter
-       evaporation.
+       evaporation. Without svd_scaled it is updated in every trial.
        --- */
     
-    diag[yy] = std::max(A(yy,yy), diag[yy]*0.4);
-
-    if(dregul.to_reg){
-      for(int xx=0;xx<npar;xx++) A(yy,xx) += LL(yy,xx);
-      //A(yy,yy) += lambda * LL(yy,yy);
-    }
-
-    
-    /* --- Damp the diagonal of A --- */
-    if(dregul.to_reg)
-      A(yy,yy) += lambda * (diag[yy] + LL(yy,yy));//A(yy,yy);
-    else
-      A(yy,yy) += lambda * diag[yy];
-    //if(!dregul.to_reg)
-    //A(yy,yy) += lambda * diag[yy];
-
+    hess_JJ[yy] = A(yy,yy);
+    if(svd_scaled) diag[yy] = std::max(A(yy,yy), diag[yy]*0.4);
 
     
     /* --- Compute J * Residue --- */
     
     for(int ww = 0; ww<nd; ww++) tmp[ww] = rf[yy][ww] * res[ww];
     B[yy] += sumarr_4(&tmp[0], nd);
-
     
   } // yy
 
-  delete [] tmp1;
+  if(dregul.to_reg) A += LL;
+  hess_reg = dregul.to_reg;
+
+  if(!svd_scaled) return;
+  
+
+  /* --- 
+     Only the diagonal damping term depends on lambda: A + lambda * D.
+     Scaling the system with S = D^-1/2 turns it into S*A*S + lambda * I, 
+     so one eigen-decomposition of S*A*S gives the decomposition of the 
+     system for any lambda:  S*A*S + lambda * I = V * (E + lambda) * V.T
+     --- */
+
+  for(int yy = 0; yy<npar; yy++){
+    double dd = diag[yy] + ((dregul.to_reg) ? LL(yy,yy) : 0.0);
+    hess_S[yy] = ((dd > 0.0) ? 1.0 / sqrt(dd) : 0.0);
+    hess_B[yy] = hess_S[yy] * B[yy];
+  }
+
+  for(int yy = 0; yy<npar; yy++)
+    for(int xx = 0; xx<npar; xx++) A(yy,xx) *= hess_S[yy] * hess_S[xx];
   
+  hess_eig.compute(A);
+  hess_V = hess_eig.eigenvectors();
+  hess_E = hess_eig.eigenvalues();
+}
+
+/* -------------------------------------------------------------------------------- */
+
+void clm::compute_trial3(double lambda, double *x, double *xnew)
+{
+
   /* --- 
-     Solve linear system with SVD decomposition and singular value thresholding.
-     The SVD is computed with Eigen3 instead of LaPack.
+     Solve the damped linear system with singular value thresholding.
+
+     svd_scaled == 0: damp the diagonal of the system assembled in
+     compute_hessian and compute its SVD, as in the original implementation.
+
+     svd_scaled == 1: use the eigen-decomposition of the scaled system computed
+     in compute_hessian. The singular values of the damped system are E + lambda
+     and U = V.
      --- */
-  //Ap = A;
-  //JacobiSVD<Matrix<double,Dynamic, Dynamic, RowMajor>,ColPivHouseholderQRPreconditioner> svd(A, ComputeThinU | ComputeThinV);
-  BDCSVD<Matrix<double,Dynamic, Dynamic, RowMajor>> svd(A,Eigen::ComputeThinU | Eigen::ComputeThinV);
+  
+  if(trial_W.size() != npar) trial_W.resize(npar), trial_sgn.resize(npar), nalloc++;
+  VectorXd &W = trial_W, &sgn = trial_sgn;
+  MatrixXd &V = ((svd_scaled) ? hess_V : hess_Vd);
+  
+  if(svd_scaled){
+    for(int j=0;j<npar;j++){
+      double w = hess_E[j] + lambda;
+      W[j] = fabs(w), sgn[j] = ((w < 0.0) ? -1.0 : 1.0);
+    }
+  }else{
 
+    /* --- Damp the diagonal of A --- */
+
+    hess_Ad = hess_A;
+    for(int yy = 0; yy<npar; yy++){
+      diag[yy] = std::max(hess_JJ[yy], diag[yy]*0.4);
+      hess_Ad(yy,yy) += lambda * (diag[yy] + ((hess_reg) ? hess_LL(yy,yy) : 0.0));
+    }
+    
+    hess_svd.compute(hess_Ad, ComputeThinU | ComputeThinV);
+    hess_U = hess_svd.matrixU(), V = hess_svd.matrixV();
+    W = hess_svd.singularValues();
+    
+    if(nvar == 1){
+      hess_svd.setThreshold(svd_thres);
+      Map<VectorXd>(xnew, npar) = hess_svd.solve(hess_Bv);
+    }
+  }
 
   
   if(nvar > 1){
@@ -1274,9 +1564,6 @@ void clm::compute_trial3(double *res, double **rf, double lambda,
     /* --- Use decomposition of parameters as SIR --- */
     double ww[npar], wt[npar], wi[npar][2];
 
-    MatrixXd U = svd.matrixU(), V = svd.matrixV();
-    VectorXd W = svd.singularValues();
-
     /* --- 
        Two steps, the second is recomputed with the filtered singular values 
        --- */
@@ -1326,44 +1613,35 @@ void clm::compute_trial3(double *res, double **rf, double lambda,
       else                        W[j] = 0.0;
     }
     
+  }else if(svd_scaled){
 
-    /* --- Now solve the linear system --- */
-    
-    memcpy(xnew, &B[0], npar*sizeof(double));
-    backSub(npar, U, W, V,  xnew);
+    /* --- Relative threshold of the singular values, as in Eigen's SVD solve --- */
     
-    
-  }else{
-    svd.setThreshold(svd_thres);
-    RES = svd.solve(B);
+    double wmax = W.maxCoeff() * svd_thres;
+    for(int j=0;j<npar;j++) if(W[j] <= wmax) W[j] = 0.0;
   }
-  //double relative_error = (A*RES - B).norm() / B.norm();
-  //fprintf(stderr,"The relative error is: %e\n", relative_error);
-  tmp1 = new double [npar]();
 
-  for(int yy=0; yy<nd; yy++){
-    for(int xx=0;xx<npar;xx++) tmp1[xx] = rf[xx][yy] * RES[xx];
-    TT[yy] = sumarr(tmp1, npar);
-  }
+
+  /* --- Now solve the linear system (and undo the scaling) --- */
+
+  if(svd_scaled){
+    for(int j=0;j<npar;j++) W[j] *= sgn[j];
     
-  delete [] tmp1;
-  // q = (resi-TT).norm()/resi.norm();
+    memcpy(xnew, &hess_B[0], npar*sizeof(double));
+    backSub(npar, V, W, V,  xnew);
+    for(int j=0;j<npar;j++) xnew[j] *= hess_S[j];
+  }else if(nvar > 1){
+    memcpy(xnew, &hess_Bv[0], npar*sizeof(double));
+    backSub(npar, hess_U, W, V,  xnew);
+  }
+  
 
   /* --- 
      New estimate of the parameters, xnew = x + dx.
      Check for maximum change, add to current pars and normalize.
      --- */
   
-  //scaleParameters(xnew);
   checkMaxChange(xnew, x);
-
-  /* --- Use low curvature acceleration? (testing!) --- */
-  
-  // if(use_geo_accel > 0){
-  //  //svd.setThreshold(1.e-3);
-  //   geoAcceleration(x, xnew, 0.3, svd, LL, res, mydat, dregul, rf, fx, lambda);
-  // }
-  
   
   for(int ii = 0; ii<npar; ii++) xnew[ii] += x[ii];
 
@@ -1382,7 +1660,7 @@ void clm::compute_trial3(double *res, double **rf, double lambda,
 void clm::backSub(int n, MatrixXd &u, VectorXd &w, MatrixXd &v,  double *b)
 {
 
-  double *tmp = new double [n];
+  double tmp[n];
   
   for(int j = 0; j<n; j++){
     if(w[j] != 0.0){
@@ -1398,8 +1676,6 @@ void clm::backSub(int n, MatrixXd &u, VectorXd &w, MatrixXd &v,  double *b)
     for(int jj=0;jj<n;jj++) s += v(j,jj)*tmp[jj];
     b[j] = s;
   }
-    
-  delete [] tmp;
 }
 
 /* -------------------------------------------------------------------------------- */
@@ -17,6 +17,15 @@
       xtol       = 1.e-5  -> Min relative change in Chi2
       maxreject  = 6      -> Allowed number of consecutive 
                              changes to lambda when iterations fail.
+      svd_scaled = 0      -> 0: every lambda trial damps and decomposes the
+                             system and thresholds its singular values.
+                             1: the system is scaled by D^-1/2 and decomposed
+                             once per line search, the thresholds act on the
+                             scaled eigenvalues.
+      broyden_n  = 0      -> Max. consecutive iterations where the Jacobian is a 
+                             Broyden update of the previous one (0 = off).
+      broyden_thres = 0.5 -> Min. ratio of actual/predicted chi2 reduction
+                             needed to keep updating the Jacobian.
 
     USER FUNCT: The user must provide a function that will compute RF and the residues.
                 It will take the following pars:
@@ -110,9 +119,33 @@ class clm{
   std::vector<double> diag, tmp, bestSyn, iSyn;
   std::vector<unsigned> ptype, ntype;
   std::vector<std::vector<unsigned>> pidx;
+  Eigen::MatrixXd hess_V;                  // Eigenvectors of the scaled Hessian
+  Eigen::VectorXd hess_E, hess_B, hess_S;  // Eigenvalues, scaled RHS and scaling of the system
+  Eigen::MatrixXd hess_Ad, hess_U, hess_Vd; // Damped system and its SVD (svd_scaled == 0)
+  Eigen::VectorXd hess_JJ;                 // Diagonal of J.T # J (svd_scaled == 0)
+  Eigen::BDCSVD<Eigen::MatrixXd> hess_svd;
+  bool hess_reg;
   bool verb, regularize, first;
   double xtol, chi2_thres, svd_thres, lfac, lmax, lmin, ilambda, regul_scal, regul_scal_in, reset_par, corr, q, tchi;
   int maxreject, proc, nvar, use_geo_accel, delay_bracket;
+  int svd_scaled;                 // Threshold the SVD of the D^-1/2 scaled system, D updated once per line search
+  int broyden_n, njac, nbroyden;  // Quasi-Newton control and counters of the last fitdata call
+  int niter, nreject;             // LM iterations and rejected steps of the last fitdata call
+  double broyden_thres;
+  double deadline;                // wall-clock time [s] at which fitdata stops (<= 0: no limit)
+  bool timedout;                  // the last fitdata call was stopped by the deadline
+
+  
+  /* --- Workspaces, allocated on the first call of fitdata and reused 
+     afterwards. nalloc counts how many times they had to be (re)allocated --- */
+  
+  double **wrf;
+  std::vector<double> wres, wbest, wxnew, wnres, wtrial, wbx, wbsyn, wdx, wores, wtmp1, ilamb, ichi;
+  reg_t wreg, wreg_trial, wreg_best;
+  Eigen::MatrixXd hess_A, hess_LL;
+  Eigen::VectorXd hess_Bv, trial_W, trial_sgn;
+  Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> hess_eig;
+  long nalloc;
 
   
   /* --- Constructor / Destructor --- */
@@ -137,15 +170,23 @@ class clm{
 			       clm_func fx, reg_t &regul, double rchi2, bool braket = true);
   //  void compute_trial3(double *res, double **rf, double lambda,
   //	      double *x, double *xnew);
-  void compute_trial3(double *res, double **rf, double lambda,
-		      double *x, double *xnew, reg_t &regul, void *mydat, clm_func fx);
+  void compute_hessian(double *res, double **rf, reg_t &regul);
+  bool checkBroyden(double *res, double **rf, double *x, double *xnew, double *dx,
+		    double ochi2, double nchi2, int nbseq);
+  void broydenUpdate(double **rf, double *ores, double *res, double *dx);
+  void compute_trial3(double lambda, double *x, double *xnew);
   //void backsub(double **u, double *w, double **v, int n,
   //	       double *b, double *x);
   void scaleRF(double **rf);
   double checkLambda(double lamb);
   void zero(double *res, double **rf);
   void getParTypes();
+  void setWorkspace(reg_t &regul);
+  void workspace(std::vector<double> &w, size_t n);
+  void workspace(reg_t &w, const reg_t &in);
   void backSub(int n, Eigen::MatrixXd &u, Eigen::VectorXd &w, Eigen::MatrixXd &v,  double *b);
+  int getNd() const {return nd;};
+  int getNpar() const {return npar;};
   //void geoAcceleration(double *x, double *dx, double h,  Eigen::BDCSVD<Eigen::Matrix<double,Dynamic, Dynamic, RowMajor>> &A, Eigen::Matrix<double,Dynamic, Dynamic, RowMajor &LL,
   //  		       double *res, void *mydat, reg_t &dregul, double **rf, clm_func fx, double lam);
 
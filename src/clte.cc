@@ -267,6 +267,17 @@ double clte::lte_opac(double temp, double n_u, double gf, double elow, double nu
 // Synthesize profiles given a depth-stratified model
 // -------------------------------------------------------------------------
 bool clte::synth(mdepth &m, double *syn, int computing_derivatives, cprof_solver sol, bool store_pops){
+
+  /* --- Syntheses (mode 2) can run in single precision, the derivatives
+     by finite differences need double --- */
+  
+  if((input.mode == 2) && (input.lte_precision == 1) && (!computing_derivatives))
+    return synth_prof(sprof, m, syn, sol);
+  
+  return synth_prof(prof, m, syn, sol);
+}
+
+template <typename T> bool clte::synth_prof(cprofiles_t<T> &prof, mdepth &m, double *syn, cprof_solver sol){
   string inam = "clte::synth: ";
   
   int ndep =   m.ndep;
@@ -280,17 +291,17 @@ bool clte::synth(mdepth &m, double *syn, int computing_derivatives, cprof_solver
 
   
   /* --- Init sizes --- */
-  vector<double> scatt;
-  scatt.resize(nw);
+  vector<double> scatt, cop;
+  scatt.resize(nw), cop.resize(nw);
   
   double lineop = 0;
   double damping = 0;
 
-  vector<float> part, frac;
-  float na, ne;
+  vector<double> part, frac;
+  double na, ne, t0;
   
   prof.sf.resize(ndep);
-  memset(&prof.sf[0], 0, ndep*sizeof(double));
+  memset(&prof.sf[0], 0, ndep*sizeof(T));
   memset(&scatt[0], 0, nw*sizeof(double));
   
   /* --- Loop in height and get things that depend on the EOS --- */
@@ -302,7 +313,10 @@ bool clte::synth(mdepth &m, double *syn, int computing_derivatives, cprof_solver
     eos->read_partial_pressures(k, frac, part, na, ne);
     
     /* --- Campute contop. for all lambdas --- */
-    eos->contOpacity(m.temp[k], nw,  &lambda[0], &prof.mki[k][0], &scatt[0], frac, na, ne);
+    t0 = pixstat::getTime();
+    eos->contOpacity(m.temp[k], nw,  &lambda[0], &cop[0], &scatt[0], frac, na, ne);
+    for(int w=0; w<nw; w++) prof.mki[k][w] = cop[w]; // T can be float
+    stats[ps_t_background] += pixstat::getTime(t0);
 
     
     /* --- Store output for later, remember that eos.fract is in fact 
@@ -340,6 +354,7 @@ bool clte::synth(mdepth &m, double *syn, int computing_derivatives, cprof_solver
 
   
   /* --- Loop regions and compute profiles for each wavelength--- */
+  t0 = pixstat::getTime();
   for(auto &it: input.regions){
     for(int w = 0; w< it.nw; w++){ // Loop lambda
       prof.set_zero();
@@ -350,7 +365,7 @@ bool clte::synth(mdepth &m, double *syn, int computing_derivatives, cprof_solver
 	prof.sf[k] = prof.plank_nu(it.nu[w], m.temp[k]);
 
 	/* --- Normalize elements of the abs. Matrix by ki and store in the vector version of the matrix elements --- */
-	double iki =  prof.mki[k][w+it.off];
+	T iki =  prof.mki[k][w+it.off];
 	prof.ki[k] = iki;
 	prof.kq[k] = prof.mkq[k][w+it.off] / iki;
 	prof.ku[k] = prof.mku[k][w+it.off] / iki;
@@ -379,12 +394,12 @@ bool clte::synth(mdepth &m, double *syn, int computing_derivatives, cprof_solver
       
     } // w
   } // regions
+  stats[ps_t_formal] += pixstat::getTime(t0);
 
   
-  /* --- Deallocate profiles --- */
+  /* --- The profile matrices are kept for the next call, 
+     prof.init only reallocates them if the dimensions change --- */
   
-  prof.cleanup();
-
   return true;
 }
 
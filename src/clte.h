@@ -7,7 +7,8 @@
   
   DEPENDENCIES: cprofiles, ceos, input
   
-  MODIFICATIONS: -
+  MODIFICATIONS: 
+           2026-10-19: Single-precision syntheses (lte_precision = single)
 
 */
 #ifndef CLTE_H
@@ -38,6 +39,7 @@ class clte: public atmos{
   /* --- Other objects included --- */
   //ceos eos; // Now ncluded in atmos base class
   cprofiles prof;
+  cprofiles_t<float> sprof; // used in mode 2 with lte_precision = single
   
   /* --- Constructor/Destructor --- */
   // clte(){};
@@ -48,12 +50,14 @@ class clte: public atmos{
  inline double lte_opac(double temp, double n_u, double gf, double elow, double nu0);
  //void synth(mdepth_t &m, mat<double> &syn, cprof_solver sol = bez_z);
   bool synth(mdepth &m, double *syn, int computing_derivatives=0, cprof_solver sol = bez_ltau, bool store_pops = true);
+  template <typename T> bool synth_prof(cprofiles_t<T> &prof, mdepth &m, double *syn, cprof_solver sol);
   std::vector<double> get_max_limits(nodes_t &n, int mode);
   std::vector<double> get_min_limits(nodes_t &n, int mode);
  std::vector<double> get_scaling(nodes_t &n, int mode);
  std::vector<double> get_steps(nodes_t &n);
  void cleanup(void){};
  void checkBounds(mdepth_t &m);
+ atmos *newWorker(){return new clte(input, grav);};
 
  
 };
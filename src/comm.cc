@@ -70,66 +70,6 @@ void unpackInstrumentalData(iput_t &input, std::vector<double> const &buff)
     offset += head;
   }
 }
-//
-void comm_get_buffer_size(iput_t &input){
-  int ninstrumentaldata = getNinstrumentData(input.regions);
-  
-  int maxlen = 0;
-  string inam = "comm_get_buffer_size: ";
-  unsigned long ntot, rest, tocom;
-  //
-  switch(input.mode)
-    { 
-    case 1: // Inversion
-      input.buffer_size =
-	(input.nw_tot*4*sizeof(double) +  // Profiles
-	 input.npar*sizeof(double) + // Model
-	 (12 * input.ndep +2+ 1)* sizeof(double) + //non-inverted quantities
-	 2*sizeof(double)) * input.npack + // Chi2, boundary value
-	6*sizeof(int) +      // xx, yy, iproc, pix, action, npacked
-	ninstrumentaldata * sizeof(double);      
-      
-      input.buffer_size1 = input.buffer_size;
-      break;
-      //
-    case 2: // Synthesis
-      input.buffer_size =
-	(13 * input.ndep * sizeof(double)) * input.npack + // depth-stratified quantities
-	6*sizeof(int) + // xx, yy, iproc, pix, action, npacked
-	ninstrumentaldata * sizeof(double);      
-      input.buffer_size1 =
-	(input.nw_tot*4*sizeof(double)) * input.npack + 6*sizeof(int);
-      break;
-      //
-    case 3: // Synthesis + derivatives
-      input.buffer_size =
-	8*sizeof(int) + // xx, yy, iproc, pix, action, npacked, ndep, cgrad
-	input.npar*sizeof(double) * input.npack + // Values of the nodes * npacked
-	1*sizeof(double) + // perturbation to the parameter
-	(12*input.ndep + 1+2)*sizeof(double)*input.npack; // atmospheric model
-      
-      input.buffer_size1 = (input.nw_tot*4*sizeof(double) +                    
-			    input.nw_tot*4*input.npar*sizeof(double) + // Derivatives
-			    1*sizeof(double)) * input.npack +// perturbation to the parameter
-	(13*input.ndep+2)*input.npack*sizeof(double)+ // Send back the pressure scale
-	                    6*sizeof(int); // xx, yy, ipix, npacked, iproc
-
-    case 4:// Synthesis + derivatives at all heights
-      input.buffer_size =
-	(12 * input.ndep * sizeof(double)) * input.npack + // depth-stratified quantities
-	6*sizeof(int)+ninstrumentaldata * sizeof(double);; // xx, yy, iproc, pix, action, npacked
-      
-      input.buffer_size1 = (input.nw_tot*4*sizeof(double) * (input.ndep*input.nresp+1)) + 6*sizeof(int);
-      break;
-    default:
-      cout << input.myid<< inam <<"ERROR, work mode ("<<input.mode<<") not valid"<<endl;
-      exit(0);
-      break;
-    }
-  cout << input.myid << inam << "MPI_buffer_size = "<<input.buffer_size/(8.*1024.)<<" kbytes"<<endl;
-  cout << input.myid << inam << "MPI_buffer_size1 = "<<input.buffer_size1/(8.*1024.)<<" kbytes"<<endl;
-}
-
 //
 void comm_send_parameters(iput_t &input){
 
@@ -141,15 +81,14 @@ void comm_send_parameters(iput_t &input){
   //
   status = MPI_Bcast(&nline,     1,    MPI_INT, 0, MPI_COMM_WORLD);
   status = MPI_Bcast(&nregions,  1,    MPI_INT, 0, MPI_COMM_WORLD);  
-  status = MPI_Bcast(&input.buffer_size,  2,    MPI_UNSIGNED_LONG, 0, MPI_COMM_WORLD);
 
-  status = MPI_Bcast(&input.nt, 39,    MPI_INT, 0, MPI_COMM_WORLD); // We are sending 11 ints from the struct!
-  status = MPI_Bcast(&input.nodes.regul_type, 9,    MPI_INT, 0, MPI_COMM_WORLD); // We are getting 15 ints from the struc
-  status = MPI_Bcast(&input.nodes.rewe, 10,    MPI_DOUBLE, 0, MPI_COMM_WORLD); // We are getting 15 ints from the struct!
+  status = MPI_Bcast(&input.nt, 45,    MPI_INT, 0, MPI_COMM_WORLD); // We are sending 45 ints from the struct!
+  status = MPI_Bcast(&input.nodes.regul_type, 9,    MPI_INT, 0, MPI_COMM_WORLD); // We are sending 9 ints from the struct!
+  status = MPI_Bcast(&input.nodes.rewe, 10,    MPI_DOUBLE, 0, MPI_COMM_WORLD); // We are sending 10 doubles from the struct!
   // status = MPI_Bcast(&input.nodes.nregul,     1,    MPI_INT, 0, MPI_COMM_WORLD);
 
 
-  status = MPI_Bcast(&input.mu,  8, MPI_DOUBLE, 0, MPI_COMM_WORLD); // We are sending 4 doubles from the struct!
+  status = MPI_Bcast(&input.mu, 12, MPI_DOUBLE, 0, MPI_COMM_WORLD); // We are sending 12 doubles from the struct!
   status = MPI_Bcast(&input.max_inv_iter,  1, MPI_UNSIGNED, 0, MPI_COMM_WORLD);
     
   //int dummy = (int)input.verbose;
@@ -251,16 +190,15 @@ void comm_recv_parameters(iput_t &input){
   int status=0, nline=0, nregions=0;
   status = MPI_Bcast(&nline,     1,    MPI_INT, 0, MPI_COMM_WORLD);
   status = MPI_Bcast(&nregions,  1,    MPI_INT, 0, MPI_COMM_WORLD);
-  status = MPI_Bcast(&input.buffer_size,  2,    MPI_UNSIGNED_LONG, 0, MPI_COMM_WORLD);
-  status = MPI_Bcast(&input.nt, 39,    MPI_INT, 0, MPI_COMM_WORLD); // We are getting 15 ints from the struct!
+  status = MPI_Bcast(&input.nt, 45,    MPI_INT, 0, MPI_COMM_WORLD); // We are getting 45 ints from the struct!
 
-  status = MPI_Bcast(&input.nodes.regul_type, 9,    MPI_INT, 0, MPI_COMM_WORLD); // We are getting 15 ints from the struct!
-  status = MPI_Bcast(&input.nodes.rewe, 10,    MPI_DOUBLE, 0, MPI_COMM_WORLD); // We are getting 15 ints from the struct!
+  status = MPI_Bcast(&input.nodes.regul_type, 9,    MPI_INT, 0, MPI_COMM_WORLD); // We are getting 9 ints from the struct!
+  status = MPI_Bcast(&input.nodes.rewe, 10,    MPI_DOUBLE, 0, MPI_COMM_WORLD); // We are getting 10 doubles from the struct!
 
   // status = MPI_Bcast(&input.nodes.nregul,     1,    MPI_INT, 0, MPI_COMM_WORLD);
 
 
-  status = MPI_Bcast(&input.mu,  8, MPI_DOUBLE, 0, MPI_COMM_WORLD); // We are getting 4 doubles from the struct!
+  status = MPI_Bcast(&input.mu, 12, MPI_DOUBLE, 0, MPI_COMM_WORLD); // We are getting 12 doubles from the struct!
   status = MPI_Bcast(&input.max_inv_iter,  1, MPI_UNSIGNED, 0, MPI_COMM_WORLD);
 
   //int dummy = 0;
@@ -385,709 +323,478 @@ void comm_recv_parameters(iput_t &input){
 
   
 }
+/* --- 
+   Pixel packages are described with derived datatypes (MPI_Type_create_struct)
+   that point straight into the arrays of the sender and of the receiver 
+   (absolute addresses relative to MPI_BOTTOM), so they are sent and received 
+   in place, without an intermediate pack buffer. Each package is preceded by 
+   a small header with the number of pixels and their location, that the 
+   receiver needs to allocate its arrays and build its own datatype.
+
+   Tags: 1 (header) and 2 (data) from the master to the slaves,
+         3 (header) and 4 (data) from the slaves to the master.
+   --- */
+
+enum comm_hdr{ch_action, ch_npacked, ch_ipix, ch_xx, ch_yy, ch_cgrad, ch_ninst, ch_nhdr};
+
+struct comm_package{
+  std::vector<int> len;
+  std::vector<MPI_Aint> disp;
+  std::vector<MPI_Datatype> type, tofree;
+  MPI_Datatype dtype;
+
+  comm_package(): dtype(MPI_DATATYPE_NULL){};
+  ~comm_package(){
+    for(auto &it: tofree) MPI_Type_free(&it);
+    if(dtype != MPI_DATATYPE_NULL) MPI_Type_free(&dtype);
+  }
+
+  
+  /* --- n elements of type t starting at ptr --- */
+  
+  void add(const void *ptr, int n, MPI_Datatype t = MPI_DOUBLE){
+    if(n <= 0) return;
+    MPI_Aint addr;
+    MPI_Get_address(ptr, &addr);
+    len.push_back(n), disp.push_back(addr), type.push_back(t);
+  }
+
+  
+  /* --- n blocks of bl doubles, separated by stride doubles --- */
+  
+  void add_strided(const double *ptr, int n, int bl, int stride){
+    if((n <= 1) || (stride == bl)){
+      add(ptr, n*bl);
+      return;
+    }
+    MPI_Datatype vt;
+    MPI_Type_vector(n, bl, stride, MPI_DOUBLE, &vt);
+    tofree.push_back(vt);
+    add(ptr, 1, vt);
+  }
+
+  
+  /* --- Committed datatype of the whole package --- */
+  
+  MPI_Datatype &get(){
+    int n = (int)len.size();
+    MPI_Type_create_struct(n, ((n>0)? &len[0] : NULL), ((n>0)? &disp[0] : NULL),
+			   ((n>0)? &type[0] : NULL), &dtype);
+    MPI_Type_commit(&dtype);
+    return dtype;
+  }
+};
+
 void comm_master_pack_data(iput_t &input, mat<double> &obs, mat<double> &model,
 			   unsigned long &ipix, int proc, mdepthall_t &m, int cgrad,
-			   int action){
+			   int action, MPI_Comm comm){
   string inam = "comm_pack_data: ";
-  double dum[m.ndep];
-  memset(dum, 0, m.ndep * sizeof(double));
-
-  // Buffer to pack the data
-  //char buffer[input.buffer_size];
-  char *buffer = new char [input.buffer_size]; 
-  MPI_Request request = {};
-  int status;
-  int pos = 0;
   int xx, yy;
-  unsigned long len = 0;
-  //
-  unsigned long ntot = input.nx * input.ny;
+  unsigned long ntot = (unsigned long)model.size(0) * model.size(1); // pixels in the map (or block)
 
-  status = MPI_Pack(&action, 1,     MPI_INT, &buffer[0], input.buffer_size, &pos, MPI_COMM_WORLD);
-  //
   int init = ipix;
   int end  = min(ipix + input.npack-1, ntot-1); 
   int nPacked = end - init + 1;
-  //
-  status = MPI_Pack(&nPacked, 1,     MPI_INT, &buffer[0], input.buffer_size, &pos, MPI_COMM_WORLD);
-  //
-  switch(input.mode)
-    {
-    case 1:
-      {
-	/* ---  Pack all pixels --- */
-	comm_get_xy(ipix, model.size(1), yy, xx);
-	
-	status = MPI_Pack(&ipix  , 1,     MPI_INT, &buffer[0], input.buffer_size,
-			  &pos, MPI_COMM_WORLD);
-	status = MPI_Pack(&xx    , 1,     MPI_INT, &buffer[0], input.buffer_size,
-			  &pos, MPI_COMM_WORLD);
-	status = MPI_Pack(&yy    , 1,     MPI_INT, &buffer[0], input.buffer_size,
-			  &pos, MPI_COMM_WORLD);
-	
-	/* --- Pack model and obs --- */
-	int len = nPacked * input.ns * input.nw_tot;
-	status = MPI_Pack(&obs(yy,xx,0,0), len,  MPI_DOUBLE, &buffer[0],
-			  input.buffer_size, &pos, MPI_COMM_WORLD);
-	
-	len = nPacked * input.npar;
-	status = MPI_Pack(&model(yy,xx,0), len,  MPI_DOUBLE, &buffer[0],
-			  input.buffer_size, &pos, MPI_COMM_WORLD);
-	
+  comm_get_xy(ipix, model.size(1), yy, xx);
 
-	/* --- Pack full stratified atmos ---*/
-	len = m.ndep * nPacked * 12;
-	status = MPI_Pack(&m.cub(yy,xx,0,0), len, MPI_DOUBLE, &buffer[0],
-			  input.buffer_size, &pos, MPI_COMM_WORLD);
-	
-	len = nPacked;
-	status = MPI_Pack(&m.boundary(yy,xx), len, MPI_DOUBLE, &buffer[0],
-			  input.buffer_size, &pos, MPI_COMM_WORLD);
-	//
-	ipix += nPacked; // Increase the pixel count
-
-	// --- Instrumental profiles --- //
-	{
-	  
-	  vector<double> ires = packInstrumentalData(input, yy, xx);
-	  len = unsigned(ires.size());
-	  status = MPI_Pack(&ires[0], len, MPI_DOUBLE, &buffer[0],
-			  input.buffer_size, &pos, MPI_COMM_WORLD);
-	}
-	break;
-      }
-    case 2:
-      { // Synthesis
-
-
-	/* ---  Pack all pixels --- */
-	comm_get_xy(ipix, model.size(1), yy, xx);
-	status = MPI_Pack(&ipix  , 1,     MPI_INT, &buffer[0], input.buffer_size,
-			  &pos, MPI_COMM_WORLD);
-	status = MPI_Pack(&xx    , 1,     MPI_INT, &buffer[0], input.buffer_size,
-			  &pos, MPI_COMM_WORLD);
-	status = MPI_Pack(&yy    , 1,     MPI_INT, &buffer[0], input.buffer_size,
-			  &pos, MPI_COMM_WORLD);
+  
+  /* --- The model cube can have more than 12 variables per pixel (e.g. 13 if it was 
+     read with read_model2), only the first 12 are sent --- */
+  
+  int mlen = 12 * m.ndep, mstride = ((m.cub.ndims() == 4) ? (int)m.cub.size(2) : 12) * m.ndep;
 
-	
-	/* --- Pack full stratified atmos ---*/
-	len = m.ndep * nPacked * 12;
-	status = MPI_Pack(&m.cub(yy,xx,0,0), len, MPI_DOUBLE, &buffer[0],
-			  input.buffer_size, &pos, MPI_COMM_WORLD);
+  
+  /* --- Instrumental profiles, the first element is the total length --- */
+  
+  vector<double> ires;
+  if((input.mode == 1) || (input.mode == 2) || (input.mode == 4))
+    ires = packInstrumentalData(input, yy, xx);
+  
+  int hdr[ch_nhdr] = {action, nPacked, (int)ipix, xx, yy, cgrad, std::max<int>(0, int(ires.size())-1)};
 
-	
+  
+  /* --- Package: pointers to the data of these pixels --- */
 
-	/* --- Increment pixel count --- */
-	ipix += nPacked;
-	// --- Instrumental profiles --- //
-	{
-	  vector<double> ires = packInstrumentalData(input, yy, xx);
-	  len = unsigned(ires.size());
-	  status = MPI_Pack(&ires[0], len, MPI_DOUBLE, &buffer[0],
-			  input.buffer_size, &pos, MPI_COMM_WORLD);
-	}
-	break;
-      }
-    case 3:
-      { //Synthesis + Derivatives
-	comm_get_xy(ipix, model.size(1), yy, xx);
-	
-	/* --- Pack data: ipix, xx, yy, compute_grad (?) --- */
-	int pint[4] = {(int)ipix, (int)xx, (int)yy, (int)cgrad};
-	status = MPI_Pack(&pint[0]       , 4,     MPI_INT,    &buffer[0],
-			  input.buffer_size, &pos, MPI_COMM_WORLD);
-	status = MPI_Pack(&input.dpar    , 1,     MPI_DOUBLE, &buffer[0],
-			  input.buffer_size, &pos, MPI_COMM_WORLD);
-	
-	/* --- Pack node values --- */
-	len = input.npar * nPacked;
-	status = MPI_Pack(&model(yy,xx,0), len, MPI_DOUBLE, &buffer[0],
-			  input.buffer_size, &pos, MPI_COMM_WORLD);
-
-	/* --- Pack full stratified atmos ---*/
-	len = m.ndep * nPacked * 12;
-	status = MPI_Pack(&m.cub(yy,xx,0,0), len, MPI_DOUBLE, &buffer[0],
-			  input.buffer_size, &pos, MPI_COMM_WORLD);
-
-	len = nPacked;
-	status = MPI_Pack(&m.boundary(yy,xx), len, MPI_DOUBLE, &buffer[0],
-			  input.buffer_size, &pos, MPI_COMM_WORLD);
-	
-	/* --- Increase the count --- */
-	ipix += nPacked; // Increase the pixel count
-       
-	break;
-      }
-    case 4:
-      { // synthesis + derivatives at all heights
-	comm_get_xy(ipix, model.size(1), yy, xx);
-	int pint[3] = {(int)ipix, (int)xx, (int)yy};
-	status = MPI_Pack(&pint[0]       , 3,     MPI_INT,    &buffer[0],
-			  input.buffer_size, &pos, MPI_COMM_WORLD);
-
-	/* --- pack ful model --- */
-	len = input.ndep * 12*nPacked;
-	status = MPI_Pack(&m.cub(yy,xx,0,0), len, MPI_DOUBLE, &buffer[0],
-			  input.buffer_size, &pos, MPI_COMM_WORLD);
-	ipix += nPacked; // Increase the pixel count
-
-	// --- Instrumental profiles --- //
-	{
-	  vector<double> ires = packInstrumentalData(input, yy, xx);
-	  len = unsigned(ires.size());
-	  status = MPI_Pack(&ires[0], len, MPI_DOUBLE, &buffer[0],
-			  input.buffer_size, &pos, MPI_COMM_WORLD);
-	}
-	
-	break;
-      }
+  comm_package pkg;
+  
+  switch(input.mode)
+    {
+    case 1: // Inversion
+      pkg.add(&obs(yy,xx,0,0), nPacked * input.ns * input.nw_tot);
+      pkg.add(&model(yy,xx,0), nPacked * input.npar);
+      pkg.add_strided(&m.cub(yy,xx,0,0), nPacked, mlen, mstride);
+      pkg.add(&m.boundary(yy,xx), nPacked);
+      break;
+    case 2: // Synthesis
+      pkg.add_strided(&m.cub(yy,xx,0,0), nPacked, mlen, mstride);
+      break;
+    case 3: // Synthesis + Derivatives
+      pkg.add(&input.dpar, 1);
+      pkg.add(&model(yy,xx,0), nPacked * input.npar);
+      pkg.add_strided(&m.cub(yy,xx,0,0), nPacked, mlen, mstride);
+      pkg.add(&m.boundary(yy,xx), nPacked);
+      break;
+    case 4: // synthesis + derivatives at all heights
+      pkg.add_strided(&m.cub(yy,xx,0,0), nPacked, mlen, mstride);
+      break;
     } // Switch case
 
+  if(hdr[ch_ninst] > 0) pkg.add(&ires[1], hdr[ch_ninst]);
   
-  /* ---  Send data to slave --- */
-  
-  status = MPI_Send(&buffer[0], input.buffer_size, MPI_PACKED, proc, 1, MPI_COMM_WORLD);
-
-  delete [] buffer;
+  ipix += nPacked; // Increase the pixel count
 
+  
+  /* ---  Send header and data to slave --- */
+  
+  MPI_Send(hdr, ch_nhdr, MPI_INT, proc, 1, comm);
+  MPI_Send(MPI_BOTTOM, 1, pkg.get(), proc, 2, comm);
 }
 
-void comm_slave_unpack_data(iput_t &input, int &action, mat<double> &obs, mat<double> &pars, vector<mdepth_t> &m, int &cgrad){
+void comm_slave_unpack_data(iput_t &input, int &action, mat<double> &obs, mat<double> &pars, vector<mdepth_t> &m, int &cgrad,
+			    MPI_Comm comm){
   string inam = "comm_slave_unpack_data: ";
 
-  //char buffer[input.buffer_size];
-  char *buffer = NULL;
-
-  int  pos = 0, tag = 0;
-  MPI_Status ierr = {}, stat = {};
-  int nPacked, nbuff=0, status = 0;
-  unsigned long len;
+  MPI_Status stat = {};
+  int hdr[ch_nhdr] = {};
   
 
-  /* --- Get DATA from master ---*/
+  /* --- Get the header from master ---*/
   
-  //int status = MPI_Recv(buffer, input.buffer_size, MPI_PACKED, 0, 1, MPI_COMM_WORLD, &ierr);
-
   while(1){
-    int from_process = MPI_ANY_SOURCE, msg_tag = 1, flag = 0;
-    MPI_Iprobe(from_process, msg_tag, MPI_COMM_WORLD, &flag, &stat);
+    int flag = 0;
+    MPI_Iprobe(0, 1, comm, &flag, &stat);
     
     if(flag > 0){
-      MPI_Get_count(&stat, MPI_CHAR, &nbuff);
-      from_process = stat.MPI_SOURCE;
-      tag = stat.MPI_TAG;
-      buffer = new char [nbuff]();
-      status = MPI_Recv(buffer, nbuff, MPI_PACKED, from_process, 1, MPI_COMM_WORLD, &ierr);
+      MPI_Recv(hdr, ch_nhdr, MPI_INT, 0, 1, comm, &stat);
       break;
     }
 
     std::this_thread::sleep_for(std::chrono::microseconds(1000)); // Avoid polling all the time!
-
   }
-    
 
-  /* --- Unpack action --- */
+  action = hdr[ch_action];
+  if(action != 1) return;
+
   
-  status = MPI_Unpack(buffer, input.buffer_size, &pos, &action, 1, MPI_INT, MPI_COMM_WORLD );
+  /* --- Allocate the arrays of this package --- */
   
-  if(action == 1){
+  int nPacked = hdr[ch_npacked], ndep = input.ndep, mlen = 12 * ndep;
+  input.nPacked = nPacked;
+  input.ipix = hdr[ch_ipix], input.xx = hdr[ch_xx], input.yy = hdr[ch_yy];
 
-    // Check mode and do whatever is required
-    switch(input.mode)
-      {
-      case 1:
-	{
-	  // Number of packed pixels
-	  status = MPI_Unpack(buffer, input.buffer_size, &pos, &nPacked, 1,
-			      MPI_INT, MPI_COMM_WORLD );
-	  
-
-	  input.chi.resize(nPacked);
-	  input.nPacked = nPacked;
-	  
-	  // Allocate arrays for data
-	  obs.set({nPacked, input.nw_tot, input.ns});
-	  pars.set({nPacked, input.npar});
-	  m.resize(nPacked);
-	  int ndep = input.ndep;
-	  for(auto &it: m) {
-	    it.setsize(ndep);
-	    it.zero();
-	  }
-	  
-	  // unpack ints
-	  status = MPI_Unpack(buffer, input.buffer_size, &pos, &input.ipix, 1,
-			      MPI_INT, MPI_COMM_WORLD );
-	  status = MPI_Unpack(buffer, input.buffer_size, &pos, &input.xx,   1,
-			      MPI_INT, MPI_COMM_WORLD );
-	  status = MPI_Unpack(buffer, input.buffer_size, &pos, &input.yy,   1,
-			      MPI_INT, MPI_COMM_WORLD );
-	  
-	  // Unpack arrays
-	  len = nPacked * input.nw_tot * input.ns;
-	  status = MPI_Unpack(buffer, input.buffer_size, &pos, &obs.d[0], len,
-			      MPI_DOUBLE, MPI_COMM_WORLD );
-	  
-	  len = nPacked * input.npar;
-	  status = MPI_Unpack(buffer, input.buffer_size, &pos, &pars.d[0],  len,
-			      MPI_DOUBLE, MPI_COMM_WORLD );
-	  
-	  
-	   /* --- Unpack model atmosphere --- */
-	  len = 12 * input.ndep;
-	  for(auto &it: m){
-	    it.setsize(input.ndep);
-	    status = MPI_Unpack(buffer, input.buffer_size, &pos, &it.cub.d[0], len,
-				MPI_DOUBLE, MPI_COMM_WORLD );
-
-	  }
-
-	  for(auto &it: m)
-	    status = MPI_Unpack(buffer, input.buffer_size, &pos, &it.bound_val, (int)1,
-				MPI_DOUBLE, MPI_COMM_WORLD );
-	  
-
-
-	  {
-	    double bla = 0.0;
-	    status = MPI_Unpack(buffer, input.buffer_size, &pos, &bla, (int)1,
-				MPI_DOUBLE, MPI_COMM_WORLD );
-	    long ndata = long(bla+0.1);
-	    
-	    if(ndata > 0){
-	      std::vector<double> dat(ndata-1, 0.0);
-	      status = MPI_Unpack(buffer, input.buffer_size, &pos, &dat[0], (int)ndata-1,
-				  MPI_DOUBLE, MPI_COMM_WORLD );
-	      
-	    
-	      unpackInstrumentalData(input, dat);
-	    }
-	  }
-	  
-	  break;
-	}
-      case 2:
-	  // Number of packed pixels
-	  status = MPI_Unpack(buffer, input.buffer_size, &pos, &nPacked, 1,
-			      MPI_INT, MPI_COMM_WORLD );
-	  
-
-	  input.nPacked = nPacked;
-	  
-
-	  
-	  // unpack ints
-	  status = MPI_Unpack(buffer, input.buffer_size, &pos, &input.ipix, 1,
-			      MPI_INT, MPI_COMM_WORLD );
-	  status = MPI_Unpack(buffer, input.buffer_size, &pos, &input.xx,   1,
-			      MPI_INT, MPI_COMM_WORLD );
-	  status = MPI_Unpack(buffer, input.buffer_size, &pos, &input.yy,   1,
-			      MPI_INT, MPI_COMM_WORLD );
-	  
-	  
-	  /* --- Unpack model atmosphere --- */
-	  
-	  len = 12 * input.ndep;
-	  m.resize(nPacked);
-	  obs.set({nPacked, input.nw_tot, input.ns});
-	  
-	  for(auto &it: m){
-	    it.setsize(input.ndep);
-	    status = MPI_Unpack(buffer, input.buffer_size, &pos, &it.cub.d[0], len,
-				MPI_DOUBLE, MPI_COMM_WORLD );
-	  }
-
-	  {
-	    double bla = 0.0;
-	    status = MPI_Unpack(buffer, input.buffer_size, &pos, &bla, (int)1,
-				MPI_DOUBLE, MPI_COMM_WORLD );
-	    long ndata = long(bla+0.1);
-	    
-	    if(ndata > 0){
-	      std::vector<double> dat(ndata-1, 0.0);
-	      status = MPI_Unpack(buffer, input.buffer_size, &pos, &dat[0], (int)ndata-1,
-				  MPI_DOUBLE, MPI_COMM_WORLD );
-	      
-	      unpackInstrumentalData(input, dat);
-	    }
-	  }
-	break;
-      case 3: // Synthesize + derivatives
-	{
-	  /* --- Number of packed pixels --- */
-	  status = MPI_Unpack(buffer, input.buffer_size, &pos, &nPacked, 1, MPI_INT, MPI_COMM_WORLD );
-	  input.nPacked = nPacked;
-
-	  
-	  /* --- Allocate arrays for data --- */
-	  obs.set({nPacked, input.nw_tot, input.ns});
-	  obs.zero();
-	  pars.set({nPacked, input.npar});
-	  m.resize(nPacked);
-	  
-	  
-	  /* --- unpack scalars --- */
-	  status = MPI_Unpack(buffer, input.buffer_size, &pos, &input.ipix, 1,
-			      MPI_INT, MPI_COMM_WORLD );
-	  status = MPI_Unpack(buffer, input.buffer_size, &pos, &input.xx,   1,
-			      MPI_INT, MPI_COMM_WORLD );
-	  status = MPI_Unpack(buffer, input.buffer_size, &pos, &input.yy,   1,
-			      MPI_INT, MPI_COMM_WORLD );
-	  status = MPI_Unpack(buffer, input.buffer_size, &pos, &cgrad,      1,
-			      MPI_INT, MPI_COMM_WORLD );
-	  status = MPI_Unpack(buffer, input.buffer_size, &pos, &input.dpar, 1,
-			      MPI_DOUBLE, MPI_COMM_WORLD );
-	  
-	  /* ---  Model parameters --- */
-	  len = input.npar*nPacked;
-	  status = MPI_Unpack(buffer, input.buffer_size, &pos, &pars.d[0], len,
-			      MPI_DOUBLE, MPI_COMM_WORLD );
-
-	  
-	  /* --- Unpack model atmosphere --- */
-	  len = 12 * input.ndep;
-	  for(auto &it: m){
-	    it.setsize(input.ndep);
-	    status = MPI_Unpack(buffer, input.buffer_size, &pos, &it.cub.d[0], len,
-				MPI_DOUBLE, MPI_COMM_WORLD );
-	  }
-
-	  for(auto &it: m)
-	    status = MPI_Unpack(buffer, input.buffer_size, &pos, &it.bound_val, (int)1,
-				MPI_DOUBLE, MPI_COMM_WORLD );
-	    
-	  
-	  break;
-	}
-      case 4:
-	status = MPI_Unpack(buffer, input.buffer_size, &pos, &nPacked, 1, MPI_INT, MPI_COMM_WORLD );
-	input.nPacked = nPacked;
-	m.resize(nPacked);
-
-	obs.set({nPacked, input.nw_tot, input.ns});
-	status = MPI_Unpack(buffer, input.buffer_size, &pos, &input.ipix, 1,
-			    MPI_INT, MPI_COMM_WORLD );
-	status = MPI_Unpack(buffer, input.buffer_size, &pos, &input.xx,   1,
-			    MPI_INT, MPI_COMM_WORLD );
-	status = MPI_Unpack(buffer, input.buffer_size, &pos, &input.yy,   1,
-			    MPI_INT, MPI_COMM_WORLD );
-
-	len = 12 * input.ndep;
-	for(auto &it: m){
-	  it.setsize(input.ndep);
-	  status = MPI_Unpack(buffer, input.buffer_size, &pos, &it.cub.d[0], len,
-			      MPI_DOUBLE, MPI_COMM_WORLD );
-	}
-	{
-	  double bla = 0.0;
-	  status = MPI_Unpack(buffer, input.buffer_size, &pos, &bla, (int)1,
-			      MPI_DOUBLE, MPI_COMM_WORLD );
-	  long ndata = long(bla+0.1);
-	  
-	  if(ndata > 0){
-	    std::vector<double> dat(ndata-1, 0.0);
-	    status = MPI_Unpack(buffer, input.buffer_size, &pos, &dat[0], (int)ndata-1,
-				MPI_DOUBLE, MPI_COMM_WORLD );
-	    
-	    unpackInstrumentalData(input, dat);
-	  }
-	}
-	
-	break;
-      }
-  } // action = 1
-    
-    
-  delete [] buffer;
+  m.resize(nPacked);
+  for(auto &it: m) it.setsize(ndep);
+  
+  if(input.mode != 4) obs.set({nPacked, input.nw_tot, input.ns});
+  
+  vector<double> dat(hdr[ch_ninst], 0.0);
+  comm_package pkg;
+
+  switch(input.mode)
+    {
+    case 1:
+      input.chi.resize(nPacked);
+      input.tel.resize(nPacked);
+      pars.set({nPacked, input.npar});
+      for(auto &it: m) it.zero();
+      
+      pkg.add(&obs.d[0], nPacked * input.nw_tot * input.ns);
+      pkg.add(&pars.d[0], nPacked * input.npar);
+      for(auto &it: m) pkg.add(&it.cub.d[0], mlen);
+      for(auto &it: m) pkg.add(&it.bound_val, 1);
+      break;
+    case 2:
+      for(auto &it: m) pkg.add(&it.cub.d[0], mlen);
+      break;
+    case 3: // Synthesize + derivatives
+      obs.zero();
+      pars.set({nPacked, input.npar});
+      cgrad = hdr[ch_cgrad];
+      
+      pkg.add(&input.dpar, 1);
+      pkg.add(&pars.d[0], nPacked * input.npar);
+      for(auto &it: m) pkg.add(&it.cub.d[0], mlen);
+      for(auto &it: m) pkg.add(&it.bound_val, 1);
+      break;
+    case 4:
+      obs.set({nPacked, input.nw_tot, input.ns});
+      for(auto &it: m) pkg.add(&it.cub.d[0], mlen);
+      break;
+    }
+
+  if(hdr[ch_ninst] > 0) pkg.add(&dat[0], hdr[ch_ninst]);
+  
+
+  /* --- Receive the data in place --- */
+  
+  MPI_Recv(MPI_BOTTOM, 1, pkg.get(), 0, 2, comm, &stat);
+
+  if(hdr[ch_ninst] > 0) unpackInstrumentalData(input, dat);
 }
 
 
-void comm_master_unpack_data(int &iproc, iput_t input, mat<double> &obs, mat<double> &pars, mat<double> &chi2, unsigned long &irec, mat<double> &dsyn, int cgrad, mdepthall_t &m){
+bool comm_master_probe(int &iproc, MPI_Comm comm){
+
+  /* --- Is there a processed package from any slave? Does not receive it --- */
   
-  // char buffer[input.buffer_size];
-  char *buffer;// = new char [input.buffer_size1];
+  MPI_Status stat = {};
+  int flag = 0;
   
-  int  pos = 0;
-  int nPacked = 0, nbuff=0, tag = 0;
-  int status = 0;
-  MPI_Status ierr = {}, stat = {};
-  unsigned long len;
+  MPI_Iprobe(MPI_ANY_SOURCE, 3, comm, &flag, &stat);
+  if(flag > 0) iproc = stat.MPI_SOURCE;
+
+  return (flag > 0);
+}
 
-  // Get buffer from the slave
-  //status = MPI_Recv(buffer, input.buffer_size1, MPI_PACKED, MPI_ANY_SOURCE,
-  //		    MPI_ANY_TAG, MPI_COMM_WORLD, &ierr);
 
+void comm_master_unpack_data(int &iproc, iput_t input, mat<double> &obs, mat<double> &pars, mat<double> &chi2, mat<double> &tel, unsigned long &irec, mat<double> &dsyn, int cgrad, mdepthall_t &m, int src,
+			     MPI_Comm comm){
+  
+  MPI_Status stat = {};
+  int hdr[3] = {};
+
+  
+  /* --- Get the header from any slave (or from src): nPacked, iproc and ipix --- */
+  
   while(1){
-    int from_process = MPI_ANY_SOURCE, msg_tag = MPI_ANY_TAG, flag = 0;
-    MPI_Iprobe(from_process, msg_tag, MPI_COMM_WORLD, &flag, &stat);
+    int flag = 0;
+    MPI_Iprobe(src, 3, comm, &flag, &stat);
     
     if(flag > 0){
-      MPI_Get_count(&stat, MPI_CHAR, &nbuff);
-      from_process = stat.MPI_SOURCE;
-      tag = stat.MPI_TAG;
-      
-      buffer = new char [nbuff]();
-      status = MPI_Recv(buffer, nbuff, MPI_PACKED, from_process, tag, MPI_COMM_WORLD, &ierr);
+      MPI_Recv(hdr, 3, MPI_INT, stat.MPI_SOURCE, 3, comm, &stat);
       break;
     }
 
     std::this_thread::sleep_for(std::chrono::microseconds(40)); // Avoid polling all the time
-    
   }
 
+  int nPacked = hdr[0], pix = hdr[2], xx, yy;
+  int nx = ((input.mode == 1) || (input.mode == 2)) ? input.nx : (int)obs.size(1);
+  int mlen = 12 * input.ndep;
+  iproc = hdr[1];
+  comm_get_xy(pix, nx, yy, xx);
 
   
-  // Get nPacked
-  status = MPI_Unpack(buffer, input.buffer_size1, &pos, &nPacked, 1, MPI_INT,
-		      MPI_COMM_WORLD );
-
-  // Get iproc
-  status = MPI_Unpack(buffer, input.buffer_size1, &pos, &iproc, 1, MPI_INT,
-		      MPI_COMM_WORLD );
-
+  /* --- Package: pointers to the results of these pixels --- */
+  
+  comm_package pkg;
+  
   switch(input.mode)
     {
     case 1:
       {
-	// Unpack pixel data
-	//for(int pp = 0; pp<nPacked;pp++){
-	int pix, xx, yy;
-	status = MPI_Unpack(&buffer[0], input.buffer_size1, &pos, &pix, 1,
-			    MPI_INT, MPI_COMM_WORLD );
-	comm_get_xy(pix, input.nx, yy, xx);
-	
-	status = MPI_Unpack(&buffer[0], input.buffer_size1, &pos, &chi2(yy,xx),
-			    nPacked, MPI_DOUBLE, MPI_COMM_WORLD );
-	len = input.nw_tot * input.ns * nPacked;
-	status = MPI_Unpack(&buffer[0], input.buffer_size1, &pos, &obs(yy,xx,0,0),
-			    len, MPI_DOUBLE, MPI_COMM_WORLD );
-
-  
-	len = input.npar*nPacked;
-	status = MPI_Unpack(&buffer[0], input.buffer_size1, &pos, &pars(yy,xx,0),
-			    len, MPI_DOUBLE, MPI_COMM_WORLD );
-	irec += nPacked;
-
-	len = input.ndep*12;
-	for(int ii=0;ii<nPacked;ii++){
-	  comm_get_xy(pix++, input.nx, yy, xx);
-	  status = MPI_Unpack(buffer, input.buffer_size1, &pos, &m.cub(yy,xx,0,0),
-			      len, MPI_DOUBLE, MPI_COMM_WORLD);
-	  
-	  status = MPI_Unpack(buffer, input.buffer_size1, &pos, &m.tr_loc(yy,xx),
-			      1, MPI_DOUBLE, MPI_COMM_WORLD);
-	  status = MPI_Unpack(buffer, input.buffer_size1, &pos, &m.tr_amp(yy,xx),
-			      1, MPI_DOUBLE, MPI_COMM_WORLD);
-	  
+	pkg.add(&chi2(yy,xx), nPacked);
+	pkg.add(&tel(yy,xx,0), nPacked*ps_nstat);
+	pkg.add(&obs(yy,xx,0,0), input.nw_tot * input.ns * nPacked);
+	pkg.add(&pars(yy,xx,0), input.npar*nPacked);
+
+	for(int ii=0, ipp=pix; ii<nPacked; ii++){
+	  int iyy, ixx;
+	  comm_get_xy(ipp++, nx, iyy, ixx);
+	  pkg.add(&m.cub(iyy,ixx,0,0), mlen);
+	  pkg.add(&m.tr_loc(iyy,ixx), 1);
+	  pkg.add(&m.tr_amp(iyy,ixx), 1);
 	}
 	break;
       }
     case 2:
-      {
-	
-	int pix, xx, yy;
-	status = MPI_Unpack(&buffer[0], input.buffer_size1, &pos, &pix, 1,
-			    MPI_INT, MPI_COMM_WORLD );
-	comm_get_xy(pix, input.nx, yy, xx);
-	
-	len = input.nw_tot * input.ns * nPacked;
-	status = MPI_Unpack(&buffer[0], input.buffer_size1, &pos, &obs(yy,xx,0,0),
-			    len, MPI_DOUBLE, MPI_COMM_WORLD );
-
-  
-	irec += nPacked;
-	
-	break;
-      }
+      pkg.add(&obs(yy,xx,0,0), input.nw_tot * input.ns * nPacked);
+      break;
     case 3:
       {
-	// for(int pp = 0; pp<nPacked;pp++){
-	int pix, xx, yy, nx;
-	nx = (int)obs.size(1);
-	
-	status = MPI_Unpack(buffer, input.buffer_size1, &pos, &pix, 1, MPI_INT,
-			    MPI_COMM_WORLD );
-	comm_get_xy(pix, nx, yy, xx);
+	pkg.add(&obs(yy,xx,0,0), input.nw_tot * input.ns * nPacked);
 	
-	len = input.nw_tot * input.ns * nPacked;
-	status = MPI_Unpack(buffer, input.buffer_size1, &pos, &obs(yy,xx,0,0), len,
-			    MPI_DOUBLE, MPI_COMM_WORLD );
-
-	len = input.ndep*12+2;
-	int mypix = pix, iyy=0, ixx=0;
-	
-	for(int ii = 0; ii< nPacked;ii++){
-	  comm_get_xy(mypix++, nx, iyy, ixx);
-	  status = MPI_Unpack(buffer, input.buffer_size1, &pos, &m.cub(yy,xx,0,0),
-			      len, MPI_DOUBLE, MPI_COMM_WORLD);
-	  status = MPI_Unpack(buffer, input.buffer_size1, &pos, &m.tr_loc(yy,xx),
-			      1, MPI_DOUBLE, MPI_COMM_WORLD);
-	  status = MPI_Unpack(buffer, input.buffer_size1, &pos, &m.tr_amp(yy,xx),
-			      1, MPI_DOUBLE, MPI_COMM_WORLD);
-	  //cerr<<mypix-1<<" "<<iyy<<" "<<ixx<<endl;
+	for(int ii=0, ipp=pix; ii<nPacked; ii++){
+	  int iyy, ixx;
+	  comm_get_xy(ipp++, nx, iyy, ixx);
+	  pkg.add(&m.cub(iyy,ixx,0,0), mlen);
+	  pkg.add(&m.tr_loc(iyy,ixx), 1);
+	  pkg.add(&m.tr_amp(iyy,ixx), 1);
 	}
-	  
-	if(cgrad > 0){
-	  len = input.nw_tot * input.ns * input.npar * nPacked;
-	  status = MPI_Unpack(buffer, input.buffer_size1, &pos, &dsyn(yy,xx,0,0,0), len,
-			      MPI_DOUBLE, MPI_COMM_WORLD);
-	}
-	
-	irec += nPacked;
 	
+	if(cgrad > 0) pkg.add(&dsyn(yy,xx,0,0,0), input.nw_tot * input.ns * input.npar * nPacked);
 	break;
       }
     case 4:
-      {
-	int pix, xx, yy, nx;
-	nx = (int)obs.size(1);
-	status = MPI_Unpack(buffer, input.buffer_size1, &pos, &pix, 1, MPI_INT,
-			    MPI_COMM_WORLD );
-	comm_get_xy(pix, nx, yy, xx);
-	
-	len = input.nw_tot * input.ns * nPacked;
-	status = MPI_Unpack(buffer, input.buffer_size1, &pos, &obs(yy,xx,0,0), len,
-			    MPI_DOUBLE, MPI_COMM_WORLD );
-	
-	len = input.nw_tot * input.ns * input.ndep * input.nresp * nPacked;
-	status = MPI_Unpack(buffer, input.buffer_size1, &pos, &dsyn(yy,xx,0,0,0,0), len,
-			    MPI_DOUBLE, MPI_COMM_WORLD);
-	
-	irec += nPacked;
-
-	break;
-      }
+      pkg.add(&obs(yy,xx,0,0), input.nw_tot * input.ns * nPacked);
+      pkg.add(&dsyn(yy,xx,0,0,0,0), input.nw_tot * input.ns * input.ndep * input.nresp * nPacked);
+      break;
     default:
       break;
     }
+
   
+  /* --- Receive the data in place, from the same slave --- */
+  
+  MPI_Recv(MPI_BOTTOM, 1, pkg.get(), iproc, 4, comm, &stat);
+  irec += nPacked;
+}
+
+
+void comm_master_discard_data(int iproc, MPI_Comm comm){
 
-  delete [] buffer;
+  /* --- Receive and drop a package from slave iproc, used for the late copies
+     of re-issued packages. All the results are doubles, so the data message
+     is received as a plain array of doubles --- */
+  
+  MPI_Status stat = {};
+  int hdr[3] = {}, ndat = 0;
+
+  MPI_Recv(hdr, 3, MPI_INT, iproc, 3, comm, &stat);
+  
+  MPI_Probe(iproc, 4, comm, &stat);
+  MPI_Get_count(&stat, MPI_DOUBLE, &ndat);
   
+  vector<double> dat(std::max<int>(1, ndat));
+  MPI_Recv(&dat[0], ndat, MPI_DOUBLE, iproc, 4, comm, &stat);
 }
 
 
-void comm_slave_pack_data(iput_t &input, mat<double> &obs, mat<double> &pars, mat<double> &dobs, int cgrad, vector<mdepth_t> &m){
+void comm_slave_pack_data(iput_t &input, mat<double> &obs, mat<double> &pars, mat<double> &dobs, int cgrad, vector<mdepth_t> &m,
+			  MPI_Comm comm){
 
-  char *buffer = new char [input.buffer_size1];
+  int nPacked = input.nPacked, rank = 0;
+  MPI_Comm_rank(comm, &rank);
+  int hdr[3] = {nPacked, rank, input.ipix};
+  int mlen = input.ndep*12;
 
-  int  pos = 0;
-  int nPacked = input.nPacked;
-  unsigned long len;
-  //
-  int status = MPI_Pack(&nPacked, 1,     MPI_INT, &buffer[0], input.buffer_size1,
-			&pos, MPI_COMM_WORLD);
-  status = MPI_Pack(&input.myrank, 1,     MPI_INT, &buffer[0], input.buffer_size1,
-		    &pos, MPI_COMM_WORLD);
+  
+  /* --- Package: pointers to the results of these pixels --- */
 
+  comm_package pkg;
+  
   switch(input.mode)
     {
     case 1:
-      status = MPI_Pack(&input.ipix, 1,   MPI_INT, &buffer[0], input.buffer_size1,
-			&pos, MPI_COMM_WORLD);
-      
-      status = MPI_Pack(&input.chi[0], nPacked, MPI_DOUBLE, &buffer[0], input.buffer_size1,
-			&pos, MPI_COMM_WORLD);
-      //   for(int pp = 0; pp<nPacked; pp++){
-	
-      len = input.nw_tot*input.ns*nPacked;
-      status = MPI_Pack(&obs.d[0], len,  MPI_DOUBLE, &buffer[0], input.buffer_size1,
-			&pos, MPI_COMM_WORLD);
-
-      
-      len = input.npar * nPacked;
-      status = MPI_Pack(&pars.d[0], len,  MPI_DOUBLE, &buffer[0], input.buffer_size1,
-			&pos, MPI_COMM_WORLD);
-      
-      // model
-      len = input.ndep*12+2;
+      pkg.add(&input.chi[0], nPacked);
+      pkg.add(&input.tel[0].d[0], nPacked*ps_nstat);
+      pkg.add(&obs.d[0], input.nw_tot*input.ns*nPacked);
+      pkg.add(&pars.d[0], input.npar * nPacked);
       for(int pp=0; pp<nPacked; pp++){
-	vector<double> vec = m[pp].model2vector();
-	status = MPI_Pack(&vec[0], len,  MPI_DOUBLE, &buffer[0], input.buffer_size1,
-			  &pos, MPI_COMM_WORLD);
+	pkg.add(&m[pp].cub.d[0], mlen);
+	pkg.add(&m[pp].tr_loc, 1);
+	pkg.add(&m[pp].tr_amp, 1);
       }
       break;
       
     case 2:
-
-      status = MPI_Pack(&input.ipix, 1,   MPI_INT, &buffer[0], input.buffer_size1,
-			&pos, MPI_COMM_WORLD);
-      	
-      len = input.nw_tot*input.ns*nPacked;
-      status = MPI_Pack(&obs.d[0], len,  MPI_DOUBLE, &buffer[0], input.buffer_size1,
-			&pos, MPI_COMM_WORLD);
-
-      
+      pkg.add(&obs.d[0], input.nw_tot*input.ns*nPacked);
       break;
       
     case 3:
-      //  for(int pp = 0; pp<nPacked; pp++){
-      status = MPI_Pack(&input.ipix, 1,   MPI_INT, &buffer[0], input.buffer_size1, &pos, MPI_COMM_WORLD);
-      
-      // Synthetic profiles
-      len = input.nw_tot*input.ns*nPacked;
-      status = MPI_Pack(&obs.d[0], len,  MPI_DOUBLE, &buffer[0], input.buffer_size1, &pos, MPI_COMM_WORLD);
-
-      // gas pressure
-      len = input.ndep*12+2;
+      pkg.add(&obs.d[0], input.nw_tot*input.ns*nPacked);
       for(int pp=0; pp<nPacked; pp++){
-	vector<double> vec = m[pp].model2vector();
-	status = MPI_Pack(&vec[0], len,  MPI_DOUBLE, &buffer[0], input.buffer_size1,
-			  &pos, MPI_COMM_WORLD);
-      }
-      
-      // Derivatives
-      if(cgrad > 0){
-	len = input.nw_tot*input.ns*input.npar*nPacked;
-	status = MPI_Pack(&dobs.d[0], len,  MPI_DOUBLE, &buffer[0], input.buffer_size1, &pos, MPI_COMM_WORLD);
+	pkg.add(&m[pp].cub.d[0], mlen);
+	pkg.add(&m[pp].tr_loc, 1);
+	pkg.add(&m[pp].tr_amp, 1);
       }
+      if(cgrad > 0) pkg.add(&dobs.d[0], input.nw_tot*input.ns*input.npar*nPacked);
       break;
 
     case 4:
-      {
-	status = MPI_Pack(&input.ipix, 1,   MPI_INT, &buffer[0], input.buffer_size1, &pos, MPI_COMM_WORLD);
-	// Synthetic profiles
-	len = input.nw_tot*input.ns*nPacked;
-	status = MPI_Pack(&obs.d[0], len,  MPI_DOUBLE, &buffer[0], input.buffer_size1, &pos, MPI_COMM_WORLD);
-	len = input.nw_tot*input.ns*input.ndep*input.nresp*nPacked;
-	status = MPI_Pack(&dobs.d[0], len,  MPI_DOUBLE, &buffer[0], input.buffer_size1, &pos, MPI_COMM_WORLD);
-
-	
-	break;
+      pkg.add(&obs.d[0], input.nw_tot*input.ns*nPacked);
+      pkg.add(&dobs.d[0], input.nw_tot*input.ns*input.ndep*input.nresp*nPacked);
+      break;
       
-      }
     default:
       break;
     } // Switch case
 
   
-  /* --- Send data to master --- */
+  /* --- Send header and data to master --- */
   
-  status = MPI_Send(&buffer[0], input.buffer_size1, MPI_PACKED, 0, 3, MPI_COMM_WORLD);
-
-  delete [] buffer;
-
+  MPI_Send(hdr, 3, MPI_INT, 0, 3, comm);
+  MPI_Send(MPI_BOTTOM, 1, pkg.get(), 0, 4, comm);
 }
 
 
 
-void comm_kill_slaves(iput_t &input, int nprocs){
-  char buffer[input.buffer_size];
-  int  pos = 0;
-  int action = 0;
+void comm_kill_slaves(iput_t &input, int nprocs, MPI_Comm comm){
+  int hdr[ch_nhdr] = {};
   string inam = "comm_kill_slaves: ";
   
-  // Pack kill command
-  int status = MPI_Pack(&action, 1,     MPI_INT, &buffer[0], input.buffer_size, &pos, MPI_COMM_WORLD);
-  
-  // Send kill command to slaves
-  for(int ss = 1; ss<nprocs; ss++) status = MPI_Send(&buffer[0], input.buffer_size, MPI_PACKED, ss, 1, MPI_COMM_WORLD);
+  // Send kill command (action = 0) to slaves, or to the sub-masters that pass it on
+  if(input.workers.size() > 0)
+    for(auto &ss: input.workers) MPI_Send(hdr, ch_nhdr, MPI_INT, ss, 1, comm);
+  else
+    for(int ss = 1; ss<nprocs; ss++) MPI_Send(hdr, ch_nhdr, MPI_INT, ss, 1, comm);
 
+  if(comm != MPI_COMM_WORLD) return;
+  
   cout << " "<<endl;
   cout << input.myid << inam << "Killing slaves" << endl;
 }
 
 
+MPI_Comm comm_split_groups(iput_t &input, int myrank, int nprocs, int &gslaves){
+
+  /* --- Two-level master (master_groups != 0). The slaves are split in groups 
+     and the first rank of each group becomes a sub-master: it gets blocks of 
+     pixels from rank 0 and distributes them among the other ranks of the group, 
+     through the communicator of the group. master_groups > 0 makes that many 
+     groups of consecutive ranks, master_groups < 0 one group per node.
+
+     Returns the communicator that this rank uses to talk to its master: 
+     MPI_COMM_WORLD without groups (or for a group of one rank, which works as
+     a plain slave of rank 0), the communicator of the group otherwise, and 
+     MPI_COMM_NULL in rank 0. In rank 0, input.workers gets the ranks that 
+     talk to it, input.submasters those of them that are sub-masters and 
+     gslaves the largest number of slaves of a sub-master --- */
+  
+  gslaves = 0;
+  input.workers.clear();
+  input.submasters.clear();
+
+  int ngroups = input.master_groups;
+  if(ngroups > 0) ngroups = std::min(ngroups, (nprocs-1) / 2);
+  
+  if((ngroups == 0) || (nprocs < 3) || !((input.mode == 1) || (input.mode == 2) || (input.mode == 4)))
+    return ((myrank == 0) ? MPI_COMM_NULL : MPI_COMM_WORLD);
+
+  
+  MPI_Comm gcomm = MPI_COMM_NULL;
+  
+  if(ngroups > 0){
+    int color = ((myrank == 0) ? MPI_UNDEFINED : (int)((long(myrank-1) * ngroups) / (nprocs-1)));
+    MPI_Comm_split(MPI_COMM_WORLD, color, myrank, &gcomm);
+  }else
+    MPI_Comm_split_type(MPI_COMM_WORLD, ((myrank == 0) ? MPI_UNDEFINED : MPI_COMM_TYPE_SHARED),
+			myrank, MPI_INFO_NULL, &gcomm);
+
+  
+  /* --- Role of each rank: size of the group for a sub-master, 1 for a
+     slave of rank 0, 0 for the slaves of a sub-master --- */
+  
+  int role = 0, grank = 0, gsize = 1;
+  
+  if(gcomm != MPI_COMM_NULL){
+    MPI_Comm_rank(gcomm, &grank);
+    MPI_Comm_size(gcomm, &gsize);
+    
+    if(gsize == 1){
+      MPI_Comm_free(&gcomm);
+      gcomm = MPI_COMM_WORLD;
+      role = 1;
+    }else role = ((grank == 0) ? gsize : 0);
+  }
+  
+  vector<int> roles((myrank == 0) ? nprocs : 1, 0);
+  MPI_Gather(&role, 1, MPI_INT, &roles[0], 1, MPI_INT, 0, MPI_COMM_WORLD);
+
+  if(myrank == 0){
+    for(int ss = 1; ss<nprocs; ss++){
+      if(roles[ss] > 0) input.workers.push_back(ss);
+      if(roles[ss] > 1) input.submasters.push_back(ss);
+      gslaves = std::max(gslaves, roles[ss] - 1);
+    }
+    cout << input.myid << "comm_split_groups: " << input.workers.size() << " sub-masters/slaves talk to rank 0, up to "
+	 << gslaves << " slaves per sub-master" << endl;
+  }
+  
+  return gcomm;
+}
+
+
 void comm_send_weights(iput_t &input, mat<double> &w){
 
   if(input.myrank > 0) w.set({input.nw_tot, input.ns});  
@@ -19,20 +19,26 @@ inline void comm_get_xy(const int t, const int nx, int &y, int &x){
   x = t - (y*nx); 
 }
 //
-void comm_get_buffer_size(iput_t &input);
 void comm_send_parameters(iput_t &input);
 void comm_recv_parameters(iput_t &input);
 void comm_master_pack_data(iput_t &input, mat<double> &obs, mat<double> &model, 
-			   unsigned long &ipix, int proc, mdepthall_t &m, int cgrad, int action = 1);
+			   unsigned long &ipix, int proc, mdepthall_t &m, int cgrad, int action = 1,
+			   MPI_Comm comm = MPI_COMM_WORLD);
 //void comm_master_unpack_data(int &iproc, iput_t input, mat<double> &obs, 
 //			     mat<double> &pars, mat<double> &chi2);
 void comm_master_unpack_data(int &iproc, iput_t input, mat<double> &obs, 
-			     mat<double> &pars, mat<double> &chi2, unsigned long &irec,
-			     mat<double> &dobs, int cgrad, mdepthall_t &m);
+			     mat<double> &pars, mat<double> &chi2, mat<double> &tel, unsigned long &irec,
+			     mat<double> &dobs, int cgrad, mdepthall_t &m, int src = MPI_ANY_SOURCE,
+			     MPI_Comm comm = MPI_COMM_WORLD);
+bool comm_master_probe(int &iproc, MPI_Comm comm = MPI_COMM_WORLD);
+void comm_master_discard_data(int iproc, MPI_Comm comm = MPI_COMM_WORLD);
 
-void comm_slave_unpack_data(iput_t &input, int &action, mat<double> &obs, mat<double> &pars, std::vector<mdepth_t> &m, int &cgrad);
-void comm_kill_slaves(iput_t &input, int nprocs);
-void comm_slave_pack_data(iput_t &input, mat<double> &obs, mat<double> &pars, mat<double> &dobs, int cgrad, std::vector<mdepth_t> &m); 
+void comm_slave_unpack_data(iput_t &input, int &action, mat<double> &obs, mat<double> &pars, std::vector<mdepth_t> &m, int &cgrad,
+			    MPI_Comm comm = MPI_COMM_WORLD);
+void comm_kill_slaves(iput_t &input, int nprocs, MPI_Comm comm = MPI_COMM_WORLD);
+void comm_slave_pack_data(iput_t &input, mat<double> &obs, mat<double> &pars, mat<double> &dobs, int cgrad, std::vector<mdepth_t> &m,
+			  MPI_Comm comm = MPI_COMM_WORLD);
+MPI_Comm comm_split_groups(iput_t &input, int myrank, int nprocs, int &gslaves);
 void comm_send_weights(iput_t &input, mat<double> &w);
 int getNinstrumentData(std::vector<region_t> const &reg);
 
@@ -55,5 +55,15 @@ void cop(double T, double TKEV, double TK, double HKT, double TLOG,
 	 double CA1, double CA2, double MG1, double MG2, double FE1,
 	 double N1, double O1, int nWLGRID, int NLINES, int NTOTALLIST);
 
+/* --- Reference implementation, evaluating every term per wavelength --- */
+
+void cop_direct(double T, double TKEV, double TK, double HKT, double TLOG,
+		double XNA, double XNE, double *WLGRID, double *OPACITY,
+		double *SCATTER,  
+		double H1, double H2, double HMIN, double HE1, double HE2,
+		double HE3, double C1, double AL1, double SI1, double SI2,
+		double CA1, double CA2, double MG1, double MG2, double FE1,
+		double N1, double O1, int nWLGRID, int NLINES, int NTOTALLIST);
+
 
 #endif
@@ -17,7 +17,15 @@ enum cprof_solver{
   lin_z,
 };
 //
-class cprofiles{
+
+/* --- 
+   The opacity matrices, the Voigt-Faraday profiles and the formal solvers 
+   work in floating-point type T: double by default (cprofiles), float for 
+   the single-precision LTE syntheses (lte_precision = single). The atomic 
+   physics (damping, Doppler width, Planck function) stays in double.
+   --- */
+
+template <typename T> class cprofiles_t{
  public:
   static constexpr double A[7] = {122.607931777104326, 214.382388694706425, 181.928533092181549,
 				  93.155580458138441, 30.180142196210589, 5.912626209773153,
@@ -29,17 +37,19 @@ class cprofiles{
   static constexpr double LARMOR= phyc::EE / (4.0 * phyc::PI * phyc::ME * phyc::CC);
 
   int nndep, nnw;
-  std::vector<double> ki, kq, ku, kv, fq, fu, fv, sf;
-  double **mki, **mkq, **mku, **mkv, **mfq, **mfu, **mfv;
+  std::vector<T> ki, kq, ku, kv, fq, fu, fv, sf;
+  std::vector<T> wdtau; // workspace of the formal solvers
+  T **mki, **mkq, **mku, **mkv, **mfq, **mfu, **mfv;
   
-  double voigt[3], faraday[3];
-  typedef double mat4[4][4]; // define a type to pass a matrix as an argument and keep the shape
-  typedef double vect4[4];
+  T voigt[3], faraday[3];
+  typedef T mat4[4][4]; // define a type to pass a matrix as an argument and keep the shape
+  typedef T vect4[4];
   
 
   /* --- methods ---*/
   
-  cprofiles(){};
+  cprofiles_t(): nndep(0), nnw(0), mki(NULL), mkq(NULL), mku(NULL), mkv(NULL),
+	       mfq(NULL), mfu(NULL), mfv(NULL){};
 
   /* 
      --- Voigt-Faraday profiles implemented here to make inlining easier for the compiler --- 
@@ -118,7 +128,7 @@ class cprofiles{
     k[3][3] = 0.0;//ki[idep];
   }
 
-  static void abmat(double ikq, double iku, double ikv, double ifq, double ifu, double ifv, mat4 &k){
+  static void abmat(T ikq, T iku, T ikv, T ifq, T ifu, T ifv, mat4 &k){
     k[0][0] = 0.0;//ki[idep];
     k[0][1] = ikq;//[idep];///ki[idep];
     k[0][2] = iku;//[idep];///ki[idep];
@@ -151,7 +161,7 @@ class cprofiles{
   /* --- matrix multiplication --- */
   
   void m4m(mat4 &a, mat4 &b, mat4 &c){
-    memset(&c[0][0],0,sizeof(double)*16);
+    memset(&c[0][0],0,sizeof(T)*16);
     
     for(int j = 0; j<4; j++)
       for(int i = 0; i<4; i++)
@@ -161,7 +171,7 @@ class cprofiles{
 
   /* --- matrix/vector multiplication --- */
   void m4v(mat4 &a, vect4 &b, vect4 &c){
-    memset(&c[0],0,sizeof(double)*4);
+    memset(&c[0],0,sizeof(T)*4);
     
     for(int i = 0; i<4; i++){
       for(int k = 0; k<4; k++){
@@ -190,7 +200,7 @@ class cprofiles{
   }
 
 
-  template <typename T> inline void solveLinearGauss4x4(T A[4][4], T B[4])
+  inline void solveLinearGauss4x4(T A[4][4], T B[4])
     {
       // --- Inplace simple Gaussian elimination with partial pivoting --- //
       // --- A and B are modified insider the routine, and B contains the --- //
@@ -243,32 +253,33 @@ class cprofiles{
   //----------------------------------------------------------------
   // Constructor
   //----------------------------------------------------------------
-  cprofiles(int nw, int ndep){
-    nnw = 0;
-    nndep = 0;
+  cprofiles_t(int nw, int ndep): cprofiles_t(){
     init(nw, ndep);
   }
 
 
   void init(int nw, int ndep){
 
-    /* --- do not reallocate if already allocated --- */
+    /* --- do not reallocate if already allocated, just zero the matrices --- */
     
-    //if(nnw == nw && nndep == ndep)
-    //  return;
+    if(nnw == nw && nndep == ndep){
+      set_zero_abmat();
+      return;
+    }
 
     /* --- Otherwise allocate everything --- */
-    
+
+    cleanup();
     nndep = ndep;
     nnw = nw;
   
-    mki = (double**)mat2d(ndep, nw);
-    mkq = (double**)mat2d(ndep, nw);
-    mku = (double**)mat2d(ndep, nw);
-    mkv = (double**)mat2d(ndep, nw);
-    mfq = (double**)mat2d(ndep, nw);
-    mfu = (double**)mat2d(ndep, nw);
-    mfv = (double**)mat2d(ndep, nw);
+    mki = mat2d(ndep, nw);
+    mkq = mat2d(ndep, nw);
+    mku = mat2d(ndep, nw);
+    mkv = mat2d(ndep, nw);
+    mfq = mat2d(ndep, nw);
+    mfu = mat2d(ndep, nw);
+    mfv = mat2d(ndep, nw);
 
     ki.resize(ndep);
     kq.resize(ndep);
@@ -282,8 +293,8 @@ class cprofiles{
   //----------------------------------------------------------------
   // Destructor
   //----------------------------------------------------------------
-  ~cprofiles(){
-    //cleanup();
+  ~cprofiles_t(){
+    cleanup();
   }
 
   //----------------------------------------------------------------
@@ -305,6 +316,9 @@ class cprofiles{
     if(mfq != NULL) del_mat(mfq);
     if(mfu != NULL) del_mat(mfu);
     if(mfv != NULL) del_mat(mfv);
+
+    mki = mkq = mku = mkv = mfq = mfu = mfv = NULL;
+    nndep = nnw = 0;
   }
 
 
@@ -326,13 +340,13 @@ class cprofiles{
   // Zero opacity matrices
   //-------------------------------------------------------------------------
   void set_zero_abmat(){
-    memset(&mki[0][0], 0, nndep*nnw*sizeof(double));
-    memset(&mkq[0][0], 0, nndep*nnw*sizeof(double));
-    memset(&mku[0][0], 0, nndep*nnw*sizeof(double));
-    memset(&mkv[0][0], 0, nndep*nnw*sizeof(double));
-    memset(&mfq[0][0], 0, nndep*nnw*sizeof(double));
-    memset(&mfu[0][0], 0, nndep*nnw*sizeof(double));
-    memset(&mfv[0][0], 0, nndep*nnw*sizeof(double));
+    memset(&mki[0][0], 0, nndep*nnw*sizeof(T));
+    memset(&mkq[0][0], 0, nndep*nnw*sizeof(T));
+    memset(&mku[0][0], 0, nndep*nnw*sizeof(T));
+    memset(&mkv[0][0], 0, nndep*nnw*sizeof(T));
+    memset(&mfq[0][0], 0, nndep*nnw*sizeof(T));
+    memset(&mfu[0][0], 0, nndep*nnw*sizeof(T));
+    memset(&mfv[0][0], 0, nndep*nnw*sizeof(T));
   }
 
   //-------------------------------------------------------------------------
@@ -542,8 +556,8 @@ class cprofiles{
   void zeeman_profile(double nu, const line_t &line, double vel, double bfield, double dlnu, double damping){
   
     /* --- Init vars --- */
-    memset(&voigt[0],   0, sizeof(double)*3);
-    memset(&faraday[0], 0, sizeof(double)*3);
+    memset(&voigt[0],   0, sizeof(T)*3);
+    memset(&faraday[0], 0, sizeof(T)*3);
 
   
     /* --- From Landi Degl'innocenti 2004, pag. 385, eq. 9.23-9.24 --- */
@@ -623,22 +637,24 @@ class cprofiles{
   //-------------------------------------------------------------------------
   // Delo-Lin formal solver, using z as input
   //-------------------------------------------------------------------------
-  void delolin(int const ndep, double* __restrict__ z, double* __restrict__ stokes, double mu){
+  void delolin(int const ndep, const double* __restrict__ z, double* __restrict__ stokes, double mu){
   
     //  int ndep = (int)z.size();
 
   
-    /* --- Init arrays --- */
-    double* __restrict__ dtau = new double [ndep]();
-    double stk[4];
-    memset(&stk[0],  0, sizeof(double) * 4);
+    /* --- Init arrays, dtau lives in a workspace that only grows --- */
+    if((int)wdtau.size() < ndep) wdtau.resize(ndep);
+    T* __restrict__ dtau = &wdtau[0];
+    memset(dtau, 0, ndep*sizeof(T));
+    T stk[4];
+    memset(&stk[0],  0, sizeof(T) * 4);
 
   
     int k0 = 0, k1 = ndep-1;
-    double itau = 0.0;
+    T itau = 0.0;
 
     /* --- Compute dtau_nu scale using linear approx --- */
-    double imu = fabs(1.0 / mu);
+    T imu = fabs(1.0 / mu);
     for(int k = 1; k<ndep; k++){
       dtau[k] = 0.5 * (ki[k-1] + ki[k]) * fabs(z[k-1] - z[k]) * imu;
       itau += dtau[k];
@@ -650,7 +666,7 @@ class cprofiles{
 
     /* --- Init integration at the lower boundary I = SF --- */
     stk[0] = sf[k1];
-    double Ku[4][4], K0[4][4], Su[4], S0[4];
+    T Ku[4][4], K0[4][4], Su[4], S0[4];
 
   
     /* --- Init source vector & Abs. matrix at upwind point --- */
@@ -667,7 +683,7 @@ class cprofiles{
 
     
       /* --- dtau, exponentials and integration coeffs. --- */
-      double dt = dtau[k1];
+      double dt = dtau[k1]; // coeffs. in double, cancellations for small dt
       double eps = 0.0;
       double cu = 0, c0 = 0;
       //
@@ -689,9 +705,9 @@ class cprofiles{
       }
 
       /* --- Compute terms for the integration --- */
-      double mat1[4][4];
-      double mat2[4][4];
-      double vec1[4] = {};
+      T mat1[4][4];
+      T mat2[4][4];
+      T vec1[4] = {};
 
       //
       for(int j = 0; j<4; j++){
@@ -710,16 +726,15 @@ class cprofiles{
       }
     
       //m4v(mat2, vec1, stk); // Matrix x vector
-      memcpy(stk, vec1, 4*sizeof(double));
+      memcpy(stk, vec1, 4*sizeof(T));
       solveLinearGauss4x4(mat2,stk);
       
       /* --- Copy variables to upwind arrays for next height ---*/
-      memcpy(&Su[0],    &S0[0],     4*sizeof(double));
-      memcpy(&Ku[0][0], &K0[0][0], 16*sizeof(double));
+      memcpy(&Su[0],    &S0[0],     4*sizeof(T));
+      memcpy(&Ku[0][0], &K0[0][0], 16*sizeof(T));
     }
   
-    memcpy(&stokes[0], &stk[0], 4*sizeof(double));
-    delete [] dtau;
+    for(int ss=0; ss<4; ss++) stokes[ss] = stk[ss];
   }
 
   inline static void bez3_coeff(double const &dt, double &alpha, double &beta, double &gamma, double &theta, double &eps)
@@ -774,27 +789,29 @@ class cprofiles{
   //
   // NOTE3: It assumes that kq,ku,kv,fq,fu,fv are normalized by ki.
   //-------------------------------------------------------------------------
-  void delobez3(int const ndep, double *z, double *stokes, double mu){
+  void delobez3(int const ndep, const double *z, double *stokes, double mu){
 
 
   
-    /* --- Init arrays --- */
-    double* __restrict__ dtau = new double [ndep]();
-    double stk[4];
-    memset(&stk[0],  0, sizeof(double) * 4);
+    /* --- Init arrays, dtau lives in a workspace that only grows --- */
+    if((int)wdtau.size() < ndep) wdtau.resize(ndep);
+    T* __restrict__ dtau = &wdtau[0];
+    memset(dtau, 0, ndep*sizeof(T));
+    T stk[4];
+    memset(&stk[0],  0, sizeof(T) * 4);
 
   
     int k0 = 0, k1 = ndep-1;
-    double itau = 0.0;
+    T itau = 0.0;
 
     /* --- Compute dtau_nu scale using a bezier interpolant approx --- */
     //
-    double dzu = fabs(z[1]  - z[0]);
-    double deu  = (ki[1] - ki[0]) / dzu;
-    double odki = deu;
-    double dki, dzd, ded;
+    T dzu = fabs(z[1]  - z[0]);
+    T deu  = (ki[1] - ki[0]) / dzu;
+    T odki = deu;
+    T dki, dzd, ded;
     //
-    double imu = fabs(1.0 / mu);
+    T imu = fabs(1.0 / mu);
     for(int k = 1; k<(ndep-1); ++k){
 
     
@@ -806,7 +823,7 @@ class cprofiles{
     
       /* --- Derivative of the opacity following Fritsch & Butland (1984) --- */
       if(deu*ded > 0.0){
-	double const lambda = (1.0 + dzd / (dzd + dzu)) / 3.0;
+	T const lambda = (1.0 + dzd / (dzd + dzu)) / 3.0;
 	dki = (deu / (lambda * ded + (1.0 - lambda) * deu)) * ded;
       } else dki = 0.0;
 
@@ -849,10 +866,10 @@ class cprofiles{
   
     stk[0] = sf[k1];
     //
-    double Ku[4][4], K0[4][4], Su[4], S0[4], tmpa[4][4], tmpb[4][4], A[4][4], tmpc[4][4]; 
-    double dkq[ndep], dku[ndep], dkv[ndep], dfq[ndep], dfu[ndep], dfv[ndep],
+    T Ku[4][4], K0[4][4], Su[4], S0[4], tmpa[4][4], tmpb[4][4], A[4][4], tmpc[4][4]; 
+    T dkq[ndep], dku[ndep], dkv[ndep], dfq[ndep], dfu[ndep], dfv[ndep],
       dSv[ndep][4], vtemp[4][ndep], vtemp1[4][ndep];
-    double dK_u[4][4], dK_0[4][4], v0[4];
+    T dK_u[4][4], dK_0[4][4], v0[4];
 
   
     /* -- centered derivatives of all independent terms in the Abs matrix --- */
@@ -905,10 +922,11 @@ class cprofiles{
 
     
       /* --- Integration coeffs. and exponential --- */
-      double const dt = dtau[ku], dt03 = dt/3.0;
-      double eps=0.0, alp=0.0, bet=0.0, gam=0.0, thet=0.0;
+      double c[5] = {};
+      bez3_coeff((double)dtau[ku], c[0], c[1], c[2], c[3], c[4]); // in double, cancellations for small dt
       //
-      bez3_coeff(dt, alp, bet, gam, thet, eps);
+      T const dt03 = dtau[ku]/3.0, alp = c[0], bet = c[1], gam = c[2], thet = c[3], eps = c[4];
+
       m4m(Ku, Ku, tmpa); //  Ku^2
       m4m(K0, K0, A);    //  K0^2
 
@@ -935,33 +953,32 @@ class cprofiles{
     
       /* --- Get new intensity at depth k --- */
       //m4v(A, v0, stk); 
-      memcpy(stk, v0, 4*sizeof(double));
+      memcpy(stk, v0, 4*sizeof(T));
       solveLinearGauss4x4(A,stk);
     
       /* --- Copy variables for next interval --- */
-      memcpy(&Su[0], &S0[0],      4 * sizeof(double)); // central point -> upwind
-      memcpy(&Ku[0][0], &K0[0][0],     16 * sizeof(double)); // central point -> upwind
-      memcpy(&dK_u[0][0], &dK_0[0][0], 16 * sizeof(double)); // central point -> upwind
+      memcpy(&Su[0], &S0[0],      4 * sizeof(T)); // central point -> upwind
+      memcpy(&Ku[0][0], &K0[0][0],     16 * sizeof(T)); // central point -> upwind
+      memcpy(&dK_u[0][0], &dK_0[0][0], 16 * sizeof(T)); // central point -> upwind
     }
 
 
-    memcpy(&stokes[0], &stk[0], 4*sizeof(double));
-    delete [] dtau;
+    for(int ss=0; ss<4; ss++) stokes[ss] = stk[ss];
   }
 
-  static void cent_deriv(int n, const double* __restrict__ dx, const double* __restrict__ y, double* __restrict__ yp, int const k0, int const k1){
+  static void cent_deriv(int n, const T* __restrict__ dx, const T* __restrict__ y, T* __restrict__ yp, int const k0, int const k1){
     // Assumes that yp has been allocated: yp[n]
     int const kinit = std::max(1,k0);
     int const kend = std::min(k1, n-2);
   
-    double oder = (y[kinit] - y[kinit-1]) / dx[kinit];
+    T oder = (y[kinit] - y[kinit-1]) / dx[kinit];
     if(k0 == 0) yp[0] = oder;
   
     for(int k = kinit; k <= kend; k++){
-      double der = (y[k+1] - y[k]) / dx[k+1];
+      T der = (y[k+1] - y[k]) / dx[k+1];
     
       if(der*oder > 0.0){
-	double lambda = (1.0 + dx[k+1] / (dx[k+1] + dx[k])) / 3.0;
+	T lambda = (1.0 + dx[k+1] / (dx[k+1] + dx[k])) / 3.0;
 	yp[k] = (oder / (lambda * der + (1.0 - lambda) * oder)) * der;
       } else yp[k] = 0.0; // Set der to zero at extrema;
     
@@ -970,19 +987,19 @@ class cprofiles{
     if(k1 == (n-1)) yp[n-1] = oder;			  
   }
 
-  static void cent_deriv_out(int const n, const double* __restrict__ dx, const double* __restrict__ y, double* __restrict__ yp, int const k0, int const k1){
+  static void cent_deriv_out(int const n, const T* __restrict__ dx, const T* __restrict__ y, T* __restrict__ yp, int const k0, int const k1){
     // Assumes that yp has been allocated: yp[n]
     int const kinit = std::max(1,k0);
     int const kend = std::min(k1, n-2);
   
-    double oder = (y[kend] - y[kend+1]) / dx[kend+1];
+    T oder = (y[kend] - y[kend+1]) / dx[kend+1];
     if(k1 == (n-1)) yp[k1] = oder;
   
     for(int k = kend; k >= kinit; --k){
-      double der = (y[k-1] - y[k]) / dx[k];
+      T der = (y[k-1] - y[k]) / dx[k];
     
       if(der*oder > 0.0){
-	double lambda = (1.0 + dx[k-1] / (dx[k-1] + dx[k])) / 3.0;
+	T lambda = (1.0 + dx[k-1] / (dx[k-1] + dx[k])) / 3.0;
 	yp[k] = (oder / (lambda * der + (1.0 - lambda) * oder)) * der;
       } else yp[k] = 0.0; // Set der to zero at extrema;
     
@@ -992,18 +1009,25 @@ class cprofiles{
   }
 
   
-  static double **mat2d(int nx1, int nx2){
-    double **p;
-    p = new double* [nx1];
-    p[0] = new double [nx1 * nx2]();
+  static T **mat2d(int nx1, int nx2){
+    T **p;
+    p = new T* [nx1];
+    p[0] = new T [nx1 * nx2]();
     for(int x1=1;x1<nx1;++x1) p[x1] = p[x1-1] + nx2;
     return p;
   }
 
-  static void del_mat(double **p){
+  static void del_mat(T **p){
     delete[] (p[0]);
     delete[] (p);
     p = NULL;
   }
 };
+
+template <typename T> constexpr double cprofiles_t<T>::A[7];
+template <typename T> constexpr double cprofiles_t<T>::B[8];
+template <typename T> constexpr double cprofiles_t<T>::LARMOR;
+
+typedef cprofiles_t<double> cprofiles;
+
 #endif
@@ -4,6 +4,7 @@
 #include <algorithm>
 #include <cmath>
 #include <cstdio>
+#include <cstring>
 #include "crh.h"
 #include "cmemt.h"
 #include "input.h"
@@ -211,6 +212,7 @@ crh::crh(iput_t &inpt, double grav): atmos(inpt, grav){
 
   /* --- Init saved pop --- */
   memset(&save_pop, 0, sizeof(crhpop));
+  dthres = 0.0, ndcheck = 0;
   //save_pop.pop = NULL;
   //save_pop.nactive = 0;
 
@@ -238,6 +240,166 @@ crh::crh(iput_t &inpt, double grav): atmos(inpt, grav){
 
 bool crh::synth(mdepth_t &m_in, double *syn, int computing_derivatives, cprof_solver sol, bool save_pops){
 
+  /* --- Full depth grid, also for the depth-by-depth response functions (mode 4) --- */
+  
+  bool hydro = false;
+  
+  if((input.nlte_depth_tol <= 0.0) || (input.mode == 4) || (dthres < 0.0))
+    return synthGrid(m_in, syn, computing_derivatives, save_pops, hydro);
+
+  
+  /* --- Adaptive grid: calibrate the subset against the full grid first.
+     The threshold is validated again every nlte_depth_check syntheses,
+     starting from the current one --- */
+
+  if(dthres == 0.0)
+    return calibrateDepth(m_in, syn, computing_derivatives, save_pops, 16.0);
+
+  if(!computing_derivatives && (input.nlte_depth_check > 0) &&
+     (++ndcheck >= input.nlte_depth_check))
+    return calibrateDepth(m_in, syn, computing_derivatives, save_pops, dthres);
+
+  
+  /* --- The perturbed models of the response functions reuse the subset of
+     the model they derive from (last call without derivatives), so the 
+     finite differences do not include the change of the grid --- */
+  
+  if(!computing_derivatives || (didx.size() < 2) || (didx.back() != (m_in.ndep-1)))
+    depthSubset(m_in, dthres, didx);
+  
+  return synthSubset(m_in, didx, syn, computing_derivatives, save_pops);
+}
+
+/* ----------------------------------------------------------------*/
+
+void crh::depthSubset(mdepth_t &m, double thres, vector<int> &idx){
+
+  /* --- Cumulative change of temperature (source function), density 
+     (opacity), optical depth and velocity between consecutive depth points, 
+     in the units of mdepth::optimize_depth: 10% in T or rho, 0.1 dex in tau
+     and 1 km/s. A point is kept when the change accumulated since the 
+     previous kept point would exceed thres. Both boundaries are kept.
+     --- */
+  
+  static const double lg11 = log10(1.1);
+  
+  idx.clear();
+  idx.push_back(0);
+  
+  double acc = 0.0;
+  
+  for(int kk=1; kk<m.ndep; kk++){
+    double tdiv = fabs(log10(m.temp[kk]) - log10(m.temp[kk-1])) / lg11;
+    double rdiv = fabs(log10(m.rho[kk])  - log10(m.rho[kk-1]))  / lg11;
+    double taudiv = fabs(m.ltau[kk] - m.ltau[kk-1]) * 10.0;
+    double vdiv = fabs(m.v[kk] - m.v[kk-1]) * 1.e-5;
+    double dd = std::max(std::max(tdiv, rdiv), std::max(taudiv, vdiv));
+    
+    if(((acc + dd) > thres) && (idx.back() != (kk-1))){
+      idx.push_back(kk-1);
+      acc = 0.0;
+    }
+    acc += dd;
+  }
+  
+  idx.push_back(m.ndep-1);
+}
+
+/* ----------------------------------------------------------------*/
+
+bool crh::synthSubset(mdepth_t &m_in, vector<int> &idx, double *syn, int computing_derivatives, bool save_pops){
+
+  /* --- Copy the selected depth points --- */
+  
+  int nsub = (int)idx.size();
+  mdepth m(nsub);
+  
+  for(int ii=0; ii<nsub; ii++)
+    for(int rr=0; rr<14; rr++) m.cub(rr,ii) = m_in.cub(rr,idx[ii]);
+  m.tr_loc = m_in.tr_loc, m.tr_amp = m_in.tr_amp;
+
+  bool hydro = false;
+  bool conv = synthGrid(m, syn, computing_derivatives, save_pops, hydro);
+
+  
+  /* --- Map Pgas and Ne from the hydrostatic equilibrium back to the full grid,
+     linear in log and log(tau). The boundary Pgas is preserved as in synthGrid --- */
+  
+  if(conv && hydro){
+    int ii = 0;
+    for(int kk=0; kk<m_in.ndep; kk++){
+      while((ii < nsub-2) && (idx[ii+1] < kk)) ii++;
+      
+      double w = (m_in.ltau[kk] - m.ltau[ii]) / (m.ltau[ii+1] - m.ltau[ii]);
+      
+      if(kk > 0) m_in.pgas[kk] = exp((1.0-w) * log(m.pgas[ii]) + w * log(m.pgas[ii+1]));
+      m_in.nne[kk] = exp((1.0-w) * log(m.nne[ii]) + w * log(m.nne[ii+1]));
+    }
+  }
+  
+  return conv;
+}
+
+/* ----------------------------------------------------------------*/
+
+bool crh::calibrateDepth(mdepth_t &m_in, double *syn, int computing_derivatives, bool save_pops, double tstart){
+
+  /* --- Reference spectrum on the full grid --- */
+  
+  bool hydro = false;
+  bool conv = synthGrid(m_in, syn, computing_derivatives, save_pops, hydro);
+  if(!conv){ // calibrate in the next call
+    if(dthres > 0.0) ndcheck = input.nlte_depth_check;
+    return conv;
+  }
+
+  
+  /* --- Refine from tstart until the maximum error relative to Stokes I 
+     is below the tolerance. The full grid is kept if no subset qualifies.
+     The trials run on a copy of the model, only the accepted one keeps
+     its Pgas and Ne. They start from the populations of the full grid
+     and do not store theirs, so a rejected trial leaves them untouched --- */
+  
+  int nd = nlambda*4, nsub = m_in.ndep;
+  double err = 0.0;
+  vector<double> tsyn(nd);
+  vector<int> &idx = didx;
+  
+  dthres = -1.0, ndcheck = 0;
+  
+  for(double thres = tstart; thres >= 1.0; thres *= 0.5){
+    depthSubset(m_in, thres, idx);
+    if((int)idx.size() >= m_in.ndep) break;
+    
+    mdepth m(m_in);
+    if(!synthSubset(m, idx, &tsyn[0], computing_derivatives, false)) continue;
+    
+    err = 0.0;
+    for(int ww=0; ww<nlambda; ww++){
+      double iref = std::max(fabs(syn[ww*4]), 1.e-30);
+      for(int ss=0; ss<4; ss++)
+	err = std::max(err, fabs(tsyn[ww*4+ss] - syn[ww*4+ss]) / iref);
+    }
+    
+    if(err <= input.nlte_depth_tol){
+      dthres = thres, nsub = (int)idx.size();
+      memcpy(syn, &tsyn[0], nd*sizeof(double));
+      for(int kk=0; kk<m_in.ndep; kk++) m_in.pgas[kk] = m.pgas[kk], m_in.nne[kk] = m.nne[kk];
+      break;
+    }
+  }
+  
+  if(input.verbose)
+    fprintf(stderr,"[p:%4d] crh::calibrateDepth: ndep=%d -> %d (max. relative error %e)\n",
+	    input.myrank, m_in.ndep, nsub, ((dthres > 0.0) ? err : 0.0));
+  
+  return conv;
+}
+
+/* ----------------------------------------------------------------*/
+
+bool crh::synthGrid(mdepth_t &m_in, double *syn, int computing_derivatives, bool save_pops, bool &hydro){
+
   static int ncall = 0, npix = 0;
   ncall++;
 
@@ -367,6 +529,8 @@ bool crh::synth(mdepth_t &m_in, double *syn, int computing_derivatives, cprof_so
   
   /* --- convert nHtot to Pgas using the electron density, the H abundance and temperature --- */
   
+  hydro = (hydrostat > 0);
+  
   if(hydrostat > 0){
     for(int kk = 0; kk < m.ndep; kk++){
       
@@ -400,6 +564,51 @@ void crh::cleanup(void){
 
 /* ----------------------------------------------------------------*/
 
+void crh::resetStats(){
+  getChemEquilStats(NULL, TRUE);
+  getRHStats(NULL, TRUE);
+}
+
+/* ----------------------------------------------------------------*/
+
+void crh::addSolverStats(pixstat_t &st){
+
+  /* --- Iterations and timers of RH accumulated for this pixel --- */
+  
+  rhstat rs;
+  getRHStats(&rs, FALSE);
+
+  st[ps_rh_iter]      += rs.Niter;
+  st[ps_rh_prd_iter]  += rs.NPRDiter;
+  st[ps_t_eos]        += rs.t_eos;
+  st[ps_t_background] += rs.t_background;
+  st[ps_t_formal]     += rs.t_formal;
+  st[ps_t_stateq]     += rs.t_stateq;
+}
+
+/* ----------------------------------------------------------------*/
+
+void crh::setDeadline(double t){
+  setRHDeadline(t);
+}
+
+/* ----------------------------------------------------------------*/
+
+void crh::printStats(int proc){
+
+  /* --- Chemical equilibrium counters accumulated for this pixel --- */
+  
+  chemstat cs;
+  getChemEquilStats(&cs, TRUE);
+  if(cs.Npoint == 0) return;
+  
+  fprintf(stderr,"[p:%4d] chemeq: calls=%ld, points=%ld, cached=%ld, warm=%ld, newton_iter=%ld (%.2f/solved point)\n",
+	  proc, cs.Ncall, cs.Npoint, cs.Nskip, cs.Nwarm, cs.Niter,
+	  (double)cs.Niter / std::max(cs.Npoint - cs.Nskip, 1L));
+}
+
+/* ----------------------------------------------------------------*/
+
 crh::~crh(void){
   cleanup();
 }
@@ -24,6 +24,9 @@ class crh: public atmos{
   int nlambda, nlines, nregions;
   std::vector<double> lambda, cmass, nhtot;
   crhpop save_pop;
+  double dthres; // threshold of the adaptive depth grid: 0 (not calibrated), <0 (full grid)
+  int ndcheck;   // syntheses since the threshold was last validated
+  std::vector<int> didx; // depth subset of the last model, reused by the response functions
   
   /* --- Prototypes --- */
   std::vector<double> get_max_limits(nodes_t &n, int mode =1);
@@ -31,9 +34,17 @@ class crh: public atmos{
   std::vector<double> get_scaling(nodes_t &n, int mode =1);
   std::vector<double> get_steps(nodes_t &n, int mode = 1);
   bool synth(mdepth &m, double *syn, int computing_derivatives = 0, cprof_solver sol = bez_ltau, bool store_pops = true);
+  bool synthGrid(mdepth &m, double *syn, int computing_derivatives, bool store_pops, bool &hydro);
+  bool synthSubset(mdepth &m, std::vector<int> &idx, double *syn, int computing_derivatives, bool store_pops);
+  bool calibrateDepth(mdepth &m, double *syn, int computing_derivatives, bool store_pops, double tstart);
+  void depthSubset(mdepth &m, double thres, std::vector<int> &idx);
   void cleanup();
   void lambdaIDX(int nw, double *lambda);
   void checkBounds(mdepth_t &m);
+  void resetStats();
+  void printStats(int proc);
+  void addSolverStats(pixstat_t &st);
+  void setDeadline(double t);
 
 
   
@@ -691,8 +691,8 @@ void mdepth::getScales(eoswrap &eos, int bound){
   kappa.resize(ndep);
   int nw = 1;
   double wav = 5000.0, scat = 0.0;
-  vector<float> frac, part;
-  float na=0, ne=0;
+  vector<double> frac, part;
+  double na=0, ne=0;
 
   
   /* --- get cont opac --- */
@@ -971,11 +971,12 @@ void mdepthall::model_parameters2( mat<double> &tmp, nodes_t &n, int nt){
 }
 
 
-int mdepthall::read_model2(iput_t const& input, std::string &filename, int tstep, bool require_tau){
-  io ifile(filename, netCDF::NcFile::read);
+int mdepthall::read_model2(iput_t const& input, std::string &filename, int tstep, bool require_tau, int y0, int ny){
+  bool const verb = (ny <= 0); // quiet when reading a y-strip
+  io ifile(filename, netCDF::NcFile::read, verb);
   std::string inam = "mdepthall::read_model: ";
-  int idep, bound = 0;
-  mat<double> tmp;
+  int bound = 0;
+  mat<double> tmp, tmp1;
     
   /* --- get dimensions --- */
   std::vector<int> dims = ifile.dimSize("temp");
@@ -987,21 +988,16 @@ int mdepthall::read_model2(iput_t const& input, std::string &filename, int tstep
     std::cout << inam << "ERROR, ndims must be 3 or 4: [(nt), ny, nx, ndep], but is "<<ndims<<std::endl;
   }     
 
+  
+  /* --- Only read a y-strip? --- */
+  if(ny > 0) dims[0] = ny;
+  else       y0 = 0;
+
   /* --- Allocate cube --- */
   cub.set({dims[0], dims[1], 13, dims[2]});
   ndep = dims[2];
 
-
-  
-  /* --- read vars, assuming they exists --- */
-  if(ifile.is_var_defined("temp")){
-    ifile.read_Tstep<double>("temp", tmp, tstep);
-
-    /* --- Copy to consecutive array --- */
-    for(int yy = 0; yy< dims[0]; yy++)
-      for(int xx = 0; xx < dims[1]; xx++)
-	memcpy(&cub(yy,xx,0,0), &tmp(yy,xx,0), dims[2]*sizeof(double));
-  }else {
+  if(!ifile.is_var_defined("temp")){
     std::cerr << inam << "ERROR, "<<filename <<" does not contain a temperature array, exiting"<<std::endl;
     exit(0);
   }
@@ -1009,125 +1005,77 @@ int mdepthall::read_model2(iput_t const& input, std::string &filename, int tstep
   boundary.set({dims[0], dims[1]});
 
 
-  /* --- Read Vlos --- */
-  if(ifile.is_var_defined("vlos")){
-    ifile.read_Tstep<double>("vlos", tmp, tstep);
-     for(int yy = 0; yy< dims[0]; yy++)
-      for(int xx = 0; xx < dims[1]; xx++)
-	memcpy(&cub(yy,xx,1,0), &tmp(yy,xx,0), dims[2]*sizeof(double));
-  }
+  /* --- Variables that go straight into cub(yy,xx,idx,:). They are read in
+     blocks of rows (tiles) that are copied into cub, so we never hold a second
+     copy of a full variable. The old way of giving B (b, inc) is converted
+     to blong/bhor tile by tile. pgas, rho and nne also set the boundary --- */
   
+  struct cvar_t{const char *name; int idx;};
+  std::vector<cvar_t> cvars = {{"temp",0}, {"vlos",1}, {"vturb",2}, {"blong",3}, {"bhor",4},
+			       {"azi",5}, {"pgas",6}, {"rho",7}, {"nne",8}, {"ltau500",9},
+			       {"z",10}, {"cmass",11}};
 
+  bool const old_b = !ifile.is_var_defined("blong") && ifile.is_var_defined("b") && ifile.is_var_defined("inc");
+  bool const set_ltau = ifile.is_var_defined("ltau500");
+  bool const set_cmass = ifile.is_var_defined("cmass");
   
-  /* --- Read Vmic --- */
-   if(ifile.is_var_defined("vturb")){
-    ifile.read_Tstep<double>("vturb", tmp, tstep);
-    for(int yy = 0; yy< dims[0]; yy++)
-      for(int xx = 0; xx < dims[1]; xx++)
-	memcpy(&cub(yy,xx,2,0), &tmp(yy,xx,0), dims[2]*sizeof(double));
-   }
-
-
-   
-   /* --- Read blong --- */
-   if(ifile.is_var_defined("blong")){
-     ifile.read_Tstep<double>("blong", tmp, tstep);
-     for(int yy = 0; yy< dims[0]; yy++)
-       for(int xx = 0; xx < dims[1]; xx++)
-	 memcpy(&cub(yy,xx,3,0), &tmp(yy,xx,0), dims[2]*sizeof(double));
-     
-   
-   
-
-
-     /* --- Read bhor --- */
-     if(ifile.is_var_defined("bhor")){
-       ifile.read_Tstep<double>("bhor", tmp, tstep);
-       for(int yy = 0; yy< dims[0]; yy++)
-	 for(int xx = 0; xx < dims[1]; xx++)
-	   memcpy(&cub(yy,xx,4,0), &tmp(yy,xx,0), dims[2]*sizeof(double));
-     }
-
-
-     
-   }else{
-
-     /* --- Are B and inc defined? -> Backwards compatibility  --- */
-     
-     mat<double> tmp1;
-
-     if(ifile.is_var_defined("b") && ifile.is_var_defined("inc")){
-       
-       ifile.read_Tstep<double>("b", tmp, tstep);
-       ifile.read_Tstep<double>("inc", tmp1, tstep);
-       
-       for(int yy = 0; yy< dims[0]; yy++)
-	 for(int xx = 0; xx < dims[1]; xx++)
-	   for(int zz = 0; zz< dims[2]; zz++){
-	     cub(yy,xx,3,zz) = tmp(yy,xx,zz) * cos(tmp1(yy,xx,zz));
-	     cub(yy,xx,4,zz) = tmp(yy,xx,zz) * sin(tmp1(yy,xx,zz));
-	   }
-     }
-   }
-
-
-
-   /* --- Read azi --- */
-   if(ifile.is_var_defined("azi")){
-     ifile.read_Tstep<double>("azi", tmp, tstep);
-     for(int yy = 0; yy< dims[0]; yy++)
-       for(int xx = 0; xx < dims[1]; xx++)
-	 memcpy(&cub(yy,xx,5,0), &tmp(yy,xx,0), dims[2]*sizeof(double));
-   }
-   
-
+  std::vector<cvar_t> toread;
+  for(auto &it: cvars){
+    if(!ifile.is_var_defined(it.name)) continue;
+    if((it.idx == 4) && !ifile.is_var_defined("blong")) continue; // bhor only with blong
+    toread.push_back(it);
+  }
 
 
-   /* --- Read Pgas --- */
-   if(ifile.is_var_defined("pgas")){
-     ifile.read_Tstep<double>("pgas", tmp, tstep);
-     for(int yy=0; yy<dims[0]; yy++) for(int xx = 0;xx<dims[1]; xx++){
-	 boundary(yy,xx) = tmp(yy,xx,0);
-	 memcpy(&cub(yy,xx,6,0), &tmp(yy,xx,0), dims[2]*sizeof(double));
-       }
-   }
+  long const npix_row = long(dims[1]) * dims[2];
+  int const ntile = (int)std::max<long>(1, (1L << 20) / std::max<long>(npix_row, 1)); // ~8 MB tiles
+  
+  for(int ty = 0; ty < dims[0]; ty += ntile){
+    int const nty = std::min(ntile, dims[0]-ty);
 
+    for(auto &it: toread){
+      ifile.read_Tstep<double>(it.name, tmp, tstep, false, y0+ty, nty);
 
- 
-   
-   /* --- Read Rho --- */
-   if(ifile.is_var_defined("rho")){
-     ifile.read_Tstep<double>("rho", tmp, tstep);
-     if(bound == 0) {
-       for(int yy=0; yy<dims[0]; yy++)
-	 for(int xx = 0;xx<dims[1]; xx++){
-	   boundary(yy,xx) = tmp(yy,xx,0);
-	 }
-     }
-     
-     for(int yy=0; yy<dims[0]; yy++)
-       for(int xx = 0;xx<dims[1]; xx++)
-	 memcpy(&cub(yy,xx,7,0), &tmp(yy,xx,0), dims[2]*sizeof(double));
-   }
-
+      if(tmp.ndims() == 1){ // A 1D z-scale, replicate it in all pixels
+	for(int yy = 0; yy<nty;yy++)
+	  for(int xx = 0; xx< dims[1]; xx++)
+	    memcpy(&cub(ty+yy,xx,it.idx,0), &tmp.d[0], dims[2]*sizeof(double));
+      }else{
+	for(int yy = 0; yy<nty; yy++)
+	  for(int xx = 0; xx < dims[1]; xx++)
+	    memcpy(&cub(ty+yy,xx,it.idx,0), &tmp(yy,xx,0), dims[2]*sizeof(double));
+      }
+      
+      if((it.idx >= 6) && (it.idx <= 8))
+	for(int yy = 0; yy<nty; yy++)
+	  for(int xx = 0; xx < dims[1]; xx++)
+	    boundary(ty+yy,xx) = cub(ty+yy,xx,it.idx,0);
+    }
 
 
-   
-   /* --- Read nne --- */
-   if(ifile.is_var_defined("nne")){
-     ifile.read_Tstep<double>("nne", tmp, tstep);
-     if(bound == 0) {
-       for(int yy=0; yy<dims[0]; yy++)
-	 for(int xx = 0;xx<dims[1]; xx++){
-	   boundary(yy,xx) = tmp(yy,xx,0);
-	 }
-     }
-     
-     for(int yy=0; yy<dims[0]; yy++)
-       for(int xx = 0;xx<dims[1]; xx++)
-	 memcpy(&cub(yy,xx,8,0), &tmp(yy,xx,0), dims[2]*sizeof(double));
-   }
+    /* --- Are B and inc defined? -> Backwards compatibility  --- */
+    
+    if(old_b){
+      ifile.read_Tstep<double>("b", tmp, tstep, false, y0+ty, nty);
+      ifile.read_Tstep<double>("inc", tmp1, tstep, false, y0+ty, nty);
+      
+      for(int yy = 0; yy<nty; yy++)
+	for(int xx = 0; xx < dims[1]; xx++)
+	  for(int zz = 0; zz< dims[2]; zz++){
+	    cub(ty+yy,xx,3,zz) = tmp(yy,xx,zz) * cos(tmp1(yy,xx,zz));
+	    cub(ty+yy,xx,4,zz) = tmp(yy,xx,zz) * sin(tmp1(yy,xx,zz));
+	  }
+    }
+  }
+  tmp.d.clear(), tmp1.d.clear();
 
+  if(verb){
+    std::cout << inam << "read [";
+    for(int ii=0; ii<(int)toread.size(); ii++) std::cout << ((ii>0) ? ", " : "") << toread[ii].name;
+    if(old_b) std::cout << ", b, inc";
+    std::cout << "] (t="<<tstep<<") ["<<dims[0]<<", "<<dims[1]<<", "<<dims[2]<<"]"<<std::endl;
+  }
+  
 
    /* --- Init boundary --- */
    if(fabs(cub(0,0,6,0)) > 0.0) bound = 1;
@@ -1138,56 +1086,12 @@ int mdepthall::read_model2(iput_t const& input, std::string &filename, int tstep
      for(int yy=0; yy<dims[0]; yy++)
        for(int xx = 0;xx<dims[1]; xx++)
 	 boundary(yy,xx) = cub(yy,xx,5+bound, 0);
-   cerr<<"mdepthall::read_model2: Bound -> "<<bound<<endl;
-   
-
-
-   /* --- Read LTAU500 --- */
-   bool set_ltau = false;
-   if(ifile.is_var_defined("ltau500")){
-    ifile.read_Tstep<double>("ltau500", tmp, tstep);
-    set_ltau = true;
-    for(int yy=0; yy<dims[0]; yy++)
-      for(int xx = 0;xx<dims[1]; xx++)
-	memcpy(&cub(yy,xx,9,0), &tmp(yy,xx,0), dims[2]*sizeof(double));
-   }
-
-
-
-   /* --- Read Z --- */
-   bool set_z = false;
-   if(ifile.is_var_defined("z")){
-     ifile.read_Tstep<double>("z", tmp, tstep);
-     set_z = true;
-     if(tmp.ndims() == 1){
-       cerr<< inam <<"replicating z-scale in all pixels"<<endl;
-       for(int yy = 0; yy<dims[0];yy++)
-	 for(int xx = 0; xx< dims[1]; xx++)
-	   for(int zz = 0; zz<dims[2]; zz++)
-	     cub(yy,xx,10,zz) = tmp.d[zz];
-     }else{
-       for(int yy=0; yy<dims[0]; yy++)
-	 for(int xx = 0;xx<dims[1]; xx++)
-	   memcpy(&cub(yy,xx,10,0), &tmp(yy,xx,0), dims[2]*sizeof(double));
-       
-     }
-     
-   }
+   if(verb) cerr<<"mdepthall::read_model2: Bound -> "<<bound<<endl;
    
-   /* -- Read cmass? --- */
-   
-   bool set_cmass = false;
-   if(ifile.is_var_defined("cmass")){
-     set_cmass = true;
-     ifile.read_Tstep<double>("cmass", tmp, tstep);
-     for(int yy=0; yy<dims[0]; yy++)
-       for(int xx = 0;xx<dims[1]; xx++)
-	 memcpy(&cub(yy,xx,11,0), &tmp(yy,xx,0), dims[2]*sizeof(double));
-   }
 
    /* --- Tr amplification factor --- */
    if(ifile.is_var_defined("transition_region_scale")){
-     ifile.read_Tstep<double>("transition_region_scale", tr_amp, tstep);
+     ifile.read_Tstep<double>("transition_region_scale", tr_amp, tstep, verb, y0, ny);
    }else{
      tr_amp.set({dims[0], dims[1]});
      long const nTot = long(dims[0]) * long(dims[1]);
@@ -1197,7 +1101,7 @@ int mdepthall::read_model2(iput_t const& input, std::string &filename, int tstep
    
    /* --- Tr location --- */
    if(ifile.is_var_defined("transition_region_loc")){
-     ifile.read_Tstep<double>("transition_region_loc", tr_loc, tstep);
+     ifile.read_Tstep<double>("transition_region_loc", tr_loc, tstep, verb, y0, ny);
    }else{
      tr_loc.set({dims[0], dims[1]});
      long const nTot = long(dims[0]) * long(dims[1]);
@@ -1207,7 +1111,7 @@ int mdepthall::read_model2(iput_t const& input, std::string &filename, int tstep
    
    /* --- Tr N --- */
    if(ifile.is_var_defined("transition_region_nGrid")){
-     ifile.read_Tstep<int>("transition_region_nGrid", tr_N, tstep);
+     ifile.read_Tstep<int>("transition_region_nGrid", tr_N, tstep, verb, y0, ny);
    }else{
      tr_N.set({dims[0], dims[1]});
      long const nTot = long(dims[0]) * long(dims[1]);
@@ -1382,7 +1286,7 @@ void mdepthall::write_model(string &filename, int tstep){
 
 
 
-void mdepthall::write_model2(iput_t const& input, string &filename, int tstep){
+void mdepthall::write_model2(iput_t const& input, string &filename, int tstep, int y0, int nytot){
 
   static bool firsttime = true;
 
@@ -1394,13 +1298,15 @@ void mdepthall::write_model2(iput_t const& input, string &filename, int tstep){
   /* --- Dims --- */
   vector<int> cdims = cub.getdims();
   vector<int> dims = {0, cdims[0], cdims[1], cdims[3]};
+  int const ny = ((nytot > 0) ? cdims[0] : -1); // cub holds rows [y0, y0+ny) of nytot
 
 
   
   /* --- Init vars & dims if firsttime --- */
   if(firsttime){
 
-    ofile.initDim({"time","y", "x", "ndep"}, dims);
+    ofile.setStorage(input.nc_deflate, input.nc_shuffle, input.nc_pixel_chunks, input.nc_float, input.nc_double);
+    ofile.initDim({"time","y", "x", "ndep"}, {0, ((nytot > 0) ? nytot : dims[1]), dims[2], dims[3]});
 
     
     /* --- vars -- */
@@ -1426,80 +1332,43 @@ void mdepthall::write_model2(iput_t const& input, string &filename, int tstep){
   }
   
   {
-  mat<double> tmp((vector<int>){dims[1], dims[2], dims[3]});
-  
-  /* --- write time step --- */
-  for(int yy=0; yy<dims[1]; yy++)
-    for(int xx = 0;xx<dims[2];xx++)
-      memcpy(&tmp(yy,xx,0), &cub(yy,xx,0,0), dims[3]*sizeof(double));
-  ofile.write_Tstep<double>(string("temp"),    tmp,  tstep);
-
-  
-  for(int yy=0; yy<dims[1]; yy++)
-    for(int xx = 0;xx<dims[2];xx++)
-      memcpy(&tmp(yy,xx,0), &cub(yy,xx,1,0), dims[3]*sizeof(double));
-  ofile.write_Tstep<double>(string("vlos"),   tmp,  tstep);
-
-  
-  for(int yy=0; yy<dims[1]; yy++)
-    for(int xx = 0;xx<dims[2];xx++)
-      memcpy(&tmp(yy,xx,0), &cub(yy,xx,2,0), dims[3]*sizeof(double));
-  ofile.write_Tstep<double>(string("vturb"),   tmp, tstep);
 
-  for(int yy=0; yy<dims[1]; yy++)
-    for(int xx = 0;xx<dims[2];xx++)
-      memcpy(&tmp(yy,xx,0), &cub(yy,xx,3,0), dims[3]*sizeof(double));
-  ofile.write_Tstep<double>(string("blong"),       tmp,     tstep);
+    /* --- write time step in blocks of rows (tiles), so we never hold a
+       second copy of a full variable --- */
 
-  for(int yy=0; yy<dims[1]; yy++)
-    for(int xx = 0;xx<dims[2];xx++)
-      memcpy(&tmp(yy,xx,0), &cub(yy,xx,4,0), dims[3]*sizeof(double));
-  ofile.write_Tstep<double>(string("bhor"),     tmp,   tstep);
-
-  for(int yy=0; yy<dims[1]; yy++)
-    for(int xx = 0;xx<dims[2];xx++)
-      memcpy(&tmp(yy,xx,0), &cub(yy,xx,5,0), dims[3]*sizeof(double));
-  ofile.write_Tstep<double>(string("azi"),     tmp,   tstep);
-
-  for(int yy=0; yy<dims[1]; yy++)
-    for(int xx = 0;xx<dims[2];xx++)
-      memcpy(&tmp(yy,xx,0), &cub(yy,xx,9,0), dims[3]*sizeof(double));
-  ofile.write_Tstep<double>(string("ltau500"), tmp,  tstep);
-
-  for(int yy=0; yy<dims[1]; yy++)
-    for(int xx = 0;xx<dims[2];xx++)
-      memcpy(&tmp(yy,xx,0), &cub(yy,xx,10,0), dims[3]*sizeof(double));
-  ofile.write_Tstep<double>(string("z"), tmp,  tstep);
-
-  
-  for(int yy=0; yy<dims[1]; yy++)
-    for(int xx = 0;xx<dims[2];xx++)
-      memcpy(&tmp(yy,xx,0), &cub(yy,xx,6,0), dims[3]*sizeof(double));
-  ofile.write_Tstep<double>(string("pgas"),    tmp,  tstep);
-  
-  
-  for(int yy=0; yy<dims[1]; yy++)
-    for(int xx = 0;xx<dims[2];xx++)
-      memcpy(&tmp(yy,xx,0), &cub(yy,xx,7,0), dims[3]*sizeof(double));
-  ofile.write_Tstep<double>(string("rho"),    tmp,  tstep);
-  
-  
-  for(int yy=0; yy<dims[1]; yy++)
-    for(int xx = 0;xx<dims[2];xx++)
-      memcpy(&tmp(yy,xx,0), &cub(yy,xx,8,0), dims[3]*sizeof(double));
-  ofile.write_Tstep<double>(string("nne"),    tmp,  tstep);
+    struct cvar_t{const char *name; int idx;};
+    std::vector<cvar_t> const cvars = {{"temp",0}, {"vlos",1}, {"vturb",2}, {"blong",3}, {"bhor",4},
+				       {"azi",5}, {"ltau500",9}, {"z",10}, {"pgas",6}, {"rho",7},
+				       {"nne",8}, {"cmass",11}};
+    
+    long const npix_row = long(dims[2]) * dims[3];
+    int const ntile = (int)std::max<long>(1, (1L << 20) / std::max<long>(npix_row, 1)); // ~8 MB tiles
+    int const yoff = ((ny > 0) ? y0 : 0);
+    mat<double> tmp;
+
+    for(int ty = 0; ty < dims[1]; ty += ntile){
+      int const nty = std::min(ntile, dims[1]-ty);
+      tmp.set({nty, dims[2], dims[3]});
+
+      for(auto &it: cvars){
+	for(int yy=0; yy<nty; yy++)
+	  for(int xx = 0;xx<dims[2];xx++)
+	    memcpy(&tmp(yy,xx,0), &cub(ty+yy,xx,it.idx,0), dims[3]*sizeof(double));
+	ofile.write_Tstep<double>(string(it.name), tmp, tstep, yoff+ty, nty);
+      }
+    }
 
-  
-  for(int yy=0; yy<dims[1]; yy++)
-    for(int xx = 0;xx<dims[2];xx++)
-      memcpy(&tmp(yy,xx,0), &cub(yy,xx,11,0), dims[3]*sizeof(double));
-  ofile.write_Tstep<double>(string("cmass"),    tmp,  tstep);
+    if(ny <= 0){
+      std::cerr << "mdepthall::write_model2: writing [";
+      for(int ii=0; ii<(int)cvars.size(); ii++) std::cerr << ((ii>0) ? ", " : "") << cvars[ii].name;
+      std::cerr << "] (t="<< tstep <<") to "<<filename<<std::endl;
+    }
   }
 
   {
-    ofile.write_Tstep<double>(string("transition_region_loc"),   tr_loc,  tstep);
-    ofile.write_Tstep<double>(string("transition_region_scale"),   tr_amp,  tstep);
-    ofile.write_Tstep<int>(string("transition_region_nGrid"),   tr_N,  tstep);
+    ofile.write_Tstep<double>(string("transition_region_loc"),   tr_loc,  tstep, y0, ny);
+    ofile.write_Tstep<double>(string("transition_region_scale"),   tr_amp,  tstep, y0, ny);
+    ofile.write_Tstep<int>(string("transition_region_nGrid"),   tr_N,  tstep, y0, ny);
   }
 
   
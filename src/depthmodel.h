@@ -88,11 +88,12 @@ class mdepthall{
     setsize(iny, inx, indep);
   }
   mdepthall(){};
-  ~mdepthall(){setsize(0,0,0);};
+  ~mdepthall(){setsize(0,0,0,false);};
 
   void model_parameters (mat<double> &tmp, nodes_t &n, int nt = 1);
   void model_parameters2( mat<double> &tmp, nodes_t &n, int nt = 1);
-  int  read_model2(iput_t const& input, std::string &filename,int tstep = 0,  bool require_tau = false);
+  int  read_model2(iput_t const& input, std::string &filename,int tstep = 0,  bool require_tau = false,
+		    int y0 = 0, int ny = -1);
   void compress(int n, double *x, double *y, int nn, double *xx, double *yy);
   void compress(int n, float *x, float *y, int nn, double *xx, double *yy);
 
@@ -101,7 +102,7 @@ class mdepthall{
   void expandAtmos(nodes_t &nodes, mat<double> &pars, int interpolation = 0);
   void expand(int n, double *x, double *y, int nn, double *xx, double *yy, int interpolation = 0);
   void write_model(std::string &filename, int tstep = 0);
-  void write_model2(iput_t const& input, std::string &filename, int tstep = 0);
+  void write_model2(iput_t const& input, std::string &filename, int tstep = 0, int y0 = 0, int nytot = -1);
 
 };
 typedef mdepthall mdepthall_t;
@@ -19,11 +19,12 @@ class eoswrap{
   size_t nspec, nz;
   float ABUND[MAX_ELEM];
   double tABUND;
-  float xna, xne;
+  double xna, xne;
   int IXH1, IXHE1;
+  bool thread_safe; // can several instances be called concurrently?
   
-  eoswrap(){};
-  ~eoswrap(){};
+  eoswrap(): thread_safe(false){};
+  virtual ~eoswrap(){};
   //eoswrap(std::vector<line_t> &lines, std::string &abfile, double grav = 4.44);
   
   
@@ -40,8 +41,9 @@ class eoswrap{
   virtual void  hydrostatic      (int ndep, double *tau, double *t, double *Pg, double *rho,
 				  double *nel, double *pel,  double *z, double *cmass, double pgas_bound, float tol = 1.0e-5) = 0;
   virtual void unique(void)=0;
-  virtual void store_partial_pressures(int ndep, int k, float na, float ne)=0;
-  virtual void read_partial_pressures(int k, std::vector<float> &frac, std::vector<float> &part, float &xa, float &xe)=0;
+  virtual void store_partial_pressures(int ndep, int k, double na, double ne)=0;
+  virtual void read_partial_pressures(int k, std::vector<double> &frac, std::vector<double> &part, double &xa, double &xe)=0;
+  virtual void copy_partial_pressures(const eoswrap &in){};
 
   virtual void contOpacity_TPg  (double T, double Pg, int nw, double *w, double *opac, double *scattering, double Pe=-1.0) = 0;
   virtual void  contOpacity_TRho  (double T, double rho, int nw, double *w, double *opac,
@@ -51,7 +53,7 @@ class eoswrap{
 			double *nne, int touse,  int keep_nne, float tol) = 0;
 
   virtual   void contOpacity        (double T, int nw, double *w,
-				     double *opac, double *scattering, std::vector<float> &frac, float na, float ne) = 0;
+				     double *opac, double *scattering, std::vector<double> &frac, double na, double ne) = 0;
 };
 
 
@@ -1,11 +1,41 @@
+/* ---
+   fillDensities: fills the gas pressure / density / electron density and
+   the depth scales (ltau500, z, cmass) of a model cube, or puts each
+   column in hydrostatic equilibrium.
+
+   The cube is processed in y-strips of nrows rows. Rank 0 reads each
+   strip of each time step as a hyperslab, sends it to a free rank and
+   writes it to the output file when it comes back, so the memory use does
+   not depend on the size of the cube. The columns of a strip are processed
+   by OpenMP threads with one EOS instance per thread. With one MPI rank,
+   rank 0 processes the strips itself.
+
+   usage: mpiexec -n N ./fillDensities.x filein.nc fileout.nc [z | tau | cmass] [0 | 1] [nrows] [eos_type]
+
+   eos_type = 0 (default) uses the fortran EOS (ceos), which is not
+   thread safe: its calls are serialized between threads, so use MPI
+   ranks rather than threads with it. eos_type = 2 (piskunov) is thread
+   safe.
+
+   Modifications:
+           2026-10-19: MPI + OpenMP version that works on y-strips and
+                       reports columns per second.
+   --- */
+
+#include <mpi.h>
 #include <vector>
 #include <string>
 #include <cstdio>
 #include <cmath>
+#include <cstring>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 #include "io.h"
+#include "input.h"
 #include "ceos.h"
+#include "piskunov.h"
 #include "depthmodel.h"
-#include "netcdf.h"
 #include "cmemt.h"
 #include "physical_consts.h"
 
@@ -20,203 +50,435 @@ enum scal_t{
 };
 
 
+/* --- Settings of the run, broadcasted to all ranks --- */
+
+struct fdens_t{
+  int scale, hydrostat, touse, keep_nne, bound, eos_type;
+  int nt, ny, nx, ndep, nrows;
+};
+
+
+/* --- One EOS instance per thread --- */
+
+template <class T> struct eospool{
+  std::vector<T*> e;
+
+  eospool(int n){
+    for(int ii=0; ii<n; ii++) e.push_back(new T(4.44));
+  }
+  ~eospool(){
+    for(auto &it: e) delete it;
+  }
+};
+
+/* ------------------------------------------------------------------------------- */
+
+template <class T> void fillEOS(T &eos, mdepth &mm, fdens_t const& par)
+{
+  double *temp = mm.temp, *pgas = mm.pgas, *rho = mm.rho, *nne = mm.nne;
+  int const ndep = mm.ndep;
+
+  for(int kk = 0; kk < ndep; kk++){
+    if(par.touse == 0){
+      if(par.keep_nne) eos.nne_from_T_Pg_nne( temp[kk], pgas[kk], rho[kk], nne[kk]);
+      else             nne[kk] = eos.nne_from_T_Pg( temp[kk], pgas[kk], rho[kk]);
+    }else if(par.touse == 1){
+      if(par.keep_nne) eos.nne_from_T_rho_nne( temp[kk], pgas[kk], rho[kk], nne[kk]);
+      else             nne[kk] = eos.nne_from_T_rho(temp[kk], pgas[kk], rho[kk]);
+    }else if(par.touse == 2)
+      rho[kk] =  eos.rho_from_T_nne(temp[kk], pgas[kk], nne[kk]);
+
+    eos.store_partial_pressures(ndep, kk, eos.xna, eos.xne);
+  }
+}
+
+/* ------------------------------------------------------------------------------- */
+
+template <class T> void hydroEOS(T &eos, mdepth &mm, fdens_t const& par)
+{
+  mm.fixBoundary(par.touse+1, eos);
+  mm.getPressureScale(0, par.bound, eos);
+}
+
+/* ------------------------------------------------------------------------------- */
+
+template <class T> void fillColumn(T &eos, mdepth &mm, fdens_t const& par, vector<double> &kappa)
+{
+  int const ndep = mm.ndep;
+  int nw = 1;
+  double wav = 5000.0, scat = 0.0;
+  vector<double> frac, part;
+  double na=0, ne=0;
+
+  double *temp = mm.temp;
+  double *rho = mm.rho;
+  double *tau = mm.ltau;
+  double *z   = mm.z;
+  double *cmass=mm.cmass;
+
+
+  if(par.hydrostat == 0 ){
+
+    /* --- EOS: Fill pressure / desities (serialized for ceos) --- */
+
+    if(eos.thread_safe) fillEOS(eos, mm, par);
+    else{
+#pragma omp critical(eos_call)
+      fillEOS(eos, mm, par);
+    }
+
+
+    /* --- Get kappa_5000 --- */
+
+    for(int kk = 0; kk < ndep; kk++){
+      eos.read_partial_pressures(kk, frac, part, na, ne);
+      eos.contOpacity(temp[kk], nw,  &wav, &kappa[kk], &scat, frac, na, ne);
+    }
+
+
+    /* --- compute the depth-scale --- */
+
+    if(par.scale == Z){
+      //
+      eos.read_partial_pressures(0, frac, part, na, ne);
+      tau[0] = 0.5 * kappa[0] * (z[0] - z[1]);
+      cmass[0] = (na + ne) * (phyc::BK * temp[0] / eos.gravity);
+
+      for(int k = 1; k < ndep; k++){
+	tau[k] = tau[k-1] + 0.5 * (kappa[k-1] + kappa[k]) * (z[k-1] - z[k]);
+	cmass[k] = cmass[k-1] + 0.5 * (rho[k-1] + rho[k]) * (z[k-1] - z[k]);
+      }
+      for(int k = 0; k < ndep; k++){
+	tau[k] = log10(tau[k]);
+      }
+    }else if(par.scale == LTAU){
+      double otau = pow(10.0, tau[0]);
+      cmass[0] = (otau / kappa[0]) * rho[0];
+      z[0] = 0.0;
+
+      for(int k = 1; k < ndep; k++){
+	double itau = pow(10.0, tau[k]);
+	z[k] = z[k-1] - 2.0 * (itau - otau) / (kappa[k] + kappa[k-1]);
+	cmass[k] = cmass[k-1] + 0.5*(rho[k-1] + rho[k])* (z[k-1] - z[k]);
+	otau = itau;
+      } // k
+    }else{
+      z[0] = 0.0;
+      tau[0] = 0.0; //kappa[0]/rho[0] * cmass[0];
+
+
+      for(int k = 1; k < ndep; k++){
+	z[k] = z[k-1] - 2.0 * (cmass[k] - cmass[k-1]) / (rho[k-1] + rho[k]);
+	tau[k] = tau[k-1] + 0.5 * (kappa[k-1] + kappa[k]) * (z[k-1] - z[k]);
+      }
+
+      /* --- Extrapolate tau at the top --- */
+
+      double toff = exp(2.0 * log(tau[1]) - log(tau[2]));
+
+
+      for(int k = 0; k < ndep; k++){
+	tau[k] = log10(tau[k]+toff);
+      }
+
+    }
+  }else{
+
+    /* --- Do hydrostatic eq. --- */
+
+    for(int kk=0; kk<ndep; kk++) mm.tau[kk] = pow(10.0, tau[kk]);
+
+    if(eos.thread_safe) hydroEOS(eos, mm, par);
+    else{
+#pragma omp critical(eos_call)
+      hydroEOS(eos, mm, par);
+    }
+
+    for(int kk=0; kk<ndep; kk++) mm.tau[kk] = log10( tau[kk]);
+  }
+}
+
+/* ------------------------------------------------------------------------------- */
+
+template <class T> void fillStrip(mdepthall_t &m, fdens_t const& par, eospool<T> &pool)
+{
+  int const nx = m.cub.size(1), ndep = par.ndep;
+  long const ncol = long(m.cub.size(0)) * nx;
+
+#pragma omp parallel default(shared)
+  {
+#ifdef _OPENMP
+    int const tid = omp_get_thread_num();
+#else
+    int const tid = 0;
+#endif
+    mdepth mm(ndep);
+    vector<double> kappa(ndep, 0.0);
+
+#pragma omp for schedule(dynamic, 1)
+    for(long ii = 0; ii < ncol; ii++){
+      int const yy = int(ii / nx), xx = int(ii % nx);
+
+      memcpy(&mm.cub(0,0), &m.cub(yy,xx,0,0), ndep*13*sizeof(double));
+      fillColumn(*pool.e[tid], mm, par, kappa);
+      memcpy(&m.cub(yy,xx,0,0), &mm.cub(0,0), ndep*13*sizeof(double));
+    }
+  }
+}
+
+/* ------------------------------------------------------------------------------- */
+
+void processStrip(mdepthall_t &m, fdens_t const& par, eospool<ceos> &ce, eospool<eos::piskunov> &pe)
+{
+  if(par.eos_type == 2) fillStrip(m, par, pe);
+  else                  fillStrip(m, par, ce);
+}
+
+/* ------------------------------------------------------------------------------- */
+
+void readStrip(iput_t const& input, string &ifile, mdepthall_t &m, fdens_t const& par, int job)
+{
+  int const nstrip = (par.ny + par.nrows - 1) / par.nrows;
+  int const tt = job / nstrip, y0 = (job % nstrip) * par.nrows;
+  int const nys = std::min(par.nrows, par.ny - y0);
+
+  m.cub.d.clear(); // variables that are not in the file are zero
+  m.read_model2(input, ifile, tt, false, y0, nys);
+}
+
+/* ------------------------------------------------------------------------------- */
+
+void writeStrip(iput_t const& input, string &ofile, mdepthall_t &m, fdens_t const& par, int job)
+{
+  int const nstrip = (par.ny + par.nrows - 1) / par.nrows;
+  int const tt = job / nstrip, y0 = (job % nstrip) * par.nrows;
+
+  m.write_model2(input, ofile, tt, y0, par.ny);
+}
+
+/* ------------------------------------------------------------------------------- */
+
 int main(int narg, char *argv[])
 {
-  
+
+  /* --- Init MPI, only the main thread of each rank calls it. With a
+     library that does not provide MPI_THREAD_FUNNELED, use one thread --- */
+
+  int nprocs = 1, myrank = 0, provided = MPI_THREAD_SINGLE;
+  MPI_Init_thread(&narg, &argv, MPI_THREAD_FUNNELED, &provided);
+  MPI_Comm_size(MPI_COMM_WORLD, &nprocs);
+  MPI_Comm_rank(MPI_COMM_WORLD, &myrank);
+
+#ifdef _OPENMP
+  if(provided < MPI_THREAD_FUNNELED){
+    if(myrank == 0) cerr<<"WARNING, the MPI library does not provide MPI_THREAD_FUNNELED, using one thread per rank"<<endl;
+    omp_set_num_threads(1);
+  }
+#endif
+
+
   /* --- Define I/O --- */
-  
+
   string ifile, ofile, scal;
-  if(narg != 5){
-    cerr<<"usage: ./fillDensities filein.nc fileout.nc [z | tau | cmass] [0 | 1]"<<endl;
-    exit(0);
+  if(narg < 5 || narg > 7){
+    if(myrank == 0)
+      cerr<<"usage: [mpiexec -n N] ./fillDensities.x filein.nc fileout.nc [z | tau | cmass] [0 | 1] [nrows] [eos_type]"<<endl;
+    MPI_Finalize();
+    return 0;
   }
-  
+
   ifile = string(argv[1]);
   ofile = string(argv[2]);
   scal = string(argv[3]);
-  int hydrostat = atoi(argv[4]);
-  cerr<<"Compute hydrostatic eq. -> "<<hydrostat <<endl;
+
+  fdens_t par;
+  par.hydrostat = atoi(argv[4]);
+  par.nrows = ((narg > 5) ? std::max(atoi(argv[5]), 1) : 1);
+  par.eos_type = ((narg > 6) ? atoi(argv[6]) : 0);
   //
 
   scal_t scale = NONE;
   if      (scal == string("z"))    scale = Z;
   else if(scal == string("tau"))   scale = LTAU;
   else if(scal == string("cmass")) scale = CMASS;
+  par.scale = scale;
 
-  if(scale == NONE){
-    cerr<<"ERROR, scale must be [tau | z | cmass]"<<endl;
-    exit(0);
+  if(scale == NONE || (par.eos_type != 0 && par.eos_type != 2)){
+    if(myrank == 0){
+      if(scale == NONE) cerr<<"ERROR, scale must be [tau | z | cmass]"<<endl;
+      else              cerr<<"ERROR, eos_type must be 0 (ceos) or 2 (piskunov)"<<endl;
+    }
+    MPI_Finalize();
+    return 0;
   }
 
-  
-    
-  /* --- Get dimensions --- */
 
-  vector<int> dim;
-  {
-    io ifil(ifile, NcFile::read);
-    dim = ifil.dimSize("temp");
+  /* --- The model routines only use the storage settings of the input --- */
+
+  iput_t input;
+  input.fit_tr = 0;
+  input.nc_deflate = 0, input.nc_shuffle = 0, input.nc_pixel_chunks = 0;
+
+
+  /* --- Get dimensions and check densities/pressures in the 1st pixel --- */
+
+  par.touse = -1;
+  if(myrank == 0){
+
+    vector<int> dim;
+    {
+      io ifil(ifile, NcFile::read);
+      dim = ifil.dimSize("temp");
+    }
+    par.nt = dim[0], par.ny = dim[1], par.nx = dim[2], par.ndep = dim[3];
+    par.nrows = std::min(par.nrows, par.ny);
+
+    mdepthall_t m;
+    par.bound = m.read_model2(input, ifile, 0, false, 0, 1);
+    //
+    if     (fabs(m.cub(0,0,6,1) - m.cub(0,0,6,0)) > 0.0) par.touse = 0;
+    else if(fabs(m.cub(0,0,7,1) - m.cub(0,0,7,0)) > 0.0) par.touse = 1;
+    else if(fabs(m.cub(0,0,8,1) - m.cub(0,0,8,0)) > 0.0) par.touse = 2;
+
+    par.keep_nne = 0;
+    if(fabs(m.cub(0,0,8,1) - m.cub(0,0,8,0)) > 0.0) par.keep_nne = 1;
   }
-  int ndep = dim[3];
 
-  /* --- Read 1st time-step and check densities/pressures --- */
-  
-  mdepthall_t m;
-  int bound = m.read_model2(ifile,(int)0, false);
-  //
-  int touse = -1;
-  if     (fabs(m.cub(0,0,6,1) - m.cub(0,0,6,0)) > 0.0) touse = 0;
-  else if(fabs(m.cub(0,0,7,1) - m.cub(0,0,7,0)) > 0.0) touse = 1;
-  else if(fabs(m.cub(0,0,8,1) - m.cub(0,0,8,0)) > 0.0) touse = 2;
-  //
-  if(touse == -1){
-    cerr<<"ERROR, you must provide at least one non-zero density/pressure scale"<<endl;
-    exit(0);
+  MPI_Bcast(&par, sizeof(fdens_t), MPI_BYTE, 0, MPI_COMM_WORLD);
+
+  if(par.touse == -1){
+    if(myrank == 0) cerr<<"ERROR, you must provide at least one non-zero density/pressure scale"<<endl;
+    MPI_Finalize();
+    return 0;
   }
 
-  bool keep_nne = false;
-  if(fabs(m.cub(0,0,8,1) - m.cub(0,0,8,0)) > 0.0) keep_nne = true;
-  
-  
-  vector<string> names = {"Pgas","Dens", "Nelect"};
-  cerr<<"EOS: using ["<<names[touse]<<"] -> Keep_nne = ["<<keep_nne<<"]"<<endl;
-  fprintf(stderr,"avmol=%e, totalAbund=%e\n", m.eos.avmol, m.eos.totalAbund);
 
-  
-  /* --- Some vars --- */
+  /* --- EOS instances of this rank --- */
 
-  vector<double> kappa;
-  kappa.resize(ndep);
-  int nw = 1;
-  double wav = 5000.0, scat = 0.0;
-  vector<float> frac, part;
-  float na=0, ne=0;
-  mdepth mm(m.ndep);
-  
-  /* --- Loop t-steps --- */
-  
-  for(int tt = 0; tt<dim[0]; tt++){
-
-    int npix = dim[1] * dim[2];
-    int per = 0, oper = -1, ipix = 0;
-
-      
-    /* --- Read Time step --- */
-    
-    if(tt > 0) m.read_model2(ifile, tt, false);
-    
-    
-    /* --- loop pixels --- */
-    
-    for(int yy = 0; yy < dim[1]; yy++){
-      for(int xx = 0; xx < dim[2]; xx++){
-
-	memcpy(&mm.cub(0,0), &m.cub(yy,xx,0,0), m.ndep*13*sizeof(double));
-	
-	double *temp = mm.temp;
-	double *pgas = mm.pgas;
-	double *rho = mm.rho;
-	double *nne = mm.nne;
-	double *tau = mm.ltau;
-	double *z   = mm.z;
-	double *pel = mm.pel;
-	double *cmass=mm.cmass;
-	
-
-	
-	/* --- EOS: Fill pressure / desities --- */
-	if(hydrostat == 0 ){
-	  for(int kk = 0; kk < ndep; kk++){
-	    if(touse == 0)
-	      if(keep_nne) m.eos.nne_from_T_Pg_nne( temp[kk], pgas[kk], rho[kk], nne[kk]);
-	      else         nne[kk] = m.eos.nne_from_T_Pg( temp[kk], pgas[kk], rho[kk]);
-	    else if(touse == 1)
-	      if(keep_nne) m.eos.nne_from_T_rho_nne( temp[kk], pgas[kk], rho[kk], nne[kk]);
-	      else         nne[kk] = m.eos.nne_from_T_rho(temp[kk], pgas[kk], rho[kk]);
-	    else if(touse == 2)
-	      rho[kk] =  m.eos.rho_from_T_nne(temp[kk], pgas[kk], nne[kk]);
-	    
-	    m.eos.store_partial_pressures(ndep, kk, m.eos.xna, m.eos.xne);
-	    m.eos.read_partial_pressures(kk, frac, part, na, ne);
-	    
-	    /* --- Get kappa_5000 --- */
-	    
-	    m.eos.contOpacity(temp[kk], nw,  &wav, &kappa[kk],
-			      &scat, frac, na, ne);
-	    //fprintf(stderr,"%d %e %e\n", kk, kappa[kk], pgas[kk]);
-	  }
-	  /* --- compute the depth-scale --- */
-	  
-	  if(scale == Z){
-	    //
-	    m.eos.read_partial_pressures(0, frac, part, na, ne);
-	    tau[0] = 0.5 * kappa[0] * (z[0] - z[1]);
-	    cmass[0] = (na + ne) * (phyc::BK * temp[0] / m.eos.gravity);
-	    
-	    for(int k = 1; k < ndep; k++){
-	      tau[k] = tau[k-1] + 0.5 * (kappa[k-1] + kappa[k]) * (z[k-1] - z[k]);
-	      cmass[k] = cmass[k-1] + 0.5 * (rho[k-1] + rho[k]) * (z[k-1] - z[k]);
-	    }
-	    for(int k = 0; k < ndep; k++){
-	      tau[k] = log10(tau[k]);
-	    }
-	  }else if(scale == LTAU){
-	    double otau = pow(10.0, tau[0]);
-	    cmass[0] = (otau / kappa[0]) * rho[0];
-	    z[0] = 0.0;
-	    
-	    for(int k = 1; k < ndep; k++){
-	      double itau = pow(10.0, tau[k]);
-	      z[k] = z[k-1] - 2.0 * (itau - otau) / (kappa[k] + kappa[k-1]);
-	      cmass[k] = cmass[k-1] + 0.5*(rho[k-1] + rho[k])* (z[k-1] - z[k]);
-	      otau = itau;
-	    } // k
-	  }else{
-	    z[0] = 0.0;
-	    tau[0] = 0.0; //kappa[0]/rho[0] * cmass[0];
-	    
-	    
-	    for(int k = 1; k < ndep; k++){
-	      z[k] = z[k-1] - 2.0 * (cmass[k] - cmass[k-1]) / (rho[k-1] + rho[k]);
-	      tau[k] = tau[k-1] + 0.5 * (kappa[k-1] + kappa[k]) * (z[k-1] - z[k]);
-	    }
-
-	    /* --- Extrapolate tau at the top --- */
-	    
-	    double toff = exp(2.0 * log(tau[1]) - log(tau[2]));
-	    
-	    
-	    for(int k = 0; k < ndep; k++){
-	      tau[k] = log10(tau[k]+toff);
-	    }
-	    
-	  }
-	}else{
-	  
-	  /* --- Do hydrostatic eq. --- */
-	  for(int kk=0; kk<m.ndep; kk++) mm.tau[kk] = pow(10.0, tau[kk]);
-	  mm.fixBoundary(touse+1, m.eos);
-	  mm.getPressureScale(0, bound, m.eos);
-	  for(int kk=0; kk<m.ndep; kk++) mm.tau[kk] = log10( tau[kk]);
+#ifdef _OPENMP
+  int const nthreads = omp_get_max_threads();
+#else
+  int const nthreads = 1;
+#endif
+
+  eospool<ceos>          ce((par.eos_type == 0) ? nthreads : 0);
+  eospool<eos::piskunov> pe((par.eos_type == 2) ? nthreads : 0);
+
+  if(myrank == 0){
+    vector<string> names = {"Pgas","Dens", "Nelect"};
+    cerr<<"Compute hydrostatic eq. -> "<<par.hydrostat <<endl;
+    cerr<<"EOS: using ["<<names[par.touse]<<"] -> Keep_nne = ["<<par.keep_nne<<"]"<<endl;
+    if(par.eos_type == 0) fprintf(stderr,"avmol=%e, totalAbund=%e\n", ce.e[0]->avmol, ce.e[0]->totalAbund);
+    else                  fprintf(stderr,"avmol=%e, totalAbund=%e\n", pe.e[0]->avmol, pe.e[0]->totalAbund);
+    fprintf(stderr,"fillDensities: %d x %d x %d columns in strips of %d rows, %d ranks x %d threads\n",
+	    par.nt, par.ny, par.nx, par.nrows, nprocs, nthreads);
+  }
+
+
+  /* --- Jobs are (time-step, strip) pairs, rank 0 does all the I/O --- */
+
+  int const nstrip = (par.ny + par.nrows - 1) / par.nrows;
+  int const njobs = par.nt * nstrip;
+  long const ntot = long(par.nt) * par.ny * par.nx;
+  double const t0 = MPI_Wtime();
+
+  if(myrank == 0){
 
+    long ndone = 0;
+    int oper = -1;
 
+    if(nprocs == 1){
+
+      /* --- Serial: read, process and write each strip --- */
+
+      mdepthall_t m;
+      for(int job = 0; job < njobs; job++){
+	readStrip(input, ifile, m, par, job);
+	processStrip(m, par, ce, pe);
+	writeStrip(input, ofile, m, par, job);
+
+	ndone += long(m.cub.size(0)) * par.nx;
+	int per = int(ndone * 100 / ntot);
+	if(per != oper){
+	  fprintf(stderr,"\rProcessing -> %d%s (%.1f columns/s)", per, "%", ndone / (MPI_Wtime()-t0));
+	  oper = per;
 	}
+      }
+    }else{
+
+      /* --- Send one strip to each rank and a new one every time a strip comes back --- */
+
+      vector<mdepthall_t> slot(nprocs);
+      vector<int> sjob(nprocs, -1);
+      int next = 0, busy = 0, hdr[2] = {0,0};
+      MPI_Status status;
+
+      for(int ww = 1; ww < nprocs; ww++){
+	if(next >= njobs) break;
+	readStrip(input, ifile, slot[ww], par, next);
+	hdr[0] = next, hdr[1] = slot[ww].cub.size(0);
+	MPI_Send(hdr, 2, MPI_INT, ww, 1, MPI_COMM_WORLD);
+	MPI_Send(&slot[ww].cub.d[0], (int)slot[ww].cub.d.size(), MPI_DOUBLE, ww, 2, MPI_COMM_WORLD);
+	sjob[ww] = next++, busy++;
+      }
+
+      while(busy > 0){
+	MPI_Recv(hdr, 2, MPI_INT, MPI_ANY_SOURCE, 1, MPI_COMM_WORLD, &status);
+	int const ww = status.MPI_SOURCE;
+	MPI_Recv(&slot[ww].cub.d[0], (int)slot[ww].cub.d.size(), MPI_DOUBLE, ww, 2, MPI_COMM_WORLD, &status);
+	busy--;
+
+	writeStrip(input, ofile, slot[ww], par, sjob[ww]);
+	ndone += long(slot[ww].cub.size(0)) * par.nx;
+
+	if(next < njobs){
+	  readStrip(input, ifile, slot[ww], par, next);
+	  hdr[0] = next, hdr[1] = slot[ww].cub.size(0);
+	  MPI_Send(hdr, 2, MPI_INT, ww, 1, MPI_COMM_WORLD);
+	  MPI_Send(&slot[ww].cub.d[0], (int)slot[ww].cub.d.size(), MPI_DOUBLE, ww, 2, MPI_COMM_WORLD);
+	  sjob[ww] = next++, busy++;
+	}
+
+	int per = int(ndone * 100 / ntot);
+	if(per != oper){
+	  fprintf(stderr,"\rProcessing -> %d%s (%.1f columns/s)", per, "%", ndone / (MPI_Wtime()-t0));
+	  oper = per;
+	}
+      }
+
+
+      /* --- Stop the other ranks --- */
+
+      hdr[0] = -1, hdr[1] = 0;
+      for(int ww = 1; ww < nprocs; ww++) MPI_Send(hdr, 2, MPI_INT, ww, 1, MPI_COMM_WORLD);
+    }
+
+    double const dt = MPI_Wtime() - t0;
+    fprintf(stderr,"\nfillDensities: %ld columns in %.2f s -> %.1f columns/s\n", ntot, dt, ntot / dt);
+
+  }else{
+
+    /* --- Process strips until rank 0 says stop --- */
+
+    mdepthall_t m;
+    m.ndep = par.ndep;
+    int hdr[2] = {0,0};
+    MPI_Status status;
+
+    while(1){
+      MPI_Recv(hdr, 2, MPI_INT, 0, 1, MPI_COMM_WORLD, &status);
+      if(hdr[0] < 0) break;
+
+      m.cub.set({hdr[1], par.nx, 13, par.ndep});
+      MPI_Recv(&m.cub.d[0], (int)m.cub.d.size(), MPI_DOUBLE, 0, 2, MPI_COMM_WORLD, &status);
+
+      processStrip(m, par, ce, pe);
+
+      MPI_Send(hdr, 2, MPI_INT, 0, 1, MPI_COMM_WORLD);
+      MPI_Send(&m.cub.d[0], (int)m.cub.d.size(), MPI_DOUBLE, 0, 2, MPI_COMM_WORLD);
+    }
+  }
 
-	memcpy(&m.cub(yy,xx,0,0), &mm.cub(0,0), 13*m.ndep*sizeof(double));
-	
-	per = ++ipix * (100. / npix);
-	fprintf(stderr,"\r[t=%d, pix=%d/%d] Processing -> %d%s", tt,ipix-1,npix-1,per,"%");
-	
-      } // xx
-    }//yy
-    
-    cerr<<endl;
-    
-    
-    /* --- Write to file --- */
-
-    m.write_model2(ofile, tt);
-    
-  } // tt
-  
+  MPI_Finalize();
+  return 0;
 }
@@ -100,6 +100,7 @@ iput_t read_input(std::string filename, bool verbose){
   input.marquardt_damping = -1.0;
   input.svd_thres = 1.0e-5;
   input.svd_split = 1;
+  input.svd_scaled = 0;
   input.nodes.regularize[0] = 0.0;
   input.nodes.nregul = 1;
   input.random_first = 0;
@@ -107,6 +108,14 @@ iput_t read_input(std::string filename, bool verbose){
   input.tcut = -1.0;
   input.use_geo_accel = 0;
   input.delay_bracket = 0;
+  input.broyden = 0;
+  input.broyden_thres = 0.5;
+  input.rf_threads = 1;
+  input.lte_precision = 0;
+  input.nlte_depth_tol = 0.0;
+  input.nlte_depth_check = 100;
+  input.pixel_timeout = 0.0;
+  input.group_timeout = 0.0;
   input.vgrad = 0;
   input.eos_type = 0;
   input.ab_len = 0;
@@ -118,6 +127,13 @@ iput_t read_input(std::string filename, bool verbose){
   input.inv_depth_opt = 0;
   input.nresp = 0;
   input.fit_tr = 0;
+  input.nc_deflate = 0;
+  input.nc_shuffle = 0;
+  input.nc_pixel_chunks = 0;
+  input.overlap_io = 1;
+  input.package_timeout = 0.0;
+  input.master_groups = 0;
+  input.group_packages = 4;
   
   // Open File and read
   std::ifstream in(filename, std::ios::in | std::ios::binary);
@@ -216,6 +232,31 @@ iput_t read_input(std::string filename, bool verbose){
 	input.delay_bracket = atoi(field.c_str());
 	set = true;
       }
+      else if(key == "broyden_updates"){
+	input.broyden = atoi(field.c_str());
+	set = true;
+      }
+      else if(key == "broyden_threshold"){
+	input.broyden_thres = atof(field.c_str());
+	set = true;
+      }
+      else if(key == "rf_threads"){
+	input.rf_threads = std::max<int>(1, atoi(field.c_str()));
+	set = true;
+      }
+      else if(key == "lte_precision"){
+	if(field == "single") input.lte_precision = 1;
+	else input.lte_precision = 0; // double
+	set = true;
+      }
+      else if(key == "nlte_depth_tolerance"){
+	input.nlte_depth_tol = std::max<double>(0.0, atof(field.c_str()));
+	set = true;
+      }
+      else if(key == "nlte_depth_check"){
+	input.nlte_depth_check = std::max<int>(0, atoi(field.c_str()));
+	set = true;
+      }
       else if(key == "depth_interpolation"){
 	input.dint = atoi(field.c_str());
 	set = true;
@@ -304,6 +345,57 @@ iput_t read_input(std::string filename, bool verbose){
 	input.max_inv_iter = atoi(field.c_str());
 	set = true;
       }
+      else if(key == "output_float"){
+	input.nc_float = strsplit(field,",");
+	set = true;
+      }
+      else if(key == "output_double"){
+	input.nc_double = strsplit(field,",");
+	set = true;
+      }
+      else if(key == "output_chunking"){
+	if(field == "pixel") input.nc_pixel_chunks = 1;
+	else if(field == "none") input.nc_pixel_chunks = 0;
+	else input.nc_pixel_chunks = atoi(field.c_str());
+	set = true;
+      }
+      else if(key == "output_deflate"){
+	input.nc_deflate = std::max<int>(0, std::min<int>(9, atoi(field.c_str())));
+	set = true;
+      }
+      else if(key == "output_shuffle"){
+	if(field == "true") input.nc_shuffle = 1;
+	else if(field == "false") input.nc_shuffle = 0;
+	else input.nc_shuffle = atoi(field.c_str());
+	set = true;
+      }
+      else if(key == "overlap_io"){
+	if(field == "true") input.overlap_io = 1;
+	else if(field == "false") input.overlap_io = 0;
+	else input.overlap_io = atoi(field.c_str());
+	set = true;
+      }
+      else if(key == "package_timeout"){
+	input.package_timeout = std::max<double>(0.0, atof(field.c_str()));
+	set = true;
+      }
+      else if(key == "pixel_timeout"){
+	input.pixel_timeout = std::max<double>(0.0, atof(field.c_str()));
+	set = true;
+      }
+      else if(key == "master_groups"){
+	if(field == "node") input.master_groups = -1;
+	else input.master_groups = atoi(field.c_str());
+	set = true;
+      }
+      else if(key == "group_timeout"){
+	input.group_timeout = std::max<double>(0.0, atof(field.c_str()));
+	set = true;
+      }
+      else if(key == "group_packages"){
+	input.group_packages = std::max<int>(1, atoi(field.c_str()));
+	set = true;
+      }
       else if(key == "master_threads"){
 	input.master_threads = atoi(field.c_str());
 	set = true;
@@ -312,6 +404,10 @@ iput_t read_input(std::string filename, bool verbose){
 	input.svd_split = atoi(field.c_str());
 	set = true;
       }
+      else if(key == "svd_scaled"){
+	input.svd_scaled = atoi(field.c_str());
+	set = true;
+      }
       else if(key == "wavelet_order"){
 	input.wavelet_order = atoi(field.c_str());
 	set = true;
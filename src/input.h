@@ -4,6 +4,7 @@
 #include <vector>
 #include <iostream>
 #include "cmemt.h"
+#include "telemetry.h"
 //
 /* --- line list struct --- */
 struct line{
@@ -88,18 +89,26 @@ typedef nodes nodes_t;
 
 /* --- input structure --- */
 struct iput{
-  unsigned long buffer_size, buffer_size1;
   int nt, ny, nx, ns, npar, npack, mode, nInv, inst_len, atmos_len, ab_len,
     nw_tot, boundary, ndep, solver, centder, thydro, dint, keep_nne, svd_split, random_first, depth_model,
     use_geo_accel, nresp, getResponse[8], delay_bracket, vgrad, verbose, use_eos, inv_depth_opt, eos_type,
-    fit_tr;
-  double mu, chi2_thres, sparse_threshold, dpar, init_step, marquardt_damping, svd_thres,  tcut;
+    fit_tr, broyden, rf_threads, lte_precision, master_groups, svd_scaled, nlte_depth_check;
+  double mu, chi2_thres, sparse_threshold, dpar, init_step, marquardt_damping, svd_thres,  tcut, broyden_thres,
+    nlte_depth_tol, pixel_timeout, group_timeout;
   std::string imodel, omodel, iprof, oprof, myid, instrument,
     atmos_type, wavelet_type, oatmos, abfile;
   int xx, yy, ipix, nPacked;
   std::vector<double> chi;
+  std::vector<pixstat_t> tel;
   int myrank, nprocs, cgrad;
   unsigned max_inv_iter, master_threads, wavelet_order;
+  int nc_deflate, nc_shuffle, nc_pixel_chunks; // storage of the output files (master only)
+  int overlap_io; // overlap the I/O of consecutive time steps with the computations (master only)
+  double package_timeout; // re-issue packages that take longer than this times the expected time (master only)
+  int group_packages;     // packages per slave in each block sent to a sub-master (master only)
+  std::vector<int> workers; // ranks that get packages from this (sub-)master, 1..nprocs-1 if empty
+  std::vector<int> submasters; // ranks in workers that are sub-masters, they get two blocks at a time
+  std::vector<std::string> nc_float, nc_double;
   std::vector<unsigned long> ntosend;
   std::vector<std::string> ilines;
   std::vector<region_t> regions;
@@ -62,6 +62,48 @@ void io::initDim(vector<string> vname, vector<int> vsize){
   }
 }
 //
+void io::setStorage(int ideflate, bool ishuffle, bool ipixel_chunks,
+		    vector<string> const& ifloat_vars, vector<string> const& idouble_vars){
+
+  // Applies to the variables created after this call
+  deflate = std::max(0, std::min(9, ideflate));
+  shuffle = ishuffle;
+  pixel_chunks = ipixel_chunks;
+  float_vars = ifloat_vars;
+  double_vars = idouble_vars;
+}
+//
+void io::setVarStorage(NcVar &var){
+
+  vector<NcDim> vdims = var.getDims();
+  int ndim = (int)vdims.size();
+  if(ndim == 0) return;
+
+  
+  // One chunk per pixel and time step: (1, 1, 1, ...) in the
+  // time, y and x dimensions and full size in the rest. The master
+  // writes whole time steps, so the writes never split a chunk
+  
+  bool pixvar = false;
+  for(auto &it: vdims) if((it.getName() == "y") || (it.getName() == "x")) pixvar = true;
+  
+  if(pixel_chunks && pixvar){
+    vector<size_t> chunks(ndim);
+    for(int ii=0; ii<ndim; ii++){
+      string dn = vdims[ii].getName();
+      if(vdims[ii].isUnlimited() || (dn == "y") || (dn == "x")) chunks[ii] = 1;
+      else chunks[ii] = std::max<size_t>(1, vdims[ii].getSize());
+    }
+    var.setChunking(NcVar::nc_CHUNKED, chunks);
+  }
+
+  
+  // Deflate and shuffle filters
+  
+  if((deflate > 0) || shuffle)
+    var.setCompression(shuffle, (deflate > 0), deflate);
+}
+//
 vector<int> io::dimSize(string vname){
   // bool exist = false;
 
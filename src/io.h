@@ -27,11 +27,18 @@ class io{
   //
   std::vector<netCDF::NcDim> dims;
   std::vector<netCDF::NcVar> vars;
+
+  // Storage of the variables created by initVar (see setStorage)
+  int deflate;
+  bool shuffle, pixel_chunks;
+  std::vector<std::string> float_vars, double_vars;
+  
   // Constructor
-  io(std::string filename, netCDF::NcFile::FileMode mode = netCDF::NcFile::write, bool verbose = true){
+ io(std::string filename, netCDF::NcFile::FileMode mode = netCDF::NcFile::write, bool verbose = true):
+  deflate(0), shuffle(false), pixel_chunks(false){
     initRead(filename, mode, verbose);
   }
- io():ifile(NULL){};
+ io():ifile(NULL), deflate(0), shuffle(false), pixel_chunks(false){};
  
   // Destructor
   ~io(){
@@ -39,6 +46,12 @@ class io{
     vars.clear();
     delete ifile;
   }
+
+  // Close the file before the object goes out of scope
+  void close(){
+    delete ifile;
+    ifile = NULL;
+  }
   
   
   ////////////////////////////////////////
@@ -50,6 +63,10 @@ class io{
   void varAttr(std::string vname, std::string attr_n, std::string attr_v);
 
   std::vector<int> dimSize(std::string vname);
+  void setStorage(int ideflate, bool ishuffle, bool ipixel_chunks,
+		  std::vector<std::string> const& ifloat_vars = {},
+		  std::vector<std::string> const& idouble_vars = {});
+  void setVarStorage(netCDF::NcVar &var);
 
   //void initVar(std::string vname, std::vector<std::string> dnames){
 
@@ -60,8 +77,10 @@ class io{
   //////////////
 
   // bool read_Tstep(std::string vname, mat<double> &res,int irec = 0);
-  // Read variable assuming double
-  template <class T> bool read_Tstep(std::string vname, mat<T> &res, int irec = 0, bool verbose = true){
+  // Read variable assuming double. If ny > 0, only rows [y0, y0+ny) of the
+  // first limited dimension (y) are read, for variables with 2 or more limited dims
+  template <class T> bool read_Tstep(std::string vname, mat<T> &res, int irec = 0, bool verbose = true,
+				     int y0 = 0, int ny = -1){
   
     std::string inam = "io::read_Tstep: ";
     res.d.clear();
@@ -109,20 +128,29 @@ class io{
     //
     // std::cout << newdims.size()<<std::endl;
 
+    bool slab = ((ny > 0) && (newdims.size() > 1));
+    if(slab) newdims[0] = ny;
+    
     res.set(newdims);
     // std::cout << res.size(0)<<std::endl;
 
     if((ndim-newdims.size()) == 1){ // There is one unlimited dimention (time)
       std::vector<size_t> start, count;
+      bool first = true;
       //
       for(auto &it: vdims){
 	if(it.isUnlimited()){
 	  irec = std::min(int(it.getSize()-1), irec);
 	  start.push_back(irec);
 	  count.push_back(1);
+	}else if(slab && first){
+	  start.push_back(y0);
+	  count.push_back(ny);
+	  first = false;
 	}else{
 	  start.push_back(0);
 	  count.push_back(it.getSize());
+	  first = false;
 	}
       }
       vars[idx].getVar(start, count, &res.d[0]);
@@ -140,7 +168,12 @@ class io{
       }
 
     }else if((ndim-newdims.size()) == 0){ // All dimensions are limited -> read all
-      vars[idx].getVar(&res.d[0]);
+      if(slab){
+	std::vector<size_t> start(ndim, 0), count;
+	for(auto &it: vdims) count.push_back(it.getSize());
+	start[0] = y0, count[0] = ny;
+	vars[idx].getVar(start, count, &res.d[0]);
+      }else vars[idx].getVar(&res.d[0]);
       //
       if(verbose){
 	std::cout << inam <<"read "<<vname<<" ["<<res.size(0);
@@ -154,7 +187,9 @@ class io{
 
 
   
-  template <class T> bool write_Tstep(std::string vname, mat<T> &var, int irec = 0){
+  // If ny > 0, var only contains rows [y0, y0+ny) of the first limited
+  // dimension (y), as in read_Tstep. Strips are written silently.
+  template <class T> bool write_Tstep(std::string vname, mat<T> &var, int irec = 0, int y0 = 0, int ny = -1){
     std::string inam = "io::write_Tstep: ";
     
     // Check if the variable exists and copy it
@@ -176,28 +211,42 @@ class io{
     std::vector<netCDF::NcDim> idims =  ivar.getDims();
     int nun = 0 ;
     for(auto &it: idims) if(it.isUnlimited()) nun++;
+    bool slab = ((ny > 0) && ((int)idims.size()-nun > 1));
   
 
 
     // Check if it is a time var or not
     if(nun == 1){
       std::vector<size_t> start, count;
+      bool first = true;
       for(auto &it: idims){
 	if(it.isUnlimited()){
 	  start.push_back(irec);
 	  count.push_back(1);
+	}else if(slab && first){
+	  start.push_back(y0);
+	  count.push_back(ny);
+	  first = false;
 	}else{
 	  start.push_back(0);
 	  count.push_back(it.getSize());
+	  first = false;
 	}
       }
       ivar.putVar(start, count, &var.d[0]);
-      std::cerr << inam << "writing ["<<vname << "] (t="<< irec <<") to "<<file<<std::endl;
+      if(!slab) std::cerr << inam << "writing ["<<vname << "] (t="<< irec <<") to "<<file<<std::endl;
 
     } else if(nun == 0){
       var.fillNaN(0.0);
-      ivar.putVar(&var.d[0]);
-      std::cerr << inam << "writing ["<<vname << "] to "<<file<<std::endl;
+      if(slab){
+	std::vector<size_t> start(idims.size(), 0), count;
+	for(auto &it: idims) count.push_back(it.getSize());
+	start[0] = y0, count[0] = ny;
+	ivar.putVar(start, count, &var.d[0]);
+      }else{
+	ivar.putVar(&var.d[0]);
+	std::cerr << inam << "writing ["<<vname << "] to "<<file<<std::endl;
+      }
 
     } else{
       std::cerr << inam <<"ERROR, more than one time dimension is not implemented"<<std::endl;
@@ -233,10 +282,20 @@ class io{
       }
     }
     
-    if(typeid(T) == typeid(double)) vars.push_back(ifile->addVar(vname, netCDF::ncDouble,idims));
-    if(typeid(T) == typeid(float))  vars.push_back(ifile->addVar(vname, netCDF::ncFloat,idims));
-    if(typeid(T) == typeid(int))    vars.push_back(ifile->addVar(vname, netCDF::ncInt,   idims));
-    if(typeid(T) == typeid(short))  vars.push_back(ifile->addVar(vname, netCDF::ncShort, idims));
+    // Floating point variables can be stored with the precision selected in setStorage
+    bool fp = ((typeid(T) == typeid(double)) || (typeid(T) == typeid(float)));
+    bool tofloat  = fp && (std::find(float_vars.begin(), float_vars.end(), vname) != float_vars.end());
+    bool todouble = fp && (std::find(double_vars.begin(), double_vars.end(), vname) != double_vars.end());
+    
+    if(tofloat)                          vars.push_back(ifile->addVar(vname, netCDF::ncFloat, idims));
+    else if(todouble)                    vars.push_back(ifile->addVar(vname, netCDF::ncDouble,idims));
+    else if(typeid(T) == typeid(double)) vars.push_back(ifile->addVar(vname, netCDF::ncDouble,idims));
+    else if(typeid(T) == typeid(float))  vars.push_back(ifile->addVar(vname, netCDF::ncFloat,idims));
+    else if(typeid(T) == typeid(int))    vars.push_back(ifile->addVar(vname, netCDF::ncInt,   idims));
+    else if(typeid(T) == typeid(short))  vars.push_back(ifile->addVar(vname, netCDF::ncShort, idims));
+    else return;
+
+    setVarStorage(vars.back());
     
   }
   
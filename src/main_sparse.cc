@@ -39,8 +39,12 @@ int main(int narg, char* argv[]){
   //
   int nprocs = 1, myrank = 0, hlen = 0;
   char hostname[MPI_MAX_PROCESSOR_NAME];
-  int status = 0;
-  MPI_Init(&narg, &argv);
+  int status = 0, provided = MPI_THREAD_SINGLE;
+
+  /* --- The master overlaps the I/O with a helper thread (overlap_io) and
+     the slaves use OpenMP, only the main thread of each rank calls MPI --- */
+  
+  MPI_Init_thread(&narg, &argv, MPI_THREAD_FUNNELED, &provided);
 
 
   //
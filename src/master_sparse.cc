@@ -2,6 +2,12 @@
 #include <string>
 #include <netcdf>
 #include <cstdio>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <deque>
+#include <functional>
 //#include <omp.h>
 #include "io.h"
 #include "cmemt.h"
@@ -48,67 +54,611 @@ void read_instruments(iput_t &iput)
 }
 
 
-//
-void slaveInversion(iput_t &iput, mdepthall_t &m, mat<double> &obs, mat<double> &x, mat<double> &chi2, mat<double> &dsyn){
+/* --- Data of one time step. The master keeps two of them when the I/O
+   overlaps with the computations: one is processed while the other one is
+   written and re-filled with a later time step --- */
+
+struct pkg_t{
+  double tlast; // time when the last copy of the package was sent [s]
+  int ncopy;    // copies sent to the slaves
+  bool done;    // results received (late copies are discarded)
+
+  pkg_t(): tlast(0.0), ncopy(0), done(false){};
+};
+
+struct tstep_t{
+  std::atomic<int> tt;      // time step stored here, -1 while it is being read/written
+  unsigned long ipix, irec; // pixels sent and received
+  mat<double> obs, model, chi2, tel, dobs;
+  mdepthall_t im;
+  std::vector<pkg_t> pkg;   // dispatch state of each package, only used by the main thread
+  std::vector<region_t> regions; // instrumental data of a block (sub-masters), empty otherwise
+  
+  tstep_t(): tt(-1), ipix(0), irec(0){};
+
+  unsigned long npix(){ return (unsigned long)im.cub.size(0) * im.cub.size(1); };
+};
+
+
+/* --- Runs the I/O tasks of the master in order, in a helper thread. Only that
+   thread calls netCDF while it is active (the library is not thread safe). 
+   With async = false the tasks are executed right away --- */
+
+class io_worker{
+  std::thread thr;
+  std::mutex mtx;
+  std::condition_variable cv;
+  std::deque<std::function<void()>> tasks;
+  bool async, busy, stop;
+
+  void run(){
+    while(1){
+      std::function<void()> f;
+      {
+	std::unique_lock<std::mutex> lock(mtx);
+	cv.wait(lock, [this]{return (stop || !tasks.empty());});
+	if(tasks.empty()) return;
+	f = tasks.front(); tasks.pop_front();
+	busy = true;
+      }
+      f();
+      {
+	std::unique_lock<std::mutex> lock(mtx);
+	busy = false;
+      }
+      cv.notify_all();
+    }
+  }
+  
+public:
+  io_worker(bool iasync): async(iasync), busy(false), stop(false){
+    if(async) thr = std::thread(&io_worker::run, this);
+  }
+  
+  ~io_worker(){
+    if(!async) return;
+    {
+      std::unique_lock<std::mutex> lock(mtx);
+      stop = true;
+    }
+    cv.notify_all();
+    thr.join();
+  }
+
+  void push(std::function<void()> f){
+    if(!async){
+      f();
+      return;
+    }
+    {
+      std::unique_lock<std::mutex> lock(mtx);
+      tasks.push_back(f);
+    }
+    cv.notify_all();
+  }
+
+  void wait(){
+    if(!async) return;
+    std::unique_lock<std::mutex> lock(mtx);
+    cv.wait(lock, [this]{return (tasks.empty() && !busy);});
+  }
+};
+
+
+/* --- Read one time step (profiles and model) and get the free parameters.
+   The model of time step 0 has been read already to get the dimensions --- */
+
+void read_tstep(iput_t &input, io &ipfile, bool inversion, tstep_t &ts, int tt)
+{
+  if(inversion) ipfile.read_Tstep(string("profiles"), ts.obs, tt);
+  else ts.obs.set({input.ny, input.nx, input.nw_tot, input.ns});
+  
+  if(tt > 0) ts.im.read_model2(input, input.imodel, tt, true);
+
+  ts.im.model_parameters2(ts.model, input.nodes);
 
-  /* --- Init dimensions --- */
-  unsigned long ntot = (unsigned long)(x.size(0) * x.size(1));
-  int ncom = (int)(std::floor(ntot / (double)iput.npack));
-  if((unsigned long)(ncom * iput.npack) != ntot) ncom++;
-  int nprocs = iput.nprocs;
-  int iproc = 0;
-  unsigned long ipix = 0;
-  int tocom = ncom;
+  ts.chi2.set({input.ny, input.nx});
+  ts.tel.set({input.ny, input.nx, ps_nstat});
+  if(input.mode == 4) ts.dobs.set({input.ny, input.nx, input.nresp, input.ndep, input.nw_tot, input.ns});
+  
+  ts.ipix = 0, ts.irec = 0;
+  ts.tt = tt;
+}
+
+
+/* --- Write the results of one time step --- */
+
+void write_tstep(iput_t &input, io &opfile, bool inversion, tstep_t &ts, int tt)
+{
+  
+  /* --- Write model parameters, profiles and depth-stratified atmos --- */
+
+  if(inversion) ts.im.write_model2(input, input.oatmos, tt);
+  
+  opfile.write_Tstep(string("profiles"), ts.obs, tt);
+  if(input.mode == 4) opfile.write_Tstep(string("derivatives"), ts.dobs, tt);
+
+    
+  /* --- Write telemetry, one variable per counter --- */
+    
+  if(input.mode == 1){
+    mat<double> tmp(input.ny, input.nx);
+    for(int ii=0; ii<ps_nstat; ii++){
+      for(int yy=0; yy<input.ny; yy++)
+	for(int xx=0; xx<input.nx; xx++) tmp(yy,xx) = ts.tel(yy,xx,ii);
+      opfile.write_Tstep(string(pixstat_names[ii]), tmp, tt);
+    }
+  }
+}
 
+
+/* --- Check dimensions in inversion mode --- */
+
+void check_tstep(iput_t &input, tstep_t &ts, int nprocs)
+{
+  mat<double> &obs = ts.obs;
+  mdepthall_t &im = ts.im;
+  
+  if(obs.size(0) != im.cub.size(0) && obs.size(1) != im.cub.size(1)){
+    cerr << input.myid <<"ERROR, the input model and the observations do not have the same dimensions in X,Y axes:"<<endl;
+    cerr << "   -> "<<input.imodel<<" "<<formatVect<int>(im.cub.getdims())<<endl;
+    cerr << "   -> "<<input.iprof<<" "<<formatVect<int>(obs.getdims())<<endl;
+    
+    comm_kill_slaves(input, nprocs);
+    exit(0);
+  }
+  
+  if(obs.size(2) != input.nw_tot){
+    cerr << input.myid <<"ERROR, number of wavelenghts in input.cfg ["<<input.nw_tot<< "] does not match the observations ["<< obs.size(2) << "]"<<endl;
+    comm_kill_slaves(input, nprocs);
+    exit(0);
+  }
+}
+
+
+/* --- Send the pixels of all time steps to the slaves. A slave that is free
+   gets pixels of the next time step as soon as that one has been read, so the
+   slaves do not wait for the master to read and write the files. 
+   The results of a time step are written (and its buffer re-filled with a 
+   later time step) by the I/O worker once all its pixels have been received.
+
+   With package_timeout > 0, a package that has been out for longer than 
+   package_timeout times its expected duration (the mean time per pixel of the
+   packages received so far) is sent again to a slave that has nothing else 
+   to do. The first copy that comes back is used, the others are discarded.
+
+   The sub-masters of a two-level run use the same routine, each block of
+   pixels received from rank 0 is a "time step", and the communicator of 
+   their group. Rank 0 keeps two blocks in flight for each sub-master 
+   (input.submasters), so the group can start on the next block while the
+   last packages of the current one are processed. The poll function is
+   called while there are no results to receive, it can add time steps 
+   (input.nt). Only rank 0 prints the progress.
+
+   The late copies are waited for at the end as long as a package is allowed
+   to take. Returns the ranks that still owe one, they are passed back in 
+   "stale" in the next call: they get no package until their result has 
+   arrived (and been discarded) --- */
+
+vector<int> slaveTimeSteps(iput_t &input, vector<tstep_t> &ts, io_worker &iow, bool inversion,
+			   std::function<void(int)> const &on_done, MPI_Comm comm = MPI_COMM_WORLD,
+			   vector<int> const &stale = {}, std::function<void()> const &poll = []{})
+{
+  static const int max_copy = 3, min_timed = 4; // copies per package, packages timed before re-issuing
+  
+  int const nprocs = input.nprocs, nslot = (int)ts.size();
+  int const &nt = input.nt; // can grow in poll()
+  unsigned long const npack = (unsigned long)input.npack;
   int compute_gradient = 0; // dummy parameter here
-  chi2.set({x.size(0), x.size(1)});
+  int isend = 0, ndone = 0, iproc = 0, nreissue = 0, ntimed = 0, ireg = -1;
+  double tpix = 0.0, tcheck = 0.0, tbusy = 0.0, t0 = pixstat::getTime();
+  unsigned long npix = 0, nmsg = 0;
+  bool const retry = (input.package_timeout > 0.0), verb = (comm == MPI_COMM_WORLD);
+
   
+  /* --- Ranks that get packages from this master --- */
+
+  vector<int> workers = input.workers;
+  if(workers.size() == 0)
+    for(int ss = 1; ss<nprocs; ss++) workers.push_back(ss);
+
+  vector<char> late(nprocs, 0);
+  for(auto &ss: stale) late[ss] = 1;
 
-  if(nprocs > 1){
+  vector<int> depth(nprocs, 1);
+  for(auto &ss: input.submasters) depth[ss] = 2;
 
   
-    /* --- Init slaves with first package --- */
-    for(int ss = 1; ss<=min(nprocs-1,ncom); ss++)
-      comm_master_pack_data(iput, obs, x, ipix, ss, m, compute_gradient);
+  /* --- Packages that each slave is working on, in the order they were sent.
+     idle has one entry per free slot of a slave --- */
+  
+  struct busy_t{ int tt; unsigned long ipix; double t0; };
+  vector<std::deque<busy_t>> owner(nprocs);
+  vector<int> idle;
+
+  
+  /* --- Instrumental data of the block of time step it (sub-masters) --- */
+
+  auto set_regions = [&](tstep_t &it){
+    if((it.regions.size() == 0) || (ireg == it.tt)) return;
+    input.regions = it.regions, ireg = it.tt;
+  };
 
-    int per  = 0;
-    int oper  = -1;
-    float pno =  100.0 / double(mth::max<int>(1, ntot - 1));
-    unsigned long irec = 0;
-    fprintf(stdout,"\rProcessed -> %d%s -> sent=%d, received=%d     ", per, "%", ipix, irec);
+  
+  /* --- Send one package to slave proc, from the next time step if this
+     one has been sent completely and the next one is ready --- */
+  
+  auto send_next = [&](int proc){
+    tstep_t *it = &ts[isend % nslot];
+    
+    if((it->tt != isend) || (it->ipix >= it->npix())){
+      if(((isend+1) >= nt) || (ts[(isend+1) % nslot].tt != (isend+1))) return false;
+      
+      it = &ts[++isend % nslot];
+      if(inversion) check_tstep(input, *it, nprocs);
+      it->pkg.assign((it->npix() + npack - 1) / npack, pkg_t());
+    }
+
+    unsigned long ip = it->ipix;
+    pkg_t &pk = it->pkg[ip / npack];
+    double tb = pixstat::getTime();
+    
+    set_regions(*it);
+    comm_master_pack_data(input, it->obs, it->model, it->ipix, proc, it->im, compute_gradient, 1, comm);
+    pk.tlast = pixstat::getTime(), pk.ncopy = 1;
+    tbusy += pk.tlast - tb, nmsg++;
+    owner[proc].push_back(busy_t{isend, ip, pk.tlast});
+    return true;
+  };
+
+  
+  /* --- Send again to slave proc a package that is taking too long --- */
+
+  auto reissue = [&](int proc){
+    if(!retry || (ntimed < min_timed)) return false;
+    
+    double const now = pixstat::getTime(), tmean = tpix / double(npix);
+    
+    for(auto &ss: workers){
+      if(ss == proc) continue;
+      
+      for(auto &ow: owner[ss]){
+	tstep_t &it = ts[ow.tt % nslot];
+	if(it.tt != ow.tt) continue;
+	
+	pkg_t &pk = it.pkg[ow.ipix / npack];
+	double const texp = tmean * double(std::min(npack, it.npix() - ow.ipix));
+	
+	if(pk.done || (pk.ncopy >= max_copy) || ((now - pk.tlast) < input.package_timeout * texp)) continue;
+	
+	unsigned long ip = ow.ipix;
+	set_regions(it);
+	comm_master_pack_data(input, it.obs, it.model, ip, proc, it.im, compute_gradient, 1, comm);
+	pk.tlast = pixstat::getTime(), pk.ncopy += 1;
+	tbusy += pk.tlast - now, nmsg++;
+	owner[proc].push_back(busy_t{ow.tt, ow.ipix, now});
+	nreissue++;
+	return true;
+      }
+    }
+    
+    return false;
+  };
+
+  if(inversion) check_tstep(input, ts[0], nprocs);
+  ts[0].pkg.assign((ts[0].npix() + npack - 1) / npack, pkg_t());
+  
+  for(auto &ss: workers)
+    for(int dd = 0; dd<depth[ss]; dd++)
+      if(!late[ss] && !send_next(ss)) idle.push_back(ss);
+
+  int per = 0, oper = -1;
+  float pno =  100.0 / double(mth::max<int>(1, ts[0].npix() - 1));
+  if(verb){
+    fprintf(stdout,"\rProcessed -> %d%s -> sent=%lu, received=%lu     ", per, "%", ts[0].ipix, ts[0].irec);
     fflush(stdout);
+  }
 
+  
+  /* --- manage packages as long as needed --- */
+  
+  while(ndone < nt){
 
-    /* --- manage packages as long as needed --- */
-    while(irec < ntot){
+    /* --- Free slaves waiting for the next time step or for a late package --- */
+    
+    if(!comm_master_probe(iproc, comm)){
+      poll();
+      while(!idle.empty() && send_next(idle.back())) idle.pop_back();
 
-      // Receive processed data from any slave (iproc)
-      comm_master_unpack_data(iproc, iput, obs, x, chi2, irec, dsyn, compute_gradient, m);
+      if(retry && !idle.empty() && ((pixstat::getTime() - tcheck) > 0.01)){
+	tcheck = pixstat::getTime();
+	while(!idle.empty() && reissue(idle.back())) idle.pop_back();
+      }
+      
+      std::this_thread::sleep_for(std::chrono::microseconds(40)); // Avoid polling all the time
+      continue;
+    }
 
-      per = irec * pno;
+    
+    /* --- Receive processed data from that slave, in the buffer of its time step,
+       unless another copy of the package has already been received --- */
+    
+    double tb = pixstat::getTime();
+    busy_t ow = busy_t{-1, 0, 0.0};
+    
+    if(!owner[iproc].empty()){
+      ow = owner[iproc].front();
+      owner[iproc].pop_front();
+    }
+    
+    tstep_t &it = ts[mth::max<int>(0, ow.tt) % nslot];
 
-      // Send more data to that same slave (iproc)
-      if(ipix < ntot) comm_master_pack_data(iput, obs, x, ipix, iproc, m, compute_gradient);
     
-      // Keep count of communications left
-      tocom--;
+    /* --- The next package queued in a sub-master starts now --- */
     
-      // Printout
-      if(per > oper){
-	oper = per;
-	//cout << "\rProcessed -> "<<per<<"% -> sent="<<ipix<<", received="<<irec;
-	fprintf(stdout,"\rProcessed -> %d%s -> sent=%d, received=%d", per, "%", ipix, irec);
-	fflush(stdout);
+    if(!owner[iproc].empty()){
+      busy_t &nx = owner[iproc].front();
+      tstep_t &in = ts[nx.tt % nslot];
+      nx.t0 = std::max(nx.t0, tb);
+      if(in.tt == nx.tt) in.pkg[nx.ipix / npack].tlast = std::max(in.pkg[nx.ipix / npack].tlast, tb);
+    }
+    
+    if((ow.tt < 0) || (it.tt != ow.tt) || it.pkg[ow.ipix / npack].done){
+      comm_master_discard_data(iproc, comm);
+      tbusy += pixstat::getTime(tb);
+      late[iproc] = 0;
+    }else{
+      comm_master_unpack_data(iproc, input, it.obs, it.model, it.chi2, it.tel, it.irec, it.dobs,
+			      compute_gradient, it.im, iproc, comm);
+      tbusy += pixstat::getTime(tb);
+      it.pkg[ow.ipix / npack].done = true;
+      tpix += pixstat::getTime(ow.t0), npix += std::min(npack, it.npix() - ow.ipix), ntimed++;
+      
+      if(ow.tt == ndone) per = it.irec * pno;
+
+      
+      /* --- Time step completed, write it in the background --- */
+    
+      if(it.irec >= it.npix()){
+	ndone++;
+	if(verb){
+	  if(nreissue > 0)
+	    fprintf(stdout,"\rProcessed -> 100%s -> time step %d/%d done (%d packages re-issued)\n", "%", ow.tt+1, nt, nreissue);
+	  else
+	    fprintf(stdout,"\rProcessed -> 100%s -> time step %d/%d done\n", "%", ow.tt+1, nt);
+	  fflush(stdout);
+	}
+	oper = -1, per = 0, nreissue = 0;
+	on_done(ow.tt);
       }
     }
+    
+    
+    // Send more data to that same slave (iproc)
+    
+    if(!send_next(iproc) && !reissue(iproc)) idle.push_back(iproc);
+
+    
+    // Printout
+    
+    if(verb && (per > oper)){
+      oper = per;
+      fprintf(stdout,"\rProcessed -> %d%s -> sent=%lu, received=%lu", per, "%", ts[ndone % nslot].ipix, ts[ndone % nslot].irec);
+      fflush(stdout);
+    }
+  }
+
+  
+  /* --- Late copies of re-issued packages, the slaves would block sending them.
+     Wait until the last one has been out for package_timeout times its
+     expected duration --- */
+  
+  int nlate = 0;
+  double tlate = 0.0, tmean = tpix / double(std::max<unsigned long>(npix, 1));
+  
+  for(int ss = 0; ss<nprocs; ss++){
+    for(auto &ow: owner[ss]){
+      nlate++, late[ss] = 1;
+      tlate = std::max(tlate, ow.t0 + input.package_timeout * tmean * double(npack));
+    }
+  }
   
-    fprintf(stdout, "\n");
+  if(verb && (nlate > 0)){
+    fprintf(stdout, "\nWaiting for %d late package(s)", nlate);
     fflush(stdout);
   }
   
+  while((nlate > 0) && (pixstat::getTime() < tlate)){
+    if(comm_master_probe(iproc, comm)){
+      comm_master_discard_data(iproc, comm);
+      if(!owner[iproc].empty()) owner[iproc].pop_front(), nlate--;
+      late[iproc] = (owner[iproc].empty() ? 0 : 1);
+    }else std::this_thread::sleep_for(std::chrono::microseconds(40));
+  }
+
+  vector<int> owing;
+  for(int ss = 0; ss<nprocs; ss++) if(late[ss]) owing.push_back(ss);
+  
+  iow.wait();
+  if(!verb) return owing;
+
+  
+  /* --- Load of this master: time spent sending and receiving packages --- */
+  
+  double const twall = pixstat::getTime(t0);
+  fprintf(stdout, "\nslaveTimeSteps: %lu packages sent to %d ranks, master busy %.3f s of %.3f s (%.1f%%)\n",
+	  nmsg, (int)workers.size(), tbusy, twall, 100.0 * tbusy / std::max(twall, 1.e-9));
+  if(owing.size() > 0)
+    fprintf(stdout, "slaveTimeSteps: %d rank(s) did not return a late package\n", (int)owing.size());
+  fflush(stdout);
+
+  return owing;
+}
+
+/* --- Sub-master of a two-level run: receives blocks of pixels from rank 0 as
+   a slave would, distributes them among the slaves of its group with 
+   slaveTimeSteps and sends the results of each whole block back to rank 0.
+   Each block is stored as a map with one row (ny = 1, nx = pixels in the 
+   block), so the packages of the group use the same routines as rank 0.
+   Rank 0 sends up to two blocks: the second one is received while the first
+   one is processed, and the group starts on it as soon as all the packages
+   of the first one have been sent --- */
+
+void do_submaster(iput_t &input, MPI_Comm gcomm)
+{
+  int gsize = 1, action = 1, cgrad = 0;
+  MPI_Comm_size(gcomm, &gsize);
+  
+  int const ndep = input.ndep, nw = input.nw_tot, ns = input.ns, npar = input.npar;
+  mat<double> obs, pars, dobs;
+  vector<mdepth_t> m;
+  vector<tstep_t> ts(2);
+  io_worker iow(false);
+
+  
+  /* --- Parameters of the group: each block is a time step with a single row
+     of pixels, nx is the largest block --- */
+  
+  iput_t gin = input;
+  gin.ny = 1, gin.nx = 1, gin.nt = 0, gin.nprocs = gsize;
+  gin.package_timeout = input.group_timeout;
+  gin.workers.clear();
+  gin.submasters.clear();
+  vector<int> late; // ranks of the group that still owe a late package
+
+  
+  /* --- Position of each block in the map of rank 0, blocks completed and
+     the next one to return (in the order they were received) --- */
+  
+  int bpix[2] = {}, nret = 0;
+  bool bdone[2] = {false, false}, quit = false;
+
+  
+  /* --- Receive a block from rank 0 as time step tt, false for the exit command --- */
+  
+  auto load = [&](int tt){
+    comm_slave_unpack_data(input, action, obs, pars, m, cgrad);
+    if(action == 0) return false;
+    
+    tstep_t &blk = ts[tt % 2];
+    int const np = input.nPacked;
+    gin.nx = std::max(gin.nx, np), bpix[tt % 2] = input.ipix;
+    blk.regions = input.regions;
+    
+    blk.obs.set({1, np, nw, ns});
+    blk.model.set({1, np, std::max(npar, 1)}); // its size(1) is the nx of the map
+    
+    if(input.mode == 1){
+      memcpy(&blk.obs.d[0], &obs.d[0], np*nw*ns*sizeof(double));
+      memcpy(&blk.model.d[0], &pars.d[0], np*npar*sizeof(double));
+    }
+    
+    blk.im.ndep = ndep;
+    blk.im.cub.set({1, np, 12, ndep});
+    blk.im.boundary.set({1, np});
+    blk.im.tr_loc.set({1, np});
+    blk.im.tr_amp.set({1, np});
+    
+    for(int pp = 0; pp<np; pp++){
+      memcpy(&blk.im.cub(0,pp,0,0), &m[pp].cub.d[0], 12*ndep*sizeof(double));
+      blk.im.boundary(0,pp) = m[pp].bound_val;
+    }
+
+    blk.chi2.set({1, np});
+    blk.tel.set({1, np, ps_nstat});
+    if(input.mode == 4) blk.dobs.set({1, np, input.nresp, ndep, nw, ns});
+    blk.ipix = 0, blk.irec = 0;
+    bdone[tt % 2] = false;
+    blk.tt = tt;
+    
+    return true;
+  };
+
+  
+  /* --- Results of time step tt back to rank 0 --- */
+
+  auto unload = [&](int tt){
+    tstep_t &blk = ts[tt % 2];
+    int const np = (int)blk.npix();
+    input.nPacked = np, input.ipix = bpix[tt % 2];
+    
+    obs.set({np, nw, ns});
+    memcpy(&obs.d[0], &blk.obs.d[0], np*nw*ns*sizeof(double));
+
+    if(input.mode == 1){
+      pars.set({np, npar});
+      memcpy(&pars.d[0], &blk.model.d[0], np*npar*sizeof(double));
+      m.resize(np), input.chi.resize(np), input.tel.resize(np);
+      
+      for(int pp = 0; pp<np; pp++){
+	m[pp].setsize(ndep);
+	memcpy(&m[pp].cub.d[0], &blk.im.cub(0,pp,0,0), 12*ndep*sizeof(double));
+	m[pp].tr_loc = blk.im.tr_loc(0,pp), m[pp].tr_amp = blk.im.tr_amp(0,pp);
+	input.chi[pp] = blk.chi2(0,pp);
+	memcpy(&input.tel[pp].d[0], &blk.tel(0,pp,0), ps_nstat*sizeof(double));
+      }
+    }else if(input.mode == 4){
+      dobs.set({np, input.nresp, ndep, nw, ns});
+      memcpy(&dobs.d[0], &blk.dobs.d[0], dobs.d.size()*sizeof(double));
+    }
+    
+    comm_slave_pack_data(input, obs, pars, dobs, cgrad, m);
+    blk.tt = -1;
+  };
+
+  
+  /* --- A block is done: return it and those after it that are also done, 
+     rank 0 expects them in the order they were sent --- */
+
+  auto on_done = [&](int tt){
+    bdone[tt % 2] = true;
+    
+    while((nret < gin.nt) && bdone[nret % 2] && (ts[nret % 2].tt == nret)){
+      bdone[nret % 2] = false;
+      unload(nret++);
+    }
+  };
+
+  
+  /* --- Take the next block as soon as it arrives and its slot is free --- */
+
+  auto poll = [&]{
+    int flag = 0;
+    if(quit || (ts[gin.nt % 2].tt >= 0)) return;
+    
+    MPI_Iprobe(0, 1, MPI_COMM_WORLD, &flag, MPI_STATUS_IGNORE);
+    if(!flag) return;
+    
+    if(load(gin.nt)) gin.nt++;
+    else quit = true;
+  };
+
+  
+  /* --- Distribute the blocks in the group, each call runs until all the
+     blocks received so far are done --- */
+  
+  while(!quit){
+    gin.nt = 0, nret = 0;
+    if(!load(0)) break;
+    gin.nt = 1;
+    
+    late = slaveTimeSteps(gin, ts, iow, false, on_done, gcomm, late, poll);
+  }
+
+  
+  /* --- Pass the exit command on to the group. A rank that never returned its
+     late package is blocked and would not exit, rank 0 has closed the 
+     outputs before sending the exit command --- */
+
+  if(late.size() > 0){
+    cerr << input.myid << "do_submaster: " << late.size() << " rank(s) of the group did not return a late package, aborting" << endl;
+    MPI_Abort(MPI_COMM_WORLD, 1);
+  }
+  
+  comm_kill_slaves(gin, gsize, gcomm);
 }
 
-void master_inverter(mdepthall_t &model, mat<double> &pars, mat<double> &obs, mat<double> &w, iput_t &input)
+void master_inverter(mdepthall_t &model, mat<double> &pars, mat<double> &obs, mat<double> &w, mat<double> &tel, iput_t &input)
 {
 
   int ndep = (int)model.ndep, nx = input.nx, ny = input.ny;
@@ -166,6 +716,7 @@ void master_inverter(mdepthall_t &model, mat<double> &pars, mat<double> &obs, ma
       
       atm->fitModel2( m, input.npar, &pars(yy,xx,0),
 		    (int)(input.nw_tot*input.ns), &obs(yy,xx,0,0), w);
+      memcpy(&tel(yy,xx,0), &atm->stats.d[0], ps_nstat*sizeof(double));
 
 
       /* --- Copy inverted model back to model cube --- */
@@ -195,8 +746,7 @@ void do_master_sparse(int myrank, int nprocs,  char hostname[]){
 
   /* --- Printout number of processes --- */
   cerr << "STIC: Initialized with "<<nprocs <<" process(es)"<<endl;
-  mat<double> model, obs, dobs, wav, w, syn, chi2;;
-  mdepthall_t im;
+  mat<double> wav, w;
 
   static const vector<string> vnames = {"temperature","vlos","vturb", "Blong", "Bhor", "azi","dens", "nne"};
   
@@ -256,8 +806,6 @@ void do_master_sparse(int myrank, int nprocs,  char hostname[]){
     input.ny = odims[0+off];
     input.nx = odims[1+off];
     input.ns = 4;
-
-    obs.set(vector<int>{input.ny, input.nx, input.nw_tot, input.ns});
   }
   vector<int> dims = {input.ny, input.nx, input.nw_tot, input.ns};
   
@@ -274,6 +822,22 @@ void do_master_sparse(int myrank, int nprocs,  char hostname[]){
     }
   }
 
+  /* --- Buffers of the time steps, two if the I/O overlaps with the computations.
+     The I/O thread needs at least MPI_THREAD_FUNNELED, otherwise the I/O is 
+     synchronous --- */
+
+  int thread_level = MPI_THREAD_SINGLE;
+  MPI_Query_thread(&thread_level);
+  
+  if((input.overlap_io > 0) && (input.nt > 1) && (thread_level < MPI_THREAD_FUNNELED)){
+    cerr << input.myid << "WARNING, the MPI library does not provide MPI_THREAD_FUNNELED, overlap_io is ignored" << endl;
+    input.overlap_io = 0;
+  }
+  
+  int const nslot = (((input.overlap_io > 0) && (input.nt > 1)) ? 2 : 1);
+  vector<tstep_t> ts(nslot);
+  mdepthall_t &im = ts[0].im;
+  
   // Read model for tstep = 0
   input.boundary = im.read_model2(input, input.imodel, 0, true);
   input.ndep = im.ndep;
@@ -286,6 +850,7 @@ void do_master_sparse(int myrank, int nprocs,  char hostname[]){
      type in memory
      --- */
   io opfile(input.oprof,  NcFile::replace);
+  opfile.setStorage(input.nc_deflate, input.nc_shuffle, input.nc_pixel_chunks, input.nc_float, input.nc_double);
   opfile.initDim({"time","ndep","vtype", "y", "x", "wav", "stokes"},{0, input.ndep, input.nresp, input.ny, input.nx, input.nw_tot, input.ns});
   opfile.initVar<double>(string("profiles"), {"time","y", "x", "wav", "stokes"});
   opfile.initVar<double>(string("wav"), {"wav"});
@@ -312,7 +877,6 @@ void do_master_sparse(int myrank, int nprocs,  char hostname[]){
 
     opfile.initVar<double>(string("derivatives") ,{"time","y", "x", "vtype", "ndep", "wav", "stokes"});
     opfile.varAttr("derivatives","units", vn);
-    dobs.set({input.ny, input.nx, input.nresp, input.ndep, input.nw_tot, input.ns});
   }
   
 					     
@@ -320,6 +884,13 @@ void do_master_sparse(int myrank, int nprocs,  char hostname[]){
     opfile.initVar<float>(string("weights"), {"wav", "stokes"});
     opfile.write_Tstep<double>(string("weights"), w);
 
+    /* --- Per-pixel telemetry of the inversion (see telemetry.h) --- */
+    
+    if(input.mode == 1){
+      for(int ii=0; ii<ps_nstat; ii++)
+	opfile.initVar<float>(string(pixstat_names[ii]), {"time","y", "x"});
+    }
+
     // omfile.initRead(input.omodel, NcFile::replace);
 
     vector<int> dims = ipfile.dimSize("profiles");
@@ -361,13 +932,28 @@ void do_master_sparse(int myrank, int nprocs,  char hostname[]){
     if(input.verbose) cerr<<input.myid<<"Using NPACK="<<input.npack<<endl;
   }
   
-  comm_get_buffer_size(input);
   MPI_Barrier(MPI_COMM_WORLD); // Wait until all processors reach this point
   comm_send_parameters(input);
   
   if(inversion) comm_send_weights(input, w); //  
 
   
+  /* --- Two-level master: rank 0 sends blocks of pixels to the sub-masters, 
+     large enough to keep all the slaves of a group busy (group_packages 
+     packages per slave). The slaves already got the original npack --- */
+
+  int gslaves = 0;
+  comm_split_groups(input, 0, nprocs, gslaves);
+  
+  if(gslaves > 0){
+    long const nblock = long(input.npack) * input.group_packages * gslaves;
+    long const nmax = (long(input.nx) * input.ny + long(input.workers.size()) - 1) / long(input.workers.size());
+    
+    input.npack = (int)std::max<long>(1, std::min<long>(nblock, nmax));
+    cout << input.myid << "Using blocks of " << input.npack << " pixels for the sub-masters" << endl;
+  }
+
+  
   
   
   /* --- Init sparse class --- */
@@ -379,95 +965,60 @@ void do_master_sparse(int myrank, int nprocs,  char hostname[]){
   //		 spt_hard, input.master_threads);
   
   //
-  // Main loop
+  // Main loop: the I/O worker reads the next time step and writes the
+  // previous one while the current one is processed
   //
-  for(int tt = 0; tt<input.nt; tt++){ // Loop in time
-
-    /* --- Read Tstep data --- */
-    
-    mat<double> pweight;
-    if(inversion){
-      ipfile.read_Tstep(string("profiles"), obs, tt);
-      if(ipfile.is_var_defined((string)"pixel_weights")){
-	ipfile.read_Tstep<double>(string("pixel_weights"), pweight, tt);
-      }
-    }
-    
-    if(tt > 0) im.read_model2(input, input.imodel, tt, true);
-
-    /* --- Check dimensions in inversion mode --- */
-    
-    if(inversion){
-      if(obs.size(0) != im.cub.size(0) && obs.size(1) != im.cub.size(1)){
-	cerr << input.myid <<"ERROR, the input model and the observations do not have the same dimensions in X,Y axes:"<<endl;
-	cerr << "   -> "<<input.imodel<<" "<<formatVect<int>(im.temp.getdims())<<endl;
-	cerr << "   -> "<<input.iprof<<" "<<formatVect<int>(obs.getdims())<<endl;
-	
-	comm_kill_slaves(input, nprocs);
-	exit(0);
-      }
-
-      if(obs.size(2) != input.nw_tot){
-	cerr << input.myid <<"ERROR, number of wavelenghts in input.cfg ["<<input.nw_tot<< "] does not match the observations ["<< obs.size(2) << "]"<<endl;
-	comm_kill_slaves(input, nprocs);
-	exit(0);
-	
-      }
-
-      /* --- get free-parameters from input model --- */
-      
-      
-    } // inversion mode
-
-    im.model_parameters2(model, input.nodes);
+  io_worker iow(nslot > 1);
 
+  read_tstep(input, ipfile, inversion, ts[0], 0);
+  if(nslot > 1) iow.push([&]{ read_tstep(input, ipfile, inversion, ts[1], 1); });
 
-    
-    /* --- Invert data --- */
-    
-    if     (input.mode == 1){
-
-      if(nprocs == 1)
-	master_inverter(im, model, obs, w, input);
-      else
-	slaveInversion(input, im, obs, model, chi2, dobs); // implemented above!
+  
+  /* --- Time step tt is done: write it and re-use its buffer --- */
+  
+  auto on_done = [&](int tt){
+    ts[tt % nslot].tt = -1; // not available until it is read again
+    iow.push([&, tt]{
+	tstep_t &it = ts[tt % nslot];
+	write_tstep(input, opfile, inversion, it, tt);
+	if((tt + nslot) < input.nt) read_tstep(input, ipfile, inversion, it, tt + nslot);
+      });
+  };
+  
+  vector<int> late;
+  
+  if((nprocs > 1) && ((input.mode == 1) || (input.mode == 2) || (input.mode == 4))){
+    late = slaveTimeSteps(input, ts, iow, inversion, on_done);
+  }else{
+    for(int tt = 0; tt<input.nt; tt++){ // Loop in time
+      tstep_t &it = ts[tt % nslot];
       
-    }else if(input.mode == 2) slaveInversion(input, im, obs, model, chi2, dobs); // it won't invert if mode == 2
-    //else if(input.mode == 3) inv.SparseOptimization(obs, model, w, im, pweight);
-    else if(input.mode == 4) slaveInversion(input, im, obs, model, chi2, dobs);
-    
-    if(inversion){
-
-      /* --- Expand fitted parameters into depth-stratified atmos --- */
+      while(it.tt != tt) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      if(inversion) check_tstep(input, it, nprocs);
 
-      // if(input.depth_model == 0)
-      //im.expandAtmos(input.nodes, model, input.dint);
       
+      /* --- Invert data --- */
       
-      /* --- init output for inverted model --- */
-      
-      if(tt == 0){
-	vector<int> odim = model.getdims();
-	odim.insert(odim.begin(), 0);
-	//omfile.initDim({"time","y", "x", "par"},odim);
-	//omfile.initVar<float>(string("model"), {"time","y", "x", "par"});
-      }
-    
+      if((input.mode == 1) && (nprocs == 1))
+	master_inverter(it.im, it.model, it.obs, w, it.tel, input);
+      //else if(input.mode == 3) inv.SparseOptimization(obs, model, w, im, pweight);
 
-      /* --- Write model parameters, profiles and depth-stratified atmos --- */
-      
-      //omfile.write_Tstep(string("model"), model, tt);
-      im.write_model2(input, input.oatmos, tt);
+      on_done(tt);
     }
-
-    opfile.write_Tstep(string("profiles"), obs, tt);
-    if(input.mode == 4) opfile.write_Tstep(string("derivatives"), dobs, tt);
-    
+    iow.wait();
   }
-
   
   
-  /* --- Tell slaves to exit while(1) loop --- */
+  /* --- Close the outputs, then tell slaves to exit while(1) loop. The ranks
+     that never returned a late package are blocked sending it and would not
+     exit, the run is aborted instead --- */
+
+  opfile.close(), ipfile.close();
+  
+  if(late.size() > 0){
+    cerr << input.myid << "do_master_sparse: " << late.size() << " rank(s) did not return a late package, aborting" << endl;
+    MPI_Abort(MPI_COMM_WORLD, 1);
+  }
   
   comm_kill_slaves(input, nprocs);
   
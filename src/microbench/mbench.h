@@ -0,0 +1,123 @@
+/* ---
+   Minimal timing harness for the kernel micro-benchmarks (make microbench).
+
+   Each kernel is wrapped in a functor that performs "ncalls" calls of the
+   kernel and processes "nitems" items (depth points, wavelengths...).
+   The functor is warmed up, the number of invocations per repetition is
+   calibrated to last at least tmin seconds, and the best and median time
+   of nrep repetitions are reported as ns per kernel call and items per
+   second.
+
+   Command line of all the executables: [-r nrep] [-t tmin] [-w nwarm]
+
+   Modifications:
+           2026-10-18: Created.
+   --- */
+
+#ifndef MBENCH_H
+#define MBENCH_H
+
+#include <chrono>
+#include <vector>
+#include <string>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+
+namespace mbench{
+
+  /* --- Options from the command line --- */
+
+  struct options{
+    int nrep, nwarm;
+    double tmin;
+
+    options(int argc, char *argv[]): nrep(7), nwarm(3), tmin(0.05){
+      for(int ii=1; ii<argc-1; ii++){
+	if     (!strcmp(argv[ii], "-r")) nrep  = std::max(1, atoi(argv[++ii]));
+	else if(!strcmp(argv[ii], "-t")) tmin  = std::max(1.e-4, atof(argv[++ii]));
+	else if(!strcmp(argv[ii], "-w")) nwarm = std::max(0, atoi(argv[++ii]));
+      }
+    }
+  };
+
+
+  /* --- Results are accumulated here so the kernels cannot be optimized away --- */
+
+  static volatile double sink_v = 0.0;
+  inline void sink(double val){sink_v = sink_v + val;}
+
+
+  inline double now(){
+    return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+  }
+
+
+  /* --- FAL-C like temperature stratification in log(tau_500),
+     interpolated linearly from a coarse table --- */
+
+  inline void falc(int ndep, double *ltau, double *temp)
+  {
+    static const int nt = 13;
+    static const double lt[nt] = {-7.0, -6.0, -5.0, -4.0, -3.5, -3.0, -2.0, -1.0, -0.5, 0.0, 0.5, 1.0, 1.5};
+    static const double tt[nt] = {9000., 6900., 6400., 4500., 4400., 4500., 4750., 5100., 5500., 6420., 7500., 8400., 9100.};
+
+    for(int kk=0; kk<ndep; kk++){
+      ltau[kk] = lt[0] + (lt[nt-1]-lt[0]) * kk / double(ndep-1);
+      int ii = 0;
+      while(ii < nt-2 && ltau[kk] > lt[ii+1]) ii++;
+      double w = (ltau[kk] - lt[ii]) / (lt[ii+1] - lt[ii]);
+      temp[kk] = tt[ii] * (1.0-w) + tt[ii+1] * w;
+    }
+  }
+
+
+  /* --- Header of the output table --- */
+
+  inline void header(const char *title){
+    fprintf(stdout, "\n%s\n", title);
+    fprintf(stdout, "%-44s %14s %14s %14s\n", "kernel", "best [ns/call]", "med. [ns/call]", "items/s");
+  }
+
+
+  /* --- Time a functor, see header --- */
+
+  template<class F> double run(const char *name, const options &opt, long ncalls, double nitems, F &&fn)
+  {
+    for(int ii=0; ii<opt.nwarm; ii++) fn();
+
+
+    /* --- Calibrate number of invocations per repetition --- */
+
+    long ninv = 1;
+    while(1){
+      double t0 = now();
+      for(long ii=0; ii<ninv; ii++) fn();
+      double dt = now() - t0;
+      if(dt >= opt.tmin || ninv > (1L<<30)) break;
+      ninv = ((dt > 0.0) ? std::max(ninv*2, long(ninv * 1.2 * opt.tmin / dt)) : ninv*10);
+    }
+
+
+    /* --- Repetitions --- */
+
+    std::vector<double> t(opt.nrep);
+    for(int rr=0; rr<opt.nrep; rr++){
+      double t0 = now();
+      for(long ii=0; ii<ninv; ii++) fn();
+      t[rr] = (now() - t0) / double(ninv);
+    }
+    std::sort(t.begin(), t.end());
+
+    double best = t[0], med = t[opt.nrep/2];
+    fprintf(stdout, "%-44s %14.1f %14.1f %14.4e\n", name, best * 1.e9 / ncalls,
+	    med * 1.e9 / ncalls, nitems / best);
+    fflush(stdout);
+
+    return best;
+  }
+
+}
+
+#endif
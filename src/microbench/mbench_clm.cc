@@ -0,0 +1,63 @@
+/* ---
+   Micro-benchmark of the Levenberg-Marquardt linear algebra in clm:
+   the normal equations and their eigen-decomposition (compute_hessian)
+   and the damped solution for one value of lambda (compute_trial3).
+
+   Sizes: npar = 30 free parameters and nd = 1000 data points, a
+   typical non-LTE inversion of two or three lines in full Stokes.
+
+   Modifications:
+           2026-10-18: Created.
+   --- */
+
+#include <cmath>
+#include <vector>
+#include "clm.h"
+#include "mbench.h"
+
+using namespace std;
+
+int main(int argc, char *argv[])
+{
+  mbench::options opt(argc, argv);
+
+  const int npar = 30, nd = 1000;
+
+
+  /* --- Smooth, partially correlated response functions --- */
+
+  vector<double> buf(npar*nd), res(nd), x(npar, 0.5), xnew(npar);
+  vector<double*> rf(npar);
+
+  for(int pp=0; pp<npar; pp++){
+    rf[pp] = &buf[pp*nd];
+    double w0 = double(nd) * (pp+0.5) / npar, sig = 20.0 + 5.0 * (pp % 7);
+    for(int ww=0; ww<nd; ww++)
+      rf[pp][ww] = exp(-0.5 * pow((ww-w0)/sig, 2)) + 0.05 * sin(0.01*ww*(pp+1));
+  }
+  for(int ww=0; ww<nd; ww++) res[ww] = 0.1 * cos(0.02*ww);
+
+
+  /* --- Fit control: unbounded parameters --- */
+
+  clm lm(nd, npar);
+  for(int pp=0; pp<npar; pp++){
+    lm.fcnt[pp].limit[0] = -1.e10, lm.fcnt[pp].limit[1] = 1.e10;
+    lm.fcnt[pp].scl = 1.0;
+  }
+  reg_t reg;
+
+  mbench::header("clm (Levenberg-Marquardt, npar=30, nd=1000)");
+
+  mbench::run("clm::compute_hessian", opt, 1, double(npar)*nd, [&](){
+      lm.compute_hessian(&res[0], &rf[0], reg);
+      mbench::sink(lm.hess_E[0]);
+    });
+
+  mbench::run("clm::compute_trial3", opt, 1, npar, [&](){
+      lm.compute_trial3(1.0, &x[0], &xnew[0]);
+      mbench::sink(xnew[0]);
+    });
+
+  return 0;
+}
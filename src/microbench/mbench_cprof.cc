@@ -0,0 +1,131 @@
+/* ---
+   Micro-benchmark of the LTE line-formation kernels in cprofiles2.h:
+   Voigt-Faraday functions, Zeeman absorption matrix and the DELO
+   formal solvers, in double and in single precision (cprofiles_t<float>,
+   lte_precision = single).
+
+   Sizes: 1000 Voigt evaluations per call, ndep = 64 depth points and
+   nw = 200 wavelengths, which is representative of one region of an
+   LTE inversion.
+
+   Modifications:
+           2026-10-18: Created.
+           2026-10-19: Single-precision formal solver and its accuracy.
+   --- */
+
+#include <cmath>
+#include <vector>
+#include <cstdio>
+#include <algorithm>
+#include "cprofiles2.h"
+#include "mbench.h"
+
+using namespace std;
+
+int main(int argc, char *argv[])
+{
+  mbench::options opt(argc, argv);
+
+  const int nv = 1000, ndep = 64, nw = 200;
+
+
+  /* --- Voigt-Faraday, a typical range of damping and frequency offsets --- */
+
+  vector<double> a(nv), v(nv);
+  for(int ii=0; ii<nv; ii++){
+    a[ii] = 1.e-3 + 0.5 * double(ii % 37) / 36.0;
+    v[ii] = -20.0 + 40.0 * double(ii) / double(nv-1);
+  }
+
+  cprofiles prof(nw, ndep);
+
+  mbench::header("cprofiles (LTE line formation)");
+
+  mbench::run("cprofiles::voigt_complex", opt, nv, nv, [&](){
+      double H, F, sum = 0.0;
+      for(int ii=0; ii<nv; ii++){
+	prof.voigt_complex(a[ii], v[ii], H, F);
+	sum += H + F;
+      }
+      mbench::sink(sum);
+    });
+
+  mbench::run("cprofiles::voigtf", opt, nv, nv, [&](){
+      double H, F, sum = 0.0;
+      for(int ii=0; ii<nv; ii++){
+	prof.voigtf(a[ii], v[ii], H, F);
+	sum += H + F;
+      }
+      mbench::sink(sum);
+    });
+
+
+  /* --- Zeeman absorption matrix for all depths and wavelengths --- */
+
+  for(int ii=0; ii<3; ii++) prof.voigt[ii] = 0.3 + 0.1*ii, prof.faraday[ii] = 0.05*(ii-1);
+
+  mbench::run("cprofiles::zeeman_opacity", opt, long(ndep)*nw, double(ndep)*nw, [&](){
+      for(int kk=0; kk<ndep; kk++)
+	for(int ww=0; ww<nw; ww++)
+	  prof.zeeman_opacity(0.7, 0.3, 1.e-7, kk, ww);
+      mbench::sink(prof.mki[ndep/2][nw/2]);
+    });
+
+
+  /* --- Formal solvers: a line with Stokes Q,U,V in a FAL-C like atmosphere,
+     optical-depth scale (bez_ltau / lin_ltau in clte) --- */
+
+  vector<double> ltau(ndep), temp(ndep), tau(ndep);
+  mbench::falc(ndep, &ltau[0], &temp[0]);
+
+  prof.sf.resize(ndep);
+  for(int kk=0; kk<ndep; kk++){
+    tau[kk] = pow(10.0, ltau[kk]);
+    prof.ki[kk] = 1.0 + 50.0 * exp(-0.5*pow((ltau[kk]+2.5)/1.2, 2));
+    prof.kq[kk] = 0.02 * (prof.ki[kk]-1.0) / prof.ki[kk];
+    prof.ku[kk] = 0.01 * (prof.ki[kk]-1.0) / prof.ki[kk];
+    prof.kv[kk] = 0.10 * (prof.ki[kk]-1.0) / prof.ki[kk];
+    prof.fq[kk] = 0.005, prof.fu[kk] = 0.003, prof.fv[kk] = 0.02;
+    prof.sf[kk] = 1.e-5 * exp(-1.4388e8 / (6302.0 * temp[kk]));
+  }
+
+  double stokes[4];
+
+  mbench::run("cprofiles::delobez3 (ndep=64)", opt, 1, ndep, [&](){
+      prof.delobez3(ndep, &tau[0], stokes, 1.0);
+      mbench::sink(stokes[0]+stokes[3]);
+    });
+
+  mbench::run("cprofiles::delolin  (ndep=64)", opt, 1, ndep, [&](){
+      prof.delolin(ndep, &tau[0], stokes, 1.0);
+      mbench::sink(stokes[0]+stokes[3]);
+    });
+
+
+  /* --- Same atmosphere in single precision --- */
+
+  cprofiles_t<float> sprof(nw, ndep);
+  sprof.sf.resize(ndep);
+  for(int kk=0; kk<ndep; kk++){
+    sprof.ki[kk] = prof.ki[kk], sprof.kq[kk] = prof.kq[kk], sprof.ku[kk] = prof.ku[kk];
+    sprof.kv[kk] = prof.kv[kk], sprof.fq[kk] = prof.fq[kk], sprof.fu[kk] = prof.fu[kk];
+    sprof.fv[kk] = prof.fv[kk], sprof.sf[kk] = prof.sf[kk];
+  }
+
+  double sstokes[4];
+
+  mbench::run("cprofiles_t<float>::delobez3 (ndep=64)", opt, 1, ndep, [&](){
+      sprof.delobez3(ndep, &tau[0], sstokes, 1.0);
+      mbench::sink(sstokes[0]+sstokes[3]);
+    });
+
+
+  /* --- Accuracy of the single-precision solution, relative to I --- */
+
+  prof.delobez3(ndep, &tau[0], stokes, 1.0);
+  double err = 0.0;
+  for(int ss=0; ss<4; ss++) err = std::max(err, fabs(sstokes[ss] - stokes[ss]) / stokes[0]);
+  fprintf(stdout, "%-44s %14.4e\n", "max |float - double| / I (delobez3)", err);
+
+  return 0;
+}
@@ -0,0 +1,149 @@
+/* ---
+   Micro-benchmark of the equations of state (ceos, eos::witt and
+   eos::piskunov): partial pressures at given T/Pgas, hydrostatic
+   equilibrium of a full model (mdepth::getPressureScale) and the
+   background opacities (contOpacity).
+
+   Sizes: a FAL-C like model with ndep = 64 points between
+   log(tau_500) = -7 and 1.5, and nw = 200 wavelengths for the
+   background opacities.
+
+   Modifications:
+           2026-10-18: Created.
+   --- */
+
+#include <cmath>
+#include <vector>
+#include <string>
+#include "input.h"
+#include "depthmodel.h"
+#include "ceos.h"
+#include "witt.h"
+#include "piskunov.h"
+#include "cop.h"
+#include "mbench.h"
+
+using namespace std;
+
+typedef void (*cop_fn)(double, double, double, double, double, double, double, double *, double *,
+		       double *, double, double, double, double, double, double, double, double,
+		       double, double, double, double, double, double, double, double, double, int, int, int);
+
+
+/* --- Same call as ceos::contOpacity, with the opacity routine as an argument --- */
+
+static void call_cop(cop_fn fn, ceos &eos, double T, int nw, double *w, double *opac, double *scat,
+		     vector<double> &frac, double na, double ne)
+{
+  double TKEV = 8.6171E-5*T;
+  double TK   = 1.38065E-16*T;
+  double HTK  = 6.6256E-27/TK;
+
+  fn(T, TKEV, TK, HTK, log(T), na, ne, w, opac, scat,
+     frac[eos.IXH1-1], frac[eos.IXH2-1], frac[eos.IXHMIN-1], frac[eos.IXHE1-1],
+     frac[eos.IXHE2-1], frac[eos.IXHE3-1], frac[eos.IXC1-1], frac[eos.IXAL1-1],
+     frac[eos.IXSI1-1], frac[eos.IXSI2-1], frac[eos.IXCA1-1], frac[eos.IXCA2-1],
+     frac[eos.IXMG1-1], frac[eos.IXMG2-1], frac[eos.IXFE1-1], frac[eos.IXN1-1],
+     frac[eos.IXO1-1], nw, (int)eos.idxspec.size(), eos.ntotallist);
+}
+
+
+/* --- All kernels of one EOS --- */
+
+static void bench_eos(const string &name, eoswrap &eos, mdepth &m, int nw, double *w, bool stored,
+		      const mbench::options &opt)
+{
+  int ndep = m.ndep;
+  vector<double> opac(nw), scat(nw), frac, part;
+  double rho, na, ne;
+
+  m.getPressureScale(0, 0, eos);
+  vector<double> pgas(m.pgas, m.pgas+ndep);
+
+  mbench::run((name+"::nne_from_T_Pg").c_str(), opt, ndep, ndep, [&](){
+      double sum = 0.0;
+      for(int kk=0; kk<ndep; kk++) sum += eos.nne_from_T_Pg(m.temp[kk], pgas[kk], rho);
+      mbench::sink(sum);
+    });
+
+  mbench::run((name+" mdepth::getPressureScale").c_str(), opt, 1, ndep, [&](){
+      m.getPressureScale(0, 0, eos);
+      mbench::sink(m.pgas[ndep-1]);
+    });
+
+  mbench::run((name+"::contOpacity_TPg").c_str(), opt, ndep, double(ndep)*nw, [&](){
+      for(int kk=0; kk<ndep; kk++)
+	eos.contOpacity_TPg(m.temp[kk], pgas[kk], nw, w, &opac[0], &scat[0]);
+      mbench::sink(opac[nw/2]);
+    });
+
+
+  /* --- From the partial pressures stored by the hydrostatic eq. (as in clte::synth),
+     eos::witt does not store them --- */
+
+  if(!stored) return;
+
+  mbench::run((name+"::contOpacity").c_str(), opt, ndep, double(ndep)*nw, [&](){
+      for(int kk=0; kk<ndep; kk++){
+	eos.read_partial_pressures(kk, frac, part, na, ne);
+	eos.contOpacity(m.temp[kk], nw, w, &opac[0], &scat[0], frac, na, ne);
+      }
+      mbench::sink(opac[nw/2]);
+    });
+}
+
+
+int main(int argc, char *argv[])
+{
+  mbench::options opt(argc, argv);
+
+  const int ndep = 64, nw = 200;
+  vector<line_t> lines;
+  string abfile = "";
+
+
+  /* --- Model and wavelength grid (vacuum, Angstroms) around the example regions --- */
+
+  mdepth m(ndep);
+  m.zero();
+  mbench::falc(ndep, m.ltau, m.temp);
+  for(int kk=0; kk<ndep; kk++) m.tau[kk] = pow(10.0, m.ltau[kk]), m.vturb[kk] = 1.e5;
+
+  vector<double> w(nw);
+  for(int ii=0; ii<nw; ii++) w[ii] = 3930.0 + (8545.0 - 3930.0) * ii / double(nw-1);
+
+
+  /* --- EOS --- */
+
+  mbench::header("EOS and background opacities");
+
+  ceos fe(lines, abfile);
+  eos::witt wi(lines, abfile);
+  eos::piskunov pi(lines, abfile);
+
+  bench_eos("ceos", fe, m, nw, &w[0], true, opt);
+  bench_eos("eos::witt", wi, m, nw, &w[0], false, opt);
+  bench_eos("eos::piskunov", pi, m, nw, &w[0], true, opt);
+
+
+  /* --- Tabulated cop vs the direct evaluation, same partial pressures --- */
+
+  vector<double> opac(nw), scat(nw), frac, part;
+  double na, ne;
+
+  fe.nne_from_T_Pg(m.temp[ndep/2], m.pgas[ndep/2], m.rho[ndep/2]);
+  fe.store_partial_pressures(1, 0, fe.xna, fe.xne);
+  fe.read_partial_pressures(0, frac, part, na, ne);
+
+  mbench::run("cop (tabulated)", opt, 1, nw, [&](){
+      call_cop(cop, fe, m.temp[ndep/2], nw, &w[0], &opac[0], &scat[0], frac, na, ne);
+      mbench::sink(opac[nw/2]);
+    });
+
+  mbench::run("cop_direct", opt, 1, nw, [&](){
+      call_cop(cop_direct, fe, m.temp[ndep/2], nw, &w[0], &opac[0], &scat[0], frac, na, ne);
+      mbench::sink(opac[nw/2]);
+    });
+
+  return 0;
+}
@@ -0,0 +1,136 @@
+/* ---
+   Micro-benchmark of two RH kernels outside of a full RH run:
+   the polarized formal solver (PiecewiseStokesBezier3) and the
+   statistical equilibrium (statEquil).
+
+   The RH global structures are filled by hand with the minimum that
+   these routines use. The Stokes propagation matrix comes from a
+   polarized background (backgrflags.ispolarized), which follows the
+   same code path as a polarized line.
+
+   Sizes: Ndep = 82 (FAL-C) and a 6-level atom, as Ca II in
+   example/atoms.input.
+
+   Modifications:
+           2026-10-18: Created.
+   --- */
+
+#include <cmath>
+#include <vector>
+#include <cstring>
+#include "mbench.h"
+
+/* --- src/rh.h is an older copy, include the RH headers by path --- */
+
+extern "C" {
+#include "rh/rh.h"
+#include "rh/atom.h"
+#include "rh/atmos.h"
+#include "rh/rh_1d/geometry.h"
+#include "rh/spectrum.h"
+#include "rh/inputs.h"
+#include "rh/rh_1d/rhf1d.h"
+#include "rh/rh_1d/bezier.h"
+
+  extern Atmosphere atmos;
+  extern Geometry geometry;
+  extern Spectrum spectrum;
+  extern InputData input;
+  extern MPI_t mpi;
+}
+
+using namespace std;
+
+int main(int argc, char *argv[])
+{
+  mbench::options opt(argc, argv);
+
+  const int ndep = 82, nlevel = 6;
+
+
+  /* --- Atmosphere, geometry and one wavelength --- */
+
+  vector<double> ltau(ndep), T(ndep), height(ndep), rho(ndep, 1.e-7), lambda(1, 854.2);
+  mbench::falc(ndep, &ltau[0], &T[0]);
+  for(int kk=0; kk<ndep; kk++) height[kk] = 2.0e6 - 2.1e6 * kk / double(ndep-1); // [m]
+
+  double muz = 1.0;
+  flags bflag;
+  bflag.hasline = FALSE, bflag.ispolarized = TRUE;
+
+  atmos.Nspace = ndep, atmos.T = &T[0], atmos.rho = &rho[0];
+  atmos.Stokes = TRUE, atmos.Nactiveatom = 0, atmos.backgrflags = &bflag;
+
+  geometry.Ndep = ndep, geometry.Nrays = 1, geometry.muz = &muz, geometry.height = &height[0];
+  geometry.vboundary[TOP] = ZERO, geometry.vboundary[BOTTOM] = THERMALIZED;
+
+  input.StokesMode = FULL_STOKES, input.magneto_optical = TRUE;
+
+
+  /* --- Opacities [m^-1], scale height of 150 km, and source functions --- */
+
+  vector<double> chi(ndep), chi_c(4*ndep), chip_c(3*ndep), Sbuf(4*ndep), Ibuf(4*ndep);
+  double *S[4], *I[4];
+
+  for(int ss=0; ss<4; ss++) S[ss] = &Sbuf[ss*ndep], I[ss] = &Ibuf[ss*ndep];
+
+  for(int kk=0; kk<ndep; kk++){
+    chi[kk] = 1.e-4 * exp(-height[kk] / 1.5e5);
+    chi_c[kk] = chi[kk];
+    for(int ss=1; ss<4; ss++) chi_c[ss*ndep+kk] = 0.02 * ss * chi[kk];
+    for(int ss=0; ss<3; ss++) chip_c[ss*ndep+kk] = 0.01 * (ss+1) * chi[kk];
+
+    S[0][kk] = 1.e-8 * exp(-1.4388e7 / (854.2 * T[kk]));
+    for(int ss=1; ss<4; ss++) S[ss][kk] = 1.e-3 * ss * S[0][kk];
+  }
+
+  ActiveSet as;
+  memset(&as, 0, sizeof(ActiveSet));
+  as.chi_c = &chi_c[0], as.chip_c = &chip_c[0];
+
+  spectrum.as = &as, spectrum.lambda = &lambda[0];
+
+  vector<double> Psi(ndep);
+
+  mbench::header("RH kernels");
+
+  mbench::run("PiecewiseStokesBezier3 (Ndep=82)", opt, 1, ndep, [&](){
+      PiecewiseStokesBezier3(0, 0, TRUE, &chi[0], S, I, &Psi[0]);
+      mbench::sink(I[0][0] + I[3][0]);
+    });
+
+
+  /* --- Statistical equilibrium of a 6-level atom: collisional rates plus
+     radiative rates that decrease with height --- */
+
+  Atom atom;
+  memset(&atom, 0, sizeof(Atom));
+  atom.Nlevel = nlevel;
+  atom.n      = matrix_double(nlevel, ndep);
+  atom.Gamma  = matrix_double(nlevel*nlevel, ndep);
+  atom.C      = matrix_double(nlevel*nlevel, ndep);
+  vector<double> ntotal(ndep, 1.e10);
+  atom.ntotal = &ntotal[0];
+
+  for(int ii=0; ii<nlevel; ii++)
+    for(int jj=0; jj<nlevel; jj++)
+      for(int kk=0; kk<ndep; kk++){
+	int ij = ii*nlevel + jj;
+	if(ii == jj) continue;
+	atom.C[ij][kk] = 1.e3 * exp(-0.3*abs(ii-jj)) * exp(-height[kk] / 3.e5);
+	atom.Gamma[ij][kk] = 1.e5 / (1.0 + abs(ii-jj)) * (1.0 + 0.1*ii);
+      }
+
+  mpi.stop = FALSE;
+
+  mbench::run("statEquil (Nlevel=6, Nspace=82)", opt, 1, ndep, [&](){
+      statEquil(&atom, 0);
+      mbench::sink(atom.n[0][ndep/2]);
+    });
+
+  freeMatrix((void **) atom.n);
+  freeMatrix((void **) atom.Gamma);
+  freeMatrix((void **) atom.C);
+
+  return 0;
+}
@@ -0,0 +1,54 @@
+/* ---
+   Micro-benchmark of the spectral degradation (FFT convolution with
+   the instrumental profile) of one region, spectral::degrade.
+
+   Sizes: nw = 100 wavelengths in full Stokes (a CRISP/CHROMIS scan
+   sampled on the synthesis grid) and a 41 point instrumental profile.
+
+   Modifications:
+           2026-10-18: Created.
+   --- */
+
+#include <cmath>
+#include <vector>
+#include "spectral.h"
+#include "mbench.h"
+
+using namespace std;
+
+int main(int argc, char *argv[])
+{
+  mbench::options opt(argc, argv);
+
+  const int nw = 100, ns = 4, npsf = 41;
+
+
+  /* --- Region and gaussian instrumental profile --- */
+
+  region_t reg;
+  reg.nw = nw, reg.off = 0, reg.w0 = 8540.0, reg.dw = 0.04, reg.inst = "spectral";
+
+  vector<double> psf(npsf);
+  for(int ii=0; ii<npsf; ii++) psf[ii] = exp(-0.5 * pow((ii - npsf/2) / 6.0, 2));
+
+  spectral sp(reg, 1);
+  sp.init(npsf, &psf[0]);
+
+
+  /* --- A line profile in all Stokes parameters --- */
+
+  vector<double> syn0(nw*ns), syn(nw*ns);
+  for(int ww=0; ww<nw; ww++)
+    for(int ss=0; ss<ns; ss++)
+      syn0[ww*ns+ss] = ((ss == 0) ? 1.0 : 0.1) * (1.0 - 0.8 * exp(-0.5 * pow((ww-nw/2)/8.0, 2)));
+
+  mbench::header("spectral degradation");
+
+  mbench::run("spectral::degrade (nw=100, ns=4)", opt, 1, double(nw)*ns, [&](){
+      syn = syn0;
+      sp.degrade(&syn[0], ns);
+      mbench::sink(syn[nw/2*ns]);
+    });
+
+  return 0;
+}
@@ -0,0 +1,2434 @@
+#ifndef MOLECULES_H
+#define MOLECULES_H
+/* ---
+   Molecular equilibrium constants and partition functions.
+   Adapted from N. Piskunov's MOLCON, KP_Q_SPLN and NEGION fortran
+   subroutines (eos.f). The tables are copied verbatim from the DATA
+   statements of the fortran version:
+
+   MOLCON:    dissociation energy + polynomial fit to log10(Kp) (NextGen)
+              and polynomial fit to log10(Q) (Sauval & Tatum 1984, Irwin
+              1987, 1988), plus the ionization potential of the molecule.
+
+   KP_Q_SPLN: cubic-spline nodes of log10(Q) and log10(Kp)+D0*5040/T vs
+              log10(T) from P. Barklem's tables.
+
+   NEGION:    cubic-spline nodes of log10(Q) of negative atomic ions vs
+              log10(T). The extra element after the last node of each ion
+              is minus the electron affinity (eV).
+   --- */
+
+namespace molec{
+  /* --- MOLCON tables --- */
+  static const int NMOL = 197, NEQCOE = 7, NPCOEF = 11;
+
+  static const char MOLNAME[NMOL][8] = {
+    "H2", "CO", "H2O", "OH", "N2", "SiO", "HS", "H2S",
+    "NH", "SiH", "CH", "H2+", "NO", "MgH", "HCl", "SiS",
+    "AlOH", "NH2", "AlH", "CN", "CO2", "SO", "TiO", "S2",
+    "FeH", "NH3", "HCN", "HCO", "O2", "CH2", "HF", "H3+",
+    "CaH", "Al2O", "AlO", "CH3", "SiH2", "MgO", "C2", "TiO2",
+    "VO2", "NaH", "AlCl", "AlF", "VO", "CS", "MgOH", "PO2",
+    "CaOH", "PH2", "C2H", "ScO", "AlO2H", "AlS", "FeO", "CrO",
+    "CH4", "NS", "SO2", "SiN", "OH-", "ZrO", "NO+", "ZrO2",
+    "BO", "SiO2", "HBO", "SiC", "YO2", "TiS", "HBO2", "C2H2",
+    "OCS", "ZrO+", "NaOH", "CaCl", "AlOF", "YO", "NaCl", "C2O",
+    "CHP", "HS-", "H2-", "TiH", "PH3", "MgS", "TiO+", "LaO2",
+    "Si2", "SiH4", "BH2", "AlOCl", "LaO", "C2N", "AlBO2", "KCl",
+    "SiH-", "CaF", "CaO2H2", "KOH", "CN-", "Al2O2", "BaOH", "SrOH",
+    "BO2", "SiF", "CH-", "C3", "C2-", "MgO2H2", "BeOH", "HBS",
+    "SiC2", "FeO2H2", "CrO2", "BeH2O2", "BH3", "NaCN", "BeH2", "Si2N",
+    "CaCl2", "NaBO2", "C3H", "OBF", "CS2", "LiOH", "Al2", "LiCl",
+    "TiOCl", "C2H4", "CHCl", "TiCl", "AlOF2", "KBO2", "Si2C", "CHF",
+    "BO-", "AlO2", "BaO2H2", "OTiF", "CS-", "C2N2", "SrO2H2", "ClCN",
+    "AlClF", "KCN", "AlCl2", "BaCl2", "AlF2", "MgCl2", "FeO-", "BO2H2",
+    "SiH3Cl", "FeCl2", "Si3", "SiH3F", "CH3Cl", "SrCl2", "CaF2", "TiF2",
+    "LiBO2", "MgClF", "BeBO2", "C2HCl", "TiCl2", "C4", "H3BO3", "MgF2",
+    "BaClF", "BeF2", "C2HF", "BeCl2", "TiOCl2", "ZrCl2", "BaF2", "BeC2",
+    "Be2O", "SrF2", "ZrF2", "FeF2", "P4", "SiH2F2", "H3O+", "C5",
+    "TiF3", "TiCl3", "ZrCl3", "Na2Cl2", "Na2O2H2", "Be3O3", "K2Cl2", "K2O2H2",
+    "ZrCl4", "Na2C2N2", "ZrF4", "Li2O2H2", "CrH"
+  };
+
+  static const double COEF[NMOL][NEQCOE] = {
+    {4.4781, 12.1354, -0.7752, -0.7821, 0.1464, 0.1603, -0.0626}, // H2
+    {11.092, 13.2368, -0.8342, -0.0477, -0.2923, -0.4557, 0.6108}, // CO
+    {9.6221, 24.7774, -2.3428, 1.6868, -1.2845, -2.9925, 3.6555}, // H2O
+    {4.392, 11.8016, -0.8507, -0.5193, 0.0502, -0.3409, 0.4836}, // OH
+    {9.7594, 12.8868, -0.8813, 0.2639, -1.5912, 1.5866, -0.5407}, // N2
+    {8.26, 12.9252, -0.7608, -0.3541, 1.562, -3.5952, 2.5962}, // SiO
+    {3.55, 11.4382, -0.7816, -0.4659, 0.4314, -1.2144, 0.9648}, // HS
+    {7.5946, 23.8543, -0.9525, -0.8118, 0.2051, -1.0299, 1.1555}, // H2S
+    {3.47, 11.4658, -0.7258, -0.6418, -0.0442, 0.2836, -0.1618}, // NH
+    {3.06, 11.2595, -0.6962, -0.6435, 0.6663, -0.3357, -0.4151}, // SiH
+    {3.465, 11.5333, -0.5255, -0.7105, 0.2264, -0.9271, 0.9577}, // CH
+    {2.6508, 15.8052, 33.7578, 34.5956, 27.3455, 16.6214, 9.9717}, // H2+
+    {6.4968, 11.9347, -0.7596, 0.0953, -0.9731, 0.8265, -0.2151}, // NO
+    {1.34, 10.2911, -0.3698, -0.0655, -2.9771, 6.1325, -4.3869}, // MgH
+    {4.4336, 11.9041, -0.8281, -0.6163, 0.158, -0.5068, 0.5164}, // HCl
+    {6.42, 12.6363, -0.7355, 0.0488, 0.8442, -2.0131, 1.3603}, // SiS
+    {10.1252, 25.2575, -0.681, -0.3051, -1.5765, 2.7536, -1.8355}, // AlOH
+    {7.44, 23.7389, -1.0179, -0.9947, -1.4353, 3.253, -1.9224}, // NH2
+    {3.06, 11.4907, -0.4322, -0.6561, -0.5978, 2.4923, -2.4038}, // AlH
+    {7.76, 12.4438, -0.4756, -0.4909, -1.4623, 2.6823, -1.5396}, // CN
+    {16.5382, 26.9571, -0.7464, -0.4921, -0.8506, -0.1365, 0.2358}, // CO2
+    {5.359, 12.338, -0.4956, -0.2251, -0.1907, -0.2038, 0.2579}, // SO
+    {6.87, 11.9229, -1.4044, 0.7899, -0.7317, -0.0193, -0.4994}, // TiO
+    {4.3693, 12.319, -0.505, -0.029, -0.0266, -0.6002, 0.4572}, // S2
+    {1.598, 12.1214, 0.9438, 2.2756, -0.1086, 4.1281, -1.9952}, // FeH
+    {12.1388, 36.6661, -1.4062, -0.9258, -1.6969, 0.6005, 1.2302}, // NH3
+    {13.2363, 25.1318, -0.5532, -0.085, -0.9817, 0.6676, 0.3054}, // HCN
+    {11.856, 24.6414, -0.9415, -0.1856, -0.2948, -0.163, 0.5836}, // HCO
+    {5.1156, 12.8758, -0.4856, -0.5054, -0.0776, -0.0713, 0.2369}, // O2
+    {7.94, 23.8609, -1.0762, -0.4928, -0.4092, 0.0031, 0.3761}, // CH2
+    {5.869, 12.2896, -0.918, -0.6238, 0.1243, -0.3525, 0.4767}, // HF
+    {0.0, 18.8343, 12.4131, 11.9991, 6.8079, 8.4071, 2.6202}, // H3+
+    {1.7, 10.1982, -0.9309, 1.8315, -5.6059, 6.9571, -3.5023}, // CaH
+    {10.9653, 24.8807, -0.0033, 0.4796, -1.6979, 3.5631, -2.5414}, // Al2O
+    {5.27, 12.2132, -0.5246, -0.1918, -0.681, 1.7287, -1.5839}, // AlO
+    {12.6885, 36.654, -1.3373, -1.0064, -0.588, -0.2362, 0.8764}, // CH3
+    {0.0, 17.8513, -15.5361, -17.6144, -13.1604, -6.4819, -5.6361}, // SiH2
+    {3.53, 10.794, 0.0122, 1.1189, -1.8758, 2.9976, -2.7758}, // MgO
+    {6.297, 12.4672, -0.4452, -0.01, -0.1868, -0.386, 0.623}, // C2
+    {13.2915, 25.934, -1.4243, 1.6519, -0.724, -0.7271, 0.7518}, // TiO2
+    {12.9619, 25.9238, -1.2927, 1.371, -2.4073, 2.2875, -0.5486}, // VO2
+    {1.88, 10.7184, -0.3642, 0.7843, -6.5309, 13.2912, -9.9502}, // NaH
+    {5.12, 11.8277, -0.3468, -1.0735, 1.8038, -1.7748, 0.4333}, // AlCl
+    {6.89, 12.2422, -0.4905, -0.4198, 0.0242, 0.3868, -0.5765}, // AlF
+    {6.41, 12.8108, -0.5811, -0.7895, -2.6766, 8.5158, -6.9993}, // VO
+    {7.355, 12.8487, -0.7627, -0.2538, 1.524, -4.0119, 3.0234}, // CS
+    {8.0735, 23.3256, -0.5884, 0.3637, -2.4401, 3.3936, -1.7121}, // MgOH
+    {11.7451, 25.2051, -0.9105, 1.0031, -0.7207, -1.1064, 1.6239}, // PO2
+    {8.7035, 23.19, -1.0964, 2.534, -5.9823, 5.3416, -1.1946}, // CaOH
+    {6.4895, 23.0863, -1.3781, 0.2539, -0.6746, -1.2341, 1.5623}, // PH2
+    {12.2087, 24.9752, -0.3204, -0.564, -0.8997, 1.6927, -0.7771}, // C2H
+    {6.96, 12.5225, -1.2695, 1.7628, -2.0543, -1.2215, 2.3706}, // ScO
+    {15.6364, 37.7022, -0.5885, -0.0823, -1.7283, 3.0502, -2.0176}, // AlO2H
+    {3.84, 11.914, -0.5187, -0.1193, -0.3886, 1.1704, -1.2299}, // AlS
+    {4.2, 12.5326, -1.0657, 1.036, -1.5641, 0.956, -0.3218}, // FeO
+    {4.4, 11.0587, -1.3926, 1.4461, -2.1552, 3.3409, -3.1078}, // CrO
+    {17.2173, 49.9426, -0.972, -2.4957, -0.0017, -2.3299, 3.1042}, // CH4
+    {4.8, 11.9223, -0.6951, 0.187, -0.7158, 0.4121, 0.0296}, // NS
+    {11.1405, 25.9246, -0.5809, 0.0734, -0.3333, 0.1699, 0.0529}, // SO2
+    {6.688, 14.0972, 4.2904, 4.9608, 2.939, 3.9789, 0.8908}, // SiN
+    {4.76, 19.9888, -6.7088, -4.3846, -2.8142, -2.3004, -0.3157}, // OH-
+    {7.85, 12.4674, -1.128, 0.0368, 0.2221, 1.1043, -1.8804}, // ZrO
+    {10.85, 17.5169, 33.0097, 36.211, 26.7396, 15.2392, 11.413}, // NO+
+    {14.465, 25.6324, -1.5339, 1.1586, -0.9355, 1.6114, -1.2154}, // ZrO2
+    {8.28, 12.6246, -0.6966, -0.3874, 0.2531, -0.7582, 0.5307}, // BO
+    {13.0355, 26.561, -0.2891, 0.3006, -0.4009, 0.5864, -0.4006}, // SiO2
+    {12.7425, 25.2283, -0.478, -0.3611, -0.2189, -0.2108, 0.5883}, // HBO
+    {4.64, 11.8909, -0.8762, 0.1138, 0.0665, -0.5226, 0.3331}, // SiC
+    {15.2, 25.8617, -1.405, -0.3896, 1.0805, 2.9269, -3.7531}, // YO2
+    {4.75, 11.6628, -1.4463, 1.3742, -0.8127, -0.4623, 0.2288}, // TiS
+    {19.0991, 38.4541, -0.7808, -0.422, -0.9239, 1.0793, -0.2304}, // HBO2
+    {16.9704, 37.7481, -0.2529, -1.0622, -0.1485, -0.7058, 1.191}, // C2H2
+    {14.3762, 26.3815, -0.1712, 0.1197, 0.0059, -0.9891, 1.1946}, // OCS
+    {0.0, 2.5576, -0.5567, -4.5109, -4.369, -0.1528, -3.1319}, // ZrO+
+    {8.015, 23.342, -0.6139, 1.4091, -6.8466, 13.0407, -9.2977}, // NaOH
+    {4.09, 10.6268, -1.1367, 2.5278, -5.6022, 4.8741, -1.1616}, // CaCl
+    {12.9003, 25.5751, -0.073, 0.2808, -1.1757, 2.3733, -1.6726}, // AlOF
+    {7.29, 12.4422, -1.3547, 1.3087, 0.1688, -5.4106, 5.1158}, // YO
+    {4.23, 11.0864, -0.4463, 1.1926, -7.582, 15.2552, -11.1116}, // NaCl
+    {14.5371, 25.6134, -0.0508, 0.371, -0.6246, -0.7682, 0.5868}, // C2O
+    {11.4442, 24.7107, -0.5678, -0.0389, 1.0076, -4.6514, 4.3893}, // CHP
+    {3.79, 19.0227, -8.0668, -5.9821, -3.8685, -3.1838, -1.0364}, // HS-
+    {0.73, 19.7162, -5.0018, -2.768, -1.2845, -0.9859, -0.338}, // H2-
+    {2.12, 12.4717, 0.1601, 1.4596, -0.2012, 5.0788, -4.5487}, // TiH
+    {9.78, 35.8044, -1.3937, -0.265, -0.6732, -2.5437, 2.971}, // PH3
+    {2.4, 11.3146, -0.5595, 0.3619, -2.0065, 3.8766, -2.99}, // MgS
+    {0.0, 4.5751, 3.4421, 0.756, -1.7011, 1.451, -1.3922}, // TiO+
+    {21.151, 31.0805, 10.707, 12.8687, 10.5799, 6.4414, 3.6171}, // LaO2
+    {3.21, 12.1817, -0.7102, -0.2403, 1.1042, -1.3644, 0.3198}, // Si2
+    {13.2716, 48.6914, -1.0602, -1.2802, -0.8603, 0.1159, -0.0701}, // SiH4
+    {8.2349, 24.0157, -0.6514, -0.6064, -0.6542, 0.9096, -0.5839}, // BH2
+    {10.9011, 25.1839, -0.106, 0.253, -1.185, 2.3355, -1.6111}, // AlOCl
+    {8.23, 12.192, 0.1751, -0.7678, -1.3836, 1.7704, -0.0265}, // LaO
+    {14.0629, 25.1475, -0.227, 0.7024, -0.8499, 0.4583, 0.1889}, // C2N
+    {20.0747, 38.6719, -0.2664, 0.2782, -1.2642, 1.602, -0.5248}, // AlBO2
+    {4.34, 10.9561, -0.872, 3.4218, -12.2306, 18.7863, -11.1011}, // KCl
+    {3.23, 19.3359, -5.757, -3.5853, -1.3882, -2.3313, -0.493}, // SiH-
+    {5.48, 11.0459, -0.8574, 2.3137, -4.6777, 4.4532, -1.1716}, // CaF
+    {17.8875, 47.4921, -1.139, 2.7534, -7.2248, 6.3242, -1.1381}, // CaO2H2
+    {8.1892, 23.3129, -1.0581, 3.5131, -11.3115, 16.9078, -9.8867}, // KOH
+    {10.31, 21.7682, -5.8992, -3.8627, -4.0284, 1.2924, -2.5856}, // CN-
+    {16.1405, 37.9519, -0.023, 0.6639, -2.491, 5.5385, -4.2945}, // Al2O2
+    {9.0621, 23.3478, -2.1422, 1.7058, -1.6807, 10.3429, -14.0183}, // BaOH
+    {8.6837, 23.1042, -1.2656, 3.2436, -7.2017, 6.5067, -1.7129}, // SrOH
+    {13.9839, 25.6721, -0.0784, 0.0544, -0.2755, 0.614, -0.3673}, // BO2
+    {5.57, 12.0158, -0.5187, -0.1216, 0.6738, -0.6377, 0.1588}, // SiF
+    {0.0, 16.4621, -13.8562, -13.1896, -9.2577, -6.3354, -2.5704}, // CH-
+    {13.861, 26.3081, -1.3134, 0.1185, -0.0461, -0.4056, 0.8088}, // C3
+    {8.48, 21.1413, -5.8697, -3.3745, -2.7491, -1.8902, -0.2441}, // C2-
+    {17.1545, 48.1845, -0.5683, 0.1125, -3.0973, 4.3727, -2.1978}, // MgO2H2
+    {9.3961, 23.7967, -0.65, 0.2061, -1.9381, 2.1259, -0.6451}, // BeOH
+    {10.4305, 24.8357, -0.493, -0.455, 0.8862, -2.7257, 2.4025}, // HBS
+    {13.1966, 25.7392, 0.0961, -0.7979, -0.1515, 4.275, -4.6336}, // SiC2
+    {17.4231, 48.8561, -0.4831, 0.9575, -1.9798, -0.0476, 1.2346}, // FeO2H2
+    {10.093, 25.0689, -1.5784, 2.2605, -3.1152, 3.7375, -2.5596}, // CrO2
+    {20.0817, 49.3051, -0.2203, 0.6123, -1.9159, 3.0362, -0.6588}, // BeH2O2
+    {11.4541, 36.8342, -1.3068, -1.2283, -0.713, -0.1039, 0.8121}, // BH3
+    {12.5346, 24.2744, -0.423, 2.1003, -7.6565, 14.5171, -10.4377}, // NaCN
+    {6.5483, 23.5736, -0.783, -0.0881, -2.2398, 2.705, -1.5244}, // BeH2
+    {10.1248, 24.8268, -0.3784, 0.5561, -0.7324, 1.7508, -1.6977}, // Si2N
+    {9.3132, 22.5681, -0.773, 3.2979, -6.3686, 5.521, -0.9987}, // CaCl2
+    {18.8913, 37.0212, -0.3881, 1.7934, -7.5472, 14.9782, -11.0505}, // NaBO2
+    {0.0, 19.8338, -46.6804, -50.9308, -35.9059, -13.5611, -23.8103}, // C3H
+    {15.5315, 26.0301, -0.1824, 0.0109, -0.3944, 0.5184, -0.0882}, // OBF
+    {11.9993, 26.2368, -0.1708, 0.2491, 0.422, -2.2962, 2.2409}, // CS2
+    {8.9381, 23.5703, -0.6263, 1.006, -4.3983, 7.4665, -4.8955}, // LiOH
+    {1.55, 11.3681, -0.1946, -0.0669, -2.3347, 5.3477, -4.0343}, // Al2
+    {4.84, 11.309, -0.5602, 0.5886, -3.9705, 7.3873, -5.2571}, // LiCl
+    {11.3225, 25.4462, -1.0487, 1.8142, -1.511, 0.4282, -0.024}, // TiOCl
+    {23.3326, 62.7915, -1.3095, -1.6903, -0.9624, -1.6171, 2.5521}, // C2H4
+    {7.4689, 23.8059, -0.5629, 0.0019, -0.3896, -0.7781, 0.389}, // CHCl
+    {6.69, 14.8883, 5.3193, 8.9551, 3.7271, 5.1452, 1.0391}, // TiCl
+    {19.2284, 37.1933, 0.1308, -0.0614, -0.9981, 2.977, -2.1833}, // AlOF2
+    {18.9713, 36.8674, -0.8338, 3.8816, -11.3916, 16.8414, -9.6911}, // KBO2
+    {11.2271, 25.9412, 0.1074, -0.8813, -0.2594, 4.4112, -4.4861}, // Si2C
+    {9.2183, 24.527, -0.6453, -1.0757, -0.7155, 2.2944, -1.4513}, // CHF
+    {0.0, 11.8175, -29.4442, -30.6402, -22.9279, -13.1209, -8.8023}, // BO-
+    {10.976, 27.6834, 5.5082, 6.6402, 5.5692, 2.7324, 1.9375}, // AlO2
+    {18.0802, 47.005, -2.3587, 2.3466, -2.2753, 8.4432, -11.3032}, // BaO2H2
+    {12.8526, 25.8889, -1.026, 1.8361, -1.5017, 0.3478, 0.0486}, // OTiF
+    {6.5, 20.6745, -7.9942, -5.7057, -2.6759, -6.1649, 1.2656}, // CS-
+    {21.5636, 39.0495, -0.119, 0.7088, -1.5184, 0.4914, 0.9277}, // C2N2
+    {17.5958, 46.9386, -1.3295, 3.5725, -8.471, 7.5694, -1.8456}, // SrO2H2
+    {12.2076, 25.3442, -0.0379, -0.1189, -0.8276, 1.3188, -0.6986}, // ClCN
+    {10.6135, 23.6489, -0.5207, 0.0519, -0.6538, 1.9149, -1.5058}, // AlClF
+    {12.501, 24.1386, -0.8692, 4.1888, -11.7377, 17.1662, -9.8522}, // KCN
+    {8.8688, 23.5425, -0.5528, 0.0031, -0.7346, 2.3344, -1.9878}, // AlCl2
+    {9.607, 22.2204, -2.5275, 2.8555, -1.4987, 7.7865, -11.3039}, // BaCl2
+    {12.3143, 24.3964, -0.494, 0.0699, -0.5475, 1.6261, -1.2695}, // AlF2
+    {8.1536, 22.9187, -0.1815, 0.6847, -2.4792, 4.3296, -2.7691}, // MgCl2
+    {0.0, 17.5598, -16.6727, -14.0707, -13.078, -5.4193, -4.7856}, // FeO-
+    {20.4537, 49.9913, -0.5362, -0.7176, -1.2169, 1.1206, -0.3773}, // BO2H2
+    {14.1133, 48.5194, -0.8436, -1.0629, -0.7362, 0.308, -0.3403}, // SiH3Cl
+    {8.3239, 23.6272, -0.2108, 1.1105, -2.1105, 1.538, -0.1684}, // FeCl2
+    {7.384, 24.86, -0.1499, -0.1631, 0.1378, 1.6604, -1.9986}, // Si3
+    {16.1268, 48.9782, -0.826, -1.038, -0.6452, -0.1029, 0.1199}, // SiH3F
+    {16.2992, 49.7196, -1.2716, -1.4752, -1.1626, 0.6516, -0.0837}, // CH3Cl
+    {9.1791, 22.1133, -1.4891, 4.105, -7.6534, 6.6694, -1.5355}, // SrCl2
+    {11.6845, 23.26, -1.2039, 3.3661, -6.2828, 5.1661, -0.6547}, // CaF2
+    {13.7563, 25.2856, -0.4137, 1.0746, -1.1248, 0.2935, 0.3807}, // TiF2
+    {19.4163, 36.9346, -0.3977, 1.3814, -4.7577, 8.2956, -5.5779}, // LiBO2
+    {9.5422, 23.6489, -0.6541, 0.7042, -2.5258, 4.5411, -3.0359}, // MgClF
+    {19.3953, 37.4967, -0.4103, 0.6249, -2.5737, 3.7334, -2.0769}, // BeBO2
+    {16.1988, 37.8077, -0.3545, -0.2428, -0.1731, -1.4896, 1.9844}, // C2HCl
+    {9.9277, 24.6274, -0.5062, 0.986, -1.31, 0.8075, -0.0931}, // TiCl2
+    {19.7168, 40.3256, -0.2533, 0.3731, -0.5863, -0.6939, 0.9337}, // C4
+    {30.6562, 75.8041, -1.6269, -1.1205, -1.8109, 2.1354, -0.8357}, // H3BO3
+    {10.751, 23.8686, -0.613, 0.7434, -2.6657, 5.0507, -3.5509}, // MgF2
+    {0.0, 13.8534, -28.5088, -27.6557, -25.042, -4.2145, -21.0916}, // BaClF
+    {13.32, 24.6323, -0.2099, 0.5174, -1.9085, 2.9836, -1.7351}, // BeF2
+    {16.6788, 38.1093, -0.3632, -0.2642, -0.4287, -0.5573, 0.9863}, // C2HF
+    {9.6498, 23.7877, -0.2606, 0.4816, -1.7048, 2.1226, -0.8176}, // BeCl2
+    {15.7352, 37.191, -1.048, 1.8371, -1.142, -0.7526, 1.288}, // TiOCl2
+    {10.7683, 24.3508, -0.5859, 0.0972, -0.3635, 0.9082, -0.3338}, // ZrCl2
+    {11.9101, 22.9073, -2.4413, 2.942, -1.3655, 7.3312, -10.8692}, // BaF2
+    {12.4073, 25.2586, -0.5256, 0.7548, -2.0655, 2.2598, -0.9944}, // BeC2
+    {9.9676, 24.002, -0.4765, 1.0925, -3.6131, 4.2582, -1.8225}, // Be2O
+    {11.3542, 22.8132, -1.4157, 4.179, -7.3508, 5.5696, -0.4507}, // SrF2
+    {13.7587, 24.716, -1.0103, 0.2376, -0.4664, -0.9114, 6.9672}, // ZrF2
+    {13.091, 27.6502, 6.5468, 8.2502, 7.3334, 4.1191, 1.2402}, // FeF2
+    {12.5389, 37.9053, -1.349, 3.1985, -1.1165, -6.7253, 7.3584}, // P4
+    {19.024, 49.7099, -0.5565, -0.7375, -0.2251, -1.1324, 1.2457}, // SiH2F2
+    {3.2806, 41.7329, 32.0127, 34.5233, 27.1981, 13.3168, 13.4808}, // H3O+
+    {27.0859, 54.0398, 0.0077, 0.4169, -0.9261, -0.3135, 0.6322}, // C5
+    {19.7864, 37.9176, -0.7063, 1.7895, -1.5401, 0.9448, -0.6313}, // TiF3
+    {14.3199, 37.3165, -0.845, 1.6603, -1.6009, 0.8934, -0.507}, // TiCl3
+    {15.554, 36.5254, -0.7361, 0.8503, -0.3688, 0.0324, 0.0881}, // ZrCl3
+    {10.6603, 34.6664, -0.4567, 3.2641, -13.6211, 27.6173, -20.7914}, // Na2Cl2
+    {18.1954, 60.7438, -0.7643, 2.2577, -14.4187, 28.3225, -20.4866}, // Na2O2H2
+    {28.8149, 64.394, -0.2174, 1.3367, -6.6368, 8.6309, -4.6284}, // Be3O3
+    {10.8345, 33.9871, -1.314, 7.484, -21.9583, 33.6428, -20.3143}, // K2Cl2
+    {18.3196, 60.4179, -1.6298, 6.4524, -22.923, 33.881, -20.0092}, // K2O2H2
+    {20.4364, 49.7173, -0.6667, 0.8064, -0.1308, -0.4433, 0.897}, // ZrCl4
+    {27.1266, 62.7471, -0.3813, 3.6624, -15.0927, 27.0694, -18.7738}, // Na2C2N2
+    {27.0557, 51.2712, -0.5271, 0.893, -0.5666, 1.5292, -1.3568}, // ZrF4
+    {20.3442, 61.3686, -0.841, 1.3617, -9.5297, 16.1158, -11.1739}, // Li2O2H2
+    {1.93, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0}  // CrH
+  };
+
+  static const double PCOEF[NMOL][NPCOEF] = {
+    {1.69179, -1.7227, 0.798033, -0.157089, -0.535313, 1.75818, -2.63895, 1.35708, 0.0, 0.0, 15.42593}, // H2
+    {3.6153, -1.773848, 0.3516181, 0.08620792, 0.2911791, -1.141469, 2.513133, -2.886502, 1.238932, 0.0, 14.014}, // CO
+    {4.344711818, -3.6343233, 1.415963, 0.01594, 0.56542, -1.2583, 0.53796, 0.0, 0.0, 0.0, 12.621}, // H2O
+    {3.0929, -1.6778, 0.6743, -0.1874, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 13.017}, // OH
+    {3.2643, -1.7303, 0.4192, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 15.581}, // N2
+    {4.2275, -1.9144, 0.7201, -1.3099, 1.1657, 0.0, 0.0, 0.0, 0.0, 0.0, 11.49}, // SiO
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 10.422}, // HS
+    {5.117210341, -3.94844146, 1.23193, 0.076156, 0.42163, -0.453534, 0.0, 0.0, 0.0, 0.0, 10.457}, // H2S
+    {3.0735, -1.8501, 0.9607, -0.3935, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 13.49}, // NH
+    {3.6908, -1.9801, 0.7704, -0.2247, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 7.91}, // SiH
+    {3.3586, -2.0656, 0.9624, -0.2239, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 10.64}, // CH
+    {2.541, -2.4336, 1.4979, 0.0192, -0.7483, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // H2+
+    {4.3073, -1.8255, 0.3765, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 9.2642}, // NO
+    {3.6704, -2.2682, 0.9354, -0.2597, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 7.2}, // MgH
+    {2.8005, -1.7476, 0.531, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 12.744}, // HCl
+    {4.8026, -1.9753, 0.26, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 10.53}, // SiS
+    {6.103792598, -4.3938712, 0.662588, 0.3751, 0.38386, -0.2147, 0.0, 0.0, 0.0, 0.0, -1.0}, // AlOH
+    {4.819621858, -3.84200734, 1.5386462, 0.784399, -2.34404, 2.50803, -1.13304, 0.0, 0.0, 0.0, 11.14}, // NH2
+    {3.3209, -2.5909, 1.7415, -0.7636, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 5.5}, // AlH
+    {4.0078, -2.1514, 0.9226, -0.1671, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 13.598}, // CN
+    {6.01081285, -4.438833, 0.840462, 0.2945, 0.3694, -0.273, 0.0, 0.0, 0.0, 0.0, 13.777}, // CO2
+    {4.7963, -2.1308, 0.5224, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 10.294}, // SO
+    {5.3051, -2.3739, 0.894, -0.3641, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 6.819}, // TiO
+    {5.0796, -2.1967, 0.4101, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 9.356}, // S2
+    {4.626598, -2.56258, 0.38885943, 0.4021982, -0.21386399, 0.027845045, 0.0, 0.0, 0.0, 0.0, 7.37}, // FeH
+    {5.884176216, -5.8364867, 1.608417, 1.50876, -0.59607, -0.58961, 0.2459, 0.0, 0.0, 0.0, -1.0}, // NH3
+    {5.434042379, -4.2409874, 0.988745, 0.49464, 0.03719, -0.22924, 0.0, 0.0, 0.0, 0.0, 13.6}, // HCN
+    {6.298781639, -3.85672804, 0.8551678, 0.321901, 0.020274, 0.15254, -0.25298, 0.0, 0.0, 0.0, 8.12}, // HCO
+    {4.0636, -2.0779, 0.766, -0.2111, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 12.0697}, // O2
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 10.396}, // CH2
+    {2.4164, -1.6132, 0.6357, -0.1767, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 16.03}, // HF
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // H3+
+    {3.8411, -2.3891, 1.3578, -0.6893, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 5.86}, // CaH
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // Al2O
+    {4.9191, -2.6291, 0.5831, 0.3163, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 9.46}, // AlO
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 9.84}, // CH3
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 8.8}, // SiH2
+    {5.3182, -2.6502, -0.2781, -0.7823, 1.3107, 0.0, 0.0, 0.0, 0.0, 0.0, 8.76}, // MgO
+    {4.3091, -2.2406, 0.4865, -0.2049, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 11.4}, // C2
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 9.5}, // TiO2
+    {8.457240767, -4.1987868, 0.334575, 0.20744, 0.18226, -0.053465, 0.0, 0.0, 0.0, 0.0, -1.0}, // VO2
+    {3.5453, -2.3457, 0.8557, -0.1685, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 4.7}, // NaH
+    {5.1115, -2.2303, 0.8001, -0.5192, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 9.4}, // AlCl
+    {4.5405, -2.1033, 0.6208, -0.293, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // AlF
+    {5.0687, -2.2186, 0.9545, -0.4592, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 7.2386}, // VO
+    {4.1646, -1.9348, 0.8034, -1.3669, 1.1561, 0.0, 0.0, 0.0, 0.0, 0.0, 11.33}, // CS
+    {6.8401894714, -4.338616427, 0.71600166, 0.128126, 0.5978087, -0.8658369, 0.385049, 0.0, 0.0, 0.0, 7.5}, // MgOH
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 11.9}, // PO2
+    {7.1623971155, -4.471282563, 1.1221899, -0.558812, 0.2294, 1.78658, -2.95118, 1.41591, 0.0, 0.0, 5.8}, // CaOH
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 9.824}, // PH2
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 11.61}, // C2H
+    {4.8065, -2.2129, 0.9991, -0.5414, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // ScO
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // AlO2H
+    {5.2461, -2.1319, 0.534, -0.2309, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // AlS
+    {5.5642, -2.1947, 0.5065, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 8.9}, // FeO
+    {5.527, -2.1311, 0.6523, -0.2533, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 7.85}, // CrO
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 12.61}, // CH4
+    {4.8052, -1.9619, 0.314, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 8.87}, // NS
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 12.349}, // SO2
+    {4.657, -2.3587, 0.8819, -0.1642, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // SiN
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // OH-
+    {5.3279, -2.4694, 0.2164, -0.2313, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 6.0}, // ZrO
+    {3.5649, -1.7328, 0.4241, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // NO+
+    {8.72011985, -4.247295, 0.2758, 0.20738, 0.09406, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // ZrO2
+    {3.9953, -1.8665, 0.5965, -0.1617, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 13.3}, // BO
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // SiO2
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // HBO
+    {5.1477, -1.8671, 0.2404, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 9.2}, // SiC
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // YO2
+    {5.8948, -2.2183, 0.5928, -0.3106, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 7.1}, // TiS
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // HBO2
+    {7.1220464309, -6.966653604, 1.9668235, 0.362597, 0.608996, -0.920435, 0.271892, 0.0, 0.0, 0.0, 11.4}, // C2H2
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 11.185}, // OCS
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // ZrO+
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // NaOH
+    {5.7494, -2.334, 0.8685, -0.5306, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 5.86}, // CaCl
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // AlOF
+    {4.9515, -2.0866, 0.6565, -0.3082, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 6.0}, // YO
+    {5.3364, -2.2844, 0.282, 0.1185, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // NaCl
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // C2O
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 10.79}, // CHP
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // HS-
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // H2-
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 6.0}, // TiH
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 9.869}, // PH3
+    {5.0367, -2.1625, 0.4859, -0.178, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // MgS
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // TiO+
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // LaO2
+    {5.2617, -2.1485, 0.5647, -0.2985, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // Si2
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // SiH4
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 9.8}, // BH2
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // AlOCl
+    {5.1147, -2.5016, 1.0445, -0.3135, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 4.95}, // LaO
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 12.0}, // C2N
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // AlBO2
+    {5.686, -2.3016, 0.2086, 0.1763, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // KCl
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // SiH-
+    {5.201, -2.2653, 0.8941, -0.5384, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // CaF
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // CaO2H2
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 7.5}, // KOH
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // CN-
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // Al2O2
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // BaOH
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // SrOH
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // BO2
+    {5.0871, -2.0375, 0.4478, -0.1243, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 7.54}, // SiF
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // CH-
+    {6.618407932, -3.576399, 0.883642, 0.087548, 0.04817, -0.16471, 0.0, 0.0, 0.0, 0.0, -1.0}, // C3
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // C2-
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // MgO2H2
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // BeOH
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // HBS
+    {7.54651307623, -5.075563869, 1.82960795, 0.0983258, -6.335157, 14.33103, -13.01689, 4.428233, 0.0, 0.0, 10.2}, // SiC2
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // FeO2H2
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // CrO2
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // BeH2O2
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // BH3
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // NaCN
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // BeH2
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // Si2N
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // CaCl2
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // NaBO2
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // C3H
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // OBF
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 10.073}, // CS2
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // LiOH
+    {5.5538, -2.3365, 0.5754, -0.2119, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 5.4}, // Al2
+    {4.5605, -2.2216, 0.576, -0.1706, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 9.57}, // LiCl
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // TiOCl
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // C2H4
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // CHCl
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // TiCl
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // AlOF2
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // KBO2
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // Si2C
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 10.06}, // CHF
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // BO-
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // AlO2
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // BaO2H2
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // OTiF
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // CS-
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // C2N2
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // SrO2H2
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 12.36}, // ClCN
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // AlClF
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // KCN
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // AlCl2
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // BaCl2
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // AlF2
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // MgCl2
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // FeO-
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // BO2H2
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // SiH3Cl
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // FeCl2
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // Si3
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // SiH3F
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // CH3Cl
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // SrCl2
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // CaF2
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // TiF2
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // LiBO2
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // MgClF
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // BeBO2
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // C2HCl
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // TiCl2
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // C4
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // H3BO3
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // MgF2
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // BaClF
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // BeF2
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // C2HF
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // BeCl2
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // TiOCl2
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // ZrCl2
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // BaF2
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // BeC2
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // Be2O
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // SrF2
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // ZrF2
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // FeF2
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // P4
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // SiH2F2
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // H3O+
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // C5
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // TiF3
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // TiCl3
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // ZrCl3
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // Na2Cl2
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // Na2O2H2
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // Be3O3
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // K2Cl2
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // K2O2H2
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // ZrCl4
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // Na2C2N2
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // ZrF4
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0}, // Li2O2H2
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 7.33}  // CrH
+  };
+
+  /* --- KP_Q_SPLN tables (Barklem) --- */
+  static const int NBARK = 60, NTQ = 33, NTK = 46;
+
+  static const char BARKNAME[NBARK][8] = {
+    "H2+", "H2", "H2-", "CH", "CH-", "C2", "C2-", "CN",
+    "CN-", "NH", "N2", "OH", "OH-", "BO", "CO", "NO+",
+    "NO", "O2", "HF", "NaH", "MgH", "MgO", "AlH", "AlO",
+    "AlF", "Al2", "SiH", "SiH-", "SiC", "SiN", "SiO", "SiF",
+    "Si2", "HS", "HS-", "CS", "NS", "SO", "MgS", "AlS",
+    "SiS", "S2", "HCl", "LiCl", "NaCl", "AlCl", "CaH", "CaF",
+    "CaCl", "ScO", "TiO", "TiS", "VO", "CrH", "CrO", "FeH",
+    "FeO", "YO", "ZrO", "LaO"
+  };
+
+  static const int MTQ[NBARK] = {
+    24, 22, 22, 26, 26, 31, 31, 29, 29, 24, 24, 23, 22, 28, 27,
+    25, 30, 30, 22, 29, 27, 33, 28, 28, 29, 29, 26, 24, 27, 30,
+    30, 30, 32, 27, 26, 28, 29, 29, 22, 23, 29, 29, 26, 25, 29,
+    28, 29, 27, 30, 27, 29, 28, 29, 27, 29, 30, 28, 27, 33, 25};
+
+  static const int MTK[NBARK] = {
+    36, 35, 32, 39, 33, 44, 43, 38, 39, 34, 36, 36, 31, 38, 46,
+    45, 37, 36, 36, 35, 39, 42, 42, 40, 41, 41, 41, 37, 40, 38,
+    44, 38, 43, 40, 40, 45, 38, 35, 35, 39, 38, 36, 36, 34, 38,
+    39, 36, 40, 37, 38, 39, 38, 41, 38, 39, 41, 38, 40, 40, 38};
+
+  static const double TQ[NBARK][NTQ] = {
+    { // H2+
+      -0.999999993529, -0.213099990781, 0.362900016751, 0.863300018968, 0.980699997741,
+      1.099999910318, 1.348399912911, 1.488499999486, 1.6320001069, 1.781399972218,
+      1.946900055894, 2.195800048889, 2.459400026935, 2.637100099165, 2.795999962688,
+      3.017700048765, 3.238299818206, 3.371799936189, 3.488399799847, 3.67509993207,
+      3.782100153231, 3.91509997526, 3.966599864718, 4.0},
+    { // H2
+      -0.999999993529, 0.546399960943, 0.928499940989, 1.176300059693, 1.287899949758,
+      1.399100094267, 1.648700096928, 1.743600009207, 1.840399908833, 2.009600002847,
+      2.197800044999, 2.438100070396, 2.693900045012, 2.91290008731, 3.025900111066,
+      3.127900068141, 3.48309994282, 3.602599959587, 3.722599865216, 3.880100116638,
+      3.949199845377, 4.0},
+    { // H2-
+      -0.999999993529, 0.546399960943, 0.928499940989, 1.176300059693, 1.287899949758,
+      1.399100094267, 1.648700096928, 1.743600009207, 1.840399908833, 2.009600002847,
+      2.197800044999, 2.438100070396, 2.693900045012, 2.91290008731, 3.025900111066,
+      3.127900068141, 3.48309994282, 3.602599959587, 3.722499862962, 3.880300111551,
+      3.949599836878, 4.0},
+    { // CH
+      -0.999999993529, -0.326599980548, 0.166399959291, 0.430299957164, 0.636699985352,
+      0.739300022626, 0.832600038271, 0.960700052763, 1.065399944135, 1.210300015201,
+      1.390500091928, 1.596199899459, 1.839399909152, 2.126100009214, 2.433400079679,
+      2.656200091992, 2.850899897814, 2.995100004942, 3.200799816137, 3.360900121256,
+      3.582299979332, 3.733499938459, 3.807899997628, 3.881700075939, 3.954999937558,
+      4.0},
+    { // CH-
+      -0.999999993529, -0.326599980548, 0.166399959291, 0.430299957164, 0.636699985352,
+      0.739300022626, 0.832600038271, 0.960700052763, 1.065399944135, 1.210300015201,
+      1.390500091928, 1.596199899459, 1.839399909152, 2.126100009214, 2.433400079679,
+      2.656200091992, 2.850899897814, 2.995100004942, 3.200799816137, 3.360900121256,
+      3.582299979332, 3.733499938459, 3.807899997628, 3.881700075939, 3.954999937558,
+      4.0},
+    { // C2
+      -0.999999993529, -0.641099986909, -0.379799981428, -0.243700001436, -0.118699997287,
+      0.073100042161, 0.177699935663, 0.32270004569, 0.524599971267, 0.758799993564,
+      1.038999957821, 1.32489992972, 1.835299910833, 1.988900009651, 2.066799937361,
+      2.141700122459, 2.28929994953, 2.361199903842, 2.431800082839, 2.668300083763,
+      2.782399986099, 2.898600107396, 3.120299878697, 3.313800022675, 3.455399924176,
+      3.584100021504, 3.731799983892, 3.848299933474, 3.940100038723, 3.976599949064,
+      4.0},
+    { // C2-
+      -0.999999993529, -0.646599981462, -0.38999999459, -0.260699995572, -0.141499983639,
+      0.058599929497, 0.174699940848, 0.310299921211, 0.425999947878, 0.553899952637,
+      0.721100033889, 0.895099981695, 1.195400039464, 1.464700029327, 1.775999970693,
+      2.102699907919, 2.343499919663, 2.547699957449, 2.710900053613, 2.955600044242,
+      3.121799916088, 3.299600180459, 3.42240002754, 3.539899959774, 3.651900050636,
+      3.753200063022, 3.826700005825, 3.895699998977, 3.960500032946, 3.984899911457,
+      4.0},
+    { // CN
+      -0.999999993529, -0.634899997994, -0.368900014961, -0.234400007277, -0.110400017216,
+      -0.010199997823, 0.096500013917, 0.212500027912, 0.347500041696, 0.460800038277,
+      0.586600034178, 0.748799991312, 0.917799942272, 1.222400041473, 1.512099970292,
+      1.816699942154, 2.171700062029, 2.515399988212, 2.651500090913, 2.785999982288,
+      3.005000111574, 3.192999969602, 3.342800094581, 3.533300119361, 3.618899924457,
+      3.702099855522, 3.905599956847, 3.962699972274, 4.0},
+    { // CN-
+      -0.999999993529, -0.634899997994, -0.368900014961, -0.2340000074, -0.109800018053,
+      -0.00999999839, 0.096300014197, 0.212300027831, 0.34880004343, 0.463300031077,
+      0.582300046379, 0.753799989938, 0.907999968524, 1.213400026211, 1.503899984038,
+      1.813799942518, 2.165600070495, 2.511599997941, 2.647500092285, 2.781499987052,
+      3.004200093722, 3.193399959808, 3.34340007966, 3.531800155631, 3.616699974148,
+      3.699299826562, 3.90639993637, 3.962899966758, 4.0},
+    { // NH
+      -0.999999993529, 0.209400027812, 0.636099987054, 0.7502999874, 0.863200019064,
+      1.101399906583, 1.242799998652, 1.406300082852, 1.588599913306, 1.819599941789,
+      2.123499954682, 2.476200015855, 2.651300090867, 2.829899942405, 2.990500009582,
+      3.179199853002, 3.425899932187, 3.596799983999, 3.773000058384, 3.841100116568,
+      3.903999997802, 3.963099961242, 3.985699890337, 4.0},
+    { // N2
+      -0.999999993529, -0.62740000711, -0.355500029093, -0.212899990105, -0.083999978765,
+      0.117200005025, 0.235600010631, 0.372299984859, 0.534399962113, 0.755199990953,
+      1.067699940593, 1.374399976828, 1.693000063852, 2.013199998928, 2.385000112558,
+      2.657300092245, 2.846099898354, 3.048700154719, 3.190600028365, 3.327999962751,
+      3.794200066108, 3.924899965861, 3.970499784444, 4.0},
+    { // OH
+      -0.999999993529, 0.243500002438, 0.709000048386, 0.816000020033, 0.92239993758,
+      1.146000105069, 1.27819996505, 1.421700077174, 1.606999894676, 1.835299910833,
+      2.139700127692, 2.483900004198, 2.691000044681, 2.875800016063, 3.043500051181,
+      3.215999875797, 3.431499854524, 3.616199985441, 3.782600142144, 3.909599854461,
+      3.964999908843, 3.986199877136, 4.0},
+    { // OH-
+      -0.999999993529, 0.223000028156, 0.697700045307, 0.806999949139, 0.917699942546,
+      1.149900097428, 1.270999979838, 1.40200009081, 1.554699943369, 1.742500012992,
+      1.977100016998, 2.215100031905, 2.576599933971, 2.857399898411, 2.991600008473,
+      3.197599856972, 3.363100067584, 3.558299981945, 3.74469986929, 3.903100020839,
+      3.962099988821, 4.0},
+    { // BO
+      -0.999999993529, -0.644399983641, -0.385699988646, -0.258099996706, -0.12990000137,
+      0.0500999544, 0.181399948365, 0.325500047784, 0.526599970651, 0.675199946549,
+      0.817600038866, 1.120799900509, 1.397500093832, 1.712900047246, 2.034199972127,
+      2.328799927826, 2.562199940748, 2.755499995921, 2.961900036039, 3.122899943507,
+      3.279300200142, 3.565800073537, 3.677399874723, 3.783700117752, 3.917400034356,
+      3.967499839897, 3.986999856016, 4.0},
+    { // CO
+      -0.999999993529, -0.632600002502, -0.364600019334, -0.22450001164, -0.097100000602,
+      0.10170001093, 0.21890003049, 0.357400033132, 0.528599970035, 0.76169999242,
+      1.076199926571, 1.381600097805, 1.692000066444, 2.001400000415, 2.360199905649,
+      2.627600048384, 2.818099938077, 3.018200037442, 3.15959984162, 3.30290011735,
+      3.57819996977, 3.810899966839, 3.872799956303, 3.930999846621, 3.972799846514,
+      3.988499816415, 4.0},
+    { // NO+
+      -0.999999993529, -0.627500007129, -0.355700028867, -0.213199991119, -0.084299978459,
+      0.116800005873, 0.23520001142, 0.371899985211, 0.534299962283, 0.755599991243,
+      1.068799938899, 1.37600001172, 1.695400057631, 2.016199995143, 2.388700102186,
+      2.66160009111, 2.85019989775, 3.0518001359, 3.193599954911, 3.330299922252,
+      3.79820014997, 3.926799913398, 3.971199803335, 3.988099826975, 4.0},
+    { // NO
+      -0.999999993529, -0.654599970871, -0.404399994113, -0.278299959398, -0.152499987861,
+      0.023999994474, 0.161199974196, 0.286499972876, 0.456300041849, 0.584600039853,
+      0.805999949049, 1.002999991176, 1.213400026211, 1.378800072782, 1.63990009006,
+      1.764899974394, 1.942200044609, 2.15960008809, 2.290399947338, 2.422600091227,
+      2.561999940497, 2.68500005184, 2.986300011188, 3.212199968587, 3.554700075022,
+      3.749399973836, 3.905899949168, 3.963199958484, 3.985699890337, 4.0},
+    { // O2
+      -0.999999993529, -0.673499974515, -0.441399995599, -0.324799985013, -0.206899982021,
+      -0.042800021354, 0.096600013777, 0.219200030611, 0.365100007495, 0.541799954931,
+      0.739900021743, 0.945600031954, 1.202600029941, 1.470500031909, 1.780299972159,
+      2.096799919076, 2.309599942625, 2.511899997173, 2.662800089794, 2.90380010124,
+      3.061499971042, 3.247299940725, 3.45950002332, 3.632700046534, 3.742399818129,
+      3.82150013046, 3.899900097834, 3.96020004122, 3.984799914097, 4.0},
+    { // HF
+      -0.999999993529, 0.270699970872, 0.758099993056, 0.862600019641, 0.967000028531,
+      1.185900048513, 1.312899948348, 1.447100043595, 1.635400099653, 1.864199897812,
+      2.169300058961, 2.511599997941, 2.727500009, 2.918100078781, 3.083100005158,
+      3.254000089478, 3.452099844378, 3.634499996198, 3.788900002446, 3.913999946997,
+      3.966399870233, 4.0},
+    { // NaH
+      -0.999999993529, -0.491600012464, -0.119499995366, 0.070100042786, 0.239200003531,
+      0.373099984156, 0.515999974697, 0.655199954116, 0.957700048717, 1.097299915751,
+      1.25270001227, 1.453300038138, 1.666200074527, 1.909900075822, 2.167100065819,
+      2.316599935755, 2.455200031937, 2.676400067316, 2.82699994221, 2.99650000353,
+      3.179699840953, 3.3132000099, 3.449399808825, 3.535900056494, 3.617899947044,
+      3.75800017678, 3.88519998691, 3.954999937558, 4.0},
+    { // MgH
+      -0.999999993529, -0.465200007095, -0.073699988148, 0.127800004931, 0.304699941696,
+      0.444300051767, 0.593800025302, 0.743600009207, 0.977800001749, 1.097799914745,
+      1.23090001328, 1.465000029526, 1.681700078478, 1.94300004653, 2.224000012063,
+      2.393000101289, 2.54779995745, 2.778699987487, 2.933700064103, 3.086100063422,
+      3.248599970312, 3.400000091874, 3.563000008101, 3.691100047413, 3.869799897759,
+      3.947799875123, 4.0},
+    { // MgO
+      -0.999999993529, -0.853800028128, -0.689500012187, -0.530399953027, -0.436900003795,
+      -0.3378999623, -0.214399995176, -0.09649999824, 0.039199965031, 0.179499932552,
+      0.506099988462, 0.964800036993, 1.463900028798, 1.810299942958, 2.080499933417,
+      2.200800041863, 2.323299930846, 2.48020000865, 2.612499896732, 2.726200012442,
+      2.845399898465, 2.947300048054, 3.014700116707, 3.081199968257, 3.166399987045,
+      3.263000147269, 3.373999981339, 3.484499905054, 3.580599939503, 3.67509993207,
+      3.832499981182, 3.931199850937, 4.0},
+    { // AlH
+      -0.999999993529, -0.451099987798, -0.049300015167, 0.158499976883, 0.339700032276,
+      0.481900014868, 0.637399983365, 0.784099972212, 1.02999998956, 1.153100097909,
+      1.288499948878, 1.531899985759, 1.76169997808, 2.042499967572, 2.333099925531,
+      2.476800014755, 2.610999901243, 2.829799942398, 2.975900013946, 3.186599971883,
+      3.345300032409, 3.455699931431, 3.561399970709, 3.682499876682, 3.788800004663,
+      3.889799869901, 3.956399968127, 4.0},
+    { // AlO
+      -0.999999993529, -0.696999997813, -0.602800014125, -0.514599984808, -0.322399990965,
+      -0.19949998548, -0.075899986296, 0.031899976827, 0.145199977027, 0.4119999454,
+      0.744600005766, 1.097899914543, 1.449400043923, 1.948700060217, 2.115099882434,
+      2.27109999042, 2.418000095986, 2.559699938576, 2.777399986334, 3.015000109913,
+      3.134899988137, 3.323300075511, 3.463199955186, 3.580999948875, 3.69359998008,
+      3.890599878936, 3.95589995721, 4.0},
+    { // AlF
+      -0.999999993529, -0.857900009158, -0.70450001925, -0.561299999903, -0.420000008373,
+      -0.326999979556, -0.239200005811, 0.031099978119, 0.19180004923, 0.353200039885,
+      0.552499957307, 0.755699991316, 1.170000067979, 1.899100085198, 2.171700062029,
+      2.293999953294, 2.406800108062, 2.636900099285, 2.855499898237, 3.190200038159,
+      3.392699939082, 3.514800104757, 3.629900119814, 3.724499908038, 3.808399985598,
+      3.926299927204, 3.970999797938, 3.987999829615, 4.0},
+    { // Al2
+      -0.999999993529, -0.955399984673, -0.880300009494, -0.804700011235, -0.720400013961,
+      -0.616400010099, -0.49090001326, -0.339799959939, -0.057700009671, 0.2345000128,
+      0.697600045649, 1.211700020173, 1.535099982089, 1.79839994686, 1.99540000464,
+      2.163400077354, 2.321399931889, 2.498599983815, 2.662600090014, 2.978700013343,
+      3.17849986987, 3.365600006593, 3.468199829835, 3.565600068863, 3.700099809986,
+      3.81189998877, 3.92749989407, 3.971399808732, 4.0},
+    { // SiH
+      -0.999999993529, -0.448699991338, -0.045100019165, 0.192000049054, 0.383999979702,
+      0.48210001492, 0.567000019182, 0.779499985725, 0.943000035377, 1.061799949678,
+      1.192600041881, 1.435100051986, 1.668100071129, 1.9326000536, 2.254499992232,
+      2.425900089072, 2.592999917273, 2.782299986205, 3.017100062354, 3.164499940783,
+      3.302500127242, 3.540299964532, 3.725399928322, 3.795000082881, 3.868899919347,
+      4.0},
+    { // SiH-
+      -0.999999993529, -0.434700009031, -0.020799970174, 0.206400032349, 0.393499983945,
+      0.491300015441, 0.576800054031, 0.778199985295, 0.92969994166, 1.125500013516,
+      1.333499922406, 1.587199913864, 1.882000128973, 2.188600064019, 2.459500026815,
+      2.679300060708, 3.012700162001, 3.146099997385, 3.293500049186, 3.517900028258,
+      3.774500088687, 3.911299877624, 3.965399897812, 4.0},
+    { // SiC
+      -0.999999993529, -0.845000047468, -0.678799995046, -0.52819995744, -0.374599998628,
+      -0.279399957553, -0.189999978423, -0.036400005261, 0.083000035411, 0.25150000207,
+      0.412799944721, 0.789499954197, 1.180000054827, 1.552099946007, 1.915700075706,
+      2.178800083958, 2.404400107935, 2.583399924025, 2.753299992426, 2.904100100796,
+      3.065800082247, 3.276300128017, 3.403000013249, 3.535600063748, 3.804100089059,
+      3.919200080604, 4.0},
+    { // SiN
+      -0.999999993529, -0.823899978694, -0.653299972913, -0.555099995812, -0.461299975749,
+      -0.263799988156, -0.137399989279, -0.006999998873, 0.195800045716, 0.438900046228,
+      0.741200017466, 1.061199950602, 1.499199992544, 1.933700051478, 2.243200013369,
+      2.380400125455, 2.505399992678, 2.676200067772, 2.823699941988, 3.196699879008,
+      3.305800045633, 3.407499895313, 3.493699843039, 3.578799954995, 3.75690015071,
+      3.831699963757, 3.911199875055, 3.964699917117, 3.986199877136, 4.0},
+    { // SiO
+      -0.999999993529, -0.820599982167, -0.646799981264, -0.554299995328, -0.466600018348,
+      -0.277899960069, -0.161500020826, -0.052100013184, 0.092200019938, 0.2345000128,
+      0.396599985562, 0.568100032837, 0.97869999999, 1.41480007808, 1.865799894008,
+      2.270699990554, 2.393800102022, 2.511699997685, 2.801999946449, 2.970600015087,
+      3.134200007045, 3.530600184647, 3.673499971964, 3.739799770088, 3.805500055374,
+      3.868299933739, 3.924399979667, 3.969999770951, 3.987799834895, 4.0},
+    { // SiF
+      -0.999999993529, -0.852100035993, -0.692500007476, -0.544199968204, -0.394999980764,
+      -0.299200023448, -0.2090999808, -0.058500009169, 0.058399930083, 0.222700028433,
+      0.382799979219, 0.76369999005, 1.159900099393, 1.513299969705, 1.867999888777,
+      2.147200101857, 2.265699986184, 2.381900121249, 2.597299911552, 2.803699941353,
+      3.02310005678, 3.274800091954, 3.427699883149, 3.574200068268, 3.689300058339,
+      3.795400091267, 3.920000101159, 3.968599809561, 3.987399845456, 4.0},
+    { // Si2
+      -0.999999993529, -0.952599989197, -0.858900004531, -0.769699971523, -0.677999991947,
+      -0.560799999468, -0.434700009031, -0.312300001113, -0.130999999799, 0.06519998645,
+      0.456000041952, 0.857700022592, 1.265499985173, 1.624599991775, 1.895800097534,
+      2.010000002965, 2.133000102356, 2.24620000843, 2.356599909246, 2.510500000757,
+      2.665900086395, 2.902100103755, 3.03400010693, 3.164599943217, 3.351399947403,
+      3.516900052935, 3.641399877969, 3.751700027472, 3.828199969872, 3.896200010746,
+      3.959600038001, 4.0},
+    { // HS
+      -0.999999993529, -0.397699973298, 0.043299960753, 0.282899972513, 0.47670001352,
+      0.575900054347, 0.664599955114, 0.874200009715, 1.025799983246, 1.222400041473,
+      1.435600051026, 1.697400052448, 1.979400008374, 2.324199930352, 2.536599967754,
+      2.724500016942, 2.903900101092, 3.102799982484, 3.23789982847, 3.368299940722,
+      3.560599952013, 3.668400026569, 3.75930020759, 3.829999926729, 3.893399944841,
+      3.958600016166, 4.0},
+    { // HS-
+      -0.999999993529, -0.397499973851, 0.043499960572, 0.282999972523, 0.47670001352,
+      0.575900054347, 0.664599955114, 0.874200009715, 1.025599982946, 1.221000046243,
+      1.434300053521, 1.695700056854, 1.987200008977, 2.321399931889, 2.538699961332,
+      2.730200002646, 2.90970009251, 3.107800099601, 3.238099823338, 3.365999996834,
+      3.557600000043, 3.754000081981, 3.821200137651, 3.890099867167, 3.95729998778,
+      4.0},
+    { // CS
+      -0.999999993529, -0.594800033588, -0.421000009558, -0.233300007614, -0.132499997333,
+      -0.036600006303, 0.099100010276, 0.21910003057, 0.387499981112, 0.541599954669,
+      0.884699991415, 1.240499991575, 1.705300047772, 2.046399964714, 2.301699959574,
+      2.421000092272, 2.534799973259, 2.813499929213, 2.985600011396, 3.152800018525,
+      3.530000199155, 3.671400024324, 3.737499831557, 3.805100064998, 3.922600029368,
+      3.96949978474, 3.987599840176, 4.0},
+    { // NS
+      -0.999999993529, -0.616500009978, -0.448199991629, -0.26689998074, -0.179799988068,
+      -0.092799983671, 0.103800013296, 0.298599964622, 0.545399959636, 0.801099948606,
+      1.087099927455, 1.404000087109, 1.619599890315, 1.808299942816, 1.949700062618,
+      2.089199924524, 2.311599940309, 2.501299984336, 2.816199934416, 2.955600044242,
+      3.106100059781, 3.478799997437, 3.611100100634, 3.739999764743, 3.826100020206,
+      3.906199941489, 3.962799969516, 3.985599892977, 4.0},
+    { // SO
+      -0.999999993529, -0.815399998091, -0.623800006435, -0.467700027189, -0.298400022363,
+      -0.211699986048, -0.12629999875, 0.105400015099, 0.237300007278, 0.377599980201,
+      0.665799956527, 0.951100029384, 1.333199923478, 1.733600021145, 2.090599923298,
+      2.362599901313, 2.531199984269, 2.669100082886, 2.799499953725, 2.93460006165,
+      3.126300028258, 3.264300115565, 3.512000173853, 3.738399807504, 3.821100140048,
+      3.906799926131, 3.962799969516, 3.985699890337, 4.0},
+    { // MgS
+      -0.999999993529, -0.809500015589, -0.662299962062, -0.50909999245, -0.297900021685,
+      -0.013199989312, 0.328700050178, 0.597200025992, 0.859300022279, 1.382500097161,
+      1.944300049651, 2.160700085771, 2.388800101905, 2.567799947764, 2.750599988136,
+      3.123099948492, 3.323800063515, 3.511500186192, 3.793100043046, 3.913899944428,
+      3.966599864718, 4.0},
+    { // AlS
+      -0.999999993529, -0.854000027202, -0.649199978887, -0.495700007805, -0.285099984301,
+      0.00330000365, 0.355400036348, 0.630700002376, 0.900499986763, 1.430000061774,
+      1.995300004741, 2.214500034622, 2.42650008868, 2.635400100178, 2.849399897827,
+      3.141799893763, 3.317600103583, 3.492399812699, 3.641099870346, 3.803100113119,
+      3.919300083174, 3.968699806803, 4.0},
+    { // SiS
+      -0.999999993529, -0.823499979115, -0.722800012565, -0.624300006529, -0.539799950497,
+      -0.463899996646, -0.264999985285, -0.117899999208, 0.030599978927, 0.212700027992,
+      0.399099986866, 0.678099938227, 0.951900031727, 1.501299989459, 2.035999971282,
+      2.242200015015, 2.464600026679, 2.68720004864, 2.930900071734, 3.225399914778,
+      3.47869999502, 3.589700152706, 3.69299999624, 3.774100080606, 3.851299921779,
+      3.942499987731, 3.977599976051, 3.989799782095, 4.0},
+    { // S2
+      -0.999999993529, -0.826699975747, -0.72690001018, -0.630400006814, -0.54579997497,
+      -0.470900044023, -0.26309998983, -0.120999994893, 0.026599988157, 0.385599980347,
+      0.657699951815, 0.921899937301, 1.44770004368, 2.050699960392, 2.264999985434,
+      2.511399998453, 2.625399997955, 2.736800011348, 3.064100038282, 3.287500034642,
+      3.476199934585, 3.571500134753, 3.668200022487, 3.753900079611, 3.82150013046,
+      3.929699833323, 3.972399835719, 3.988399819055, 4.0},
+    { // HCl
+      -0.999999993529, -0.375899994328, 0.080900039129, 0.324200046812, 0.519999972683,
+      0.619800019211, 0.709400048872, 0.923699938307, 1.067899940285, 1.236899997954,
+      1.452800039027, 1.715700044973, 2.005000001483, 2.338699922576, 2.574199939989,
+      2.776599985625, 2.95270004643, 3.129200100545, 3.255100113486, 3.383400029028,
+      3.586800084762, 3.770200001819, 3.905099969646, 3.962999964, 3.985599892977,
+      4.0},
+    { // LiCl
+      -0.999999993529, -0.815999996096, -0.629400007485, -0.478000030989, -0.30920000414,
+      -0.233200007644, -0.158200015132, 0.123900002012, 0.27929997212, 0.436400020337,
+      0.808799949302, 1.182600052045, 1.861999903043, 2.104099903263, 2.319299933295,
+      2.539299959497, 2.744900001658, 3.086100063422, 3.3132000099, 3.477799973263,
+      3.679099832337, 3.795000082881, 3.907399910774, 3.964099933664, 4.0},
+    { // NaCl
+      -0.999999993529, -0.954899985481, -0.87760000427, -0.799600007213, -0.711500047454,
+      -0.603000014229, -0.468400032815, -0.33929996056, -0.062100004665, 0.243000002369,
+      0.721200033916, 1.250400019543, 1.54629995862, 1.804599942427, 2.016199995143,
+      2.155900089353, 2.299299962063, 2.464300026649, 2.617799880793, 3.024800089739,
+      3.228399990697, 3.404599971317, 3.519699983839, 3.644999969448, 3.749999987182,
+      3.885499979279, 3.953599906988, 3.982399977458, 4.0},
+    { // AlCl
+      -0.999999993529, -0.955499984511, -0.869199985077, -0.778899969247, -0.684700005875,
+      -0.543499965244, -0.435500007127, -0.312900000786, -0.171000002636, -0.020499970118,
+      0.305799936659, 0.569500050216, 0.828500045474, 1.335599914899, 1.913900075723,
+      2.13170009744, 2.378300086008, 2.554299949098, 2.721000026207, 3.001700037935,
+      3.216299868471, 3.418500053455, 3.601799941653, 3.716299891262, 3.843900045364,
+      3.936599967473, 3.975299913981, 4.0},
+    { // CaH
+      -0.999999993529, -0.512499987824, -0.155700003171, 0.024599993016, 0.18750002103,
+      0.317000005796, 0.456000041952, 0.585800036448, 0.932099962302, 1.093799922793,
+      1.264799985684, 1.478000018068, 1.706000048044, 1.973700029746, 2.245700009253,
+      2.389600099662, 2.523199980116, 2.715700040553, 2.866199895123, 3.084100024579,
+      3.277800164079, 3.38779993139, 3.489399772872, 3.610700109669, 3.699599818482,
+      3.777400147272, 3.856200040645, 3.944899936738, 4.0},
+    { // CaF
+      -0.999999993529, -0.903199970838, -0.808700014864, -0.592400043245, -0.512299988111,
+      -0.434100010459, -0.251999994973, -0.111400014815, 0.035099971656, 0.207800030232,
+      0.399299986971, 0.654899954392, 0.915899947482, 1.436400049491, 1.980300006243,
+      2.194800050834, 2.412800103945, 2.595099914479, 2.772399981901, 3.224999904655,
+      3.422200032989, 3.510800203466, 3.595900007258, 3.833199996429, 3.93259988115,
+      3.973599868103, 4.0},
+    { // CaCl
+      -0.999999993529, -0.984000009244, -0.957999980472, -0.891499969784, -0.81829998845,
+      -0.741500023085, -0.531099952839, -0.338099962051, -0.145499979997, 0.0557999377,
+      0.390299982276, 0.753799989938, 1.164500085269, 1.517099967847, 1.805399942511,
+      2.010700002082, 2.182400081066, 2.353099912577, 2.498599983815, 2.643400095102,
+      2.892900109572, 3.159699839019, 3.402800018491, 3.526000110067, 3.63539997103,
+      3.746799916002, 3.838700116225, 3.936299960999, 3.975299913981, 4.0},
+    { // ScO
+      -0.999999993529, -0.864699992103, -0.717600023585, -0.593900037209, -0.392199988506,
+      -0.271399970975, -0.13759998895, 0.070400042724, 0.322000045166, 0.662599952759,
+      1.025299982495, 1.456900031734, 1.927500062877, 2.237900017994, 2.371999935668,
+      2.503099987998, 2.7054000513, 2.917000080585, 3.234699910583, 3.359500131828,
+      3.498599957399, 3.61689996963, 3.792600032564, 3.915799993246, 3.967299845413,
+      3.986899858656, 4.0},
+    { // TiO
+      -0.999999993529, -0.747100010471, -0.574600023221, -0.400899972496, -0.282599970695,
+      -0.159800022788, -0.002699999565, 0.189600046046, 0.455000042295, 0.737200025718,
+      0.997200000451, 1.24069999219, 1.436900048532, 1.684700076002, 1.80899994289,
+      1.92490006731, 2.217400021492, 2.359699906296, 2.499999981691, 2.691900044784,
+      2.910800090754, 3.133300031354, 3.358900118167, 3.515900077612, 3.754000081981,
+      3.898800071943, 3.960700027431, 3.984899911457, 4.0},
+    { // TiS
+      -0.999999993529, -0.962699988814, -0.901499970617, -0.7538000017, -0.626000006848,
+      -0.459699966058, -0.235500006941, 0.029599980869, 0.290699972528, 0.56900004401,
+      0.874600009447, 1.152200097713, 1.324999929822, 1.581699916054, 1.780199972154,
+      2.114299882624, 2.258499983395, 2.418100095833, 2.61139990004, 2.815299932682,
+      3.128300078111, 3.36200009442, 3.548800167838, 3.753000058282, 3.828499962682,
+      3.895900003684, 3.959600038001, 4.0},
+    { // VO
+      -0.999999993529, -0.859600001293, -0.707600038455, -0.564800002948, -0.423600012637,
+      -0.334999965903, -0.245999998869, -0.103600014237, 0.049099955507, 0.220200030748,
+      0.396899985719, 0.595800025708, 0.799299948788, 1.2161000358, 1.991100008977,
+      2.255299990465, 2.374299990554, 2.490799995645, 2.682300055768, 2.880300105369,
+      3.04700012087, 3.233999928545, 3.367799952921, 3.506400139279, 3.655499963731,
+      3.789299993576, 3.917700042064, 3.967899828866, 4.0},
+    { // CrH
+      -0.999999993529, -0.455599976423, -0.05700001011, 0.149199973352, 0.329500050777,
+      0.469900012068, 0.626000010311, 0.763799989932, 1.04189995437, 1.174700061798,
+      1.320199924932, 1.565999945509, 1.794499958848, 2.079999933928, 2.361399903481,
+      2.499299982753, 2.62880007589, 2.961200037838, 3.203299872162, 3.363900048067,
+      3.468299827328, 3.597999952987, 3.697199883122, 3.804000091465, 3.912599911026,
+      3.965699889538, 4.0},
+    { // CrO
+      -0.999999993529, -0.86799998695, -0.722400012798, -0.577400032807, -0.435000008317,
+      -0.338499961554, -0.248599995967, -0.094599990759, 0.026999987186, 0.198000043784,
+      0.361000024744, 0.556199944964, 0.759799994289, 1.172100065217, 1.533299984153,
+      1.942200044609, 2.207000050713, 2.324699930077, 2.434300077901, 2.662000090671,
+      2.877100043654, 3.380800086723, 3.484399907751, 3.588600126934, 3.766500077019,
+      3.833099994251, 3.899300083712, 3.961799997094, 4.0},
+    { // FeH
+      -0.999999993529, -0.45139998704, -0.049800014691, 0.163599967317, 0.349000043697,
+      0.491000015792, 0.656099953288, 0.782699976883, 1.05629995328, 1.195500039378,
+      1.363099883249, 1.491199996295, 1.62069990555, 1.873199963187, 1.990700009381,
+      2.117799881795, 2.299299962063, 2.492499993066, 2.646800092766, 2.859899898641,
+      3.02720013627, 3.196199891251, 3.396000008152, 3.503500071671, 3.604700006665,
+      3.753200063022, 3.878900094298, 3.953599906988, 3.982399977458, 4.0},
+    { // FeO
+      -0.999999993529, -0.873599993511, -0.733400014527, -0.5901000525, -0.45029998982,
+      -0.358500025705, -0.266299982175, -0.132299997662, 0.019300004673, 0.187700023412,
+      0.362600018013, 0.563499975735, 0.769699982941, 1.194000040673, 1.967700046342,
+      2.240800017319, 2.363099900409, 2.482200006244, 2.679000061392, 2.881300105916,
+      3.138799882798, 3.324900037125, 3.443799950951, 3.567100103917, 3.765900090603,
+      3.906099944049, 3.963499950211, 4.0},
+    { // YO
+      -0.999999993529, -0.827499974905, -0.709400049607, -0.555099995812, -0.458399969345,
+      -0.360800023198, -0.217000003967, -0.082999979785, 0.085500030985, 0.263799985715,
+      0.473900012793, 0.691000068209, 1.137000118292, 1.948000058536, 2.229600015344,
+      2.36159990312, 2.480900007808, 2.706900052853, 2.923900075088, 3.253200072018,
+      3.487799816033, 3.638899873155, 3.806000043343, 3.92080007907, 3.969199793014,
+      3.987499842816, 4.0},
+    { // ZrO
+      -0.999999993529, -0.889399972135, -0.762599990938, -0.647099980967, -0.499100003942,
+      -0.347300014887, -0.178199990717, -0.033099988066, 0.120299999317, 0.295799967424,
+      0.483200015204, 0.935199992527, 1.403400088219, 1.861999903043, 2.100099916565,
+      2.218700015606, 2.335399924317, 2.443200057519, 2.5435999574, 2.685600050967,
+      2.757799999576, 2.824899942069, 3.029100173107, 3.142199903402, 3.26810002289,
+      3.403200008008, 3.533200121779, 3.746699913777, 3.827799979459, 3.900300092509,
+      3.961400008126, 3.985199903537, 4.0},
+    { // LaO
+      -0.999999993529, -0.900099970436, -0.797800008298, -0.572400015689, -0.49090001326,
+      -0.411600025447, -0.223400012244, -0.07509998697, 0.077800041181, 0.4467000485,
+      0.974400008393, 1.487400001413, 2.086799926977, 2.30969994241, 2.553199951241,
+      2.694800045115, 2.835299919577, 3.158999857229, 3.339400149246, 3.505100108972,
+      3.643799938955, 3.778500169494, 3.923100015562, 3.969699779224, 4.0}
+  };
+
+  static const double Q[NBARK][NTQ] = {
+    { // H2+
+      0.0, 3.13405372e-54, 2.79094653e-21, 1.23472801e-05, 0.00019113767,
+      0.00159015822, 0.0286372258, 0.0772825554, 0.155973372, 0.260173878,
+      0.392258869, 0.610976857, 0.858280722, 1.03103181, 1.19086826,
+      1.43487833, 1.72600071, 1.93618282, 2.144663, 2.51641126,
+      2.73576648, 3.00087246, 3.09979361, 3.16267828},
+    { // H2
+      -0.301029996, -0.301029996, -0.301029993, -0.301014761, -0.300830296,
+      -0.299579846, -0.273523089, -0.244514974, -0.200940921, -0.0966513596,
+      0.0466537413, 0.253454444, 0.490680129, 0.702774809, 0.815787556,
+      0.921650976, 1.3564614, 1.54038533, 1.74931286, 2.05314222,
+      2.19184017, 2.29424176},
+    { // H2-
+      0.0, -2.33773993e-28, 2.44687637e-09, 1.52343412e-05, 0.000199699327,
+      0.00145015002, 0.0275069068, 0.0565150214, 0.100089074, 0.204378636,
+      0.347683737, 0.55448444, 0.791710125, 1.00380481, 1.11681755,
+      1.22268097, 1.6574914, 1.84141532, 2.05015916, 2.35457108,
+      2.49367435, 2.59526213},
+    { // CH
+      0.602059991, 0.602059991, 0.602059991, 0.602060332, 0.602165251,
+      0.602823947, 0.605270405, 0.61674121, 0.639356745, 0.697275561,
+      0.807373382, 0.964829191, 1.17499627, 1.4409659, 1.73756867,
+      1.95686009, 2.15204558, 2.30321543, 2.54391678, 2.76626113,
+      3.14285914, 3.45064753, 3.61820766, 3.7947925, 3.97873352,
+      4.09454845},
+    { // CH-
+      0.602059991, 0.602059991, 0.602059991, 0.602060332, 0.602165251,
+      0.602823947, 0.605270405, 0.61674121, 0.639356745, 0.697275561,
+      0.807373382, 0.964829191, 1.17499627, 1.4409659, 1.73756867,
+      1.95686009, 2.15204558, 2.30321543, 2.54391678, 2.76626113,
+      3.14285914, 3.45064753, 3.61820766, 3.7947925, 3.97873352,
+      4.09454845},
+    { // C2
+      -0.301029996, -0.301029996, -0.301025114, -0.300889289, -0.299650416,
+      -0.285375904, -0.261880905, -0.202557475, -0.0758154506, 0.108741954,
+      0.356855782, 0.625923966, 1.12398377, 1.27632444, 1.35481857,
+      1.43279873, 1.60543007, 1.70561849, 1.81703868, 2.25976911,
+      2.48518357, 2.71100862, 3.13226319, 3.50279565, 3.78546485,
+      4.05600414, 4.38531038, 4.66021357, 4.88728164, 4.98046685,
+      5.04115178},
+    { // C2-
+      0.0, 3.06186733e-10, 6.05130452e-06, 0.000142892529, 0.00127320127,
+      0.0161646004, 0.0437243232, 0.101235802, 0.169606083, 0.259829165,
+      0.393016002, 0.543581825, 0.820473194, 1.07902941, 1.38398722,
+      1.70756358, 1.94727608, 2.15137195, 2.31733908, 2.58660581,
+      2.79634658, 3.05059595, 3.24376566, 3.44147908, 3.64408082,
+      3.84616767, 4.00941275, 4.17762667, 4.34796842, 4.41465569,
+      4.45648843},
+    { // CN
+      0.301029996, 0.301029996, 0.301033877, 0.301144985, 0.302197074,
+      0.305962496, 0.317414924, 0.345164806, 0.40261659, 0.469509483,
+      0.557986956, 0.68668693, 0.832311015, 1.11249062, 1.39061897,
+      1.68912236, 2.04085086, 2.38334891, 2.51982417, 2.65723188,
+      2.89757486, 3.13417863, 3.34956572, 3.67021044, 3.8366904,
+      4.0131085, 4.49624705, 4.64196948, 4.73930577},
+    { // CN-
+      0.301029996, 0.301029996, 0.301033877, 0.30114597, 0.302208363,
+      0.305974907, 0.31738219, 0.345099132, 0.403295361, 0.471137779,
+      0.554768737, 0.690845559, 0.823616989, 1.10397357, 1.38261707,
+      1.68619289, 2.03462898, 2.37920185, 2.51531135, 2.65190139,
+      2.8955403, 3.13301339, 3.34805469, 3.66359914, 3.82748956,
+      4.00110767, 4.48813539, 4.63059377, 4.72601398},
+    { // NH
+      0.477121255, 0.477121255, 0.477145558, 0.477422583, 0.479165128,
+      0.507336232, 0.55792787, 0.650927763, 0.783772883, 0.977128946,
+      1.2547617, 1.59370843, 1.7656127, 1.94310238, 2.10736564,
+      2.31634551, 2.63911181, 2.90779886, 3.23761517, 3.38408466,
+      3.53002527, 3.6760065, 3.73381804, 3.77089299},
+    { // N2
+      -0.301029996, -0.301029996, -0.301026992, -0.300916378, -0.299778665,
+      -0.284863174, -0.256557042, -0.198005654, -0.0978023806, 0.0716534937,
+      0.34569636, 0.634211414, 0.943681335, 1.25953307, 1.6291412,
+      1.90110477, 2.09323219, 2.31478263, 2.48830497, 2.67463022,
+      3.43476112, 3.67792111, 3.76647032, 3.82533357},
+    { // OH
+      0.602059991, 0.602059991, 0.602098506, 0.602435415, 0.60426223,
+      0.629944916, 0.674423842, 0.75106983, 0.880944146, 1.06853042,
+      1.3440944, 1.67338502, 1.87630902, 2.05975529, 2.23094861,
+      2.42043757, 2.69348987, 2.96997378, 3.25804067, 3.50868908,
+      3.62747034, 3.674362, 3.70528328},
+    { // OH-
+      0.0, -2.21986382e-18, 2.3834482e-05, 0.000269911385, 0.00181659858,
+      0.0268675942, 0.0657969495, 0.132082718, 0.233568782, 0.380619521,
+      0.584573697, 0.804775559, 1.15260926, 1.42868887, 1.56307779,
+      1.78072967, 1.97588845, 2.23815179, 2.52106025, 2.78255794,
+      2.88403464, 2.95023047},
+    { // BO
+      0.301029996, 0.301029996, 0.301035335, 0.301155585, 0.302363075,
+      0.314616549, 0.34411202, 0.405681433, 0.534224748, 0.649054853,
+      0.768804586, 1.04313679, 1.30653283, 1.61428844, 1.93190684,
+      2.22495195, 2.45809826, 2.65499084, 2.88182773, 3.08175651,
+      3.29999902, 3.75895058, 3.95664774, 4.15699252, 4.43657573,
+      4.55348068, 4.60125225, 4.63386799},
+    { // CO
+      0.0, 6.35186438e-11, 3.56703693e-06, 0.00012190744, 0.00128744332,
+      0.0160687623, 0.0438850285, 0.103016376, 0.209583107, 0.390424533,
+      0.668213646, 0.956436228, 1.25829541, 1.56354193, 1.92010809,
+      2.18702897, 2.38096809, 2.60027262, 2.77354484, 2.96855587,
+      3.39710219, 3.80567834, 3.92064615, 4.03186141, 4.11457737,
+      4.14653977, 4.17035582},
+    { // NO+
+      0.0, 3.76087167e-11, 3.02047723e-06, 0.000113817836, 0.00125296708,
+      0.0161639205, 0.0444670474, 0.103014787, 0.203423803, 0.373328797,
+      0.648085133, 0.937142685, 1.24743878, 1.56391262, 1.93423483,
+      2.20681137, 2.39879702, 2.61938382, 2.79288432, 2.97835839,
+      3.74262742, 3.98291456, 4.06981316, 4.10371377, 4.12793386},
+    { // NO
+      0.301029996, 0.301029996, 0.301036917, 0.301177682, 0.302478523,
+      0.314867816, 0.346604988, 0.39986727, 0.504021357, 0.599081584,
+      0.782950452, 0.95974205, 1.15675939, 1.31569313, 1.57798259,
+      1.71426733, 1.92357187, 2.19637389, 2.36116182, 2.52429714,
+      2.69139052, 2.835478, 3.19632754, 3.50287233, 4.05093712,
+      4.40255045, 4.70480156, 4.82105609, 4.86785552, 4.89800724},
+    { // O2
+      0.176091259, 0.176091264, 0.176106327, 0.176310225, 0.177817001,
+      0.189780621, 0.222047628, 0.274131733, 0.361644055, 0.492200725,
+      0.657711464, 0.84249575, 1.08423424, 1.34349628, 1.64818199,
+      1.96221445, 2.17421133, 2.37658113, 2.53035277, 2.79598012,
+      2.99460614, 3.26037482, 3.60856412, 3.93248172, 4.15843502,
+      4.33296246, 4.51855468, 4.67270253, 4.73899302, 4.78101842},
+    { // HF
+      0.0, 2.06736485e-18, 4.2845027e-05, 0.000389455273, 0.00220095798,
+      0.0267750796, 0.0680957645, 0.13726595, 0.266508755, 0.452871669,
+      0.727979959, 1.05485387, 1.26622692, 1.4553517, 1.62359433,
+      1.81061591, 2.05825562, 2.32532732, 2.58470703, 2.82129143,
+      2.92839792, 2.99954398},
+    { // NaH
+      0.0, 1.07495077e-25, 1.45302174e-08, 9.45191022e-06, 0.000429372634,
+      0.00358966602, 0.0184078097, 0.0564791277, 0.230140723, 0.337362777,
+      0.467655193, 0.647028778, 0.846150376, 1.08075157, 1.33296886,
+      1.48116201, 1.62042402, 1.85515095, 2.03393468, 2.2623089,
+      2.54524052, 2.77585914, 3.0349372, 3.21401608, 3.39445264,
+      3.72231063, 4.036613, 4.21589694, 4.33405348},
+    { // MgH
+      0.301029996, 0.301029996, 0.30103, 0.301035989, 0.301395752,
+      0.304481095, 0.320096833, 0.36306627, 0.493130449, 0.580442612,
+      0.68713887, 0.891188943, 1.0916622, 1.34187422, 1.61686699,
+      1.78417903, 1.93941452, 2.18408938, 2.36860969, 2.57370643,
+      2.82149418, 3.08064348, 3.39446338, 3.67278254, 4.11169175,
+      4.31927706, 4.46189498},
+    { // MgO
+      9.31473671e-08, 1.02718001e-05, 0.000415810007, 0.00488595179, 0.0142479044,
+      0.0348458015, 0.0806391302, 0.1445479, 0.236281647, 0.344726851,
+      0.628348804, 1.06253999, 1.55282649, 1.89705347, 2.16656558,
+      2.28706256, 2.41130808, 2.57718772, 2.72926951, 2.87606107,
+      3.05890474, 3.25273205, 3.4040979, 3.57051902, 3.80256568,
+      4.07948904, 4.40057461, 4.71304105, 4.97587011, 5.22646479,
+      5.63223394, 5.88454326, 6.06134597},
+    { // AlH
+      0.0, 2.88831324e-30, 1.99020487e-09, 4.48117923e-06, 0.000327338663,
+      0.00330104116, 0.0195672632, 0.0618939551, 0.199899233, 0.290552542,
+      0.400095984, 0.613776272, 0.827624272, 1.09780952, 1.38316996,
+      1.5257932, 1.66071207, 1.89265, 2.06530475, 2.35204779,
+      2.60157298, 2.79583974, 3.00512505, 3.28470793, 3.56855504,
+      3.86261803, 4.06266455, 4.19411233},
+    { // AlO
+      0.301030009, 0.30116915, 0.301857051, 0.304221066, 0.327673699,
+      0.367170655, 0.429260706, 0.498112323, 0.580863558, 0.802081822,
+      1.10659573, 1.44646594, 1.79208021, 2.28824364, 2.454243,
+      2.6102719, 2.7590136, 2.90820341, 3.16208836, 3.48961036,
+      3.67900216, 4.02378131, 4.32827336, 4.61416346, 4.90411271,
+      5.43263632, 5.61204793, 5.73420675},
+    { // AlF
+      1.74483121e-07, 1.44462965e-05, 0.000430600918, 0.00407289157, 0.0198292074,
+      0.043122119, 0.0770170855, 0.242729905, 0.368566934, 0.506309511,
+      0.686515527, 0.877569697, 1.27944587, 2.00236791, 2.27464103,
+      2.39798541, 2.51448956, 2.77256395, 3.05938791, 3.58570998,
+      3.94691234, 4.17771156, 4.40445976, 4.59940711, 4.78220532,
+      5.06460704, 5.18240702, 5.22902697, 5.2625744},
+    { // Al2
+      0.179670158, 0.182432412, 0.190707909, 0.205474472, 0.231547126,
+      0.278447805, 0.353558442, 0.462702879, 0.698391937, 0.966286095,
+      1.412968, 1.92116406, 2.24326695, 2.50628662, 2.70590678,
+      2.88571393, 3.07212395, 3.30844026, 3.55408219, 4.09054974,
+      4.4650108, 4.84732057, 5.07959112, 5.31788704, 5.66604167,
+      5.95736309, 6.24763709, 6.35337521, 6.4207427},
+    { // SiH
+      0.602059991, 0.602059991, 0.602059991, 0.602061504, 0.602259675,
+      0.603237863, 0.606134107, 0.638598108, 0.70552271, 0.776490435,
+      0.86963672, 1.06794448, 1.27700589, 1.52641003, 1.83925518,
+      2.00824875, 2.17436967, 2.36709686, 2.62923668, 2.81812898,
+      3.01629388, 3.40861989, 3.76407089, 3.91231862, 4.07912479,
+      4.39169203},
+    { // SiH-
+      0.477121255, 0.477121255, 0.477121255, 0.477123194, 0.477333669,
+      0.478352661, 0.481379914, 0.511493239, 0.570437597, 0.690733002,
+      0.851450787, 1.07208791, 1.3466684, 1.64281223, 1.90900757,
+      2.12726363, 2.47959421, 2.64041129, 2.83718613, 3.17490421,
+      3.60709851, 3.8520984, 3.95110043, 4.01495803},
+    { // SiC
+      0.778151285, 0.77815778, 0.778467483, 0.781761996, 0.798596997,
+      0.823043459, 0.858405837, 0.944698829, 1.02811457, 1.16125141,
+      1.29987978, 1.64778264, 2.02604387, 2.39333137, 2.75492156,
+      3.01736183, 3.24423782, 3.4323895, 3.62856479, 3.82361742,
+      4.05678668, 4.39811116, 4.62606874, 4.88369498, 5.45037003,
+      5.70186082, 5.87867313},
+    { // SiN
+      0.301029997, 0.301031111, 0.301134345, 0.301733362, 0.304054912,
+      0.328005971, 0.369237963, 0.436177163, 0.575840844, 0.775643376,
+      1.04966128, 1.35517538, 1.78479792, 2.21632898, 2.52508777,
+      2.66258177, 2.7896926, 2.97202518, 3.14488326, 3.67302012,
+      3.85410868, 4.03650011, 4.20394156, 4.38261344, 4.799752,
+      4.99079018, 5.20407391, 5.3542234, 5.41619589, 5.4564883},
+    { // SiO
+      1.15935286e-09, 1.33938779e-06, 0.000126393854, 0.000743488558, 0.00290560674,
+      0.0243602354, 0.0594055076, 0.110779562, 0.200921332, 0.306686718,
+      0.440208997, 0.591427391, 0.97674405, 1.40277234, 1.85006939,
+      2.25388381, 2.37716547, 2.49655385, 2.8128372, 3.02564589,
+      3.25831487, 3.91753401, 4.18174485, 4.30934515, 4.4412895,
+      4.57720906, 4.71343727, 4.84008948, 4.89437679, 4.93333326},
+    { // SiF
+      0.602060068, 0.602069321, 0.602416416, 0.605869535, 0.622428027,
+      0.647014636, 0.682727141, 0.7672426, 0.848606128, 0.977861592,
+      1.11494946, 1.46617004, 1.84987126, 2.19864861, 2.5513622,
+      2.8299896, 2.94888321, 3.06723538, 3.30054781, 3.5567514,
+      3.87390244, 4.2902062, 4.5656496, 4.84343243, 5.07161154,
+      5.29215094, 5.57045054, 5.68673426, 5.73305273, 5.7645293},
+    { // Si2
+      0.177458636, 0.178865469, 0.185174431, 0.198545289, 0.223211945,
+      0.273146682, 0.347202359, 0.433519931, 0.578235004, 0.7493086,
+      1.11438016, 1.50554676, 1.90916746, 2.26680374, 2.53758193,
+      2.65204641, 2.77718827, 2.89774189, 3.02638888, 3.23657948,
+      3.49314751, 3.94948361, 4.22234176, 4.49719404, 4.89329701,
+      5.24648401, 5.51563306, 5.76036308, 5.93652984, 6.09925287,
+      6.25655206, 6.35928555},
+    { // HS
+      0.602059991, 0.602059991, 0.602059991, 0.602061087, 0.60222846,
+      0.603107361, 0.605953101, 0.636819263, 0.696133372, 0.817316564,
+      0.982641975, 1.21128822, 1.47454069, 1.80848807, 2.01777092,
+      2.2047012, 2.38769014, 2.60748329, 2.77541049, 2.9559211,
+      3.25810072, 3.4476359, 3.62069846, 3.76519663, 3.9027539,
+      4.05155063, 4.14906525},
+    { // HS-
+      0.0, -1.34899922e-36, 3.93709229e-11, 1.09927521e-06, 0.000168468655,
+      0.00104736957, 0.00389310947, 0.0347592719, 0.0939728425, 0.214264126,
+      0.379504105, 0.607683588, 0.879920358, 1.20368334, 1.41778972,
+      1.60835517, 1.79171067, 2.01132623, 2.17361291, 2.35051027,
+      2.65098201, 3.00797567, 3.14403901, 3.29177936, 3.44309215,
+      3.54193175},
+    { // CS
+      8.01415913e-11, 0.000125352531, 0.0026400805, 0.0227204071, 0.0507156588,
+      0.0915700359, 0.170262726, 0.254662759, 0.388264184, 0.520852712,
+      0.836763216, 1.18006872, 1.63846469, 1.97781591, 2.23259816,
+      2.35215192, 2.46758164, 2.77151343, 2.98858962, 3.22685419,
+      3.85352237, 4.11486738, 4.24308129, 4.38147542, 4.65871624,
+      4.79162984, 4.84738875, 4.88712667},
+    { // NS
+      0.301029996, 0.301172594, 0.303692557, 0.322581368, 0.345142176,
+      0.379082782, 0.493012552, 0.639188168, 0.849961936, 1.08506602,
+      1.35878612, 1.66890741, 1.88226086, 2.07245906, 2.22204883,
+      2.38026463, 2.65395209, 2.89728065, 3.31506618, 3.51514373,
+      3.74664636, 4.38782094, 4.63550855, 4.88634033, 5.06052691,
+      5.23031067, 5.35741257, 5.41088207, 5.44544822},
+    { // SO
+      0.477121256, 0.477123031, 0.477340894, 0.480137842, 0.498062011,
+      0.52010298, 0.552859671, 0.689933685, 0.78899879, 0.904347382,
+      1.16137896, 1.43095125, 1.80321983, 2.19947231, 2.55501565,
+      2.82695242, 2.99868226, 3.14641649, 3.29756475, 3.46995391,
+      3.74525534, 3.96606749, 4.41402843, 4.88529406, 5.07083587,
+      5.27125272, 5.40819456, 5.46595567, 5.50262626},
+    { // MgS
+      0.000598134506, 0.00907415761, 0.0365871871, 0.0981887039, 0.231537358,
+      0.46034845, 0.770319579, 1.02667183, 1.28237401, 1.80021522,
+      2.36057384, 2.57919229, 2.82564576, 3.04551507, 3.30150673,
+      3.91398438, 4.28360091, 4.65025167, 5.252099, 5.54002256,
+      5.67140478, 5.75604548},
+    { // AlS
+      0.301454659, 0.305214286, 0.335969691, 0.396389544, 0.528118497,
+      0.759265575, 1.07863424, 1.3417868, 1.6052686, 2.12964137,
+      2.69355265, 2.91463076, 3.14123776, 3.39528116, 3.69825407,
+      4.17760919, 4.49492912, 4.82835625, 5.12676714, 5.47474098,
+      5.74624415, 5.86794302, 5.94686136},
+    { // SiS
+      0.00021420553, 0.00391454561, 0.0128772929, 0.0320719906, 0.0595748044,
+      0.0934759073, 0.216035157, 0.327577694, 0.451135985, 0.612583438,
+      0.78528124, 1.05224782, 1.31983481, 1.86419736, 2.39761336,
+      2.60460721, 2.83728407, 3.10015286, 3.44003486, 3.9201692,
+      4.37905751, 4.59051511, 4.79269326, 4.95619678, 5.11912288,
+      5.33102935, 5.42182905, 5.45491766, 5.48323443},
+    { // S2
+      0.176361725, 0.180474397, 0.190034476, 0.20967505, 0.237948954,
+      0.271981473, 0.401915722, 0.51063559, 0.633935507, 0.959759175,
+      1.21999166, 1.478014, 1.99867094, 2.60018154, 2.81589457,
+      3.0791276, 3.21416842, 3.3574471, 3.84701436, 4.23844127,
+      4.60712882, 4.80607484, 5.01657217, 5.21232351, 5.37577915,
+      5.66241901, 5.78589818, 5.83371531, 5.86889648},
+    { // HCl
+      0.0, -9.39717639e-38, 1.99035065e-11, 8.53344697e-07, 0.000149698465,
+      0.000963023997, 0.00368065922, 0.034899429, 0.0906397384, 0.191254224,
+      0.354426745, 0.581437356, 0.850206664, 1.172639, 1.40442517,
+      1.60575283, 1.78550706, 1.979303, 2.13259826, 2.30549897,
+      2.61726366, 2.939494, 3.20513208, 3.3277203, 3.37695322,
+      3.40870792},
+    { // LiCl
+      2.16536232e-09, 2.33132319e-06, 0.000237058651, 0.00298037541, 0.0206774719,
+      0.0392527497, 0.066046629, 0.232844563, 0.353164993, 0.486059227,
+      0.827021594, 1.1876403, 1.85966287, 2.10146401, 2.32179221,
+      2.56929294, 2.83813132, 3.37383665, 3.78337963, 4.1038378,
+      4.52933267, 4.79571343, 5.06447376, 5.20001497, 5.28461641},
+    { // NaCl
+      0.00250427115, 0.00462829204, 0.0115087415, 0.0246236786, 0.04941957,
+      0.0960404361, 0.175392489, 0.267381833, 0.495850195, 0.774074627,
+      1.23488361, 1.7580617, 2.05277407, 2.31073569, 2.52500945,
+      2.67353314, 2.83875314, 3.05124299, 3.27264555, 3.95687964,
+      4.34105239, 4.69454401, 4.93893384, 5.22013986, 5.46687083,
+      5.79042959, 5.94957798, 6.01528159, 6.05484882},
+    { // AlCl
+      0.00119123479, 0.00235137571, 0.00729605511, 0.0190276352, 0.0421168326,
+      0.101519442, 0.16495896, 0.250517093, 0.361768457, 0.489488683,
+      0.787179653, 1.03937933, 1.29222696, 1.79417533, 2.37100885,
+      2.59135219, 2.86074751, 3.08134538, 3.31763328, 3.77119541,
+      4.15567817, 4.54158469, 4.91132815, 5.15661093, 5.45451355,
+      5.69555004, 5.80314895, 5.8738564},
+    { // CaH
+      0.301029996, 0.301029996, 0.301030031, 0.301043253, 0.301512757,
+      0.30471766, 0.31910539, 0.353337475, 0.555077327, 0.683055894,
+      0.830237768, 1.02457287, 1.24059928, 1.50054454, 1.76870342,
+      1.91188452, 2.04676238, 2.25140468, 2.42873951, 2.72501888,
+      3.0314699, 3.22378877, 3.41490576, 3.66691881, 3.87529091,
+      4.07752631, 4.30038336, 4.5671398, 4.73726728},
+    { // CaF
+      0.301109593, 0.30158284, 0.303547765, 0.329377316, 0.353380889,
+      0.38621344, 0.49354726, 0.596828275, 0.716133904, 0.866954727,
+      1.04265325, 1.28566654, 1.53961233, 2.05418985, 2.59649086,
+      2.81299165, 3.04706177, 3.26851669, 3.5140219, 4.26495969,
+      4.63546593, 4.80969873, 4.98301026, 5.52540725, 5.79423027,
+      5.91292244, 5.99137474},
+    { // CaCl
+      0.317225685, 0.319939575, 0.325046695, 0.342413338, 0.369245119,
+      0.405946593, 0.541387435, 0.693704577, 0.860864587, 1.04546441,
+      1.36488232, 1.72105979, 2.12836928, 2.47981561, 2.76784689,
+      2.97547567, 3.15845391, 3.35962356, 3.55189708, 3.76338643,
+      4.16989951, 4.65052991, 5.11944652, 5.36833393, 5.60049286,
+      5.85812407, 6.09625539, 6.37881618, 6.49929916, 6.57733019},
+    { // ScO
+      0.30103052, 0.301056986, 0.301627859, 0.305031797, 0.334203517,
+      0.377626739, 0.449931611, 0.597298949, 0.80739917, 1.11987256,
+      1.46935032, 1.89462045, 2.36283033, 2.67285901, 2.80799548,
+      2.94367054, 3.17034766, 3.44419663, 3.93406625, 4.14877722,
+      4.40132745, 4.63083597, 5.02020859, 5.34623469, 5.49624505,
+      5.55520195, 5.59512884},
+    { // TiO
+      0.301030273, 0.301274188, 0.305080909, 0.32748361, 0.364940555,
+      0.42565536, 0.528510302, 0.678420299, 0.909962868, 1.17325017,
+      1.42401228, 1.66284843, 1.8593109, 2.12782453, 2.27879673,
+      2.43053847, 2.84076121, 3.0404199, 3.23317233, 3.49713296,
+      3.81649449, 4.17637054, 4.58483751, 4.89707857, 5.43634501,
+      5.82338312, 6.00381009, 6.07656843, 6.12255387},
+    { // TiS
+      0.304980694, 0.30737708, 0.31370564, 0.347284079, 0.402224084,
+      0.504749031, 0.677104022, 0.908244648, 1.15137493, 1.41943747,
+      1.71930442, 1.99431335, 2.16705258, 2.43665668, 2.67251655,
+      3.12995983, 3.33813508, 3.5727563, 3.8690532, 4.20282216,
+      4.7582888, 5.20124757, 5.5739064, 6.01744349, 6.19668319,
+      6.36512198, 6.53145274, 6.64006381},
+    { // VO
+      0.602060184, 0.602074849, 0.602487979, 0.60609377, 0.621735328,
+      0.643535218, 0.677266632, 0.754390207, 0.860229129, 0.996485993,
+      1.14955244, 1.33136365, 1.5239415, 1.92953879, 2.69886838,
+      2.96278406, 3.08255047, 3.2022137, 3.41209074, 3.65910644,
+      3.89613393, 4.1921985, 4.42126394, 4.67387073, 4.97070656,
+      5.27182752, 5.59908393, 5.73683051, 5.82740434},
+    { // CrH
+      0.77815125, 0.77815125, 0.778151253, 0.778156044, 0.778487647,
+      0.781435724, 0.797761458, 0.836643433, 0.994560101, 1.09477346,
+      1.21494844, 1.43375621, 1.64801058, 1.92388642, 2.20084288,
+      2.33800905, 2.46882124, 2.83885668, 3.17117774, 3.42900906,
+      3.61611897, 3.88231251, 4.12429163, 4.42814797, 4.77026411,
+      4.94189616, 5.05223749},
+    { // CrO
+      1.00000034, 1.00001797, 1.00043432, 1.00419164, 1.02043482,
+      1.04529017, 1.08103915, 1.16789264, 1.25313844, 1.3887257,
+      1.52922459, 1.70675083, 1.89878639, 2.29930282, 2.65631817,
+      3.06325362, 3.32764208, 3.44607647, 3.55857836, 3.81043444,
+      4.08723915, 4.90107455, 5.09233888, 5.29270782, 5.66135748,
+      5.81146307, 5.96784937, 6.12098023, 6.21634269},
+    { // FeH
+      0.301029996, 0.301029996, 0.301029997, 0.301033582, 0.30133659,
+      0.304170685, 0.321721618, 0.357441174, 0.510395873, 0.614816325,
+      0.753695444, 0.866500007, 0.985095998, 1.23353132, 1.36204999,
+      1.51362175, 1.75344115, 2.03700842, 2.28490539, 2.66677765,
+      3.00844316, 3.3961227, 3.90056344, 4.18562787, 4.4599995,
+      4.87124721, 5.22290637, 5.42957366, 5.50813201, 5.55573511},
+    { // FeO
+      1.00000055, 1.00002243, 1.00046241, 1.00429174, 1.0202945,
+      1.04353191, 1.07960964, 1.15315189, 1.25832716, 1.39234566,
+      1.54366558, 1.72716588, 1.92226897, 2.33524587, 3.10328428,
+      3.37599921, 3.49905897, 3.62149223, 3.8380541, 4.09238656,
+      4.47428992, 4.79318896, 5.01514143, 5.25898668, 5.68213308,
+      6.00605915, 6.14470591, 6.23435069},
+    { // YO
+      0.301048879, 0.301757571, 0.305340616, 0.324274311, 0.351192835,
+      0.392665019, 0.476704361, 0.572455822, 0.707994309, 0.863322447,
+      1.05626799, 1.26260268, 1.69801282, 2.50412822, 2.78570794,
+      2.91942675, 3.04421443, 3.30369838, 3.59519633, 4.11879209,
+      4.53879552, 4.82852457, 5.17994373, 5.45286438, 5.57723896,
+      5.62569685, 5.65923907},
+    { // ZrO
+      7.0418825e-06, 0.00010760627, 0.00116187693, 0.00595416748, 0.0274940009,
+      0.0804379883, 0.176971099, 0.281412128, 0.405246392, 0.557954523,
+      0.729493672, 1.16265753, 1.62413045, 2.08051793, 2.31817769,
+      2.43682377, 2.55477813, 2.66810315, 2.78388474, 2.98263945,
+      3.10600472, 3.23514548, 3.69286105, 3.96690647, 4.27444233,
+      4.60249299, 4.91756604, 5.45244762, 5.66883315, 5.87054537,
+      6.04664824, 6.11667945, 6.16061629},
+    { // LaO
+      0.30108214, 0.301447532, 0.303284517, 0.329731496, 0.354421364,
+      0.388119264, 0.500468249, 0.610755136, 0.73667117, 1.06969404,
+      1.5788208, 2.0864465, 2.68420724, 2.90840011, 3.16767321,
+      3.33604871, 3.52117506, 4.0174782, 4.33409559, 4.66090751,
+      4.97506049, 5.32135273, 5.73163338, 5.87007813, 5.96131674}
+  };
+
+  static const double TK[NBARK][NTK] = {
+    { // H2+
+      -0.999999993529, -0.99140000046, -0.98340001001, -0.956499982896, -0.888599975419,
+      -0.809400015499, -0.716600027498, -0.591400047269, -0.47740003209, -0.335499965282,
+      -0.209199980744, -0.017799976264, 0.173299943268, 0.377899979937, 0.584100041272,
+      0.981499998074, 1.075399927923, 1.163300089041, 1.375800007358, 1.531899985759,
+      1.729100022745, 1.87610003493, 2.028199977024, 2.239800018575, 2.470700025935,
+      2.685100051695, 2.899700106976, 3.057399996821, 3.298700161091, 3.414099937677,
+      3.522500032115, 3.662199900008, 3.77070001192, 3.911299877624, 3.965199903328,
+      4.0},
+    { // H2
+      -0.999999993529, -0.99140000046, -0.983500009882, -0.956699982573, -0.888999973777,
+      -0.809900015952, -0.71720002515, -0.592300043647, -0.47880002952, -0.337599962672,
+      -0.2120999874, -0.023099970609, 0.16489996359, 0.362300019275, 0.560599939736,
+      0.880100005528, 1.18580004862, 1.29299995164, 1.401400091921, 1.646600095219,
+      1.739500021561, 1.833999911366, 2.004400001305, 2.191400057447, 2.431400083629,
+      2.686200050094, 2.908900093694, 3.125400005824, 3.280900195092, 3.492599817367,
+      3.608200085128, 3.725099921561, 3.881200088658, 3.949899830504, 4.0},
+    { // H2-
+      -0.999999993529, -0.978400015269, -0.944199997999, -0.856800014247, -0.753000002171,
+      -0.636399995054, -0.462899988609, -0.294200016665, -0.119799994646, 0.066500001713,
+      0.284999972725, 0.512599976409, 1.003599989411, 1.171700065743, 1.335599914899,
+      1.470600031724, 1.669300068983, 1.810099942983, 1.969000044803, 2.120299887566,
+      2.285399965426, 2.496199987455, 2.718900031847, 2.924600074984, 3.128700088082,
+      3.29320004273, 3.502600050689, 3.614000035132, 3.727599977906, 3.882700050503,
+      3.950799845848, 4.0},
+    { // CH
+      -0.999999993529, -0.990900000863, -0.982000011796, -0.952599989197, -0.87860000696,
+      -0.790300012818, -0.688700011135, -0.558699997986, -0.436400004985, -0.307600007686,
+      -0.173599998332, -0.056200010612, 0.069300034588, 0.196100045453, 0.323700046438,
+      0.44000005762, 0.549799965386, 0.752999989358, 0.827900047001, 0.904099978008,
+      1.018699974015, 1.128600088053, 1.365399882457, 1.500499991127, 1.632900104982,
+      1.875900029982, 2.05109995943, 2.250400001291, 2.453500033961, 2.641500096407,
+      2.773099982521, 2.904500100204, 3.059099954601, 3.193799950014, 3.396300014431,
+      3.588700129277, 3.75770016967, 3.883900019978, 4.0},
+    { // CH-
+      -0.999999993529, -0.987600004651, -0.969400017531, -0.921800024215, -0.800100007062,
+      -0.642499985523, -0.469000037638, -0.298500022499, -0.120799994748, 0.070100042786,
+      0.263099987402, 0.495800010179, 0.682199963322, 0.834400035928, 0.995100000789,
+      1.081299921486, 1.166400079296, 1.395700093342, 1.52589997912, 1.664900076852,
+      1.956600058135, 2.247400006455, 2.549699957473, 2.789499978583, 2.968300019587,
+      3.252200050192, 3.4065999189, 3.583200000418, 3.684999943468, 3.813000012894,
+      3.919600090882, 3.968999798529, 4.0},
+    { // C2
+      -0.999999993529, -0.990600001105, -0.9809000132, -0.949999993397, -0.872099989476,
+      -0.781599976096, -0.669999960957, -0.547699983005, -0.417700013048, -0.273199967955,
+      -0.119899994406, 0.018100005497, 0.137399988246, 0.249800003312, 0.367999995295,
+      0.472400012403, 0.56980005394, 0.779599985758, 0.867800014641, 0.961500049686,
+      1.07089993553, 1.181900052794, 1.34049989999, 1.482800009472, 1.614199893579,
+      1.731700021012, 1.92090007413, 2.035399971564, 2.151600090822, 2.281999979285,
+      2.390400098907, 2.478900010907, 2.596099913148, 2.698000045481, 2.833099929055,
+      2.973000014571, 3.221999828736, 3.340800144318, 3.459200016066, 3.67509993207,
+      3.796800120618, 3.892699928365, 3.956999981229, 4.0},
+    { // C2-
+      -0.999999993529, -0.990300001346, -0.979700014521, -0.947299995539, -0.912999988981,
+      -0.865099991479, -0.770699970589, -0.653799972127, -0.522599970833, -0.386299989475,
+      -0.23930000578, -0.070599990758, 0.041199962653, 0.158699976983, 0.265799980894,
+      0.378599979322, 0.482500015023, 0.578600053398, 0.784299971545, 0.870200012391,
+      0.961500049686, 1.072799932318, 1.176300059693, 1.444000043153, 1.546499958053,
+      1.649700097742, 1.865499894721, 2.167700063949, 2.444300054382, 2.566499946135,
+      2.683600053877, 2.927900074497, 3.041800017332, 3.158799862433, 3.257400163686,
+      3.339900161718, 3.528200159065, 3.604700006665, 3.677299877217, 3.832499981182,
+      3.931999868201, 3.973399862706, 4.0},
+    { // CN
+      -0.999999993529, -0.990400001266, -0.980100014221, -0.948199994825, -0.867299988043,
+      -0.774099970032, -0.659099963805, -0.531399952758, -0.396399976892, -0.249199995297,
+      -0.089699972952, 0.046499957859, 0.168699952698, 0.284999972725, 0.400399985726,
+      0.588600028503, 0.762599991353, 0.856500022827, 0.955300041687, 1.070199936713,
+      1.177500058115, 1.447600043666, 1.554799943267, 1.662600080966, 1.877700074512,
+      2.245100010241, 2.560299938367, 2.761499999576, 3.014700116707, 3.271800019829,
+      3.433299895367, 3.555700049167, 3.632000066109, 3.705399930656, 3.841300111482,
+      3.936499965315, 3.975299913981, 4.0},
+    { // CN-
+      -0.999999993529, -0.990300001346, -0.980000014348, -0.947799995143, -0.913699993008,
+      -0.866299989605, -0.772899970229, -0.712400043932, -0.656199968359, -0.589500052342,
+      -0.523099969637, -0.455299977181, -0.382999984914, -0.310600002039, -0.235500006941,
+      -0.081099981723, 0.022399998361, 0.118600002059, 0.204600035071, 0.290599972628,
+      0.45160004346, 0.700000037445, 0.931399955477, 1.176100059956, 1.452500039561,
+      1.745300003357, 2.132700101222, 2.497399985635, 2.611799898837, 2.728500006353,
+      2.946800047977, 3.14359993714, 3.323600068314, 3.484399907751, 3.629600113141,
+      3.800200182895, 3.911199875055, 3.964899911601, 4.0},
+    { // NH
+      -0.999999993529, -0.991500000379, -0.983700009627, -0.957199981765, -0.890199969686,
+      -0.812200008729, -0.720800013728, -0.597600022321, -0.478000030989, -0.351700033383,
+      -0.223700012079, -0.119399995606, -0.009399998486, 0.21190002767, 0.427799950658,
+      0.615800018765, 0.731800033667, 0.848600024735, 1.021399976632, 1.161800093757,
+      1.285699952987, 1.428100065299, 1.6358000988, 1.856799907572, 2.07579993524,
+      2.540399957361, 2.718900031847, 2.888900110077, 3.175399944572, 3.428199869527,
+      3.596899981415, 3.745799893758, 3.880100116638, 4.0},
+    { // N2
+      -0.999999993529, -0.990300001346, -0.980000014348, -0.947899995063, -0.913899994159,
+      -0.866599989136, -0.77349997013, -0.656999967102, -0.523799967963, -0.38319998519,
+      -0.236000006788, -0.083899978867, 0.023999994474, 0.121300000066, 0.20710003129,
+      0.292799970426, 0.45230004322, 0.690900068551, 0.923099937971, 1.162100092813,
+      1.445700043395, 1.729500021922, 2.196100048306, 2.528399986098, 2.65950009275,
+      2.780599988005, 2.973200014527, 3.112500081155, 3.298000146027, 3.483199940123,
+      3.632200060516, 3.796600116425, 3.854600001832, 3.911799890471, 3.965099906085,
+      4.0},
+    { // OH
+      -0.999999993529, -0.990800000943, -0.981500012434, -0.951499990974, -0.875799999429,
+      -0.790100012938, -0.681400001535, -0.558299997745, -0.426200015717, -0.291600013138,
+      -0.154099995516, -0.043200020973, 0.072900042202, 0.305799936659, 0.529699969696,
+      0.712500045598, 0.854000023317, 0.990300001562, 1.142800111339, 1.292299950482,
+      1.466600030583, 1.635700099013, 1.822799933694, 1.992200007868, 2.15310009031,
+      2.386500108353, 2.60449990629, 2.869799893075, 3.032400140381, 3.231399995262,
+      3.403899989662, 3.618999922198, 3.774300084646, 3.905999946609, 3.963399952969,
+      4.0},
+    { // OH-
+      -0.999999993529, -0.987100005289, -0.967600009816, -0.917100012569, -0.788200005091,
+      -0.618500007546, -0.433400012125, -0.254299995626, -0.068299994147, 0.113400013077,
+      0.311699938886, 0.539799952919, 0.77539998437, 0.868600013871, 0.955300041687,
+      1.149100098996, 1.255500003415, 1.36419988287, 1.521899970516, 1.745600002324,
+      1.906400077947, 2.060299937992, 2.468300027048, 2.855599898246, 3.025100095556,
+      3.300300181648, 3.495399882715, 3.70870000579, 3.891899909535, 3.95759999433,
+      4.0},
+    { // BO
+      -0.999999993529, -0.990400001266, -0.980100014221, -0.948099994905, -0.867099988356,
+      -0.774199970016, -0.658099965375, -0.526299961984, -0.388999993208, -0.24410000099,
+      -0.087699974992, 0.085400031162, 0.165399962157, 0.245300002688, 0.397699986136,
+      0.552599956974, 0.743200010583, 0.829400043182, 0.919699937061, 1.145700105657,
+      1.261299988237, 1.388000093224, 1.600399891505, 1.801099942058, 1.934900049163,
+      2.06299993773, 2.415800099353, 2.627500046092, 2.91340008649, 3.0247000878,
+      3.144699963648, 3.329099936361, 3.513000149176, 3.637699906712, 3.763800138147,
+      3.903300015719, 3.960900021915, 4.0},
+    { // CO
+      -0.999999993529, -0.990100001508, -0.979000014924, -0.966500005101, -0.945699996809,
+      -0.910399974022, -0.860899998037, -0.76399998711, -0.702000003762, -0.643399984631,
+      -0.573800020482, -0.504899997282, -0.435000008317, -0.360600023402, -0.285399985933,
+      -0.206999981965, -0.031999982334, 0.097900011956, 0.22710002436, 0.345900039562,
+      0.480000014377, 0.620700018192, 0.759199993854, 0.849300024418, 0.943900034192,
+      1.053599953886, 1.167400076152, 1.303499961392, 1.438300045845, 1.544299964286,
+      1.645900094649, 1.853899907367, 1.973000032371, 2.087999925751, 2.418800094762,
+      2.588699921809, 2.754999995127, 2.961400037324, 3.171900028914, 3.310999963058,
+      3.441899999173, 3.67539992459, 3.818500133516, 3.932999889782, 3.973599868103,
+      4.0},
+    { // NO+
+      -0.999999993529, -0.989500002226, -0.982600011031, -0.97680001619, -0.964199995243,
+      -0.940500000934, -0.901799970656, -0.847200046694, -0.791000012396, -0.735400018144,
+      -0.670299962119, -0.611100016543, -0.521199974182, -0.42920001927, -0.3417999733,
+      -0.247899996748, -0.158200015132, -0.063000003138, 0.024399993502, 0.111300017527,
+      0.238200005503, 0.393199983789, 0.556499943964, 0.664499954996, 0.764299989339,
+      0.901499984331, 1.037199964169, 1.214200029052, 1.36329988318, 1.524699976538,
+      1.705000047655, 1.957800057189, 2.191000058225, 2.424400090052, 2.687100048785,
+      2.88560010827, 3.124099973419, 3.264000122881, 3.400900068286, 3.555400056924,
+      3.712799971332, 3.833600005141, 3.938500008477, 3.975899930173, 4.0},
+    { // NO
+      -0.999999993529, -0.990700001024, -0.98130001269, -0.950999991782, -0.874499995932,
+      -0.785799994547, -0.675999984199, -0.556299996536, -0.430000020217, -0.294300016801,
+      -0.152699988818, 0.053099945611, 0.139899982053, 0.225500025841, 0.342200034627,
+      0.489900016936, 0.63539998904, 0.944700033139, 1.257799996142, 1.411000076437,
+      1.560699938868, 1.690900069295, 1.820899939153, 2.059899938262, 2.204500047145,
+      2.381000123772, 2.527199984718, 2.657000092176, 2.961400037324, 3.172900004817,
+      3.343200084633, 3.500700006393, 3.630000122038, 3.762400169843, 3.894499970732,
+      3.957099983412, 4.0},
+    { // O2
+      -0.999999993529, -0.991200000621, -0.982900010648, -0.954999985319, -0.88469999143,
+      -0.801600008423, -0.704800021108, -0.579500039996, -0.464299999861, -0.331499970252,
+      -0.183499984477, 0.000300000332, 0.080700039483, 0.161299973909, 0.272299971104,
+      0.41139994591, 0.572500055544, 0.884499992028, 1.285999952547, 1.536399980598,
+      1.760499979463, 1.909700075943, 2.060099938011, 2.295099955114, 2.431500083432,
+      2.607499905177, 2.863099896887, 3.085900059538, 3.285600080832, 3.475799924916,
+      3.673999959497, 3.769700004571, 3.885299984367, 3.953299900437, 3.982299980098,
+      4.0},
+    { // HF
+      -0.999999993529, -0.990500001185, -0.980700013455, -0.949499993794, -0.870599985441,
+      -0.780599971703, -0.668299961201, -0.542099959324, -0.405199999053, -0.258999996962,
+      -0.109700017992, 0.005900006526, 0.126300003808, 0.244200002535, 0.364700009178,
+      0.566200009252, 0.739700022037, 0.87050001219, 0.995100000789, 1.160000099415,
+      1.306499959824, 1.511299970683, 1.667800071666, 1.944000048931, 2.203500045717,
+      2.368499890651, 2.531599983045, 2.953500045827, 3.232699961904, 3.420900068406,
+      3.62560002417, 3.783500122187, 3.911899893041, 3.965599892296, 3.986499869216,
+      4.0},
+    { // NaH
+      -0.999999993529, -0.986700005799, -0.966500005101, -0.91429999646, -0.780899973021,
+      -0.604600015064, -0.415900016707, -0.26949997452, -0.119799994646, 0.138299986017,
+      0.236200009447, 0.337800035973, 0.543499957153, 0.645699966249, 0.747799994753,
+      0.936200002277, 1.144900107225, 1.498799992732, 1.868799886875, 2.24620000843,
+      2.448700041837, 2.736000010293, 2.856599898338, 2.978500013386, 3.223599869226,
+      3.461000010341, 3.558699971603, 3.659399869584, 3.741399795885, 3.817300107199,
+      3.866999964921, 3.915599988107, 3.96949978474, 3.987699837536, 4.0},
+    { // MgH
+      -0.999999993529, -0.984600008479, -0.959699977726, -0.896699970175, -0.824399978168,
+      -0.738000022846, -0.624100006491, -0.521399973703, -0.394099983253, -0.280199957634,
+      -0.129400001006, 0.008800009733, 0.262799988126, 0.426699948959, 0.602000024872,
+      0.687600038302, 0.773199983643, 0.983699998989, 1.196600038429, 1.468300031707,
+      1.744400006454, 2.000800000237, 2.283099974801, 2.478900010907, 2.668500083544,
+      2.810499923431, 2.961300037581, 3.122399931044, 3.289199993314, 3.488599794452,
+      3.611400093858, 3.735099895698, 3.794200066108, 3.85560002609, 3.900800079711,
+      3.943299970733, 3.977899984147, 3.989799782095, 4.0},
+    { // MgO
+      -0.999999993529, -0.99140000046, -0.983600009755, -0.95689998225, -0.889399972135,
+      -0.814300001748, -0.71870001928, -0.588300050999, -0.453399981984, -0.340099960446,
+      -0.229100009116, -0.131299999306, -0.032099982855, 0.234000013786, 0.421499940926,
+      0.623300014326, 0.95710004696, 1.312599949346, 1.449700043965, 1.576799927543,
+      1.878100084408, 1.992300007767, 2.117199881937, 2.259199981848, 2.412800103945,
+      2.559299939355, 2.681600056786, 2.840599899231, 2.921800075398, 2.999100000908,
+      3.075700050695, 3.195899898596, 3.321200125893, 3.444999920496, 3.596000004674,
+      3.723799892261, 3.801000163647, 3.870899913321, 3.948099868748, 3.980100038179,
+      3.990399785742, 4.0},
+    { // AlH
+      -0.999999993529, -0.991700000218, -0.984500008606, -0.959399978211, -0.895899970115,
+      -0.822599980062, -0.735300017963, -0.621500006004, -0.519699977483, -0.393299985465,
+      -0.279599957217, -0.119099996326, 0.032799975372, 0.369899987302, 0.484700015592,
+      0.599500026459, 0.706000044739, 0.858600022416, 1.032399981097, 1.207300019902,
+      1.407200081186, 1.62179992987, 1.731500020998, 1.834899910997, 2.001000000297,
+      2.136700116348, 2.344099919281, 2.569199949518, 2.715000042458, 2.887100109091,
+      3.058399971986, 3.254200093843, 3.339700156729, 3.419800087662, 3.614800017063,
+      3.688500036968, 3.763700140411, 3.834300020388, 3.89469997544, 3.959200029267,
+      3.984399924657, 4.0},
+    { // AlO
+      -0.999999993529, -0.990200001427, -0.979600014579, -0.947099995698, -0.86409999304,
+      -0.765599982735, -0.654599970871, -0.48190002484, -0.334299966773, -0.261699993179,
+      -0.190699978943, -0.051400013623, 0.203800036281, 0.448400046186, 0.67719994081,
+      0.926499939871, 1.125300008707, 1.301999962176, 1.443300043053, 1.591999908461,
+      1.744100007486, 1.907900077036, 2.115999882221, 2.240000018636, 2.370699904645,
+      2.544299957408, 2.697200045389, 2.984100011843, 3.113000067159, 3.255100113486,
+      3.398200054199, 3.552300137074, 3.708399998959, 3.767600052115, 3.828399965078,
+      3.883900019978, 3.934599924312, 3.974099881597, 3.988899805855, 4.0},
+    { // AlF
+      -0.999999993529, -0.990000001588, -0.978700015097, -0.944999997364, -0.909099971604,
+      -0.858500006382, -0.757299999638, -0.642099985919, -0.555999996355, -0.47210004182,
+      -0.393499984912, -0.316899998606, -0.240700004785, -0.163600016741, 0.004700005198,
+      0.199000042905, 0.407999955146, 0.653599955589, 0.90719997047, 1.11549988234,
+      1.30709995951, 1.453200038316, 1.671400069432, 1.82189993628, 1.990200009885,
+      2.13980012807, 2.345399918454, 2.632700101787, 2.823899942001, 3.039999981491,
+      3.221299811021, 3.394699980943, 3.530200194319, 3.651900050636, 3.729300016221,
+      3.801800144398, 3.864500024888, 3.926799913398, 3.970599787143, 3.987999829615,
+      4.0},
+    { // Al2
+      -0.999999993529, -0.989000002864, -0.974500017513, -0.934600001292, -0.836000018446,
+      -0.76079999586, -0.686600008373, -0.535699951601, -0.28199996743, -0.043900020307,
+      0.163499967603, 0.376299981343, 0.590400024612, 0.799099948868, 1.0521999542,
+      1.277099967309, 1.435600051026, 1.567499947388, 1.691200068517, 1.776799970983,
+      1.859299907748, 2.071099936707, 2.167400064884, 2.275999988777, 2.39860010642,
+      2.521599978276, 2.774999984206, 2.966300024728, 3.149600081729, 3.239899777149,
+      3.35500002937, 3.443299963641, 3.533800107272, 3.632900040941, 3.727399973399,
+      3.819000144482, 3.875600019645, 3.929299844368, 3.972099827623, 3.988399819055,
+      4.0},
+    { // SiH
+      -0.999999993529, -0.99140000046, -0.98340001001, -0.956299983219, -0.887899978293,
+      -0.808300014501, -0.715200032976, -0.594200036002, -0.476700033375, -0.346800011107,
+      -0.216100000924, -0.052800012745, 0.097200012936, 0.400199986531, 0.551899959309,
+      0.729800036262, 0.811599968243, 0.892199977976, 1.084999925294, 1.246500010038,
+      1.419700080198, 1.493799995076, 1.571699944776, 1.710300049358, 1.883500127143,
+      2.084099929737, 2.249500002998, 2.441500062366, 2.661800090891, 2.963000033211,
+      3.067300121039, 3.173299995177, 3.452099844378, 3.578299967308, 3.701799848691,
+      3.764000133619, 3.829799931523, 3.896800024868, 3.94529992824, 3.979900038121,
+      4.0},
+    { // SiH-
+      -0.999999993529, -0.987600004651, -0.969600018389, -0.922500022255, -0.80250000924,
+      -0.641899986117, -0.469100038442, -0.331599970128, -0.185599982521, -0.027199971384,
+      0.132400000632, 0.303499947192, 0.456900041643, 0.588100029922, 0.705600044253,
+      0.788399957867, 0.86960001291, 1.130800121324, 1.266899984152, 1.417200079117,
+      1.597299897101, 1.784999972412, 2.148700096238, 2.391300099732, 2.604699906216,
+      2.795399964225, 2.966900023186, 3.101099942664, 3.221899826205, 3.398000050013,
+      3.520499987571, 3.607600071677, 3.691000050106, 3.837700094444, 3.937599989054,
+      3.975499919378, 4.0},
+    { // SiC
+      -0.999999993529, -0.990000001588, -0.978700015097, -0.944899997444, -0.859400002218,
+      -0.747400009795, -0.622400006173, -0.529199955048, -0.440699996008, -0.362300021673,
+      -0.287899999539, -0.184799983266, -0.084999977745, 0.153299974273, 0.329500050777,
+      0.501999999757, 0.62210001611, 0.761799992301, 0.871200011722, 1.010099970625,
+      1.180900053864, 1.313699945686, 1.469100032236, 1.635600099226, 1.78739997254,
+      1.985200008184, 2.184000076667, 2.376300038281, 2.551999953579, 2.719600029942,
+      2.875100001206, 3.035300079752, 3.266200069228, 3.422800016643, 3.716399888974,
+      3.829199945904, 3.912099898179, 3.967499839897, 3.986999856016, 4.0},
+    { // SiN
+      -0.999999993529, -0.989400002354, -0.976200016535, -0.939000001324, -0.844400047679,
+      -0.728200009424, -0.596300027552, -0.504499997742, -0.415400017723, -0.277599960573,
+      -0.156200005564, 0.00500000553, 0.133799997164, 0.346400040229, 0.560699940977,
+      0.812499978836, 1.100499908984, 1.270699980454, 1.396100093451, 1.512999969852,
+      1.646400095056, 1.799499943479, 1.937600043955, 2.089199924524, 2.204800047573,
+      2.326999928814, 2.62560000254, 2.842999898848, 2.995700004337, 3.207899975247,
+      3.349599925475, 3.511700181256, 3.60890010082, 3.707299973915, 3.875000006072,
+      3.95479993319, 3.982699969538, 4.0},
+    { // SiO
+      -0.999999993529, -0.989800001843, -0.977800015614, -0.965400000387, -0.942999998951,
+      -0.906099971214, -0.853600029053, -0.746500011822, -0.627200007073, -0.53599995152,
+      -0.442399995015, -0.359500024576, -0.277799960237, -0.193499981023, -0.114300007852,
+      0.043099960934, 0.252900000885, 0.463200031365, 0.658599950987, 0.881700000619,
+      1.033799976159, 1.186600047764, 1.313899945021, 1.446900043566, 1.530799987021,
+      1.611899894969, 1.836099910505, 1.933100052635, 2.024399983199, 2.234800017046,
+      2.438100070396, 2.672300076658, 2.879100086103, 3.071900144142, 3.357300081738,
+      3.506800148605, 3.609900123238, 3.705599935209, 3.783100131056, 3.85560002609,
+      3.941900000479, 3.977199965256, 3.989699784735, 4.0},
+    { // SiF
+      -0.999999993529, -0.989900001716, -0.978200015384, -0.943899998237, -0.856000017949,
+      -0.752800002289, -0.636199995446, -0.54229996017, -0.450699988809, -0.357200027173,
+      -0.266699981218, -0.122099995694, 0.037699967455, 0.239100003728, 0.444100052039,
+      0.647799962661, 0.903599979224, 1.055199953527, 1.198200037048, 1.306299959929,
+      1.473800025819, 1.614599893337, 1.776299970802, 2.018099992746, 2.355999909817,
+      2.544399957409, 2.719100031303, 2.913800085834, 3.082199987679, 3.307699998646,
+      3.46569989251, 3.641299875428, 3.785100086708, 3.872099940468, 3.923100015562,
+      3.962899966758, 3.985999882416, 4.0},
+    { // Si2
+      -0.999999993529, -0.989800001843, -0.977800015614, -0.94289999903, -0.854200026277,
+      -0.742700020382, -0.626400006923, -0.529999953135, -0.432800013553, -0.244000001101,
+      -0.06060000721, 0.134899994439, 0.319400036096, 0.520299972591, 0.758299993201,
+      0.999800000032, 1.115299882387, 1.232700008682, 1.395600093315, 1.462100027608,
+      1.537899978877, 1.677200076479, 1.861799903518, 1.960100055337, 2.060199938002,
+      2.256599987593, 2.382000120969, 2.508699999392, 2.604799906179, 2.694300045058,
+      2.89770010774, 3.06390003311, 3.309499954132, 3.421600049335, 3.54510007934,
+      3.647500032975, 3.738599802159, 3.850099892669, 3.897000029576, 3.940400032349,
+      3.97689995716, 3.989599787375, 4.0},
+    { // HS
+      -0.999999993529, -0.991500000379, -0.983700009627, -0.957099981927, -0.889899970082,
+      -0.811800010059, -0.720300014019, -0.597300023529, -0.479300028602, -0.355900028641,
+      -0.22040001389, -0.063300002629, 0.103600013071, 0.282399972463, 0.445500050134,
+      0.551799959643, 0.654099955129, 0.841300028049, 0.924699938865, 1.008599974703,
+      1.134600119466, 1.275999969569, 1.428100065299, 1.5718999441, 1.925500066287,
+      2.204800047573, 2.309199943483, 2.422500091292, 2.589699921391, 2.740600013863,
+      3.010500211824, 3.153300005517, 3.297100126659, 3.564500043156, 3.667900016363,
+      3.765000110979, 3.833600005141, 3.898500064882, 3.959500035818, 4.0},
+    { // HS-
+      -0.999999993529, -0.99140000046, -0.983600009755, -0.956799982411, -0.889199972956,
+      -0.810600014048, -0.718600019672, -0.594600034393, -0.475600035395, -0.351300033835,
+      -0.215299998219, -0.059000008855, 0.107400017352, 0.287399972966, 0.451900043357,
+      0.559599933622, 0.661999952053, 0.849900024145, 0.935299993502, 1.019899974488,
+      1.147500102131, 1.289899946823, 1.448200043751, 1.604399893427, 1.955100059318,
+      2.111799883216, 2.266299986827, 2.486700000829, 2.634500100715, 2.763799994218,
+      3.061299965869, 3.193199964705, 3.330599929735, 3.542200009977, 3.653300016839,
+      3.751500022732, 3.822900096904, 3.888699897882, 3.956699974678, 4.0},
+    { // CS
+      -0.999999993529, -0.989900001716, -0.978400015269, -0.94429999792, -0.9082999715,
+      -0.857100012859, -0.752400002525, -0.635499996818, -0.545999975816, -0.457299972125,
+      -0.37429999962, -0.293200015308, -0.213099990781, -0.132899996676, -0.056600010361,
+      0.020600002735, 0.259699995129, 0.368999991088, 0.478400013961, 0.606700020904,
+      0.754499990446, 0.883899993869, 1.018499973936, 1.160200098786, 1.34219990277,
+      1.521599969871, 1.733000021103, 1.944300049651, 2.190600059003, 2.302899956999,
+      2.42650008868, 2.569499949894, 2.808399927264, 3.000600013389, 3.215099897774,
+      3.384500004618, 3.569400157668, 3.649200076174, 3.728099989175, 3.794900080784,
+      3.850599904798, 3.94229999198, 3.977399970654, 3.989699784735, 4.0},
+    { // NS
+      -0.999999993529, -0.990600001105, -0.981100012945, -0.95049999259, -0.873399992973,
+      -0.783599984882, -0.675099980713, -0.541399956364, -0.395999977999, -0.266799980979,
+      -0.140499984549, -0.039000018808, 0.05949992686, 0.333700043951, 0.561399949667,
+      0.814300000023, 1.093799922793, 1.389700092007, 1.613299894122, 1.818699941902,
+      1.935900047234, 2.057599943794, 2.2630999834, 2.347599917054, 2.44180006151,
+      2.589699921391, 2.77999998864, 2.923600075132, 3.090100136942, 3.243799861068,
+      3.409899832414, 3.540999981275, 3.664399944917, 3.784300104447, 3.867699948131,
+      3.933899909205, 3.974499892392, 4.0},
+    { // SO
+      -0.999999993529, -0.990300001346, -0.979800014464, -0.94739999546, -0.864899991791,
+      -0.766199981094, -0.655399969615, -0.570000007473, -0.484300021712, -0.335399965406,
+      -0.195199982286, -0.061600005513, 0.218000030127, 0.485000015669, 0.763399990406,
+      1.050999954469, 1.284599954602, 1.496899993623, 1.665900075064, 1.900800081348,
+      2.121499912734, 2.238600018208, 2.353299912387, 2.502599986981, 2.724000018265,
+      2.898000107625, 3.087000080901, 3.394899985129, 3.49809994573, 3.59769996074,
+      3.764100131355, 3.896600020161, 3.959400033634, 3.984499922017, 4.0},
+    { // MgS
+      -0.999999993529, -0.989100002737, -0.975100017168, -0.936600001306, -0.836200019985,
+      -0.721000013612, -0.5858000482, -0.40199997929, -0.22410001186, -0.032599985461,
+      0.161199974196, 0.328500050029, 0.50030000444, 0.668199959353, 0.845900025961,
+      1.04439995447, 1.249400018961, 1.644100093184, 1.829999913006, 2.016499994764,
+      2.198800043054, 2.390100098633, 2.584799923439, 2.732700005942, 2.882100106354,
+      3.15310001072, 3.421800043886, 3.617199962854, 3.710600021662, 3.802700122743,
+      3.866399979313, 3.924799968622, 3.970099773649, 3.987799834895, 4.0},
+    { // AlS
+      -0.999999993529, -0.990100001508, -0.979200014809, -0.945999996571, -0.8614999971,
+      -0.759399998401, -0.64739998067, -0.570100007815, -0.493700010078, -0.338299961803,
+      -0.171200002305, 0.011800009824, 0.224300026952, 0.444500051495, 0.671499957167,
+      0.916999944465, 1.129700114502, 1.316399936704, 1.454500036003, 1.616999891886,
+      1.732600021075, 1.853499907339, 2.068399937206, 2.239700018544, 2.392500100831,
+      2.559899938186, 2.737800012666, 2.90040010627, 3.079899947411, 3.396800024897,
+      3.506600143942, 3.619399913163, 3.75990022181, 3.81640008746, 3.870499904273,
+      3.951799867684, 3.981500001219, 3.990799794669, 4.0},
+    { // SiS
+      -0.999999993529, -0.989700001971, -0.97760001573, -0.942499999348, -0.905499971137,
+      -0.852500034142, -0.744500016327, -0.624600006585, -0.540899954249, -0.45749997162,
+      -0.374999997305, -0.288000000083, -0.108400017191, 0.078900040951, 0.263199987161,
+      0.452000043323, 0.655699953656, 0.867600014833, 1.04639995455, 1.200700033999,
+      1.488000000362, 1.601099891841, 1.718000043105, 1.976300019997, 2.297799959581,
+      2.485800001912, 2.639900097497, 2.81449993114, 3.007900176287, 3.213699931959,
+      3.428099872251, 3.543700045854, 3.658599888896, 3.751100013252, 3.845200012306,
+      3.933499900573, 3.972799846514, 4.0},
+    { // S2
+      -0.999999993529, -0.990200001427, -0.979500014636, -0.946899995857, -0.863799993508,
+      -0.765399983281, -0.654599970871, -0.580900042715, -0.507399994406, -0.362100021876,
+      -0.188299980007, -0.014799984774, 0.109400019606, 0.2345000128, 0.477600013754,
+      0.755899991461, 1.030999986034, 1.295799956272, 1.573099940045, 1.772299969352,
+      1.952100061683, 2.17510007253, 2.272899989817, 2.369799888302, 2.719800029398,
+      2.905200099168, 3.124999995853, 3.325800015533, 3.526000110067, 3.60109992596,
+      3.687300004911, 3.761200197011, 3.824500058555, 3.929699833323, 3.972199830322,
+      4.0},
+    { // HCl
+      -0.999999993529, -0.991200000621, -0.982900010648, -0.955099985158, -0.884999990199,
+      -0.803100009784, -0.707900040314, -0.578500036573, -0.451699986281, -0.315099999587,
+      -0.17759999171, 0.004700005198, 0.170399948281, 0.337400036751, 0.518799973287,
+      0.670999958602, 0.866800015602, 0.95880005194, 1.048599954637, 1.300399963012,
+      1.459100027821, 1.617599891524, 1.892900108375, 2.137900120885, 2.342899920045,
+      2.572799943499, 2.696800045344, 2.819099940005, 3.129400105531, 3.257400163686,
+      3.39029988885, 3.593600066698, 3.77650012909, 3.907399910774, 3.963799941937,
+      4.0},
+    { // LiCl
+      -0.999999993529, -0.990600001105, -0.980800013328, -0.949699993635, -0.870999986517,
+      -0.780599971703, -0.670399962507, -0.525699963419, -0.372100006896, -0.241500003892,
+      -0.117200000888, -0.002699999565, 0.128300005305, 0.398699986658, 0.62210001611,
+      0.857900022553, 1.123799972641, 1.412000076869, 1.878300089356, 2.010100002839,
+      2.147100102231, 2.340599921508, 2.500999983726, 2.909300093102, 3.15829987544,
+      3.442099994097, 3.552400134489, 3.65699992752, 3.739799770088, 3.816500089654,
+      3.927899883025, 3.971499811431, 3.988199824335, 4.0},
+    { // NaCl
+      -0.999999993529, -0.990200001427, -0.979400014694, -0.946399996253, -0.863199994445,
+      -0.760899995586, -0.647199980868, -0.502899999583, -0.344699995228, -0.189599978796,
+      -0.021099970231, 0.168599952985, 0.363900012544, 0.548199963295, 0.743000011272,
+      0.97170001367, 1.206000022679, 1.649500097579, 1.798299947168, 1.949400061897,
+      2.199200042276, 2.308499944985, 2.41560009966, 2.718500032935, 2.878500073368,
+      3.072900119551, 3.294400068554, 3.494399859377, 3.571200142141, 3.649000071092,
+      3.725399928322, 3.791600011598, 3.849899892786, 3.902200043876, 3.935299939418,
+      3.963299955727, 3.985999882416, 4.0},
+    { // AlCl
+      -0.999999993529, -0.990100001508, -0.978900014981, -0.945399997047, -0.860399998817,
+      -0.755000000993, -0.641999986018, -0.562600001034, -0.484700021191, -0.333799967394,
+      -0.171900001146, 0.000700000774, 0.17919993307, 0.362200019695, 0.544299958198,
+      0.729900036289, 1.000099999706, 1.255400003731, 1.356699894615, 1.446700043538,
+      1.66730007256, 1.790899969914, 1.906300078008, 2.07579993524, 2.229800015461,
+      2.418600095068, 2.61009990395, 2.835499918715, 3.158599867636, 3.433599902175,
+      3.553400108634, 3.658799884068, 3.731799983892, 3.799800183514, 3.85920011342,
+      3.92829987198, 3.971099800636, 3.988099826975, 4.0},
+    { // CaH
+      -0.999999993529, -0.987100005289, -0.967700010245, -0.917400014295, -0.788900008166,
+      -0.619900005844, -0.438499999987, -0.297400021006, -0.152699988818, 0.095800014897,
+      0.192700048439, 0.288899973117, 0.502699997829, 0.598600026276, 0.692400063424,
+      0.874100009782, 1.069399937975, 1.251400016381, 1.429200063258, 1.786799972508,
+      2.241100016825, 2.374099985781, 2.508299998578, 2.736100010425, 2.940400046996,
+      3.172500014456, 3.414699953465, 3.518400015919, 3.626000033067, 3.720399815632,
+      3.790799994826, 3.8568000552, 3.912499908457, 3.965899884023, 3.986599866576,
+      4.0},
+    { // CaF
+      -0.999999993529, -0.990100001508, -0.978900014981, -0.945499996967, -0.85970000083,
+      -0.760899995586, -0.645699982353, -0.568600006255, -0.490100014169, -0.414600019349,
+      -0.337499962797, -0.166600010905, 0.018100005497, 0.227700023805, 0.446400048908,
+      0.67919993507, 0.917399943368, 1.151600097582, 1.388100093152, 1.673600072105,
+      1.859699907776, 2.027499978161, 2.172300063882, 2.326399929144, 2.469000027118,
+      2.602999906846, 2.766099988859, 2.942700047349, 3.208999999898, 3.393899964199,
+      3.473199862064, 3.550900173271, 3.649700088879, 3.737099842247, 3.824600056158,
+      3.886899943668, 3.922600029368, 3.953799911355, 3.982599972178, 4.0},
+    { // CaCl
+      -0.999999993529, -0.990000001588, -0.978800015039, -0.945199997205, -0.85970000083,
+      -0.757699999402, -0.637399993094, -0.48790001702, -0.331299970501, -0.176999992703,
+      -0.009399998486, 0.183899978146, 0.38309997934, 0.575000054664, 0.775699984469,
+      0.991700001336, 1.223400038066, 1.479800014746, 1.68830007303, 1.927600062706,
+      2.171300060794, 2.362299901855, 2.677400065038, 2.818999939812, 2.977500013601,
+      3.188100003282, 3.297200128811, 3.399500081408, 3.476999953924, 3.553300111219,
+      3.635599965437, 3.714699927865, 3.880700101376, 3.917300031786, 3.950699843664,
+      3.981500001219, 4.0},
+    { // ScO
+      -0.999999993529, -0.989900001716, -0.978100015442, -0.943599998475, -0.906599971279,
+      -0.854600024426, -0.751900002819, -0.633000001718, -0.549599991039, -0.459499966564,
+      -0.382199983808, -0.302300019435, -0.223100012409, -0.142199983002, 0.04409996003,
+      0.263099987402, 0.498700006787, 0.787399961203, 1.08109992128, 1.284999954015,
+      1.469200032302, 1.62630002936, 1.806199942595, 1.962800052141, 2.127600040674,
+      2.31239993958, 2.501099983929, 2.687700047912, 2.871699929043, 3.097899963574,
+      3.321300123494, 3.473699874151, 3.623999988582, 3.714499932441, 3.812500001929,
+      3.939100021425, 3.975499919378, 4.0},
+    { // TiO
+      -0.999999993529, -0.990000001588, -0.978600015154, -0.944799997523, -0.908699971552,
+      -0.857800009621, -0.756699999991, -0.640999987008, -0.558499997865, -0.468200031208,
+      -0.391499990442, -0.311600001494, -0.234500007247, -0.156900008913, 0.022299998604,
+      0.2530000008, 0.493800012518, 0.755999991533, 1.031299984976, 1.259699990133,
+      1.475600022497, 1.610499895815, 1.743500009551, 1.8742999904, 1.991200008876,
+      2.110599883501, 2.229700015403, 2.368099891374, 2.550499956502, 2.718900031847,
+      2.90040010627, 3.100599930952, 3.26140018629, 3.43089984091, 3.595700012427,
+      3.700999830477, 3.812099993156, 3.918800070327, 4.0},
+    { // TiS
+      -0.999999993529, -0.989900001716, -0.978300015327, -0.943999998158, -0.857000013322,
+      -0.749900004164, -0.630700006226, -0.472300041453, -0.30260001877, -0.137799988621,
+      0.036899968747, 0.221200029822, 0.409699948305, 0.589400026233, 0.773999983908,
+      1.144800107421, 1.318399930051, 1.492999995451, 1.599399892599, 1.709900049562,
+      1.830799912678, 1.974700025997, 2.093699921187, 2.218300017417, 2.356699909151,
+      2.556599944616, 2.721500024883, 2.899600107015, 3.108300111313, 3.277700161675,
+      3.473699874151, 3.561899982394, 3.651500060292, 3.752000034582, 3.849299908044,
+      3.949299843252, 3.980400030259, 4.0},
+    { // VO
+      -0.999999993529, -0.989700001971, -0.97720001596, -0.941600000062, -0.903499970877,
+      -0.850000045709, -0.743600018354, -0.622200006135, -0.52579996318, -0.432100015219,
+      -0.335999964661, -0.24470000032, -0.162400019076, -0.079299983434, 0.0860000301,
+      0.306199934827, 0.514099975654, 0.754399990373, 0.998500000242, 1.259199991714,
+      1.462500027873, 1.59409990396, 1.749599988559, 1.862499901854, 1.977700014748,
+      2.099499917238, 2.219100013795, 2.336799923578, 2.490599995948, 2.653400091349,
+      2.813799929791, 3.039999981491, 3.248999979416, 3.420600076579, 3.568200129624,
+      3.711500001072, 3.797000124811, 3.87720005584, 3.952899891703, 3.982199982738,
+      4.0},
+    { // CrH
+      -0.999999993529, -0.986400006182, -0.965500000815, -0.911599980926, -0.774199970016,
+      -0.591300047671, -0.395999977999, -0.241100004338, -0.082399980397, 0.06740001228,
+      0.201100040364, 0.404199970436, 0.583300043542, 0.720200033644, 0.849100024508,
+      0.999700000048, 1.146600103894, 1.313699945686, 1.484300006844, 1.818599941915,
+      2.329599927387, 2.494199990488, 2.647900092011, 2.817699937307, 2.978800013321,
+      3.07520006299, 3.173099999997, 3.35500002937, 3.453299873395, 3.550900173271,
+      3.615300005769, 3.67989981239, 3.756500141231, 3.825900024999, 3.925199957577,
+      3.970999797938, 3.987999829615, 4.0},
+    { // CrO
+      -0.999999993529, -0.990100001508, -0.979000014924, -0.945599996888, -0.86019999913,
+      -0.762199992032, -0.648899979184, -0.558699997986, -0.471200043472, -0.383099985052,
+      -0.296800020192, -0.150999980685, 0.004800005309, 0.258899995806, 0.500200004716,
+      0.799499948708, 1.111899883193, 1.321399926154, 1.510699970976, 1.911200075749,
+      2.074899935521, 2.250800000408, 2.492799992611, 2.596399912749, 2.717700035112,
+      2.838899904066, 2.963600031669, 3.079499957247, 3.187099982349, 3.306700023376,
+      3.419100069243, 3.511600183724, 3.608100082886, 3.714999921002, 3.849199910587,
+      3.93779999337, 3.975999932872, 3.989299795295, 4.0},
+    { // FeH
+      -0.999999993529, -0.984400008734, -0.959299978372, -0.895799970107, -0.826399976062,
+      -0.734200015973, -0.630100007402, -0.516599981935, -0.397099974957, -0.27119997131,
+      -0.145499979997, -0.009699998438, 0.255099999023, 0.346600040496, 0.449100045233,
+      0.619000019122, 0.755599991243, 0.894399980797, 1.087999928381, 1.245200006037,
+      1.414300077863, 1.641000090661, 1.859999907798, 1.986200008581, 2.11359988279,
+      2.338499922681, 2.441400062651, 2.547699957449, 2.672500076202, 2.792999970371,
+      2.980100013033, 3.076100040858, 3.171900028914, 3.277900166484, 3.382700044561,
+      3.566100080548, 3.692300015093, 3.880700101376, 3.952899891703, 3.982099985378,
+      4.0},
+    { // FeO
+      -0.999999993529, -0.990000001588, -0.978800015039, -0.945099997285, -0.858900004531,
+      -0.761099995039, -0.646599981462, -0.555299995932, -0.467100022367, -0.378699985067,
+      -0.29270001463, -0.139999985005, 0.023699995203, 0.274899971481, 0.523099971728,
+      0.820700065333, 1.139000117314, 1.337699907393, 1.528499984712, 1.687000074103,
+      1.874399992874, 2.15960008809, 2.285299965834, 2.412400104558, 2.541299957372,
+      2.695800045229, 2.833199928625, 2.986600011099, 3.089200123628, 3.188200005376,
+      3.293800055642, 3.389499893666, 3.572500110129, 3.713499955318, 3.886799946212,
+      3.955499948475, 3.983099958978, 4.0},
+    { // YO
+      -0.999999993529, -0.989900001716, -0.978100015442, -0.943599998475, -0.906599971279,
+      -0.854800023501, -0.753000002171, -0.633500000738, -0.551999993939, -0.468100030404,
+      -0.389499993899, -0.309100004361, -0.133399995854, 0.05649993565, 0.272899971191,
+      0.500400004165, 0.753299989575, 1.00699997941, 1.231400012003, 1.451000042229,
+      1.630300110524, 1.824199929671, 2.105499898608, 2.241200016661, 2.36579989553,
+      2.520299976781, 2.671400078709, 2.79399996781, 2.918200078617, 3.119499885215,
+      3.296200107291, 3.372999960817, 3.445999895116, 3.611900082565, 3.679199829843,
+      3.746099900431, 3.893299942487, 3.958000003064, 3.983999935217, 4.0},
+    { // ZrO
+      -0.999999993529, -0.990000001588, -0.978600015154, -0.944699997602, -0.908499971526,
+      -0.857700010083, -0.757399999579, -0.640499987503, -0.560899999555, -0.477700031539,
+      -0.402799984231, -0.325199984021, -0.241900003445, -0.153099990732, 0.022399998361,
+      0.139299983539, 0.259599995213, 0.484100015437, 0.73980002189, 1.000699997941,
+      1.229300017963, 1.456800031912, 1.644800093754, 1.894100103889, 2.182400081066,
+      2.329299927551, 2.459500026815, 2.64480009414, 2.7130000479, 2.790499976773,
+      2.871399922676, 2.950800047864, 3.114000039168, 3.245499899759, 3.375300008019,
+      3.567400110928, 3.763500144939, 3.903999997802, 3.962699972274, 4.0},
+    { // LaO
+      -0.999999993529, -0.989800001843, -0.977800015614, -0.965400000387, -0.942999998951,
+      -0.905799971175, -0.853500029516, -0.749300005515, -0.629200007448, -0.547299981313,
+      -0.464299999861, -0.384599987126, -0.301700020765, -0.215699999572, -0.12269999613,
+      0.066199998191, 0.271999971061, 0.489000016703, 0.730700035286, 0.97410000898,
+      1.208900016485, 1.444000043153, 1.618199891161, 1.805999942574, 1.946000053733,
+      2.103599904926, 2.311099940765, 2.50749999695, 2.820099941746, 3.046400108923,
+      3.140899872075, 3.240099776859, 3.390099884664, 3.533200121779, 3.824000070539,
+      3.931299853095, 3.972899849213, 4.0}
+  };
+
+  static const double K[NBARK][NTK] = {
+    { // H2+
+      4.42957541, 4.37932049, 4.33377025, 4.1894119, 3.87980381,
+      3.60560575, 3.38348484, 3.21906034, 3.17418592, 3.22262666,
+      3.33835355, 3.605627, 3.94760606, 4.36682517, 4.8243614,
+      5.76048333, 5.98692326, 6.19817292, 6.68782242, 7.01093782,
+      7.37659784, 7.6297682, 7.88109111, 8.21896898, 8.57758262,
+      8.90363659, 9.21775276, 9.42959734, 9.69819905, 9.79500145,
+      9.86528682, 9.93436788, 9.9829999, 10.0535387, 10.0846296,
+      10.1060842},
+    { // H2
+      4.33236814, 4.29581929, 4.26319598, 4.15958556, 3.94191814,
+      3.75775385, 3.62205794, 3.54834328, 3.5657016, 3.67113883,
+      3.82317647, 4.12537323, 4.48562853, 4.90513083, 5.35374193,
+      6.11006816, 6.85457398, 7.11814881, 7.38453538, 7.96695243,
+      8.16995327, 8.36333109, 8.68395976, 9.00870885, 9.40191577,
+      9.80250704, 10.1435416, 10.4644833, 10.6793995, 10.9311192,
+      11.0407332, 11.1286512, 11.2174582, 11.251288, 11.2755438},
+    { // H2-
+      1.5004001, 1.51890075, 1.55168026, 1.65288578, 1.8005286,
+      1.99447676, 2.32390682, 2.67727737, 3.06563496, 3.49775541,
+      4.01918509, 4.57270183, 5.78498219, 6.20289001, 6.61060644,
+      6.94364359, 7.41088561, 7.71011795, 8.01529618, 8.28393262,
+      8.56193844, 8.90231661, 9.25057044, 9.56495081, 9.86699872,
+      10.0933282, 10.3393396, 10.4435216, 10.5281929, 10.6161252,
+      10.6496413, 10.6734711},
+    { // CH
+      4.02977109, 3.98070656, 3.93412321, 3.7900968, 3.48851269,
+      3.22735998, 3.03551446, 2.92292742, 2.92091802, 3.00008533,
+      3.14834979, 3.3194754, 3.53427804, 3.77650259, 4.03937489,
+      4.29173326, 4.53955396, 5.02820574, 5.22155157, 5.42579592,
+      5.74273382, 6.04939295, 6.69058645, 7.03556837, 7.35395278,
+      7.88410502, 8.22803201, 8.5900149, 8.93618673, 9.24268733,
+      9.45116432, 9.65365465, 9.87998838, 10.0599715, 10.2853995,
+      10.439613, 10.5277585, 10.564705, 10.58224},
+    { // CH-
+      0.00555704089, 0.069278555, 0.161127487, 0.392568897, 0.93404546,
+      1.55126868, 2.1530676, 2.6904301, 3.2122808, 3.74412547,
+      4.26210892, 4.87016071, 5.34884501, 5.73346535, 6.12327029,
+      6.31928852, 6.5014931, 6.94339411, 7.17280993, 7.40740486,
+      7.8780735, 8.33065941, 8.79208352, 9.15354869, 9.41609197,
+      9.78936123, 9.95325717, 10.1086309, 10.1886032, 10.278883,
+      10.3408394, 10.3652193, 10.379396},
+    { // C2
+      8.60089074, 8.49126962, 8.38109698, 8.04969052, 7.33445382,
+      6.68944017, 6.11627467, 5.70822557, 5.46551083, 5.36623586,
+      5.40130166, 5.51586428, 5.65126716, 5.7925235, 5.9463717,
+      6.08566153, 6.22091373, 6.55819752, 6.73413011, 6.9494273,
+      7.23590242, 7.55750335, 8.0481192, 8.49140179, 8.88243789,
+      9.20862477, 9.6830527, 9.94152289, 10.1816063, 10.4161034,
+      10.5722887, 10.6713587, 10.7721964, 10.8449002, 10.9359487,
+      11.0311771, 11.1981583, 11.2707487, 11.3355157, 11.4358655,
+      11.4859647, 11.5224946, 11.5448674, 11.5587454},
+    { // C2-
+      11.1491436, 10.9864294, 10.8133169, 10.3135505, 9.82990992,
+      9.22612571, 8.24990949, 7.3639346, 6.6973597, 6.27851153,
+      6.05417796, 5.99977828, 6.04328044, 6.12931775, 6.22808475,
+      6.34474699, 6.46153608, 6.57780268, 6.86348186, 7.0035322,
+      7.16792194, 7.3883956, 7.60932783, 8.21460104, 8.44483871,
+      8.66980601, 9.11193829, 9.67094043, 10.1392152, 10.3371856,
+      10.5219855, 10.8831906, 11.034636, 11.1763794, 11.2849916,
+      11.3693144, 11.5509595, 11.6255091, 11.697062, 11.8378493,
+      11.9055943, 11.9278193, 11.9406334},
+    { // CN
+      10.2101693, 10.0641137, 9.91151171, 9.4650218, 8.49380166,
+      7.61993629, 6.83168541, 6.24697351, 5.87794835, 5.68877032,
+      5.66156783, 5.73652874, 5.84890733, 5.97551013, 6.11057162,
+      6.34765859, 6.59638501, 6.74980496, 6.92871089, 7.15809139,
+      7.38891656, 8.00283807, 8.24407517, 8.47881701, 8.91810988,
+      9.58841295, 10.1110076, 10.4279209, 10.7970904, 11.1123519,
+      11.2700197, 11.3629817, 11.4083493, 11.4442087, 11.5004857,
+      11.5421834, 11.5612532, 11.5740938},
+    { // CN-
+      13.3743325, 13.1701844, 12.9589015, 12.3336642, 11.7264408,
+      10.9683815, 9.73102303, 9.08511692, 8.57828484, 8.07793708,
+      7.67419434, 7.34520245, 7.07349346, 6.87092098, 6.72282616,
+      6.57496331, 6.56389283, 6.59635943, 6.64860348, 6.71515833,
+      6.86515877, 7.14388191, 7.43935385, 7.77447431, 8.16909938,
+      8.59725601, 9.17157344, 9.71590667, 9.88674025, 10.0599422,
+      10.3725852, 10.6267757, 10.8267819, 10.9772045, 11.0929432,
+      11.2192075, 11.3074343, 11.3534987, 11.3846135},
+    { // NH
+      4.77476987, 4.72869744, 4.68750133, 4.55565673, 4.27300885,
+      4.02437234, 3.82491863, 3.68167067, 3.6494999, 3.70165802,
+      3.82230166, 3.95887877, 4.13152537, 4.54301035, 4.99919698,
+      5.42359029, 5.69366673, 5.96904126, 6.37205603, 6.68027906,
+      6.93017176, 7.19477406, 7.55312604, 7.91389442, 8.2594508,
+      8.97253963, 9.24250159, 9.49713005, 9.903921, 10.2052687,
+      10.3624382, 10.4671445, 10.5340118, 10.5784579},
+    { // N2
+      13.4746372, 13.2827195, 13.0841292, 12.4984314, 11.9297358,
+      11.2196399, 10.0633431, 8.98761003, 8.14708875, 7.59438415,
+      7.28237738, 7.16349607, 7.16755303, 7.21382676, 7.27663646,
+      7.35231603, 7.51431967, 7.79329659, 8.09531427, 8.42571903,
+      8.83262059, 9.24863375, 9.94152729, 10.4378768, 10.6337241,
+      10.8135299, 11.0909066, 11.2775885, 11.4992813, 11.6875532,
+      11.8197869, 11.9661453, 12.0253559, 12.0906142, 12.158121,
+      12.2054183},
+    { // OH
+      5.6836661, 5.61432226, 5.54615092, 5.33932395, 4.89822063,
+      4.51964954, 4.18967043, 3.97520539, 3.8875152, 3.91070803,
+      4.02043777, 4.15609229, 4.33216948, 4.75978718, 5.23175789,
+      5.64401033, 5.97330651, 6.29266346, 6.63896324, 6.9519413,
+      7.28115437, 7.57708279, 7.89437761, 8.18431606, 8.46601672,
+      8.87838437, 9.25573262, 9.69668389, 9.95460708, 10.2476844,
+      10.4702825, 10.6973378, 10.8250521, 10.9068594, 10.9341997,
+      10.9492183},
+    { // OH-
+      0.0110756925, 0.0951817208, 0.219424113, 0.526154397, 1.2242776,
+      2.00036078, 2.71848917, 3.32863107, 3.90446496, 4.42959329,
+      4.97535625, 5.5809164, 6.19117527, 6.42922809, 6.64801597,
+      7.11602988, 7.35187602, 7.5747502, 7.87197246, 8.26238453,
+      8.53406257, 8.79436738, 9.48825001, 10.124875, 10.3918757,
+      10.7924745, 11.0359089, 11.2590847, 11.4201445, 11.4723473,
+      11.504716},
+    { // BO
+      11.1021111, 10.9452234, 10.7812607, 10.2998095, 9.25297587,
+      8.31179477, 7.44795714, 6.79175681, 6.38148738, 6.16867019,
+      6.11834004, 6.20147819, 6.26819651, 6.34453716, 6.50691095,
+      6.69031328, 6.94689994, 7.07794822, 7.22643889, 7.63668566,
+      7.85566812, 8.09384143, 8.48032353, 8.83340554, 9.06843804,
+      9.29626286, 9.928987, 10.2970279, 10.7574345, 10.9176042,
+      11.074893, 11.2845249, 11.4582435, 11.559156, 11.6483193,
+      11.7268469, 11.7508802, 11.7644413},
+    { // CO
+      13.9707818, 13.7452953, 13.4991781, 13.2302613, 12.8015716,
+      12.1249144, 11.2755709, 9.90591837, 9.20304178, 8.64388806,
+      8.09455517, 7.65630017, 7.30313934, 7.01317804, 6.79617992,
+      6.6382243, 6.47942344, 6.48307752, 6.54692151, 6.63596003,
+      6.7593773, 6.91244189, 7.09148895, 7.22723569, 7.38790457,
+      7.59616561, 7.83249946, 8.13285615, 8.43729501, 8.67416288,
+      8.89571367, 9.33123987, 9.57288069, 9.80289783, 10.4429206,
+      10.7537258, 11.0436373, 11.3772684, 11.6745242, 11.8431817,
+      11.9831225, 12.2015165, 12.3273378, 12.4267822, 12.4605281,
+      12.4813192},
+    { // NO+
+      -16.4367049, -15.9479725, -15.6328271, -15.371691, -14.8153424,
+      -13.8092884, -12.2733537, -10.3125818, -8.51916441, -6.94241603,
+      -5.31428866, -4.0115891, -2.30842328, -0.851236131, 0.315363375,
+      1.37700296, 2.24029017, 3.0254419, 3.64788177, 4.18752969,
+      4.85426844, 5.50847656, 6.05752782, 6.36492502, 6.61998643,
+      6.93617028, 7.22106136, 7.57459093, 7.88135744, 8.23871968,
+      8.66650167, 9.29216133, 9.85925787, 10.3860756, 10.9186017,
+      11.2800477, 11.6598768, 11.8498516, 12.0118851, 12.1696103,
+      12.3104023, 12.4116984, 12.4975835, 12.5270821, 12.5453351},
+    { // NO
+      9.7243168, 9.60986725, 9.49709941, 9.1532584, 8.40666667,
+      7.7289503, 7.11667182, 6.6732881, 6.39850838, 6.26813904,
+      6.26464267, 6.41341938, 6.50579144, 6.60441808, 6.74549161,
+      6.93224526, 7.12452642, 7.55403551, 8.00623773, 8.23063881,
+      8.44908253, 8.63557996, 8.81747109, 9.14920085, 9.35554863,
+      9.61532658, 9.8348975, 10.0306107, 10.4703995, 10.7353473,
+      10.9162544, 11.0592772, 11.1632143, 11.2652956, 11.3753617,
+      11.4330396, 11.4742638},
+    { // O2
+      8.6166037, 8.53580973, 8.4614191, 8.22454866, 7.70961049,
+      7.23279409, 6.82619517, 6.48840355, 6.32284332, 6.26129941,
+      6.31146238, 6.48266172, 6.5770753, 6.67667794, 6.81797441,
+      7.00012641, 7.21825772, 7.65814173, 8.2437887, 8.6152365,
+      8.95868901, 9.2048634, 9.4738575, 9.92519152, 10.1910953,
+      10.5246696, 10.9668328, 11.2896317, 11.5232565, 11.6978452,
+      11.8303029, 11.8778087, 11.9199146, 11.9332728, 11.9354743,
+      11.9356695},
+    { // HF
+      7.66126888, 7.55796589, 7.45424962, 7.14285495, 6.47160169,
+      5.88064578, 5.35400024, 4.97952484, 4.76855557, 4.70733515,
+      4.77041952, 4.88273991, 5.04347026, 5.23383384, 5.45399209,
+      5.8636049, 6.2448129, 6.5435799, 6.83251621, 7.20802329,
+      7.51847177, 7.90707256, 8.17942008, 8.63301803, 9.04675857,
+      9.31342818, 9.58269693, 10.2831435, 10.7167382, 10.9710589,
+      11.1985078, 11.3351075, 11.4174002, 11.4431605, 11.4518115,
+      11.4570056},
+    { // NaH
+      3.37494118, 3.35142895, 3.31900697, 3.25223211, 3.17722105,
+      3.23889858, 3.44385537, 3.66956198, 3.94177399, 4.47588697,
+      4.6926655, 4.92210449, 5.38219182, 5.59717906, 5.79861828,
+      6.14091127, 6.49282797, 7.05734273, 7.62706556, 8.19869525,
+      8.50194761, 8.91017365, 9.0635091, 9.20323319, 9.43371916,
+      9.5879291, 9.62858467, 9.66027575, 9.69077261, 9.75023563,
+      9.82735365, 9.94414048, 10.1180341, 10.1841772, 10.2302142},
+    { // MgH
+      2.2357598, 2.22746378, 2.21749541, 2.20971928, 2.2281095,
+      2.28240641, 2.39768109, 2.53541092, 2.74031112, 2.9482885,
+      3.25018333, 3.54637404, 4.12293766, 4.50709337, 4.9107574,
+      5.09728171, 5.27388215, 5.66981887, 6.0349972, 6.47494352,
+      6.9061874, 7.29909281, 7.72702753, 8.02156385, 8.30117837,
+      8.50001995, 8.69331251, 8.8735004, 9.02862692, 9.16929546,
+      9.22805911, 9.26804345, 9.28551172, 9.30882172, 9.33438244,
+      9.37043398, 9.41271788, 9.43062732, 9.44752211},
+    { // MgO
+      6.62169554, 6.57396601, 6.53178774, 6.39575614, 6.10411021,
+      5.85705722, 5.64078524, 5.48547037, 5.44746842, 5.47809668,
+      5.54153917, 5.61543383, 5.70364142, 5.9912295, 6.22535556,
+      6.49540361, 6.96635549, 7.48517311, 7.68780164, 7.87688146,
+      8.3387234, 8.52341782, 8.73213257, 8.97444246, 9.23426536,
+      9.4692112, 9.64709087, 9.83318972, 9.89623129, 9.93036659,
+      9.93989313, 9.91917519, 9.87742997, 9.83815471, 9.80782281,
+      9.80588241, 9.82229742, 9.8565771, 9.93193216, 9.98130027,
+      10.0001034, 10.0190024},
+    { // AlH
+      4.55751209, 4.5203603, 4.48895424, 4.38590313, 4.1655454,
+      3.9748388, 3.82270926, 3.7237352, 3.71075384, 3.77105384,
+      3.88096185, 4.10222297, 4.3631579, 5.05215449, 5.30596695,
+      5.55965043, 5.78723148, 6.09055104, 6.40524625, 6.70132011,
+      7.02680925, 7.38091385, 7.57433711, 7.76708815, 8.09176227,
+      8.36015208, 8.75810324, 9.1636135, 9.40929584, 9.67614245,
+      9.90912661, 10.130005, 10.210609, 10.2761785, 10.3778541,
+      10.3869137, 10.3789714, 10.3609935, 10.3453552, 10.3404209,
+      10.3450694, 10.3504927},
+    { // AlO
+      8.3900512, 8.29687473, 8.19903917, 7.91745446, 7.31266503,
+      6.77620154, 6.36001828, 6.005954, 5.89493194, 5.88183637,
+      5.88745826, 5.93820815, 6.12949751, 6.39148922, 6.67753628,
+      7.01538582, 7.29645936, 7.55190855, 7.76077459, 7.99162746,
+      8.25176274, 8.56709346, 9.00479214, 9.27034474, 9.54391357,
+      9.88573469, 10.1568318, 10.5726453, 10.7185512, 10.8448572,
+      10.9261724, 10.9617365, 10.9622935, 10.9589742, 10.956773,
+      10.9592333, 10.9697955, 10.9873387, 10.996717, 11.0049267},
+    { // AlF
+      10.2779588, 10.1461233, 10.001449, 9.59588451, 9.20401387,
+      8.71584902, 7.93476519, 7.30362422, 6.97226603, 6.73917755,
+      6.5839712, 6.47857483, 6.40914538, 6.36796425, 6.35776597,
+      6.44668705, 6.62231279, 6.8940791, 7.21816863, 7.50354198,
+      7.77553394, 7.98923376, 8.33265806, 8.59817898, 8.9191371,
+      9.21294225, 9.61301613, 10.1319773, 10.4261482, 10.6988264,
+      10.8830093, 11.0276394, 11.1222859, 11.1939649, 11.232091,
+      11.2617955, 11.2835341, 11.3050394, 11.3239849, 11.3332739,
+      11.3404593},
+    { // Al2
+      4.58061654, 4.56880212, 4.55460893, 4.5230164, 4.48462144,
+      4.48453254, 4.50243399, 4.57898989, 4.79446729, 5.06218544,
+      5.32647887, 5.61596458, 5.91878774, 6.22084522, 6.59260771,
+      6.92624888, 7.16648742, 7.3803605, 7.60613263, 7.78114347,
+      7.96349597, 8.46236535, 8.68498183, 8.92065575, 9.16070099,
+      9.3714044, 9.71755559, 9.91527031, 10.065502, 10.1263336,
+      10.1878581, 10.2190045, 10.2345456, 10.235883, 10.2306947,
+      10.2330445, 10.248257, 10.2836088, 10.3354995, 10.3626055,
+      10.3847824},
+    { // SiH
+      3.65534492, 3.61686498, 3.58207152, 3.47166348, 3.23942936,
+      3.04254116, 2.89555418, 2.81182856, 2.82063187, 2.90828339,
+      3.05830139, 3.30881074, 3.58288551, 4.21723399, 4.55753397,
+      4.95261462, 5.12496593, 5.28652685, 5.64306954, 5.92197992,
+      6.22228646, 6.35797636, 6.50808667, 6.79483931, 7.18062352,
+      7.64517546, 8.0233267, 8.43867407, 8.87539059, 9.39626873,
+      9.55143305, 9.69423694, 10.0043352, 10.1181956, 10.2121876,
+      10.2511425, 10.2854951, 10.3145178, 10.3343915, 10.3502081,
+      10.3609207},
+    { // SiH-
+      -0.00558200441, 0.06280203, 0.160185182, 0.405179578, 0.97335399,
+      1.63533302, 2.25843254, 2.70830842, 3.15465724, 3.61287514,
+      4.05534888, 4.5149461, 4.91742509, 5.25328089, 5.54189748,
+      5.73437705, 5.91251383, 6.42204177, 6.66200362, 6.91531022,
+      7.20801449, 7.50482589, 8.06627717, 8.4353463, 8.75794332,
+      9.04277491, 9.28874548, 9.46798681, 9.61774552, 9.82587088,
+      9.97666405, 10.0914762, 10.206812, 10.4141262, 10.5511335,
+      10.6011581, 10.6328101},
+    { // SiC
+      6.16113667, 6.08056745, 5.99241856, 5.74627379, 5.22998242,
+      4.74721946, 4.41053521, 4.26537227, 4.19051823, 4.16280177,
+      4.16135621, 4.18841673, 4.23864343, 4.42872601, 4.61523567,
+      4.8234363, 4.98195167, 5.18626773, 5.36772945, 5.62934325,
+      5.99244744, 6.29809595, 6.67740401, 7.10895449, 7.5169982,
+      8.05000442, 8.56645446, 9.02817924, 9.40621713, 9.72103325,
+      9.97070616, 10.1874672, 10.4374242, 10.5714207, 10.7760076,
+      10.8516688, 10.9111692, 10.9563485, 10.97429, 10.9871213},
+    { // SiN
+      -0.00619781547, 0.0848609127, 0.196064809, 0.497123293, 1.18897572,
+      1.9186967, 2.62315778, 3.05273275, 3.43021744, 3.94578983,
+      4.33637874, 4.77648307, 5.08009716, 5.52076538, 5.91658657,
+      6.34532803, 6.8089219, 7.07821386, 7.28343107, 7.48924036,
+      7.74785491, 8.07320653, 8.3841724, 8.73341961, 8.99749485,
+      9.26833724, 9.87061374, 10.2371353, 10.4527843, 10.6991881,
+      10.8327558, 10.952217, 11.0044987, 11.0443394, 11.0966593,
+      11.1232398, 11.1347908, 11.1430698},
+    { // SiO
+      11.4050701, 11.2383717, 11.0479872, 10.857527, 10.5291858,
+      10.0299663, 9.40176723, 8.37779721, 7.56648908, 7.12897954,
+      6.80845737, 6.61035669, 6.47626027, 6.38672504, 6.33748232,
+      6.31504783, 6.39896901, 6.57050464, 6.77957844, 7.0546979,
+      7.25666589, 7.46821253, 7.65295611, 7.86199318, 8.00689889,
+      8.1583657, 8.63247719, 8.85848839, 9.07929672, 9.59868913,
+      10.0815564, 10.5801355, 10.950991, 11.2332752, 11.5577168,
+      11.6992033, 11.7906326, 11.8720444, 11.9340131, 11.9839431,
+      12.0202077, 12.023905, 12.0234985, 12.0225173},
+    { // SiF
+      8.07962771, 7.9765097, 7.86075347, 7.54319774, 6.8637572,
+      6.27390768, 5.82038016, 5.58237072, 5.43345627, 5.34506424,
+      5.30430969, 5.30381091, 5.37039194, 5.52586675, 5.73917199,
+      5.98604852, 6.32601237, 6.53739754, 6.74216216, 6.9024416,
+      7.17169276, 7.42937191, 7.76136028, 8.30305963, 9.07397324,
+      9.47369452, 9.80355498, 10.1133486, 10.3327834, 10.5695037,
+      10.7089429, 10.847624, 10.9464754, 10.995877, 11.020666,
+      11.038779, 11.0494543, 11.0562432},
+    { // Si2
+      5.67283853, 5.62347035, 5.56757223, 5.41768102, 5.11227801,
+      4.85177473, 4.68672191, 4.61013792, 4.57573256, 4.60303015,
+      4.71514437, 4.89560583, 5.1035715, 5.35674397, 5.67915871,
+      6.0212193, 6.18859999, 6.36316815, 6.62817059, 6.75174384,
+      6.90811006, 7.24154241, 7.75829011, 8.05515111, 8.36331898,
+      8.94930255, 9.28242481, 9.56780251, 9.74633137, 9.88490355,
+      10.1217942, 10.2624627, 10.429512, 10.50195, 10.584809,
+      10.6558949, 10.7182848, 10.7883335, 10.8156423, 10.84179,
+      10.8671618, 10.8773945, 10.8865496},
+    { // HS
+      4.8480778, 4.80052841, 4.75800072, 4.62131936, 4.32813235,
+      4.06979597, 3.86117673, 3.70870647, 3.66944125, 3.71312218,
+      3.8358872, 4.0495908, 4.33575683, 4.68834859, 5.03798675,
+      5.27548504, 5.50763645, 5.92498456, 6.10034896, 6.26769895,
+      6.50337165, 6.75151007, 7.00614263, 7.2392164, 7.79402208,
+      8.22932001, 8.39711452, 8.58437618, 8.86924334, 9.12994506,
+      9.57983834, 9.79459177, 9.9865452, 10.2762147, 10.3667382,
+      10.4397952, 10.4829323, 10.5165447, 10.5422431, 10.5570489},
+    { // HS-
+      5.5939428, 5.54112159, 5.49440704, 5.34292095, 5.01710444,
+      4.72722685, 4.48921346, 4.30654529, 4.24672026, 4.27533258,
+      4.38641947, 4.58901741, 4.86676743, 5.21629633, 5.56576492,
+      5.80489687, 6.03597791, 6.4520118, 6.62994334, 6.79700316,
+      7.0334826, 7.28160966, 7.54510901, 7.796873, 8.34486858,
+      8.58600102, 8.82519747, 9.17569562, 9.41767897, 9.63120977,
+      10.1034159, 10.2902654, 10.4630909, 10.6816453, 10.7723055,
+      10.8368855, 10.8733596, 10.898731, 10.9174885, 10.9265232},
+    { // CS
+      10.3882486, 10.2442335, 10.0850042, 9.64119637, 9.21596075,
+      8.68098114, 7.80764789, 7.1173015, 6.74835988, 6.49070759,
+      6.32766577, 6.22574743, 6.16792604, 6.14219594, 6.14048203,
+      6.15670543, 6.29377004, 6.38955618, 6.50080311, 6.64878444,
+      6.84658182, 7.05156508, 7.29962408, 7.59318442, 7.99953073,
+      8.40517655, 8.8599424, 9.27843303, 9.73177753, 9.93381768,
+      10.1565925, 10.4138251, 10.8224699, 11.1089356, 11.3729723,
+      11.5447186, 11.7089196, 11.7764055, 11.8412789, 11.8922291,
+      11.928104, 11.9602389, 11.9592782, 11.9568849, 11.9540367},
+    { // NS
+      8.21172874, 8.13215919, 8.05395277, 7.81687091, 7.31086816,
+      6.86347558, 6.48805694, 6.21800693, 6.1002882, 6.09874073,
+      6.15348603, 6.22198935, 6.30335582, 6.5882078, 6.86984942,
+      7.21053674, 7.6064641, 8.03751729, 8.36744193, 8.66938528,
+      8.83712435, 9.00511742, 9.27861575, 9.3915591, 9.52016365,
+      9.72749655, 9.99269485, 10.1795241, 10.3730986, 10.5281687,
+      10.6732894, 10.7759973, 10.8683721, 10.9597839, 11.0264372,
+      11.0802751, 11.1126405, 11.1323182},
+    { // SO
+      8.75191752, 8.65746274, 8.55815815, 8.27034148, 7.65279492,
+      7.09903198, 6.66947776, 6.44855703, 6.30342703, 6.1876143,
+      6.18331753, 6.23498166, 6.45092035, 6.74525976, 7.10320604,
+      7.50232395, 7.83839264, 8.14923187, 8.40053062, 8.76360178,
+      9.13092018, 9.3377033, 9.54727282, 9.82593094, 10.2283955,
+      10.5121181, 10.7740092, 11.0955407, 11.1757046, 11.2418157,
+      11.3343768, 11.3965998, 11.4209509, 11.4292388, 11.4338732},
+    { // MgS
+      0.00238207215, 0.111831201, 0.249359166, 0.610871361, 1.44928421,
+      2.25228945, 3.01696412, 3.82069149, 4.42046677, 4.94085197,
+      5.38257012, 5.71923998, 6.03648506, 6.32765841, 6.62217369,
+      6.94020589, 7.2608651, 7.86589125, 8.14780056, 8.43021608,
+      8.70776098, 8.99845323, 9.28151214, 9.47788178, 9.65472371,
+      9.91894848, 10.1198437, 10.2392794, 10.293207, 10.3513334,
+      10.4015088, 10.4640832, 10.5321321, 10.565205, 10.5905249},
+    { // AlS
+      7.20083446, 7.13896999, 7.07309364, 6.88626833, 6.49533705,
+      6.15690758, 5.91266473, 5.80175512, 5.7278573, 5.66299864,
+      5.68984975, 5.79940311, 5.99598021, 6.24915359, 6.54205696,
+      6.88034921, 7.18412907, 7.45608041, 7.66158329, 7.91606594,
+      8.1121341, 8.33261229, 8.74985904, 9.08714746, 9.38032444,
+      9.68215184, 9.96834445, 10.1927454, 10.4000055, 10.6808687,
+      10.7594872, 10.8329695, 10.9137949, 10.9432478, 10.9717824,
+      11.0246325, 11.0509073, 11.0603063, 11.0702131},
+    { // SiS
+      9.80579039, 9.68077804, 9.53843949, 9.15173633, 8.78368101,
+      8.32046691, 7.57485208, 6.99145705, 6.69867611, 6.47924928,
+      6.32013093, 6.20399599, 6.09500397, 6.11626788, 6.22589475,
+      6.39772807, 6.62666267, 6.89506334, 7.13678047, 7.35378261,
+      7.79989814, 8.00589336, 8.23962355, 8.8079387, 9.54737011,
+      9.96065276, 10.2705073, 10.5775273, 10.8589087, 11.0988374,
+      11.3049531, 11.407725, 11.5085212, 11.5885547, 11.6648426,
+      11.7233054, 11.7431908, 11.7550057},
+    { // S2
+      8.31098143, 8.23796829, 8.16071448, 7.94058475, 7.47326551,
+      7.06552279, 6.75119241, 6.60634612, 6.50151784, 6.38507267,
+      6.3648411, 6.43582365, 6.52599055, 6.64086315, 6.91194447,
+      7.27032109, 7.65208049, 8.03331681, 8.44027949, 8.73539482,
+      9.0037825, 9.34736645, 9.50666603, 9.6708544, 10.2745366,
+      10.5576924, 10.8348663, 11.0296021, 11.1760329, 11.223102,
+      11.2733667, 11.3119655, 11.3392303, 11.3647114, 11.3662026,
+      11.3645462},
+    { // HCl
+      6.23942081, 6.17247833, 6.11090789, 5.91602542, 5.49508682,
+      5.11488366, 4.79806641, 4.53827772, 4.4297727, 4.43259753,
+      4.52768578, 4.75457871, 5.029658, 5.35151837, 5.73523761,
+      6.0740315, 6.50988446, 6.70427697, 6.88384448, 7.34113249,
+      7.60765403, 7.86458983, 8.29754742, 8.67457167, 8.98726357,
+      9.3414393, 9.53750694, 9.73456602, 10.2256817, 10.4084354,
+      10.5780386, 10.7937881, 10.9415492, 11.0172457, 11.0412346,
+      11.054026},
+    { // LiCl
+      7.81513444, 7.73474886, 7.65327913, 7.41020225, 6.8906557,
+      6.43912347, 6.05835368, 5.77500689, 5.66449901, 5.66832253,
+      5.72098798, 5.7969903, 5.9085419, 6.19986009, 6.48111339,
+      6.80110426, 7.17847389, 7.59838191, 8.28898802, 8.48534616,
+      8.68921642, 8.97268154, 9.19707532, 9.69675956, 9.94062175,
+      10.1554426, 10.2210084, 10.2760765, 10.3188911, 10.3666127,
+      10.4861785, 10.5623784, 10.5969325, 10.6231742},
+    { // NaCl
+      7.76639986, 7.69603373, 7.62087016, 7.40602358, 6.95316107,
+      6.53956037, 6.22045276, 5.97163085, 5.84538139, 5.82837728,
+      5.893633, 6.0379901, 6.23815456, 6.45806307, 6.71158549,
+      7.02664526, 7.36123835, 8.01131108, 8.23187202, 8.45549777,
+      8.81277774, 8.95763967, 9.09029478, 9.41984181, 9.5726284,
+      9.73955856, 9.90028973, 10.0111699, 10.0435094, 10.0722458,
+      10.1038583, 10.1505555, 10.2305052, 10.352466, 10.4568499,
+      10.5594305, 10.6500799, 10.7085309},
+    { // AlCl
+      8.71312957, 8.62230274, 8.52264663, 8.24332074, 7.64797472,
+      7.09597083, 6.67810422, 6.4666431, 6.31173121, 6.12955558,
+      6.06481747, 6.09984831, 6.21275844, 6.38242685, 6.58702491,
+      6.81963855, 7.18514452, 7.54769191, 7.69491077, 7.82809632,
+      8.1759301, 8.3921967, 8.60779318, 8.93564106, 9.22717591,
+      9.5548407, 9.84409586, 10.1341462, 10.4694614, 10.6864354,
+      10.7619271, 10.8172017, 10.8476309, 10.8690831, 10.8830285,
+      10.8985547, 10.9128486, 10.9206468, 10.9270722},
+    { // CaH
+      2.60712338, 2.58949002, 2.56573374, 2.51847815, 2.47886902,
+      2.5635183, 2.77452979, 2.99753589, 3.26351645, 3.77915858,
+      3.99362147, 4.21043094, 4.68575878, 4.88545546, 5.06941513,
+      5.39918899, 5.72918713, 6.02376886, 6.30414168, 6.85537461,
+      7.54367451, 7.74366372, 7.94382227, 8.27030789, 8.53130032,
+      8.77561735, 8.96883984, 9.03384301, 9.09697752, 9.16404707,
+      9.23694779, 9.33883711, 9.46074157, 9.61139899, 9.67762096,
+      9.72239296},
+    { // CaF
+      8.36662796, 8.2677118, 8.15915857, 7.85567264, 7.2017246,
+      6.63692256, 6.17516759, 5.95621808, 5.79023312, 5.67434876,
+      5.59254553, 5.51537526, 5.55109421, 5.69058601, 5.90686918,
+      6.18514632, 6.50019785, 6.82737703, 7.16793732, 7.58670435,
+      7.86232375, 8.11249995, 8.3302443, 8.56249226, 8.77268433,
+      8.95964487, 9.16642741, 9.36068731, 9.59840244, 9.73081263,
+      9.7819326, 9.83217033, 9.90609779, 9.99642637, 10.1308888,
+      10.2671075, 10.3634525, 10.4582622, 10.5532956, 10.6134965},
+    { // CaCl
+      7.21223483, 7.14220894, 7.06615857, 6.85233098, 6.39482158,
+      5.98381212, 5.64639971, 5.39573561, 5.27968685, 5.26904675,
+      5.33858205, 5.4897226, 5.6973977, 5.9293071, 6.19308853,
+      6.49221904, 6.82379813, 7.19826995, 7.50617814, 7.86090263,
+      8.21268552, 8.46500155, 8.82112613, 8.96191986, 9.10767912,
+      9.28057069, 9.36018256, 9.42890936, 9.47827082, 9.52721246,
+      9.58629392, 9.6586153, 9.92218283, 10.0129765, 10.1076486,
+      10.2037093, 10.2646621},
+    { // ScO
+      10.4905877, 10.3556394, 10.2026517, 9.78288748, 9.37557516,
+      8.87134261, 8.07778176, 7.43036196, 7.11120118, 6.86226514,
+      6.71061207, 6.60057006, 6.5288894, 6.48714633, 6.48573632,
+      6.60479123, 6.82392971, 7.16626913, 7.55953101, 7.84703741,
+      8.11302918, 8.34564315, 8.62982914, 8.90731727, 9.23239355,
+      9.61725313, 10.0012408, 10.3456254, 10.6360282, 10.9241016,
+      11.1464953, 11.2755805, 11.4084106, 11.5058888, 11.6327748,
+      11.8227186, 11.8807639, 11.9204085},
+    { // TiO
+      10.5003146, 10.3689129, 10.2234611, 9.81821963, 9.42583641,
+      8.93725952, 8.16130686, 7.53149595, 7.21421839, 6.96421677,
+      6.81440823, 6.70566003, 6.63693471, 6.59691473, 6.5920797,
+      6.71493769, 6.93994033, 7.24973264, 7.6153209, 7.93580404,
+      8.24353922, 8.43251138, 8.61568267, 8.79856829, 8.97160026,
+      9.16314556, 9.3703651, 9.62640544, 9.96908073, 10.2664046,
+      10.5470002, 10.8007817, 10.9666033, 11.122325, 11.2808185,
+      11.3960173, 11.5324843, 11.6758517, 11.7895685},
+    { // TiS
+      8.68678721, 8.60217691, 8.50802917, 8.24760655, 7.69460139,
+      7.18689675, 6.79209506, 6.47098719, 6.31238561, 6.28589385,
+      6.35123515, 6.49019022, 6.6813019, 6.89369552, 7.13196888,
+      7.64623833, 7.89557734, 8.14487697, 8.29239993, 8.44084581,
+      8.59987675, 8.79239659, 8.96206967, 9.15480733, 9.38507733,
+      9.72588298, 9.98945674, 10.239311, 10.4821692, 10.6489163,
+      10.8378517, 10.9336067, 11.0438992, 11.1865548, 11.343164,
+      11.518246, 11.5747329, 11.6107492},
+    { // VO
+      9.64981341, 9.52535447, 9.37906053, 8.98947488, 8.61418762,
+      8.15314537, 7.43311562, 6.86905943, 6.57074795, 6.37609442,
+      6.24926742, 6.17950587, 6.14929176, 6.14439251, 6.1957105,
+      6.35569957, 6.56900311, 6.86109079, 7.18741003, 7.55461518,
+      7.84951589, 8.04638394, 8.29440977, 8.49253491, 8.71472178,
+      8.97188093, 9.24307268, 9.52150899, 9.88774181, 10.2561595,
+      10.5833087, 10.9832795, 11.3009506, 11.5276682, 11.7021265,
+      11.8641392, 11.9646919, 12.0658131, 12.1686452, 12.2102927,
+      12.2360386},
+    { // CrH
+      3.20395078, 3.17845904, 3.14287179, 3.06964365, 2.98627063,
+      3.04927162, 3.26487026, 3.50807355, 3.8019408, 4.10840036,
+      4.39885908, 4.86003497, 5.27048165, 5.5688259, 5.82794794,
+      6.10614299, 6.36043504, 6.63707996, 6.9105933, 7.43127692,
+      8.20840089, 8.45606902, 8.68460796, 8.9275229, 9.13918531,
+      9.25384187, 9.36043516, 9.5380984, 9.62961795, 9.71912292,
+      9.77534414, 9.82799906, 9.88766509, 9.94648659, 10.0588603,
+      10.1271833, 10.155401, 10.1762401},
+    { // CrO
+      7.49861218, 7.42399273, 7.34298944, 7.11551312, 6.63457156,
+      6.2338669, 5.93024363, 5.78349311, 5.70196, 5.66488287,
+      5.66043549, 5.70341655, 5.80082744, 6.03949301, 6.32435171,
+      6.72141626, 7.16312926, 7.46760355, 7.74620777, 8.35776014,
+      8.62666988, 8.92629722, 9.33566775, 9.50098247, 9.68129773,
+      9.84458953, 9.99421774, 10.1174507, 10.220199, 10.3261853,
+      10.4265671, 10.5171237, 10.6242742, 10.7627549, 10.9828505,
+      11.1703146, 11.2625968, 11.2962315, 11.323826},
+    { // FeH
+      3.46389011, 3.44635534, 3.42232317, 3.38264415, 3.37001436,
+      3.39504808, 3.47014356, 3.59668523, 3.76882129, 3.98297317,
+      4.22204452, 4.50140466, 5.08857805, 5.30016142, 5.53983246,
+      5.93341811, 6.23220946, 6.51046248, 6.86288403, 7.13021965,
+      7.40658053, 7.76491382, 8.09544191, 8.2737914, 8.44316615,
+      8.72502011, 8.85200099, 8.98302212, 9.13347947, 9.26869999,
+      9.44105374, 9.50576622, 9.55330331, 9.58870558, 9.61164151,
+      9.64437699, 9.67761811, 9.78602272, 9.86123365, 9.89843645,
+      9.92325185},
+    { // FeO
+      7.40379841, 7.33332003, 7.25696646, 7.04295762, 6.59297984,
+      6.22608381, 5.94986251, 5.82095047, 5.75390759, 5.72837945,
+      5.73255619, 5.78996001, 5.90409876, 6.15272729, 6.45319264,
+      6.85319206, 7.30610066, 7.59581595, 7.87720726, 8.11432503,
+      8.4041297, 8.88072439, 9.10723049, 9.34604221, 9.59444644,
+      9.88914312, 10.1358169, 10.3827996, 10.5282107, 10.6530519,
+      10.7708705, 10.8669227, 11.0374122, 11.1745495, 11.3842872,
+      11.4896332, 11.5362944, 11.5661305},
+    { // YO
+      10.9075828, 10.7651242, 10.6035792, 10.1600702, 9.7292587,
+      9.19695938, 8.35836741, 7.65513306, 7.30888856, 7.03889303,
+      6.84937567, 6.70699893, 6.5368547, 6.51146447, 6.61336235,
+      6.81377307, 7.10274025, 7.43265316, 7.74348994, 8.05784603,
+      8.32022312, 8.61341634, 9.07079648, 9.30805077, 9.53622302,
+      9.82899185, 10.1125802, 10.3287376, 10.5277678, 10.8023557,
+      10.9985334, 11.073909, 11.1429133, 11.3117879, 11.3953364,
+      11.490075, 11.7226037, 11.8220764, 11.8597608, 11.8821384},
+    { // ZrO
+      11.8657231, 11.7119681, 11.5416539, 11.0650658, 10.6025855,
+      10.0272577, 9.10998448, 8.33701308, 7.95221784, 7.64476546,
+      7.43415793, 7.26930835, 7.14206394, 7.0534205, 6.98976619,
+      7.00963461, 7.06810454, 7.25037701, 7.53225414, 7.86629697,
+      8.18070207, 8.50526139, 8.78014153, 9.16095232, 9.63997957,
+      9.90110083, 10.1396734, 10.4658557, 10.5711706, 10.6760831,
+      10.7682219, 10.843663, 10.9703048, 11.0662157, 11.1713481,
+      11.3542903, 11.5601914, 11.7014817, 11.7553587, 11.7874862},
+    { // LaO
+      11.8641006, 11.6988888, 11.5102044, 11.3214462, 10.9960375,
+      10.4974215, 9.87730057, 8.88370948, 8.05693711, 7.64241038,
+      7.3175902, 7.07866561, 6.89245543, 6.75506249, 6.65932558,
+      6.59428165, 6.66117597, 6.82962855, 7.08869355, 7.39413882,
+      7.71317262, 8.04654952, 8.29997958, 8.58208436, 8.8023526,
+      9.06199698, 9.41521892, 9.74682871, 10.2547038, 10.617467,
+      10.773127, 10.9397263, 11.1911315, 11.4177917, 11.8075794,
+      11.9260665, 11.967918, 11.9938538}
+  };
+
+  /* --- NEGION tables --- */
+  static const int NNEG = 7, NTQN = 14;
+
+  static const int NEGZ[NNEG] = {1, 6, 8, 9, 14, 16, 17}; // H- C- O- F- Si- S- Cl-
+
+  static const int MTQN[NNEG] = {2, 11, 14, 2, 14, 13, 2};
+
+  static const double TQN[NNEG][NTQN] = {
+    {-0.999999993529, 4.0},
+    {-0.999999993529, 1.525599978474, 2.651200090844, 3.068100141729, 3.226999955268, 3.385099991304, 3.54019996214, 3.686999996896, 3.800200182895, 3.904799977325, 4.0},
+    {-0.999999993529, 0.593600025261, 1.294199953625, 1.553499944587, 1.796599952393, 1.944000048931, 2.095699919825, 2.317899934571, 2.554199949293, 2.748599991156, 2.927100074615, 3.424799962155, 3.799400175128, 4.0},
+    {-0.999999993529, 4.0},
+    {-0.999999993529, 1.461700027344, 2.557999941888, 2.964800028584, 3.119799876818, 3.277800164079, 3.422000038438, 3.498999966735, 3.576999999319, 3.691600033946, 3.829999926729, 3.931199850937, 3.973199857309, 4.0},
+    {-0.999999993529, 0.84480002646, 1.660300085079, 1.953300060737, 2.227700014231, 2.367499892458, 2.509300000613, 2.885400108161, 3.072500129387, 3.247699949829, 3.753500070131, 3.90360000804, 4.0},
+    {-0.999999993529, 4.0}
+  };
+
+  static const double QN[NNEG][NTQN+1] = {
+    {0.0, 0.0, -0.7542},
+    {0.602059991, 0.602059991, 0.602059991, 0.602065454, 0.602289485, 0.605084791, 0.619452167, 0.656276557, 0.702664478, 0.755240436, 0.806182861, -1.262},
+    {0.602059991, 0.602059991, 0.602060513, 0.602235198, 0.605755401, 0.613868967, 0.629318181, 0.661565642, 0.697424435, 0.72177434, 0.738756672, 0.764722428, 0.772376824, 0.774494613, -1.46},
+    {0.0, 0.0, -3.4011},
+    {0.602059991, 0.602059991, 0.602059991, 0.602081178, 0.602612605, 0.607739466, 0.627640471, 0.649433587, 0.681270625, 0.744441879, 0.836538833, 0.90567089, 0.93333297, 0.950480774, -1.389},
+    {0.602059991, 0.602059991, 0.602060045, 0.602153895, 0.605580586, 0.61290325, 0.626569786, 0.682012696, 0.70843161, 0.728330454, 0.76110377, 0.765938688, 0.768312725, -2.077},
+    {0.0, 0.0, -3.617}
+  };
+
+}
+
+#endif
@@ -12,6 +12,7 @@
    
    --- */
 #include <cmath>
+#include <cstddef>
 #include "physical_consts.h"
 
 namespace pfn{  
@@ -618,7 +619,8 @@ namespace pfn{
   };
 
 
-  template <class Ft> int partition_f(int IEL, Ft TT, Ft XNELEC, Ft XNATOM, Ft *POTI, Ft *FRCT, bool scalPot = false)
+  template <class Ft> int partition_f(int IEL, Ft TT, Ft XNELEC, Ft XNATOM, Ft *POTI, Ft *FRCT, bool scalPot = false,
+					  Ft *TVEFF = NULL)
     {
       const int IONSIZ = 6;
       Ft IP[IONSIZ], PART[IONSIZ], POTLO[IONSIZ];
@@ -708,6 +710,11 @@ namespace pfn{
 	else        POTI[ii] = IP[ii];
 	//	printf("[%d] PF=%e, ION=%e\n", ii, FRCT[ii], POTI[ii]);
       }
+
+      /* --- XSAHA keeps using the (possibly clipped) kT of the 
+	 partition-function loop in the Saha equation --- */
+      
+      if(TVEFF) *TVEFF = TV;
       
       return (int)NIONS;
     }
@@ -0,0 +1,1629 @@
+/* ----
+   Native C++ port of N. Piskunov's EOS. See piskunov.h.
+
+   Modifications:
+           2026-10-18: Created.
+   ---- */
+#include <iostream>
+#include <cmath>
+#include <cstring>
+#include <cstdio>
+#include <algorithm>
+#include <fstream>
+#include <string>
+#include <cctype>
+//
+#include "piskunov.h"
+#include "partition.h"
+#include "molecules.h"
+#include "cop.h"
+//
+using namespace std;
+
+/* --- Constants as defined in the fortran version --- */
+
+static const double kBol = 1.38065E-16, amu = 1.66053886E-24, hmass = 1.66053E-24, amulog = -23.779751;
+
+
+/* --- Atomic data --- */
+
+const double eos::piskunov::AMASS[MAX_ELEM]=
+  {1.008,  4.003,  6.941,  9.012, 10.811, 12.011, 14.007, 15.999,
+   18.998, 20.179, 22.990, 24.305, 26.982, 28.086, 30.974, 32.060,
+   35.453, 39.948, 39.102, 40.080, 44.956, 47.900, 50.941, 51.996,
+   54.938, 55.847, 58.933, 58.710, 63.546, 65.370, 69.720, 72.590,
+   74.922, 78.960, 79.904, 83.800, 85.468, 87.620, 88.906, 91.220,
+   92.906, 95.940, 98.906,101.070,102.905,106.400,107.868,112.400,
+   114.820,118.690,121.750,127.600,126.905,131.300,132.905,137.340,
+   138.906,140.120,140.908,144.240,146.000,150.400,151.960,157.250,
+   158.925,162.500,164.930,167.260,168.934,170.040,174.970,178.490,
+   180.948,183.850,186.200,190.200,192.200,195.090,196.967,200.590,
+   204.370,207.190,208.981,210.000,210.000,222.000,223.000,226.025,
+   227.000,232.038,230.040,238.029,237.048,242.000,242.000,245.000,
+   248.000,252.000,253.000};
+
+const char eos::piskunov::ELEMEN[MAX_ELEM][3]=
+  {"H ",  "He",  "Li",  "Be",  "B ",  "C ",  "N ",  "O ",  "F ",  "Ne",
+   "Na",  "Mg",  "Al",  "Si",  "P ",  "S ",  "Cl",  "Ar",  "K ",  "Ca",
+   "Sc",  "Ti",  "V ",  "Cr",  "Mn",  "Fe",  "Co",  "Ni",  "Cu",  "Zn",
+   "Ga",  "Ge",  "As",  "Se",  "Br",  "Kr",  "Rb",  "Sr",  "Y ",  "Zr",
+   "Nb",  "Mo",  "Tc",  "Ru",  "Rh",  "Pd",  "Ag",  "Cd",  "In",  "Sn",
+   "Sb",  "Te",  "I ",  "Xe",  "Cs",  "Ba",  "La",  "Ce",  "Pr",  "Nd",
+   "Pm",  "Sm",  "Eu",  "Gd",  "Tb",  "Dy",  "Ho",  "Er",  "Tm",  "Yb",
+   "Lu",  "Hf",  "Ta",  "W ",  "Re",  "Os",  "Ir",  "Pt",  "Au",  "Hg",
+   "Tl",  "Pb",  "Bi",  "Po",  "At",  "Rn",  "Fr",  "Ra",  "Ac",  "Th",
+   "Pa",  "U ",  "Np",  "Pu",  "Am",  "Cm",  "Bk",  "Cf",  "Es"};
+
+const float eos::piskunov::ABUND_default[MAX_ELEM] =
+  {-0.04048,-1.07,-10.95,-10.89, -9.44, -3.48, -3.99,
+   -3.11, -7.48, -3.95,  -5.71, -4.46, -5.57, -4.49, -6.59, -4.83,
+   -6.54, -5.48, -6.82,  -5.68, -8.94, -7.05, -8.04, -6.37, -6.65,
+   -4.50, -7.12, -5.79,  -7.83, -7.44, -9.16, -8.63, -9.67, -8.69,
+   -9.41, -8.81, -9.44,  -9.14, -9.80, -9.54,-10.62,-10.12,-20.00,
+   -10.20,-10.92,-10.35, -11.10,-10.18,-10.58,-10.04,-11.04, -9.80,
+   -10.53, -9.81,-10.92,  -9.91,-10.82,-10.49,-11.33,-10.54,-20.00,
+   -11.04,-11.53,-10.92, -11.94,-10.94,-11.78,-11.11,-12.04,-10.96,
+   -11.28,-11.16,-11.91, -10.93,-11.77,-10.59,-10.69,-10.24,-11.03,
+   -10.95,-11.14,-10.19, -11.33,-20.00,-20.00,-20.00,-20.00,-20.00,
+   -20.00,-11.92,-20.00, -12.51,-20.00,-20.00,-20.00,-20.00,-20.00,
+   -20.00,-20.00};
+
+
+/* --- Default species list (DEFAULT.EOS.current) --- */
+
+static const int NDEF = 57;
+static const char *DEFAULT_SPECIES[NDEF] =
+  {"H" ,"H+",
+   "He","He+","He++",
+   "C" ,"C+" ,"C++" ,"N" ,"N+" ,"N++",
+   "O" ,"O+" ,"O++" ,
+   "Na","Na+","Na++","Mg","Mg+","Mg++",
+   "Si","Si+","Si++","P" ,"P+" ,"P++" ,"S" ,"S+" ,"S++",
+   "Cl","Cl+","Cl++","K" ,"K+" ,"K++",
+   "Ca","Ca+","Ca++","Ti","Ti+","Ti++",
+   "Mn","Mn+","Mn++","Fe","Fe+","Fe++",
+   "H2","CO","OH","CH","H2+",
+   "H-","C-","O-","Si-","Cl-"};
+
+
+/* --- Molecular anions treated with NEGION, and the atom they refer to --- */
+
+static const int NMOLNEG = 7;
+static const char *MOLNEG_NAME[NMOLNEG] = {"H2-", "CH-", "C2-", "CN-", "OH-", "SiH-", "HS-"};
+static const int   MOLNEG_Z[NMOLNEG]    = {   1,     6,     6,     6,     8,     14,    16};
+
+
+/* --- Helpers --- */
+
+inline string elname(int iel)
+{
+  return string(eos::piskunov::ELEMEN[iel], (eos::piskunov::ELEMEN[iel][1] == ' ') ? 1 : 2);
+}
+
+inline double ipow(double x, int n)
+{
+  double res = 1.0;
+  if(n < 0) x = 1.0 / x, n = -n;
+  for(int ii=0; ii<n; ii++) res *= x;
+  return res;
+}
+
+/* --- Natural cubic spline (SPL_INIT / SPL_INTERP) --- */
+
+static void spl_init(const double *x, const double *y, double *y2, int n)
+{
+  vector<double> u(n, 0.0);
+  y2[0] = 0.0;
+
+  for(int ii=1; ii<n-1; ii++){
+    double sig = (x[ii]-x[ii-1]) / (x[ii+1]-x[ii-1]);
+    double p = sig * y2[ii-1] + 2.0;
+    y2[ii] = (sig - 1.0) / p;
+    u[ii] = (6.0*((y[ii+1]-y[ii])/(x[ii+1]-x[ii])-(y[ii]-y[ii-1])/
+		  (x[ii]-x[ii-1]))/(x[ii+1]-x[ii-1])-sig*u[ii-1])/p;
+  }
+  y2[n-1] = 0.0;
+  for(int ii=n-2; ii>=0; ii--) y2[ii] = y2[ii]*y2[ii+1] + u[ii];
+}
+
+static double spl_interp(const double *xa, const double *ya, const double *y2a, int n, double x)
+{
+  int klo = 0, khi = n-1;
+  while((khi-klo) > 1){
+    int ii = (klo+khi)/2;
+    if(xa[ii] > x) khi = ii;
+    else           klo = ii;
+  }
+
+  double h = xa[khi] - xa[klo];
+  double a = (xa[khi] - x) / h, b = (x - xa[klo]) / h;
+
+  return a*ya[klo] + b*ya[khi] + ((a*a-1.0)*a*y2a[klo] + (b*b-1.0)*b*y2a[khi]) * (h*h) / 6.0;
+}
+
+
+// -------------------------------------------------------------------------
+// Constructors
+// -------------------------------------------------------------------------
+
+eos::piskunov::piskunov(double grav): eoswrap()
+{
+  gravity = pow(10.0, grav);
+  tol = 1.e-8, tol1 = 1.e-6, rhoest = 0.0;
+  warm.on = false, warm.valid = false, thread_safe = true;
+
+  vector<iabund> modABUND;
+  initAbundances(modABUND);
+
+  initTables();
+
+  vector<line_t> lines;
+  initEOS(lines);
+
+  unique();
+}
+
+eos::piskunov::piskunov(vector<line_t> &lines, std::string &abfile, double grav): eoswrap()
+{
+  gravity = pow(10.0, grav);
+  tol = 1.e-8, tol1 = 1.e-6, rhoest = 0.0;
+  warm.on = false, warm.valid = false, thread_safe = true;
+
+  readAbund(abfile);
+
+  initTables();
+
+  initEOS(lines);
+
+  unique();
+}
+
+// -------------------------------------------------------------------------
+// Abundances
+// -------------------------------------------------------------------------
+
+void eos::piskunov::initAbundances(vector<iabund> &ab, bool verbose)
+{
+
+  /* --- Init default abundances --- */
+
+  for(int ii=0; ii<MAX_ELEM; ii++) abund_d[ii] = pow(10.0, (double)ABUND_default[ii]);
+
+
+  /* --- replace abunds --- */
+
+  for(auto &it: ab){
+    for(int ii=0; ii<MAX_ELEM; ii++){
+      if(!strcmp(ELEMEN[ii], it.elem)){
+	abund_d[ii] = pow(10., (double)it.abund);
+	if(verbose) fprintf(stderr, "piskunov::initAbundances: Changed [%s] -> %7.3f\n", it.elem, it.abund);
+	break;
+      }
+    } // ii
+  } // it
+
+
+  /* --- Normalize --- */
+
+  double sum = 0.0;
+  for(int ii = 0; ii<MAX_ELEM; ii++) sum += abund_d[ii];
+  for(int ii = 0; ii<MAX_ELEM; ii++){
+    abund_d[ii] /= sum;
+    ABUND[ii] = (float)abund_d[ii];
+  }
+  totalAbund = 1.0;
+  this->tABUND = 1.0;
+
+
+  /* --- Average molecular weight --- */
+
+  wsum = 0, asum = 0;
+  for(int ii = 0; ii<MAX_ELEM; ii++){
+    wsum += AMASS[ii] * abund_d[ii];
+    asum += abund_d[ii];
+  }
+  avmol = wsum / asum;
+}
+
+void eos::piskunov::readAbund(std::string file)
+{
+
+  /* --- Open file and read abundances --- */
+
+  std::vector<iabund> ab;
+  iabund ia;
+
+  std::ifstream in(file, std::ios::in | std::ios::binary);
+  std::string iline;
+  if(in){
+    while (std::getline(in, iline)) {
+
+      if(iline[0] == '#' || iline == "") continue;
+      iline.erase(0,2); // Remove dummy spaces
+      int n = iline.find(" ");
+      sscanf(iline.substr(0, n).c_str(), "%2s", ia.elem);
+
+      if(ia.elem[1] != '\0' && ia.elem[1] != ' ') ia.elem[1] = tolower(ia.elem[1]);
+      else ia.elem[1] = ' ';
+      ia.elem[2] = '\0';
+
+      ia.abund = atof(iline.substr(n+1).c_str()) - 12.0;
+      ab.push_back(ia);
+    }//while
+  }else
+    fprintf(stderr,"piskunov::readAbund: WARNING: file [%s] not found, using default abundance values\n",
+	    file.c_str());
+
+  /* --- Update abundances --- */
+
+  initAbundances(ab, false);
+}
+
+// -------------------------------------------------------------------------
+// Second derivatives of the splines of KP_Q_SPLN and NEGION
+// -------------------------------------------------------------------------
+
+void eos::piskunov::initTables()
+{
+  q2b.resize(molec::NBARK*molec::NTQ), k2b.resize(molec::NBARK*molec::NTK);
+  q2n.resize(molec::NNEG*molec::NTQN);
+
+  for(int ii=0; ii<molec::NBARK; ii++){
+    spl_init(molec::TQ[ii], molec::Q[ii], &q2b[ii*molec::NTQ], molec::MTQ[ii]);
+    spl_init(molec::TK[ii], molec::K[ii], &k2b[ii*molec::NTK], molec::MTK[ii]);
+  }
+
+  for(int ii=0; ii<molec::NNEG; ii++)
+    spl_init(molec::TQN[ii], molec::QN[ii], &q2n[ii*molec::NTQN], molec::MTQN[ii]);
+}
+
+// -------------------------------------------------------------------------
+// MPARSE: atomic constituents, multiplicity and charge of a species name
+// -------------------------------------------------------------------------
+
+int eos::piskunov::mparse(const string &name, int &nel, int &nch, int *zat, int *nat)const
+{
+  size_t i1 = 0, n = name.size();
+  nel = 0, nch = 0;
+
+  for(int jj=0; jj<4; jj++){
+    if(i1 >= n) return 1;
+
+    size_t len = (((i1+1) < n) && (name[i1+1] >= 'a') && (name[i1+1] <= 'z')) ? 2 : 1;
+    string tmp = name.substr(i1, len);
+
+    int iel = -1;
+    for(int ii=0; ii<MAX_ELEM; ii++)
+      if(tmp == elname(ii)){
+	iel = ii;
+	break;
+      }
+    if(iel < 0) return 1;
+
+    zat[nel] = iel+1, nat[nel] = 1;
+    nel++, i1 += len;
+
+    if(i1 < n && name[i1] >= '1' && name[i1] <= '5'){
+      nat[nel-1] = name[i1] - '0';
+      i1++;
+    }
+
+    if(i1 >= n) return 0;
+    if(name[i1] == '-'){
+      nch = -1;
+      return 0;
+    }
+    if(name[i1] == '+'){
+      nch = 1;
+      while((++i1 < n) && (name[i1] == '+') && (nch < IONSIZ)) nch++;
+      return 0;
+    }
+  }
+
+  return 0;
+}
+
+string eos::piskunov::mbuild(const string &name, int charge)const
+{
+  if(charge < 0) return name + "-";
+  return name + string(charge, '+');
+}
+
+int eos::piskunov::llength(const string &name)const
+{
+  int nel, nch, zat[4], nat[4], res = 0;
+  mparse(name, nel, nch, zat, nat);
+
+  for(int ii=0; ii<nel; ii++) res += zat[ii]*10 + 10000*nat[ii];
+
+  if(nch > 0)      res += nch;
+  else if(nch < 0) res += 9;
+
+  return res;
+}
+
+// -------------------------------------------------------------------------
+// EQLIST: merge default list with the user species and sort it
+// -------------------------------------------------------------------------
+
+int eos::piskunov::eqlist(vector<string> &names)
+{
+  string inam = "piskunov::eqlist: ";
+  vector<string> lst(DEFAULT_SPECIES, DEFAULT_SPECIES + NDEF);
+  int nel, nch, zat[4], nat[4];
+
+
+  /* --- Add species of the line list. Atoms come with all their ions --- */
+
+  for(int ii=0; ii<(int)names.size(); ii++){
+    string chname = mbuild(names[ii], ion[ii]-1);
+    if(std::find(lst.begin(), lst.end(), chname) != lst.end()) continue;
+
+    const string &nam = names[ii];
+    bool isatom = ((nam.size() == 1) || ((nam.size() == 2) && (nam[1] >= 'a') && (nam[1] <= 'z')));
+
+    if(isatom && (ion[ii] > 0)){
+      int iel = -1;
+      for(int jj=0; jj<MAX_ELEM; jj++) if(nam == elname(jj)) iel = jj;
+      if(iel < 0) return 1;
+
+      int maxion = pfn::nLev[iel];
+      if(maxion < ion[ii]){
+	cerr << inam << "ERROR, no partition function for "<<chname<<endl;
+	return 3;
+      }
+      for(int jj=0; jj<maxion; jj++) lst.push_back(mbuild(nam, jj));
+    }else lst.push_back(chname);
+  }
+
+
+  /* --- The fortran version assumes that all atoms that form a
+     species are in the list. Make sure of it --- */
+
+  for(int ii=0, nn=(int)lst.size(); ii<nn; ii++){
+    if(mparse(lst[ii], nel, nch, zat, nat)) return 1;
+    for(int jj=0; jj<nel; jj++){
+      string aname = elname(zat[jj]-1);
+      if(std::find(lst.begin(), lst.end(), aname) == lst.end()) lst.push_back(aname);
+    }
+  }
+
+
+  /* --- Sort (SORT2) and remove duplicates --- */
+
+  vector<pair<int,string>> srt;
+  for(auto &it: lst) srt.push_back(make_pair(llength(it), it));
+  std::sort(srt.begin(), srt.end());
+  srt.erase(std::unique(srt.begin(), srt.end()), srt.end());
+
+
+  /* --- Fill the species structures --- */
+
+  nlist = (int)srt.size() + 1; // Last one is e-
+  splist.resize(nlist-1);
+  indzat.resize(MAX_ELEM+1, -1);
+  iatom.clear(), indsp.clear();
+
+  for(int ii=0; ii<nlist-1; ii++){
+    species_t &sp = splist[ii];
+    sp.name = srt[ii].second;
+    mparse(sp.name, sp.nel, sp.nch, sp.zat, sp.nat);
+    sp.imol = -1, sp.ibark = -1, sp.ineg = -1;
+    sp.ntot = 0, sp.awt = 0.0, sp.ratiom = 0.0;
+
+    for(int jj=0; jj<sp.nel; jj++){
+      sp.ntot += sp.nat[jj];
+      sp.awt += sp.nat[jj] * AMASS[sp.zat[jj]-1];
+      sp.ratiom += sp.nat[jj] * log10(AMASS[sp.zat[jj]-1]);
+    }
+    sp.ratiom += -log10(sp.awt) + (sp.ntot-1)*amulog;
+
+    if(sp.nel == 1 && sp.nat[0] == 1){
+      sp.type = ((sp.nch == 0) ? 1 : 3);
+
+      if(sp.type == 1){
+	indzat[sp.zat[0]] = (int)iatom.size();
+	iatom.push_back(sp.zat[0]);
+	indsp.push_back(ii);
+      }else if(sp.nch < 0){
+	for(int jj=0; jj<molec::NNEG; jj++) if(molec::NEGZ[jj] == sp.zat[0]) sp.ineg = jj;
+      }
+    }else{
+      sp.type = 2;
+      for(int jj=0; jj<molec::NMOL; jj++)  if(sp.name == molec::MOLNAME[jj])  sp.imol = jj;
+      for(int jj=0; jj<molec::NBARK; jj++) if(sp.name == molec::BARKNAME[jj]) sp.ibark = jj;
+
+      /* --- Barklem's data are not used for CN --- */
+
+      if(sp.name == "CN") sp.ibark = -1;
+      if(sp.imol < 0) cerr << inam << "WARNING, no dissociation constant for molecule "<<sp.name<<endl;
+    }
+  } // ii
+
+  jatom = (int)iatom.size();
+  for(auto &sp: splist)
+    for(int jj=0; jj<sp.nel; jj++) sp.jat[jj] = indzat[sp.zat[jj]];
+
+
+  /* --- Index of each user species in the list --- */
+
+  idxspec.resize(names.size());
+  for(int ii=0; ii<(int)names.size(); ii++){
+    string chname = mbuild(names[ii], ion[ii]-1);
+    idxspec[ii] = -1;
+    for(int jj=0; jj<nlist-1; jj++)
+      if(splist[jj].name == chname){
+	idxspec[ii] = jj;
+	break;
+      }
+    if(idxspec[ii] < 0) return 1;
+  }
+
+  return 0;
+}
+
+// -------------------------------------------------------------------------
+// Init list of species
+// -------------------------------------------------------------------------
+
+void eos::piskunov::initEOS(vector<line_t> &lines)
+{
+  const string inam = "piskunov::initEOS: ";
+
+
+  /* --- Background absorbers, same as in ceos --- */
+
+  species = {"H",   "H",     "H",     "He",   "He",   "He",
+	     "C",    "Al",   "Si",    "Si",    "Ca",   "Ca",
+	     "Mg",   "Mg",   "N",     "Fe",   "O"};
+
+  ion = { 1, 2, 0, 1, 2, 3,
+	  1, 1, 1, 2, 1, 2,
+	  1, 2, 1, 1, 1};
+
+
+  /* --- Add external line list --- */
+
+  int kk = (int)species.size();
+  for(auto &it: lines){
+    string nam(it.elem);
+    nam.erase(nam.find_last_not_of(' ')+1);
+    species.push_back(nam);
+    ion.push_back(it.ion);
+    it.off = kk++;
+  }
+
+
+  /* --- Indexes of the background absorbers (start at 1, as in ceos) --- */
+
+  IXH1  = 1,  IXH2  = 2, IXHMIN = 3, IXHE1 = 4,  IXHE2 = 5,  IXHE3 = 6, IXC1 = 7;
+  IXAL1 = 8,  IXSI1 = 9, IXSI2  = 10, IXCA1 = 11, IXCA2 = 12, IXMG1 = 13;
+  IXMG2 = 14, IXN1 = 15, IXFE1 = 16, IXO1 = 17;
+
+
+  /* --- Build species list --- */
+
+  switch(eqlist(species))
+    {
+    case 0: break;
+    case 1:
+      cerr << inam <<"ERROR, found ilegal species name"<<endl;
+      exit(0);
+    default:
+      cerr << inam <<"ERROR, cannot build the list of species"<<endl;
+      exit(0);
+    }
+  ntotallist = nlist;
+  nspec = nlist;
+
+
+  /* --- Allocate work arrays --- */
+
+  int neq = jatom + 1;
+
+  fract.resize(nlist, 0.0), pf.resize(nlist, 1.0), xamass.resize(nlist, 0.0);
+  it.resize(nlist), kt.resize(nlist), part.resize(nlist), potion.resize(nlist);
+  pp.resize(nlist), xnpf.resize(nlist), pfunc.resize(nlist);
+
+  P.resize(neq), B.resize(neq), A.resize(neq*neq), AA.resize(neq*neq);
+  rs.resize(neq), cs.resize(neq), sol.resize(neq), res.resize(neq), ipiv.resize(neq), rnf.resize(MAX_ELEM+1);
+  spf.resize(jatom*IONSIZ), sfr.resize(jatom*IONSIZ), spot.resize(jatom*IONSIZ);
+  warm.P.resize(jatom);
+
+  for(int ii=0; ii<nlist-1; ii++) xamass[ii] = splist[ii].awt;
+}
+
+// -------------------------------------------------------------------------
+// Unique species in line list of the EOS (same as in ceos)
+// -------------------------------------------------------------------------
+
+void eos::piskunov::unique(void)
+{
+  vector<string> bla  = species;
+  for(int ii=0; ii<(int)species.size();ii++) bla[ii] += std::to_string(ion[ii]);
+
+  idx.resize(bla.size());
+  idx1.clear();
+  uspec.resize(0);
+
+  for(int jj = 0; jj< (int)bla.size(); jj++){
+    bool isin = false;
+
+    for(int ii=0; ii<(int)uspec.size();ii++){
+      if(bla[jj] == uspec[ii]) {
+	isin = true;
+	idx[jj] = ii;
+	break;
+      }
+    }
+
+    if(!isin) {
+      uspec.push_back(bla[jj]);
+      idx[jj] = uspec.size()-1;
+      idx1.push_back(jj);
+    }
+  }
+}
+
+void eos::piskunov::store_partial_pressures(int ndep, int k, double na, double ne)
+{
+  int nuspec = (int)uspec.size();
+
+  /* --- always init the buffer if (k == 0) --- */
+
+  if(k == 0) buf.set({ndep, nuspec + 1, 2});
+
+  for(int ii = 0; ii<nuspec; ii++){
+    buf(k,ii,0) = fract[idxspec[idx1[ii]]];
+    buf(k,ii,1) = pf[idxspec[idx1[ii]]];
+  }
+
+  buf(k,nuspec,0) = na;
+  buf(k,nuspec,1) = ne;
+}
+
+void eos::piskunov::read_partial_pressures(int k, vector<double> &frac, vector<double> &part_o, double &xa, double &xe)
+{
+  int ndep = (int)buf.size(0);
+
+  if(k >= ndep){
+    cerr << "piskunov::read_partial_pressures: ERROR, ndep["<<ndep<<"] <= k["<<k<<"]"<<endl;
+    return;
+  }
+
+  int nsp = (int)idx.size();
+  int nuspec = (int)buf.size(1);
+
+  frac.resize(nsp);
+  part_o.resize(nsp);
+
+  for(int ii=0;ii<nsp;ii++){
+    frac[ii]   = buf(k,idx[ii], 0);
+    part_o[ii] = buf(k,idx[ii], 1);
+  }
+
+  xa = buf(k,nuspec-1, 0);
+  xe = buf(k,nuspec-1, 1);
+}
+
+// -------------------------------------------------------------------------
+// XSAHA: partition functions (mode 3), ionization fractions (mode 2)
+// or fractions divided by the partition function (mode 1). iel starts at 1.
+// -------------------------------------------------------------------------
+
+int eos::piskunov::xsaha(int iel, double t, double xne_i, double xna_i, double *poti, double *frct, int mode)const
+{
+  if(mode == 5) return pfn::nLev[iel-1];
+
+  double prt[IONSIZ], fff[IONSIZ], tv = 0.0;
+  int nions = pfn::partition_f<double>(iel-1, t, xne_i, xna_i, poti, prt, true, &tv);
+
+  if(mode == 3){
+    for(int ii=0; ii<nions; ii++) frct[ii] = prt[ii];
+    return nions;
+  }
+
+
+  /* --- Saha equation, poti is already lowered --- */
+
+  double cf = 2.0*2.4148E15*t*sqrt(t)/xne_i;
+  fff[0] = 1.0;
+  for(int ii=1; ii<nions; ii++) fff[ii] = cf*prt[ii]/prt[ii-1]*exp(-poti[ii-1]/tv);
+
+  double f0 = 1.0;
+  for(int ii=nions-1; ii>0; ii--) f0 = 1.0 + fff[ii]*f0;
+  fff[0] = 1.0 / f0;
+  for(int ii=1; ii<nions; ii++) fff[ii] *= fff[ii-1];
+
+  if(mode == 1) for(int ii=0; ii<nions; ii++) frct[ii] = fff[ii] / prt[ii];
+  else          for(int ii=0; ii<nions; ii++) frct[ii] = fff[ii];
+
+  return nions;
+}
+
+// -------------------------------------------------------------------------
+// KP_Q_SPLN: Barklem's partition functions and equilibrium constants
+// -------------------------------------------------------------------------
+
+bool eos::piskunov::kp_q_spln(int ib, double t, double &q, double &k)const
+{
+  if(ib < 0) return false;
+
+  double tlog = log10(t);
+
+  q = spl_interp(molec::TQ[ib], molec::Q[ib], &q2b[ib*molec::NTQ], molec::MTQ[ib], tlog);
+  k = spl_interp(molec::TK[ib], molec::K[ib], &k2b[ib*molec::NTK], molec::MTK[ib], tlog);
+
+
+  /* --- From pascals to dyn/cm^2 --- */
+
+  k += 1.0;
+
+  return true;
+}
+
+// -------------------------------------------------------------------------
+// MOLCON: equilibrium constant and partition function of a molecule
+// -------------------------------------------------------------------------
+
+void eos::piskunov::molcon(const species_t &sp, double t, double qprd, double &eqk,
+			   double &qpart, double &pion, bool &barklem)const
+{
+  barklem = false;
+
+  if(sp.imol < 0){
+    eqk = 1.e20, qpart = 1.0, pion = 0.0;
+    return;
+  }
+
+  const double *C = molec::COEF[sp.imol], *PC = molec::PCOEF[sp.imol];
+  double th = 5040.0 / std::max(1250.0, t), lth = log10(th);
+
+  eqk = C[1]+lth*(C[2]+lth*(C[3]+lth*(C[4]+lth*(C[5]+lth*C[6])))) - th*C[0];
+  eqk = pow(10.0, eqk);
+
+  qpart = PC[molec::NPCOEF-2];
+  for(int ii=molec::NPCOEF-3; ii>=0; ii--) qpart = lth*qpart + PC[ii];
+  qpart = pow(10.0, qpart);
+  pion = PC[molec::NPCOEF-1];
+
+  double qs = 0, ks = 0;
+  if(kp_q_spln(sp.ibark, t, qs, ks)){
+    eqk = pow(10.0, ks - C[0]*5040.0/t);
+    qpart = pow(10.0, qs);
+    barklem = true;
+  }
+
+  if(sp.name == "H3O+"){
+    eqk = (sp.ntot-1)*(79.733501+2.5*(log10(t)-15.859914)) +
+      1.5*sp.ratiom + qprd - qpart - C[0]*5039.7475/t;
+    eqk = pow(10.0, eqk);
+  }
+}
+
+// -------------------------------------------------------------------------
+// NEGION: partition function and ionization equilibrium of negative ions
+// -------------------------------------------------------------------------
+
+bool eos::piskunov::negion(int anum, double t, double partn, double &iit, double &qatom, double &pion)const
+{
+  for(int ii=0; ii<molec::NNEG; ii++){
+    if(molec::NEGZ[ii] != anum) continue;
+
+    int n = molec::MTQN[ii];
+    qatom = pow(10.0, spl_interp(molec::TQN[ii], molec::QN[ii], &q2n[ii*molec::NTQN], n, log10(t)));
+    pion = -molec::QN[ii][n];
+    iit = 1.0 / (0.3333984*(2.0*partn)/qatom*exp(-pion/(8.6173175E-5*t))*sqrt(t)*t*t);
+
+    return true;
+  }
+
+  qatom = 1.0, iit = 1.e-50;
+  return false;
+}
+
+// -------------------------------------------------------------------------
+// NELECT: electron density of a hot gas, assuming no molecules
+// -------------------------------------------------------------------------
+
+void eos::piskunov::nelect(double t, double pgas, double &xna_o, double &xne_o, double &wtmole)const
+{
+  double tk = kBol*t, xntot = pgas/tk, xe = 0.5*xntot, xa = xe;
+  double poti[IONSIZ], frc[IONSIZ];
+
+  for(int ll=0; ll<200; ll++){
+    double xnenew = 0.0;
+
+    for(int iel=1; iel<=MAX_ELEM; iel++){
+      int maxion = xsaha(iel, t, xe, xa, poti, frc, 2);
+      double x = 0.0;
+      for(int ii=1; ii<std::min(maxion, iel+1); ii++) x += frc[ii]*ii;
+      xnenew += x * xa * abund_d[iel-1];
+    }
+
+    xnenew = 0.5*(xnenew + xe);
+    double error = fabs((xe-xnenew)/xnenew);
+    xe = xnenew, xa = xntot - xe;
+
+    if(error < 1.e-5) break;
+    if(ll == 199) cerr<<"piskunov::nelect: WARNING, can't converge calculating electron density "<<t<<" "<<pgas<<endl;
+  }
+
+  xne_o = xe, xna_o = xa;
+
+  double x = 0.0;
+  for(int ii=0; ii<MAX_ELEM; ii++) x += abund_d[ii]*AMASS[ii];
+  wtmole = x*amu;
+}
+
+// -------------------------------------------------------------------------
+// EOSFCN: residuals (iflag = 1) and Jacobian (iflag = 2) of the
+// molecular equilibrium equations. A(row, col) = A[row*neq + col]
+// -------------------------------------------------------------------------
+
+void eos::piskunov::eosfcn(double pg, int iflag)
+{
+  int neq = jatom+1;
+  double pe = P[neq-1], bbb = 0.0;
+
+  if(iflag == 1){
+    for(int k=1; k<jatom; k++) B[k] = 0.0;
+    B[0] = -pg, B[neq-1] = -pe;
+
+    for(int ii=0; ii<nlist-1; ii++){
+      const species_t &sp = splist[ii];
+      int nq = sp.nch;
+      double pf = 1.0;
+
+      for(int jj=0; jj<sp.nel; jj++) pf *= ipow(P[sp.jat[jj]], sp.nat[jj]);
+      double cratio = ((pe > 0.0 && nq != 0) ? it[ii]/ipow(pe,nq)/kt[ii] : it[ii]/kt[ii]);
+      double pn = cratio * pf;
+
+      B[0] += (nq+1)*pn;
+      bbb += sp.ntot*pn;
+      for(int jj=0; jj<sp.nel; jj++){
+	int kkk = sp.jat[jj];
+	if(kkk != 0) B[kkk] -= sp.nat[jj]*pn;
+      }
+      B[neq-1] += nq*pn;
+    }
+    for(int jj=1; jj<jatom; jj++) B[jj] += abund_d[iatom[jj]-1]*bbb;
+
+  }else{
+    double *aaa = &rs[0]; // scratch
+    std::fill(A.begin(), A.end(), 0.0);
+    for(int jj=0; jj<neq; jj++) aaa[jj] = 0.0;
+    A[(neq-1)*neq + neq-1] = -1.0;
+
+    for(int ii=0; ii<nlist-1; ii++){
+      const species_t &sp = splist[ii];
+      int nq = sp.nch, nelt = sp.nel;
+      double pf = 1.0, dpf[4] = {1.0, 1.0, 1.0, 1.0};
+
+      for(int jj=0; jj<nelt; jj++){
+	double pj = P[sp.jat[jj]];
+	double cr = ipow(pj, sp.nat[jj]);
+	double dummy = dpf[jj];
+
+	pf *= cr;
+	for(int kk=0; kk<nelt; kk++) dpf[kk] *= cr;
+
+	if(sp.nat[jj] > 1) dpf[jj] = dummy*ipow(pj, sp.nat[jj]-1)*sp.nat[jj];
+	else               dpf[jj] = dummy;
+      }
+
+      double cratio = ((pe > 0.0 && nq != 0) ? it[ii]/ipow(pe,nq)/kt[ii] : it[ii]/kt[ii]);
+      double pn = cratio * pf;
+
+      for(int jj=0; jj<nelt; jj++){
+	int kk = sp.jat[jj];
+	double at = cratio*dpf[jj];
+
+	A[kk] += (nq+1)*at;
+	aaa[kk] += sp.ntot*at;
+	for(int ll=0; ll<nelt; ll++){
+	  int kkk = sp.jat[ll];
+	  if(kkk != 0) A[kkk*neq + kk] -= sp.nat[ll]*at;
+	}
+	A[(neq-1)*neq + kk] += nq*at;
+      }
+
+      if(pe > 0.0 && nq != 0){
+	double at = nq*pn/pe;
+	A[neq-1] -= (nq+1)*at;
+	bbb -= sp.ntot*at;
+	for(int ll=0; ll<nelt; ll++){
+	  int kkk = sp.jat[ll];
+	  if(kkk != 0) A[kkk*neq + neq-1] += sp.nat[ll]*at;
+	}
+	A[(neq-1)*neq + neq-1] -= nq*at;
+      }
+    } // ii
+
+    for(int k=1; k<jatom; k++){
+      double ab = abund_d[iatom[k]-1];
+      for(int kk=0; kk<jatom; kk++) A[k*neq + kk] += ab*aaa[kk];
+      A[k*neq + neq-1] += ab*bbb;
+    }
+  }
+}
+
+// -------------------------------------------------------------------------
+// Solves A x = B for the first n equations, B is overwritten with x.
+// Rows and columns are equilibrated before the LU decomposition and the
+// solution is refined once, as DGESVX does in the fortran version.
+// Returns > 0 if the matrix is singular.
+// -------------------------------------------------------------------------
+
+int eos::piskunov::lineq(int n)
+{
+  int neq = jatom+1;
+
+
+  /* --- Equilibrate --- */
+
+  for(int ii=0; ii<n; ii++){
+    double mx = 0.0;
+    for(int jj=0; jj<n; jj++) mx = std::max(mx, fabs(A[ii*neq+jj]));
+    if(mx == 0.0 || !std::isfinite(mx)) return ii+1;
+    rs[ii] = 1.0/mx;
+  }
+  for(int jj=0; jj<n; jj++){
+    double mx = 0.0;
+    for(int ii=0; ii<n; ii++) mx = std::max(mx, fabs(A[ii*neq+jj])*rs[ii]);
+    if(mx == 0.0) return jj+1;
+    cs[jj] = 1.0/mx;
+  }
+  for(int ii=0; ii<n; ii++)
+    for(int jj=0; jj<n; jj++) AA[ii*n+jj] = rs[ii]*A[ii*neq+jj]*cs[jj];
+
+
+  /* --- LU with partial pivoting --- */
+
+  for(int k=0; k<n; k++){
+    int ip = k;
+    double mx = fabs(AA[k*n+k]);
+    for(int ii=k+1; ii<n; ii++)
+      if(fabs(AA[ii*n+k]) > mx) mx = fabs(AA[ii*n+k]), ip = ii;
+
+    ipiv[k] = ip;
+    if(mx == 0.0 || !std::isfinite(mx)) return k+1;
+
+    if(ip != k) for(int jj=0; jj<n; jj++) std::swap(AA[k*n+jj], AA[ip*n+jj]);
+
+    double iv = 1.0 / AA[k*n+k];
+    for(int ii=k+1; ii<n; ii++){
+      double f = (AA[ii*n+k] *= iv);
+      if(f == 0.0) continue;
+      for(int jj=k+1; jj<n; jj++) AA[ii*n+jj] -= f*AA[k*n+jj];
+    }
+  }
+
+
+  /* --- Solve and refine once with the residual of the original system --- */
+
+  for(int pass=0; pass<2; pass++){
+
+    if(pass == 0) for(int ii=0; ii<n; ii++) res[ii] = rs[ii]*B[ii];
+    else{
+      for(int ii=0; ii<n; ii++){
+	double sum = B[ii];
+	for(int jj=0; jj<n; jj++) sum -= A[ii*neq+jj]*sol[jj];
+	res[ii] = rs[ii]*sum;
+      }
+    }
+
+    for(int k=0; k<n; k++) if(ipiv[k] != k) std::swap(res[k], res[ipiv[k]]);
+    for(int ii=1; ii<n; ii++)
+      for(int jj=0; jj<ii; jj++) res[ii] -= AA[ii*n+jj]*res[jj];
+    for(int ii=n-1; ii>=0; ii--){
+      for(int jj=ii+1; jj<n; jj++) res[ii] -= AA[ii*n+jj]*res[jj];
+      res[ii] /= AA[ii*n+ii];
+    }
+
+    if(pass == 0) for(int ii=0; ii<n; ii++) sol[ii] = res[ii]*cs[ii];
+    else          for(int ii=0; ii<n; ii++) sol[ii] += res[ii]*cs[ii];
+  }
+
+  for(int ii=0; ii<n; ii++) B[ii] = sol[ii];
+
+  return 0;
+}
+
+// -------------------------------------------------------------------------
+// GAS: molecular and ionization equilibrium for given T, Pgas, Pe (guess).
+// Fills xne, xna, xnpf and pfunc. Returns false if the Newton iterations
+// did not converge. If use_warm is true, the atomic partial pressures are
+// initialized from the warm-start state (or from the current content of P
+// if the warm state is not valid).
+// -------------------------------------------------------------------------
+
+bool eos::piskunov::gas(double temp, double pgas, double pelec, double &rho, double &pgnew, bool use_warm)
+{
+  int neq = jatom+1;
+  double t = std::max(1200.0, temp), pg = pgas, pe = pelec;
+  double tk = kBol*temp;
+  double xnelec = pe / tk, xnatom = pg / tk;
+
+  if(pg > pe) xnatom -= xnelec;
+  else        xnelec = xnatom*0.01;
+
+
+  /* --- Partition functions and ionization fractions of each atom --- */
+
+  for(int jj=0; jj<jatom; jj++){
+    int ij = jj*IONSIZ;
+    xsaha(iatom[jj], t, xnelec, xnatom, &spot[ij], &spf[ij], 3);
+    xsaha(iatom[jj], t, xnelec, xnatom, &spot[ij], &sfr[ij], 2);
+  }
+  std::fill(rnf.begin(), rnf.end(), 1.0);
+
+
+  /* --- Ionization/dissociation constants of each species --- */
+
+  for(int ii=0; ii<nlist-1; ii++){
+    const species_t &sp = splist[ii];
+    int ij = sp.jat[0]*IONSIZ, nq = sp.nch;
+
+    if(sp.type == 1){
+      kt[ii] = 1.0, it[ii] = 1.0;
+      part[ii] = spf[ij], potion[ii] = spot[ij];
+    }else if(sp.type == 3){
+      kt[ii] = 1.0;
+      if(nq > 0){
+	if(nq < pfn::nLev[sp.zat[0]-1]){
+	  it[ii] = sfr[ij+nq]/sfr[ij]*ipow(pe, nq);
+	  rnf[sp.zat[0]] += sfr[ij+nq]/sfr[ij];
+	  part[ii] = spf[ij+nq], potion[ii] = spot[ij+nq];
+	}else it[ii] = 0.0, part[ii] = 1.0, potion[ii] = 0.0;
+      }else negion(sp.zat[0], temp, spf[ij], it[ii], part[ii], potion[ii]);
+    }else{
+      double qprd = ((nq <= 0) ? 0.0 : -nq*log10(2.0)), pion = 0.0, dum = 0.0;
+      bool barklem = false;
+
+      for(int jj=0; jj<sp.nel; jj++) qprd += sp.nat[jj]*log10(spf[sp.jat[jj]*IONSIZ]);
+      molcon(sp, temp, qprd, kt[ii], part[ii], pion, barklem);
+      it[ii] = 1.0;
+
+      if(nq > 0 && barklem){
+
+	/* --- Ionized molecule: the charge goes with the atom with the
+	   lowest ionization potential --- */
+
+	int k = sp.jat[0];
+	for(int jj=1; jj<sp.nel; jj++) if(spot[sp.jat[jj]*IONSIZ] < spot[k*IONSIZ]) k = sp.jat[jj];
+	it[ii] = sfr[k*IONSIZ+1]/sfr[k*IONSIZ]*pe;
+      }else if(nq < 0){
+	for(int jj=0; jj<NMOLNEG; jj++)
+	  if(sp.name == MOLNEG_NAME[jj]){
+	    negion(MOLNEG_Z[jj], temp, spf[indzat[MOLNEG_Z[jj]]*IONSIZ], it[ii], dum, dum);
+	    break;
+	  }
+      }
+      potion[ii] = ((pion > 0.0) ? pion : 6.4);
+    }
+  }
+
+
+  /* --- Initial partial pressures --- */
+
+  if(use_warm && warm.valid)
+    for(int jj=0; jj<jatom; jj++) P[jj] = warm.P[jj] * pg / warm.Pg;
+  else if(!use_warm)
+    for(int jj=0; jj<jatom; jj++) P[jj] = pg*abund_d[iatom[jj]-1]/rnf[iatom[jj]];
+
+
+  /* --- Newton iterations --- */
+
+  int ngit = 0, repeat = 0;
+  double delmax = 0, dptot = 0, dpq = 0;
+
+  while(ngit < MAXIT){
+    ngit++;
+    P[neq-1] = pe;
+
+
+    /* --- Rescale atomic pressures until the total pressure is roughly right --- */
+
+    double scale = 10.0;
+    int idir = 0;
+    for(int kk=0; kk<500; kk++){
+      eosfcn(pg, 1);
+      if(B[0] > 1.e2){
+	if(idir != -1) scale = sqrt(scale), idir = -1;
+	for(int jj=0; jj<neq-1; jj++) P[jj] /= scale;
+      }else if(B[0] < -1.e2){
+	if(idir != 1) scale = sqrt(scale), idir = 1;
+	for(int jj=0; jj<neq-1; jj++) P[jj] *= scale;
+      }else break;
+    }
+
+
+    /* --- Jacobian and corrections --- */
+
+    eosfcn(pg, 2);
+
+    if(lineq(neq)){
+      if(repeat < 2){
+	for(int jj=0; jj<neq-1; jj++) P[jj] *= 0.999;
+	repeat++;
+	continue;
+      }else if(repeat < 4){
+	for(int jj=0; jj<neq-1; jj++) P[jj] *= 1.001;
+	repeat++;
+	continue;
+      }else{
+	cerr<<"piskunov::gas: WARNING, degenerate matrix at T="<<temp<<", Pg="<<pg<<endl;
+	eosfcn(pg, 1);
+	eosfcn(pg, 2);
+	if(lineq(neq-1)) return false;
+	B[neq-1] = 0.0;
+	double ptot = 0.0;
+	for(int jj=0; jj<neq-1; jj++) ptot += P[jj];
+	pe = std::max(pg-ptot, 1.e-20);
+      }
+    }
+    repeat = 0;
+
+    delmax = -1.0;
+    for(int k=0; k<neq; k++) delmax = std::max(delmax, fabs(B[k]/std::max(P[k], 1.e-50)));
+    double factor = 1.0/(delmax + 1.0);
+
+    delmax = -1.0;
+    for(int k=0; k<jatom; k++){
+      double pnew = P[k] - B[k]*factor;
+      if(pnew < 0.0) pnew = std::min(std::min(P[k], fabs(pnew)), pg);
+      double dp = pnew - P[k];
+      if(fabs(dp) > 1.e-15) dp *= std::min(1.0, 0.4*P[k]/fabs(dp));
+      P[k] = pnew;
+      delmax = std::max(delmax, fabs(dp/std::max(P[k], 1.e-50)));
+    }
+
+    double penew = pe - B[neq-1]*factor;
+    if(penew < 0.0) penew = std::min(pe, fabs(penew));
+    double dpe = penew - pe;
+    if(fabs(dpe) > 1.e-15) dpe *= std::min(1.0, 0.4*pe/fabs(dpe));
+    pe = penew;
+    if(fabs(pe/pg) >= 1.e-15) delmax = std::max(delmax, fabs(dpe/pe));
+
+    double ptot = pe, pq = 0.0, lpe = log(std::max(pe, 1.e-115));
+    for(int ii=0; ii<nlist-1; ii++){
+      const species_t &sp = splist[ii];
+      double pf = log(std::max(it[ii], 1.e-115)) - log(kt[ii]) - lpe*sp.nch;
+      for(int jj=0; jj<sp.nel; jj++) pf += log(std::max(P[sp.jat[jj]], 1.e-115))*sp.nat[jj];
+      pp[ii] = exp(pf);
+      ptot += pp[ii], pq += sp.nch*pp[ii];
+    }
+    dptot = fabs(ptot-pg)/pg, dpq = fabs(pe-pq)/pg;
+
+    if(!std::isfinite(dptot) || !std::isfinite(delmax)) return false;
+    if(dptot <= tol && dpq <= tol && delmax <= tol) break;
+  }
+  if(ngit >= MAXIT) return false;
+
+
+  /* --- Final partial pressures --- */
+
+  double ptot = pe, pu = 0.0, pnote = 0.0;
+  for(int ii=0; ii<nlist-1; ii++){
+    const species_t &sp = splist[ii];
+    double pf = 1.0;
+    for(int jj=0; jj<sp.nel; jj++) pf *= ipow(P[sp.jat[jj]], sp.nat[jj]);
+    double penq = ((pe > 0.0) ? ipow(pe, sp.nch) : 1.0);
+    pp[ii] = it[ii]/(kt[ii]*penq)*pf;
+    ptot += pp[ii];
+    pu += sp.awt*pp[ii];
+  }
+  pp[nlist-1] = pe;
+
+  rho = ptot/tk * (pu/ptot) * hmass;
+  xne = pe/tk;
+
+  for(int ii=0; ii<nlist-1; ii++){
+    if(part[ii] > 0.0){
+      xnpf[ii] = ((pp[ii]/tk >= 1.e-20) ? pp[ii]/tk : 0.0);
+      pfunc[ii] = part[ii];
+    }else{
+      xnpf[ii] = 0.0;
+      pfunc[ii] = 1.0;
+    }
+    pnote += pp[ii];
+  }
+  xnpf[nlist-1] = xne;
+  pfunc[nlist-1] = 1.0;
+  xna = pnote / tk;
+  pgnew = ptot;
+
+  return true;
+}
+
+// -------------------------------------------------------------------------
+// Number densities / partition functions of a hot gas (only atoms and ions)
+// -------------------------------------------------------------------------
+
+void eos::piskunov::hot_fractions(double t)
+{
+  double poti[IONSIZ], prt[IONSIZ], frc[IONSIZ];
+
+  for(int ii=0; ii<nlist-1; ii++){
+    const species_t &sp = splist[ii];
+
+    if(sp.nel == 1 && sp.nat[0] == 1 && sp.nch >= 0){
+      int nions = xsaha(sp.zat[0], t, xne, xna, poti, prt, 3);
+      xsaha(sp.zat[0], t, xne, xna, poti, frc, 1);
+      if(sp.nch < nions){
+	pf[ii] = prt[sp.nch];
+	fract[ii] = frc[sp.nch]*xna*abund_d[sp.zat[0]-1];
+      }else pf[ii] = 1.0, fract[ii] = 0.0;
+    }else{
+      pf[ii] = 1.0;
+      fract[ii] = 1.e-30;
+    }
+  }
+  fract[nlist-1] = xne, pf[nlist-1] = 1.0;
+}
+
+// -------------------------------------------------------------------------
+// EQSTAT: solve the EOS for a given T and Pgas. Mode 0 computes Pe,
+// mode 10 keeps the electron density given by Pe. Fills fract (number
+// densities / partition functions) and pf. Returns xne.
+// -------------------------------------------------------------------------
+
+double eos::piskunov::eqstat(int mode, double t, double pg, double pe, double &rho)
+{
+  double tk = kBol*t;
+
+  if(t > 9000.){
+
+    /* --- Hot gas: no molecules, Saha equation --- */
+
+    double wtmol = 0.0;
+    if(mode < 10){
+      nelect(t, pg, xna, xne, wtmol);
+    }else{
+      for(int ii=0; ii<MAX_ELEM; ii++) wtmol += abund_d[ii]*AMASS[ii];
+      wtmol *= amu;
+      xne = pe/tk, xna = pg/tk - xne;
+    }
+    rho = xna*wtmol;
+    hot_fractions(t);
+
+  }else{
+
+    /* --- Cold gas: molecular equilibrium. Initial guess of Pe --- */
+
+    bool use_warm = (warm.on && warm.valid && (fabs(log(t/warm.T)) < 0.3));
+    double pe_old = pe, pgas = pg;
+
+    if(mode < 10){
+      if(use_warm) pe_old = warm.Pe * pg / warm.Pg;
+      else if(t > 4000.) pe_old = pg*0.1;
+      else if(t > 2000.) pe_old = pg*0.01;
+      else               pe_old = pg*0.001;
+    }
+
+
+    /* --- The partition functions depend on Pe through the lowering of the
+       ionization potential: iterate until Pe is consistent --- */
+
+    bool conv = false, first = true;
+    for(int iter=0; iter<100; iter++){
+      conv = gas(t, pg, pe_old, rho, pgas, use_warm || !first);
+
+      /* --- Warm start failed, try again from scratch --- */
+
+      if(!conv && (use_warm || !first)){
+	use_warm = false;
+	conv = gas(t, pg, pe_old, rho, pgas, false);
+      }
+      first = false;
+
+      double pe_new = ((mode < 10) ? xne*tk : pe);
+
+      if(mode < 10 && (fabs(pgas-pg)/std::max(1.e-20, pgas) > tol1 ||
+		       fabs(pe_new-pe_old)/std::max(1.e-20, pe_new) > tol1)){
+	pe_old = pe_new;
+	continue;
+      }
+      break;
+    }
+    if(!conv) cerr<<"piskunov::eqstat: WARNING, EOS did not converge at T="<<t<<", Pg="<<pg<<endl;
+
+    if(mode >= 10) xne = pe/tk;
+
+
+    /* --- Store solution for the next depth point --- */
+
+    if(warm.on && conv){
+      warm.valid = true, warm.T = t, warm.Pg = pgas, warm.Pe = P[jatom];
+      for(int jj=0; jj<jatom; jj++) warm.P[jj] = P[jj];
+    }
+
+    for(int ii=0; ii<nlist-1; ii++){
+      fract[ii] = xnpf[ii]/pfunc[ii];
+      pf[ii] = pfunc[ii];
+    }
+    fract[nlist-1] = xne, pf[nlist-1] = 1.0;
+  }
+
+  rhoest = rho;
+  return xne;
+}
+
+// -------------------------------------------------------------------------
+// EQSTAT_RHO: same as eqstat but for given T and rho. Returns xne and
+// the gas pressure in pg.
+// -------------------------------------------------------------------------
+
+double eos::piskunov::eqstat_rho(int mode, double t, double &pg, double pe, double rho)
+{
+  double tk = kBol*t, sum = 0.0;
+  for(int ii=0; ii<MAX_ELEM; ii++) sum += abund_d[ii]*AMASS[ii];
+  sum *= amu;
+
+  if(t > 9000.){
+    double xntot = rho/sum, pgas = 2.0*xntot*tk, wtmol = 0.0;
+
+    for(int iter=0; iter<1000; iter++){
+      nelect(t, pgas, xna, xne, wtmol);
+      if(fabs((xntot-xna)/xntot) <= tol) break;
+      pgas += (xntot-xna)*tk;
+    }
+
+    if(mode < 10) pe = xne*tk;
+    else          xne = pe/tk;
+    xna = (pgas-pe)/tk;
+
+    rhoest = xna*wtmol;
+    pg = pgas;
+    hot_fractions(t);
+
+  }else{
+    bool use_warm = (warm.on && warm.valid && (fabs(log(t/warm.T)) < 0.3));
+    double pg_old = rho/sum*tk, pgas = pg_old, rho_new = rho, pe_old = pe;
+
+    if(use_warm) pg_old = warm.Pg * rho / warm.rho;
+
+    if(mode < 10){
+      if(use_warm)         pe_old = warm.Pe * pg_old / warm.Pg;
+      else if(t > 4000.)   pe_old = pg_old*0.1;
+      else if(t > 2000.)   pe_old = pg_old*0.01;
+      else                 pe_old = pg_old*0.001;
+    }
+
+    bool conv = false, first = true;
+    for(int iter=0; iter<200; iter++){
+      conv = gas(t, pg_old, pe_old, rho_new, pgas, use_warm || !first);
+      if(!conv && (use_warm || !first)){
+	use_warm = false;
+	conv = gas(t, pg_old, pe_old, rho_new, pgas, false);
+      }
+      first = false;
+
+      double pe_new = ((mode < 10) ? xne*tk : pe);
+
+      if(fabs(pgas-pg_old)/std::max(1.e-20, pgas) > tol1 ||
+	 fabs(pe_new-pe_old)/std::max(1.e-20, pe_new) > tol1){
+	pe_old = pe_new, pg_old = pgas;
+	continue;
+      }
+
+      if(fabs(rho-rho_new)/rho > tol1){
+	pe_old = pe_new*rho/rho_new;
+	pg_old = pgas*rho/rho_new;
+	continue;
+      }
+      break;
+    }
+    if(!conv) cerr<<"piskunov::eqstat_rho: WARNING, EOS did not converge at T="<<t<<", rho="<<rho<<endl;
+
+    pg = pgas;
+    if(mode >= 10) xne = pe/tk;
+
+    if(warm.on && conv){
+      warm.valid = true, warm.T = t, warm.Pg = pgas, warm.Pe = P[jatom], warm.rho = rho_new;
+      for(int jj=0; jj<jatom; jj++) warm.P[jj] = P[jj];
+    }
+
+    for(int ii=0; ii<nlist-1; ii++){
+      fract[ii] = xnpf[ii]/pfunc[ii];
+      pf[ii] = pfunc[ii];
+    }
+    fract[nlist-1] = xne, pf[nlist-1] = 1.0;
+    rhoest = rho_new;
+  }
+
+  return xne;
+}
+
+// -------------------------------------------------------------------------
+// eoswrap interface
+// -------------------------------------------------------------------------
+
+double eos::piskunov::nne_from_T_Pg(double T, double Pg, double &rho, double iPe)
+{
+  return eqstat(0, T, Pg, iPe, rho);
+}
+
+double eos::piskunov::nne_from_T_Pg_nne(double T, double Pg, double &rho, double nne)
+{
+  return eqstat(10, T, Pg, nne*kBol*T, rho);
+}
+
+double eos::piskunov::nne_from_T_rho(double T, double &iPg, double rho)
+{
+  return eqstat_rho(0, T, iPg, -1.0, rho);
+}
+
+double eos::piskunov::nne_from_T_rho_nne(double T, double &iPg, double rho, double nne)
+{
+  return eqstat_rho(10, T, iPg, nne*kBol*T, rho);
+}
+
+double eos::piskunov::rho_from_T_pel(double T, double &iPg, double Pe, float itol)
+{
+  return rho_from_T_nne(T, iPg, Pe/(kBol*T), itol);
+}
+
+double eos::piskunov::rho_from_T_nne(double T, double &iPg, double nne, float itol)
+{
+
+  /* --- Find the gas pressure that gives nne: secant iterations on
+     log(nne) vs log(Pg), bracketed with bisection --- */
+
+  double Pe = nne*kBol*T, rho = 0.0;
+  double x0 = 0, x1 = 0, f0 = 0, f1 = 0, lo = -1.e30, hi = 1.e30;
+  double lnne = log(nne);
+
+  if(T > 8000)      x0 = log(Pe/0.5);
+  else if(T > 4000) x0 = log(Pe/0.1);
+  else if(T > 2000) x0 = log(Pe/0.01);
+  else              x0 = log(Pe/0.001);
+  if(warm.on && warm.valid) x0 = log(warm.Pg);
+
+  f0 = log(eqstat(0, T, exp(x0), -1.0, rho)) - lnne;
+  if(f0 < 0.0) lo = x0; else hi = x0;
+  x1 = x0 - ((f0 > 0.0) ? 0.5 : -0.5);
+
+  for(int iter=0; iter<100; iter++){
+    f1 = log(eqstat(0, T, exp(x1), -1.0, rho)) - lnne;
+    if(fabs(f1) <= itol*0.1) break;
+
+    if(f1 < 0.0) lo = std::max(lo, x1);
+    else         hi = std::min(hi, x1);
+
+    double x2 = x1 - f1*(x1-x0)/(f1-f0);
+    if(!std::isfinite(x2) || x2 <= lo || x2 >= hi){
+      if(lo > -1.e29 && hi < 1.e29) x2 = 0.5*(lo+hi);
+      else x2 = x1 + ((f1 > 0.0) ? -2.0 : 2.0);
+    }
+    x0 = x1, f0 = f1, x1 = x2;
+  }
+
+  iPg = exp(x1);
+  return rho;
+}
+
+void eos::piskunov::contOpacity(double T, int nw, double *w, double *opac, double *scattering,
+				std::vector<double> &frac, double na, double ne)
+{
+  double TKEV = 8.6171E-5*T;
+  double TK   = 1.38065E-16*T;
+  double HTK  = 6.6256E-27/TK;
+  double TLOG = log(T);
+
+  int nlines = (int)idxspec.size();
+
+  cop(T, TKEV, TK, HTK, TLOG, na, ne, w, opac, scattering,
+      frac[IXH1-1], frac[IXH2-1], frac[IXHMIN-1], frac[IXHE1-1],
+      frac[IXHE2-1], frac[IXHE3-1], frac[IXC1-1], frac[IXAL1-1],
+      frac[IXSI1-1], frac[IXSI2-1], frac[IXCA1-1], frac[IXCA2-1],
+      frac[IXMG1-1], frac[IXMG2-1], frac[IXFE1-1], frac[IXN1-1],
+      frac[IXO1-1], nw, nlines, ntotallist);
+}
+
+void eos::piskunov::contOpacity_TPg(double T, double Pg, int nw, double *w, double *opac, double *scattering, double Pe)
+{
+  double rho = 0.0;
+  nne_from_T_Pg(T, Pg, rho, Pe);
+
+  double TKEV = 8.6171E-5*T;
+  double TK   = 1.38065E-16*T;
+  double HTK  = 6.6256E-27/TK;
+  double TLOG = log(T);
+
+  int nlines = (int)idxspec.size();
+
+  cop(T, TKEV, TK, HTK, TLOG, xna, xne, w, opac, scattering,
+      fract[idxspec[IXH1-1]],  fract[idxspec[IXH2-1]],  fract[idxspec[IXHMIN-1]],
+      fract[idxspec[IXHE1-1]], fract[idxspec[IXHE2-1]], fract[idxspec[IXHE3-1]],
+      fract[idxspec[IXC1-1]],  fract[idxspec[IXAL1-1]], fract[idxspec[IXSI1-1]],
+      fract[idxspec[IXSI2-1]], fract[idxspec[IXCA1-1]], fract[idxspec[IXCA2-1]],
+      fract[idxspec[IXMG1-1]], fract[idxspec[IXMG2-1]], fract[idxspec[IXFE1-1]],
+      fract[idxspec[IXN1-1]],  fract[idxspec[IXO1-1]], nw, nlines, ntotallist);
+}
+
+void eos::piskunov::contOpacity_TRho(double T, double rho, int nw, double *w, double *opac, double *scattering, double Pe)
+{
+  double Pg = 0.0;
+  nne_from_T_rho(T, Pg, rho);
+
+  double TKEV = 8.6171E-5*T;
+  double TK   = 1.38065E-16*T;
+  double HTK  = 6.6256E-27/TK;
+  double TLOG = log(T);
+
+  int nlines = (int)idxspec.size();
+
+  cop(T, TKEV, TK, HTK, TLOG, xna, xne, w, opac, scattering,
+      fract[idxspec[IXH1-1]],  fract[idxspec[IXH2-1]],  fract[idxspec[IXHMIN-1]],
+      fract[idxspec[IXHE1-1]], fract[idxspec[IXHE2-1]], fract[idxspec[IXHE3-1]],
+      fract[idxspec[IXC1-1]],  fract[idxspec[IXAL1-1]], fract[idxspec[IXSI1-1]],
+      fract[idxspec[IXSI2-1]], fract[idxspec[IXCA1-1]], fract[idxspec[IXCA2-1]],
+      fract[idxspec[IXMG1-1]], fract[idxspec[IXMG2-1]], fract[idxspec[IXFE1-1]],
+      fract[idxspec[IXN1-1]],  fract[idxspec[IXO1-1]], nw, nlines, ntotallist);
+}
+
+// -------------------------------------------------------------------------
+// Batched calls over depth. The EOS solution at each depth point is used
+// as initial guess for the next one.
+// -------------------------------------------------------------------------
+
+void eos::piskunov::hydrostatic(int ndep, double *tau, double *t, double *Pg, double *rho, double *nel,
+				double *pel, double *z, double *cmass, double pgas_bound, float itol)
+{
+  int maxiter = 50;
+  int nw = 1;
+  double wav = 5000.0;
+  double kappa = 0.0, scat = 0.0, kappa_old = 0.0;
+
+  warm_start(true);
+
+
+  /* --- Init boundary --- */
+
+  Pg[0] = pgas_bound;
+  z[0] = 0.0;
+  contOpacity_TPg(t[0], Pg[0], nw, &wav, &kappa_old, &scat, -1.0);
+  store_partial_pressures(ndep, (int)0, xna, xne);
+
+  cmass[0] = Pg[0] / gravity;
+  kappa_old /= rhoest;
+
+  rho[0] = rhoest;
+  nel[0] = xne;
+  pel[0] = bk * xne * t[0];
+
+
+  /* --- Integrate in height --- */
+
+  for(int k = 1; k < ndep; k++){
+
+    double dtau = tau[k] - tau[k-1];
+    double dif = 1e10;
+    int iter = 0;
+    kappa = kappa_old;
+
+    while((dif > itol) && (iter < maxiter)){
+      dif = Pg[k];
+      Pg[k] = Pg[k-1] + gravity * 2.0 * dtau / (kappa + kappa_old);
+
+      contOpacity_TPg(t[k], Pg[k], nw, &wav, &kappa, &scat);
+      kappa /= rhoest;
+
+      dif = fabs(2.0 * (dif-Pg[k]) / ( dif+Pg[k]));
+      iter++;
+    }
+
+    nel[k] = xne;
+    rho[k] = rhoest;
+    pel[k] = bk * xne * t[k];
+
+    z[k] = z[k-1] - 2.0 * dtau / (kappa * rhoest + kappa_old * rho[k-1]);
+    cmass[k] = cmass[k-1] + 2.0 * dtau / (kappa + kappa_old);
+
+    store_partial_pressures(ndep, k, xna, xne);
+    kappa_old = kappa;
+  }
+
+  for(int kk=0; kk<ndep; kk++) cmass[kk] = log10(cmass[kk]);
+
+  warm_start(false);
+}
+
+void eos::piskunov::hydrostatic_cmass(int ndep, double *tau, double *t, double *Pg, double *rho, double *nel,
+				      double *z, double *cmass, double *ltau, double &pgas_bound)
+{
+  double wav = 5000.0;
+  double dum, kappa_old, kappa, cm, ocm;
+  int  nw = 1;
+
+  warm_start(true);
+
+  cm = pow(10.0, cmass[0]);
+  Pg[0] = gravity * cm;
+  contOpacity_TPg(t[0], Pg[0], nw, &wav, &kappa, &dum);
+
+  rho[0] = rhoest, nel[0] = xne;
+  store_partial_pressures(ndep, 0, xna, xne);
+
+  z[0] = 0.0;
+  tau[0] = Pg[0] * kappa / (rho[0]*gravity);
+  ltau[0] = log10(tau[0]);
+
+  for(int k = 1; k<ndep; k++){
+    kappa_old = kappa;
+    ocm = cm;
+
+    cm = pow(10.0, cmass[k]);
+    Pg[k] = gravity * cm;
+
+    contOpacity_TPg(t[k], Pg[k], nw, &wav, &kappa, &dum);
+    rho[k] = rhoest, nel[k] = xne;
+
+    double dz =  2.0 * (cm - ocm) / (rho[k-1] + rho[k]);
+    z[k] = z[k-1] - dz;
+    tau[k] = tau[k-1] + dz * 0.5 * (kappa + kappa_old), ltau[k] = log10(tau[k]);
+
+    store_partial_pressures(ndep, k, xna, xne);
+  }
+
+  warm_start(false);
+}
+
+void eos::piskunov::fill_densities(int ndep, double *t, double *pgas, double *rho, double *pel,
+				   double *nne, int touse,  int keep_nne, float itol)
+{
+
+  /* --- touse switches which of the following to use to compute the rest:
+     (0) pgas, (1) rho, (2) pel, (3) nne.
+     --- */
+
+  warm_start(true);
+
+  if((keep_nne == 0) && ((touse == 0) || (touse == 1))){
+    if(touse == 0){
+      for(int k = 0; k<ndep; k++){
+	nne[k] = nne_from_T_Pg(t[k], pgas[k], rho[k]);
+	pel[k] = bk*nne[k]*t[k];
+	store_partial_pressures(ndep, k, xna, xne);
+      }
+    }else{
+      for(int k = 0; k<ndep; k++){
+	nne[k] = nne_from_T_rho(t[k], pgas[k], rho[k]);
+	pel[k] = bk*nne[k]*t[k];
+	store_partial_pressures(ndep, k, xna, xne);
+      }
+    }
+  }else{
+    if(touse == 0){
+      for(int k = 0; k<ndep; k++){
+	nne_from_T_Pg_nne(t[k], pgas[k], rho[k], nne[k]);
+	pel[k] = bk*nne[k]*t[k];
+	store_partial_pressures(ndep, k, xna, xne);
+      }
+    }else if(touse == 1){
+      for(int k = 0; k<ndep; k++){
+	nne_from_T_rho_nne(t[k], pgas[k], rho[k], nne[k]);
+	pel[k] = bk*nne[k]*t[k];
+	store_partial_pressures(ndep, k, xna, xne);
+      }
+    } else if(touse == 2){
+      for(int k = 0; k<ndep; k++){
+	rho[k] = rho_from_T_pel(t[k], pgas[k], pel[k], itol);
+	nne[k] = xne;
+	store_partial_pressures(ndep, k, xna, xne);
+      }
+    } else if(touse == 3){
+      for(int k = 0; k<ndep; k++){
+	rho[k] = rho_from_T_nne(t[k], pgas[k], nne[k], itol);
+	pel[k] = bk*nne[k]*t[k];
+	store_partial_pressures(ndep, k, xna, xne);
+      }
+    } else{
+      cerr << "piskunov::fill_densities: ERROR, touse["<<touse<<"] takes values between 0-3"<<endl;
+    }
+  }
+
+  warm_start(false);
+}
@@ -0,0 +1,164 @@
+/* ----
+   Native C++ port of N. Piskunov's EOS (eos.f, eos_eqns.f), in double
+   precision and with all its state kept in the object, so several
+   instances can be used concurrently from different threads.
+
+   The species list, the molecular equilibrium (GAS/EOSFCN), the hot-gas
+   Saha solution (NELECT) and the drivers (EQSTAT, EQSTAT_RHO) follow the
+   fortran version. The list of background absorbers and the bookkeeping
+   of the partial pressures is identical to ceos, so both classes can be
+   swapped with the "eos_type" keyword.
+
+   Batched calls over depth (fill_densities, hydrostatic*) warm-start
+   the Newton iterations of each depth point with the solution of the
+   previous one.
+
+   Modifications:
+           2026-10-18: Created.
+   ---- */
+
+#ifndef PISKUNOV_H
+#define PISKUNOV_H
+
+#include <vector>
+#include <string>
+#include "input.h"
+#include "cmemt.h"
+#include "eoswrap.h"
+
+namespace eos{
+
+  class piskunov: public eoswrap{
+  public:
+
+    /* --- Atomic data and size of the problem --- */
+
+    static const int IONSIZ = 6, MAXIT = 1000;
+    static const double AMASS[MAX_ELEM];
+    static const char   ELEMEN[MAX_ELEM][3];
+    static const float  ABUND_default[MAX_ELEM];
+
+    /* --- One entry of the species list (splist in the fortran code) --- */
+
+    struct species_t{
+      std::string name;
+      int type, nel, nch, ntot;    // type: 1 atom, 2 molecule, 3 atomic ion
+      int zat[4], nat[4], jat[4];  // atomic numbers, multiplicity, index in the atom list
+      int imol, ibark, ineg;       // row in the MOLCON/Barklem/NEGION tables (-1 if absent)
+      double awt, ratiom;
+    };
+
+
+    /* --- EOS book keeping --- */
+
+    double abund_d[MAX_ELEM];
+    double avmol, wsum, asum, gravity, totalAbund, rhoest;
+    double tol, tol1;
+    int   IXH2,IXHMIN,IXHE2,IXHE3,IXC1,IXAL1,IXSI1,
+          IXSI2,IXCA1,IXCA2,IXMG1,IXMG2,IXFE1,IXN1,IXO1;
+    int nlist, jatom, ntotallist;
+
+    std::vector<species_t> splist;
+    std::vector<int> iatom, indsp, indzat;
+    std::vector<std::string> species, uspec;
+    std::vector<int> ion, idxspec, idx, idx1;
+    std::vector<double> fract, pf, xamass;
+    mat<double> buf;
+
+
+    /* --- Work arrays of the molecular equilibrium --- */
+
+    std::vector<double> it, kt, part, potion, pp, xnpf, pfunc;
+    std::vector<double> spf, sfr, spot; // Saha PF/fractions/potentials of each atom
+    std::vector<double> P, B, A, AA, rs, cs, rnf, sol, res;
+    std::vector<int> ipiv;
+    std::vector<double> q2b, k2b, q2n;
+
+
+    /* --- Warm start: solution at the previous depth point --- */
+
+    struct warm_t{
+      bool on, valid;
+      double T, Pg, Pe, rho;
+      std::vector<double> P;
+    } warm;
+
+
+    /* --- Constructors / init --- */
+
+    piskunov(double grav = 4.44);
+    piskunov(std::vector<line_t> &lines, std::string &abfile, double grav = 4.44);
+    ~piskunov(){};
+
+    void initAbundances(std::vector<iabund> &ab, bool verbose = false);
+    void readAbund(std::string file);
+    void initEOS(std::vector<line_t> &lines);
+    void initTables();
+    void unique(void);
+
+
+    /* --- Species list (MPARSE, MBUILD, EQLIST) --- */
+
+    int  mparse(const std::string &name, int &nel, int &nch, int *zat, int *nat)const;
+    std::string mbuild(const std::string &name, int charge)const;
+    int  llength(const std::string &name)const;
+    int  eqlist(std::vector<std::string> &names);
+
+
+    /* --- Atomic/molecular data (XSAHA, MOLCON, KP_Q_SPLN, NEGION) --- */
+
+    int  xsaha(int iel, double t, double xne, double xna, double *poti, double *frct, int mode)const;
+    bool kp_q_spln(int ibark, double t, double &q, double &k)const;
+    void molcon(const species_t &sp, double t, double qprd, double &eqk,
+		double &qpart, double &pion, bool &barklem)const;
+    bool negion(int anum, double t, double partn, double &iit, double &qatom, double &pion)const;
+
+
+    /* --- Solvers (NELECT, GAS/EOSFCN, EQSTAT, EQSTAT_RHO) --- */
+
+    void nelect(double t, double pgas, double &xna_o, double &xne_o, double &wtmole)const;
+    void eosfcn(double pg, int iflag);
+    int  lineq(int n);
+    bool gas(double t, double pgas, double pelec, double &rho, double &pgnew, bool use_warm);
+    double eqstat(int mode, double t, double pg, double pe, double &rho);
+    double eqstat_rho(int mode, double t, double &pg, double pe, double rho);
+    void hot_fractions(double t);
+
+
+    /* --- eoswrap interface --- */
+
+    double nne_from_T_Pg    (double T,  double Pg,  double &rho, double iPe = -1.0);
+    double nne_from_T_rho   (double T, double &iPg,  double rho);
+    double rho_from_T_pel   (double T, double &iPg,   double Pe, float tol = 1.0e-5);
+    double rho_from_T_nne   (double T, double &iPg,  double nne, float tol = 1.0e-5);
+
+    double nne_from_T_Pg_nne (double T,  double Pg,  double &rho, double nne);
+    double nne_from_T_rho_nne(double T, double &iPg,  double rho, double nne);
+
+    void store_partial_pressures(int ndep, int k, double na, double ne);
+    void read_partial_pressures(int k, std::vector<double> &frac, std::vector<double> &part, double &xa, double &xe);
+    void copy_partial_pressures(const eoswrap &in){buf = dynamic_cast<const piskunov&>(in).buf;};
+
+    void contOpacity_TPg  (double T, double Pg, int nw, double *w, double *opac,
+			   double *scattering, double Pe=-1.0);
+    void contOpacity_TRho (double T, double rho, int nw, double *w, double *opac,
+			   double *scattering, double Pe=-1.0);
+    void contOpacity      (double T, int nw, double *w, double *opac, double *scattering,
+			   std::vector<double> &frac, double na, double ne);
+
+    void hydrostatic      (int ndep, double *tau, double *t, double *Pg, double *rho,
+			   double *nel, double *pel,  double *z, double *cmass, double pgas_bound, float tol = 1.0e-5);
+    void hydrostatic_cmass(int ndep, double *tau, double *t, double *Pg, double *rho, double *nel,
+			   double *z, double *cmass, double *ltau, double &pgas_bound);
+    void fill_densities(int ndep, double *t, double *pgas, double *rho, double *pel,
+			double *nne, int touse,  int keep_nne = 0, float tol = 1.0e-5);
+
+
+    /* --- Warm start control for batched calls over depth --- */
+
+    inline void warm_start(bool on){warm.on = on, warm.valid = false;};
+  };
+
+}
+
+#endif
@@ -11,6 +11,17 @@
   See: K. C. Ng 1974, J. Chem. Phys. 61, 2680
  Also: L. Auer 1987, in "Numerical Radiative Transfer",
          ed. W. Kalkofen, pp. 101-109
+
+       Anderson mixing (AndersonInit) is an alternative with the same
+       interface. It keeps the differences of the last Ndepth residuals
+       r = G(x) - x and iterates of the fixed-point iteration x = G(x),
+       and applies them at every iteration after Ndelay instead of every
+       Nperiod th. The history is dropped (restart) when the residual
+       grows by more than a factor restart, or when the mixed solution
+       has a negative component.
+
+  See: D. G. Anderson 1965, J. ACM 12, 547
+ Also: H. F. Walker & P. Ni 2011, SIAM J. Numer. Anal. 49, 1715
        --                                              -------------- */
 
 #include <stdlib.h>
@@ -26,6 +37,8 @@
 
 /* --- Function prototypes --                          -------------- */
 
+static bool_t AndersonMix(struct Ng *Ngs, double *solution);
+
 
 /* --- Global variables --                             -------------- */
 
@@ -47,6 +60,7 @@ struct Ng* NgInit(int N, int Ndelay, int Norder, int Nperiod,
 
   Ngs = (struct Ng*) malloc(sizeof(struct Ng));
 
+  Ngs->method  = ACCEL_NG;
   Ngs->N       = N;
   Ngs->Norder  = Norder;
   Ngs->Nperiod = Nperiod;
@@ -62,10 +76,48 @@ struct Ng* NgInit(int N, int Ndelay, int Norder, int Nperiod,
     Ngs->previous[0][k] = solution[k];
   Ngs->count = 1;
 
+  Ngs->Ndepth = Ngs->Nhist = Ngs->ihist = Ngs->Nrestart = 0;
+  Ngs->dR = Ngs->dG = NULL;
+  Ngs->r  = Ngs->g  = NULL;
+
   return Ngs;
 }
 /* ------- end ---------------------------- NgInit.c ---------------- */
 
+/* ------- begin -------------------------- AndersonInit.c ---------- */
+
+struct Ng* AndersonInit(int N, int Ndelay, int Ndepth, double beta,
+			double restart, double *solution)
+{
+  /* --- Anderson mixing with a history of Ndepth steps, Ndepth = 0
+         means no acceleration. Uses the Ng structure with Norder = 0,
+         so that previous only keeps the last two iterates as needed
+         by MaxChange. beta is the mixing parameter (1 = no damping)
+         --                                            -------------- */
+
+  struct Ng *Ngs;
+
+  Ngs = NgInit(N, Ndelay, 0, 1, solution);
+
+  Ngs->method   = ACCEL_ANDERSON;
+  Ngs->Ndelay   = MAX(Ndelay, 3);
+  Ngs->Ndepth   = MAX(Ndepth, 0);
+  Ngs->beta     = beta;
+  Ngs->restart  = restart;
+  Ngs->rnorm    = -1.0;
+
+  if (Ngs->Ndepth > 0) {
+    Ngs->A  = matrix_double(Ngs->Ndepth, Ngs->Ndepth);
+    Ngs->b  = (double *) malloc(Ngs->Ndepth * sizeof(double));
+    Ngs->dR = matrix_double(Ngs->Ndepth, N);
+    Ngs->dG = matrix_double(Ngs->Ndepth, N);
+    Ngs->r  = (double *) malloc(N * sizeof(double));
+    Ngs->g  = (double *) malloc(N * sizeof(double));
+  }
+  return Ngs;
+}
+/* ------- end ---------------------------- AndersonInit.c ---------- */
+
 /* ------- begin -------------------------- Accelerate.c ------------ */
 
 bool_t Accelerate(struct Ng *Ngs, double *solution)
@@ -83,6 +135,8 @@ bool_t Accelerate(struct Ng *Ngs, double *solution)
   }
   (Ngs->count)++;
 
+  if (Ngs->method == ACCEL_ANDERSON) return AndersonMix(Ngs, solution);
+
   /* --- Accelerate only after we have accumulated enough iterations,
          and then only every Ngs->period th iteration after iteration
          Ngs->Ndelay --                               --------------- */
@@ -154,16 +208,131 @@ bool_t Accelerate(struct Ng *Ngs, double *solution)
 }
 /* ------- end ---------------------------- Accelerate.c ------------ */
 
+/* ------- begin -------------------------- AndersonMix.c ----------- */
+
+static bool_t AndersonMix(struct Ng *Ngs, double *solution)
+{
+  register int i, j, k;
+
+  int     N = Ngs->N, Nhist, i0;
+  double *x, rk, rnorm, w, mix, *gamma;
+
+  /* --- solution holds G(x) of the iterate x stored in previous.
+         Residuals are weighted with 1/solution^2, so that the
+         least-squares problem is solved for the relative change, as
+         measured by MaxChange --                     --------------- */
+
+  if (Ngs->Ndepth <= 0) return FALSE;
+
+  i0 = (Ngs->count - 1) % 2;
+  x  = Ngs->previous[(Ngs->count - 2) % 2];
+
+  rnorm = 0.0;
+  for (k = 0;  k < N;  k++) {
+    if (solution[k]) rnorm += SQ((solution[k] - x[k]) / solution[k]);
+  }
+  rnorm = sqrt(rnorm);
+
+  /* --- Add the new differences to the history (the order of the
+         columns does not matter), or restart if the residual went
+         up --                                        --------------- */
+
+  if (Ngs->rnorm >= 0.0) {
+    if (rnorm > Ngs->restart * Ngs->rnorm) {
+      if (Ngs->Nhist > 0) Ngs->Nrestart++;
+      Ngs->Nhist = Ngs->ihist = 0;
+    } else {
+      i = Ngs->ihist;
+      for (k = 0;  k < N;  k++) {
+	rk = solution[k] - x[k];
+	Ngs->dR[i][k] = rk - Ngs->r[k];
+	Ngs->dG[i][k] = solution[k] - Ngs->g[k];
+      }
+      Ngs->ihist = (i + 1) % Ngs->Ndepth;
+      Ngs->Nhist = MIN(Ngs->Nhist + 1, Ngs->Ndepth);
+    }
+  }
+  for (k = 0;  k < N;  k++) {
+    Ngs->r[k] = solution[k] - x[k];
+    Ngs->g[k] = solution[k];
+  }
+  Ngs->rnorm = rnorm;
+
+  if ((Ngs->count < Ngs->Ndelay) || (Ngs->Nhist == 0)) return FALSE;
+  getCPU(4, TIME_START, NULL);
+
+  /* --- Normal equations of min || r - dR gamma || --  ------------ */
+
+  Nhist = Ngs->Nhist;
+  gamma = Ngs->b;
+  for (i = 0;  i < Nhist;  i++) {
+    gamma[i] = 0.0;
+    for (j = 0;  j < Nhist;  j++)  Ngs->A[i][j] = 0.0;
+  }
+  for (k = 0;  k < N;  k++) {
+    if (!solution[k]) continue;
+    w = 1.0 / SQ(solution[k]);
+    for (i = 0;  i < Nhist;  i++) {
+      gamma[i] += w * Ngs->dR[i][k] * Ngs->r[k];
+      for (j = 0;  j <= i;  j++)
+	Ngs->A[i][j] += w * Ngs->dR[i][k] * Ngs->dR[j][k];
+    }
+  }
+  for (i = 0;  i < Nhist;  i++)
+    for (j = i+1;  j < Nhist;  j++)  Ngs->A[i][j] = Ngs->A[j][i];
+
+  mpi.stop = FALSE;
+  SolveLinearEq(Nhist, Ngs->A, gamma, TRUE);
+  if (mpi.stop) { /* Get out if there is a singular matrix */
+    solveLinearCXX(Nhist, Ngs->A, gamma, TRUE);
+    mpi.stop = FALSE;
+  }
+
+  /* --- x_new = G(x) - dG gamma - (1 - beta) (r - dR gamma) -- ---- */
+
+  mix = 1.0 - Ngs->beta;
+  for (k = 0;  k < N;  k++) {
+    solution[k] = Ngs->g[k] - mix * Ngs->r[k];
+    for (i = 0;  i < Nhist;  i++)
+      solution[k] -= gamma[i] * (Ngs->dG[i][k] - mix * Ngs->dR[i][k]);
+  }
+
+  /* --- Keep the plain iterate and restart if mixing produced a
+         negative component (populations, densities) -- ------------ */
+
+  for (k = 0;  k < N;  k++)
+    if ((solution[k] <= 0.0) && (Ngs->g[k] > 0.0)) break;
+
+  if (k < N) {
+    for (k = 0;  k < N;  k++) solution[k] = Ngs->g[k];
+    Ngs->Nhist = Ngs->ihist = 0;
+    Ngs->Nrestart++;
+    getCPU(4, TIME_POLL, "Accelerate");
+    return FALSE;
+  }
+  for (k = 0;  k < N;  k++) Ngs->previous[i0][k] = solution[k];
+
+  getCPU(4, TIME_POLL, "Accelerate");
+  return TRUE;
+}
+/* ------- end ---------------------------- AndersonMix.c ----------- */
+
 /* ------- begin -------------------------- NgFree.c ---------------- */
 
 void NgFree(struct Ng *Ngs)
 {
   freeMatrix((void **) Ngs->previous);
 
-  if (Ngs->Norder > 0) {
+  if (Ngs->Norder > 0 || Ngs->Ndepth > 0) {
     free(Ngs->b);
     freeMatrix((void **) Ngs->A);
   }
+  if (Ngs->Ndepth > 0) {
+    freeMatrix((void **) Ngs->dR);
+    freeMatrix((void **) Ngs->dG);
+    free(Ngs->r);
+    free(Ngs->g);
+  }
 
   free(Ngs);
 }
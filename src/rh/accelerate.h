@@ -13,8 +13,17 @@
 /* --- Defines structure and prototypes for Ng acceleration -- ------ */
 
 struct Ng {
+  enum AccelMethod method;
   int      N, Ndelay, Norder, Nperiod, count;
   double **previous, **A, *b, *theStorage;
+
+  /* --- Anderson mixing (method == ACCEL_ANDERSON) only. Differences
+         of the last Nhist <= Ndepth residuals and iterates (ring
+         buffer, next slot ihist), and residual and iterate of the
+         previous step --                             --------------- */
+
+  int      Ndepth, Nhist, ihist, Nrestart;
+  double   beta, restart, rnorm, **dR, **dG, *r, *g;
 };
 
 
@@ -24,6 +33,8 @@ bool_t Accelerate(struct Ng *Ngs, double *solution);
 void   NgFree(struct Ng *Ngs);
 struct Ng *NgInit(int N, int Ndelay, int Norder, int Nperiod,
 		  double *solution);
+struct Ng *AndersonInit(int N, int Ndelay, int Ndepth, double beta,
+			double restart, double *solution);
 double MaxChange(struct Ng *Ngs, char *text, bool_t quiet);
 
 
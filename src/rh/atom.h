@@ -37,6 +37,8 @@ enum zeeman_cpl  {LS_COUPLING=0, JK_COUPLING, JJ_COUPLING};
 
 /* --- Structure prototypes --                         -------------- */
 
+enum profile_storage {PROFILE_DOUBLE, PROFILE_FLOAT, PROFILE_FILE};
+
 typedef struct Atom Atom;
 typedef struct Molecule Molecule;
 typedef struct AtomicTransition AtomicTransition;
@@ -51,11 +53,13 @@ typedef struct Paschenstruct Paschenstruct;
 struct AtomicLine {
   bool_t   symmetric, polarizable, Voigt, PRD;
   enum vdWaals vdWaals;
+  enum profile_storage storage;
   int      i, j, Nlambda, Nblue, Ncomponent, Nxrd, fd_profile;
   double   lambda0, *lambda, isotope_frac, g_Lande_eff,
            Aji, Bji, Bij, *Rij, *Rji, **phi, **phi_Q, **phi_U, **phi_V,
          **psi_Q, **psi_U, **psi_V, *wphi, *Qelast, Grad, cvdWaals[4],
     cStark, qcore, qwing, **rho_prd, *c_shift, *c_fraction, **gII;
+  float  **phi_float;
   int    **id0, **id1;
   FILE    *fp_GII;
   double  **frac, rel_change;
@@ -124,8 +128,9 @@ struct Atom {
   char    ID[ATOM_ID_WIDTH+1], **label, *popsinFile, *popsoutFile;
   bool_t  active, NLTEpops, converged;
   enum solution initial_solution;
+  enum AccelMethod accel;
   int     Nlevel, Nline, Ncont, Nfixed, Nprd, *stage, periodic_table,
-          activeindex;
+          activeindex, accel_order;
   long    offset_coll;
   double  abundance, weight, *g, *E, **C, *vbroad, **n, **nstar,
     *ntotal, **Gamma, mxchange;  
@@ -235,6 +240,7 @@ void LTEpops_elem(Element *element);
 void SetLTEQuantities(void);
 void getProfiles(void);
 void Profile(AtomicLine *line);
+void setProfileStorage(void);
 void readProfile(AtomicLine *line, int lamu, double *phi);
 void writeProfile(AtomicLine *line, int lamu, double *phi);
 void readAtom(Atom *atom, char *atomFileName, bool_t active);
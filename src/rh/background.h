@@ -59,6 +59,7 @@ int writeBackground_j(int la, int mu, bool_t to_obs,
 
 void init_Background_j();
 void Background_j(bool_t write_analyze_output, bool_t equilibria_only);
+void Background_ray_j(void);
 
   
 void   writeBRS(void);
@@ -93,8 +93,29 @@
        --                                              -------------- */
  
 
+/* --- Cached solutions of previous call, one per depth point.
+       Within an inversion the same model is synthesized many times with
+       only small perturbations (finite-difference response functions,
+       Levenberg-Marquardt trials), and most depth points come back with
+       the same (T, nHtot, ne). Those are taken from the cache, scaled
+       to the present nHtot; the remaining ones use the scaled cached
+       solution as starting point of the Newton-Raphson iteration instead
+       of the fully dissociated state.
+       --                                              -------------- */
+
+typedef struct {
+  int     Nspace, Nequation;
+  bool_t *valid;
+  double *T, *nHtot, *ne, **n;
+} ChemCache;
+
+
 /* --- Function prototypes --                          -------------- */
 
+static void initChemCache(int Nspace, int Nequation);
+static bool_t matchChemCache(int k, double tol);
+static void   scaleChemCache(int k, int Nnuclei, double *n);
+
 
 /* --- Global variables --                             -------------- */
 
@@ -102,6 +123,10 @@ extern Atmosphere atmos;
 extern InputData input; 
 extern char   messageStr[];
 extern MPI_t mpi;
+extern rhstat rhStats;
+
+static ChemCache chemCache = {0, 0, NULL, NULL, NULL, NULL, NULL};
+static chemstat  chemStats = {0, 0, 0, 0, 0};
 
 
 /* ------- begin -------------------------- ChemicalEquilibrium.c --- */
@@ -112,11 +137,11 @@ void ChemicalEquilibrium(int NmaxIter, double iterLimit)
   register int k, i, j, nu;
 
   char    tmpStr[7];
-  bool_t  quiet;
+  bool_t  quiet, warm, reuse;
   int     Nequation, **nucl_index, niter, Nnuclei, Ngdelay, Ngperiod,
           Ngorder, Nmaxstage;
   double *f, *a, *n, **df, *Phi, PhiHmin, fHmin, dnmax = 0.0,
-         *fn0, fraction, saha, *fjk, *dfjk;
+         *fn0, fraction, saha, *fjk, *dfjk, t0 = getWallTime();
   struct  Ng *Ngn;
   Atom *atom;
   Molecule *molecule;
@@ -210,9 +235,34 @@ void ChemicalEquilibrium(int NmaxIter, double iterLimit)
   Ngn = NgInit(Nequation, Ngdelay=NG_CHEM_DELAY,
 	       Ngorder=NG_CHEM_ORDER, Ngperiod=NG_CHEM_PERIOD, n);
 
+  /* --- Solutions can only be taken over from the cache if they are
+         fully determined by (T, nHtot, ne), which is not the case when
+         the neutral fractions come from old populations -- ---------- */
+
+  reuse = input.chemeq_cache;
+  if (reuse) {
+    initChemCache(atmos.Nspace, Nequation);
+    for (i = 0;  i < Nnuclei;  i++) {
+      atom = nuclei[i]->model;
+      if (atom && atom->active && atom->initial_solution == OLD_POPULATIONS)
+	reuse = FALSE;
+    }
+  }
+  chemStats.Ncall++;
+
   /* --- Go through spatial grid and solve (local) equations -- ----- */
 
   for (k = 0;  k < atmos.Nspace;  k++) {
+    chemStats.Npoint++;
+
+    PhiHmin = 0.25*pow(CI/atmos.T[k], 1.5) *
+      exp(E_ION_HMIN / (KBOLTZMANN * atmos.T[k]));
+
+    if (reuse  &&  matchChemCache(k, input.chemeq_cache_tol)) {
+      scaleChemCache(k, Nnuclei, n);
+      chemStats.Nskip++;
+      goto store;
+    }
 
     /* --- Collect for each atom the population fraction of
            the neutral stage --                        -------------- */
@@ -246,8 +296,6 @@ void ChemicalEquilibrium(int NmaxIter, double iterLimit)
       }
     }
     // printf("out! %d\n\n", k);
-    PhiHmin = 0.25*pow(CI/atmos.T[k], 1.5) *
-      exp(E_ION_HMIN / (KBOLTZMANN * atmos.T[k]));
     fHmin = atmos.ne[k] * fn0[0]*PhiHmin;
     
     /* --- Equilibrium constant for each molecule at this location -- */
@@ -255,82 +303,104 @@ void ChemicalEquilibrium(int NmaxIter, double iterLimit)
     for (i = 0;  i < atmos.Nmolecule;  i++) 
       Phi[i] = equilconstant(&atmos.molecules[i], atmos.T[k]);
 
-    /* --- Initial solution of atomic number densities, and
-           the molecules. Assume everything is dissociated -- ------- */
+    warm = (input.chemeq_cache  &&  chemCache.valid[k]);
+    if (warm) chemStats.Nwarm++;
 
-    for (i = 0;  i < Nnuclei;  i++) n[i] = a[i];
-    for (i = 0;  i < atmos.Nmolecule;  i++) n[Nnuclei+i] = 0.0;
+    for (;;) {
 
-    /* --- Reset counter in Ng structure, store initial solution - -- */
+      /* --- Initial solution of atomic number densities, and
+             the molecules. Start from the cached solution, scaled to
+             the present density, or assume everything is
+             dissociated --                            -------------- */
 
-    Ngn->count = 1;
-    for (i = 0;  i < Nequation;  i++)  Ngn->previous[0][i] = n[i];
+      if (warm) {
+	scaleChemCache(k, Nnuclei, n);
+      } else {
+	for (i = 0;  i < Nnuclei;  i++) n[i] = a[i];
+	for (i = 0;  i < atmos.Nmolecule;  i++) n[Nnuclei+i] = 0.0;
+      }
 
-    /* --- Iterate to convergence, with maximum number NmaxIter -- -- */
+      /* --- Reset counter in Ng structure, store initial solution - */
 
-    niter = 1;
-    while (niter <= NmaxIter) {
-      for (i = 0;  i < Nequation;  i++) {
-	f[i] = n[i] - a[i];
-	for (j = 0;  j < Nequation;  j++) df[i][j] = 0.0;
-        df[i][i] = 1.0;
-      }
-      /* --- Add nHminus to the H number conservation equation -- --- */ 
+      Ngn->count = 1;
+      for (i = 0;  i < Nequation;  i++)  Ngn->previous[0][i] = n[i];
 
-      f[0] += fHmin * n[0];
-      df[0][0] += fHmin;
+      /* --- Iterate to convergence, with maximum number NmaxIter -- */
 
-      /* --- Fill in the rest of the population matrix f[] and its
-             derivative df[][] --                      -------------- */
+      niter = 1;
+      while (niter <= NmaxIter) {
+	for (i = 0;  i < Nequation;  i++) {
+	  f[i] = n[i] - a[i];
+	  for (j = 0;  j < Nequation;  j++) df[i][j] = 0.0;
+	  df[i][i] = 1.0;
+	}
+	/* --- Add nHminus to the H number conservation equation -- --- */ 
 
-      for (i = 0;  i < atmos.Nmolecule;  i++) {
-        molecule = &atmos.molecules[i];
-        saha = Phi[i];
-	for (j = 0;  j < molecule->Nelement;  j++) {
-	  nu = nucl_index[i][j];
-          saha *= pow(fn0[nu] * n[nu], molecule->pt_count[j]);
+	f[0] += fHmin * n[0];
+	df[0][0] += fHmin;
 
-	  /* --- Contributions to equation of conservation for the
-                 nuclei in this molecule --            -------------- */
+	/* --- Fill in the rest of the population matrix f[] and its
+	       derivative df[][] --                      -------------- */
 
-	  f[nu] += molecule->pt_count[j] * n[Nnuclei + i];
-	}
-	/* --- Saha equation for this molecule --      -------------- */
+	for (i = 0;  i < atmos.Nmolecule;  i++) {
+	  molecule = &atmos.molecules[i];
+	  saha = Phi[i];
+	  for (j = 0;  j < molecule->Nelement;  j++) {
+	    nu = nucl_index[i][j];
+	    saha *= pow(fn0[nu] * n[nu], molecule->pt_count[j]);
 
-        saha /= pow(atmos.ne[k], molecule->charge);
-        f[Nnuclei + i] -= saha;
+	    /* --- Contributions to equation of conservation for the
+		   nuclei in this molecule --            -------------- */
 
-        /* --- Fill the derivatives matrix --          -------------- */
+	    f[nu] += molecule->pt_count[j] * n[Nnuclei + i];
+	  }
+	  /* --- Saha equation for this molecule --      -------------- */
+
+	  saha /= pow(atmos.ne[k], molecule->charge);
+	  f[Nnuclei + i] -= saha;
 
-        for (j = 0;  j < molecule->Nelement;  j++) {
-	  nu = nucl_index[i][j];
-          df[nu][Nnuclei + i] += molecule->pt_count[j];
-	  df[Nnuclei + i][nu] = -saha * (molecule->pt_count[j]/n[nu]);
+	  /* --- Fill the derivatives matrix --          -------------- */
+
+	  for (j = 0;  j < molecule->Nelement;  j++) {
+	    nu = nucl_index[i][j];
+	    df[nu][Nnuclei + i] += molecule->pt_count[j];
+	    df[Nnuclei + i][nu] = -saha * (molecule->pt_count[j]/n[nu]);
+	  }
 	}
-      }
-      /* --- Solve linearized equations --             -------------- */
-      mpi.stop = false;
-      SolveLinearEq(Nequation, df, f, true);
-      
-      if(mpi.stop){
-	fprintf(stderr,"chemequil: Singular matrix!\n");
-	fprintf(stderr, "   %d %f %e, trying SVD\n", k, atmos.T[k], atmos.nHtot[k]);
-	solveLinearCXX(Nequation, df, f, TRUE);
+	/* --- Solve linearized equations --             -------------- */
 	mpi.stop = false;
-      }
+	SolveLinearEq(Nequation, df, f, true);
+      
+	if(mpi.stop){
+	  fprintf(stderr,"chemequil: Singular matrix!\n");
+	  fprintf(stderr, "   %d %f %e, trying SVD\n", k, atmos.T[k], atmos.nHtot[k]);
+	  solveLinearCXX(Nequation, df, f, TRUE);
+	  mpi.stop = false;
+	}
       
-      for (i = 0;  i < Nequation;  i++)  n[i] -= f[i];
+	for (i = 0;  i < Nequation;  i++)  n[i] -= f[i];
 
-      /* --- Check convergence and accelerate if appropriate -- ----- */
+	/* --- Check convergence and accelerate if appropriate -- ----- */
+
+	Accelerate(Ngn, n);
+	sprintf(messageStr,
+		"\n%s-- Chemical equilibrium: depth %3.3d, iteration %d",
+		(niter == 1) ? "\n" : "", k, niter);
+
+	if ((dnmax = MaxChange(Ngn, messageStr, quiet=TRUE)) <= iterLimit)
+	  break;
+	niter++;
+      }
+      chemStats.Niter += MIN(niter, NmaxIter);
 
-      Accelerate(Ngn, n);
-      sprintf(messageStr,
-	      "\n%s-- Chemical equilibrium: depth %3.3d, iteration %d",
-	      (niter == 1) ? "\n" : "", k, niter);
+      /* --- A warm start that fails falls back on the dissociated
+             starting solution --                      -------------- */
 
-      if ((dnmax = MaxChange(Ngn, messageStr, quiet=TRUE)) <= iterLimit)
-	break;
-      niter++;
+      if (dnmax > iterLimit  &&  warm) {
+	warm = FALSE;
+	continue;
+      }
+      break;
     }
     if (dnmax > iterLimit) {
       sprintf(messageStr, "Iteration not converged:\n"
@@ -339,8 +409,19 @@ void ChemicalEquilibrium(int NmaxIter, double iterLimit)
 	      atmos.T[k], atmos.nHtot[k], dnmax);
       Error(WARNING, "ChemicalEquilibrium", messageStr);
     }
+    /* --- Keep converged solution for subsequent calls -- ---------- */
+
+    if (input.chemeq_cache) {
+      chemCache.valid[k] = (dnmax <= iterLimit);
+      chemCache.T[k]     = atmos.T[k];
+      chemCache.nHtot[k] = atmos.nHtot[k];
+      chemCache.ne[k]    = atmos.ne[k];
+      for (i = 0;  i < Nequation;  i++) chemCache.n[k][i] = n[i];
+    }
+
     /* --- Store population numbers nuclei --          -------------- */
 
+  store:
     for (i = 0;  i < Nnuclei;  i++) {
       if ((atom = nuclei[i]->model) != NULL) {
 	fraction = n[i] / atom->ntotal[k];
@@ -398,9 +479,98 @@ void ChemicalEquilibrium(int NmaxIter, double iterLimit)
     free(dfjk);
   }
   getCPU(3, TIME_POLL, "Chemical equilibrium");
+  rhStats.t_eos += getWallTime() - t0;
 }
 /* ------- end ---------------------------- ChemicalEquilibrium.c --- */
 
+/* ------- begin -------------------------- initChemCache.c --------- */
+
+static void initChemCache(int Nspace, int Nequation)
+{
+  register int k;
+
+  /* --- (Re)allocate the per-depth cache when the dimensions of the
+         problem change --                             -------------- */
+
+  if (chemCache.Nspace == Nspace  &&  chemCache.Nequation == Nequation)
+    return;
+
+  if (chemCache.valid) {
+    free(chemCache.valid);
+    free(chemCache.T);  free(chemCache.nHtot);  free(chemCache.ne);
+    freeMatrix((void **) chemCache.n);
+  }
+  chemCache.Nspace    = Nspace;
+  chemCache.Nequation = Nequation;
+
+  chemCache.valid = (bool_t *) malloc(Nspace * sizeof(bool_t));
+  chemCache.T     = (double *) malloc(Nspace * sizeof(double));
+  chemCache.nHtot = (double *) malloc(Nspace * sizeof(double));
+  chemCache.ne    = (double *) malloc(Nspace * sizeof(double));
+  chemCache.n     = matrix_double(Nspace, Nequation);
+
+  for (k = 0;  k < Nspace;  k++) chemCache.valid[k] = FALSE;
+}
+/* ------- end ---------------------------- initChemCache.c --------- */
+
+/* ------- begin -------------------------- matchChemCache.c -------- */
+
+static bool_t matchChemCache(int k, double tol)
+{
+  /* --- Cached solution at depth k can be used if T, nHtot and ne
+         agree to relative tolerance tol. With tol = 0 only identical
+         conditions match, which leaves results unchanged -- -------- */
+
+  if (!chemCache.valid[k]) return FALSE;
+
+  return (fabs(atmos.T[k] - chemCache.T[k]) <= tol * chemCache.T[k]  &&
+	  fabs(atmos.nHtot[k] - chemCache.nHtot[k]) <=
+	  tol * chemCache.nHtot[k]  &&
+	  fabs(atmos.ne[k] - chemCache.ne[k]) <= tol * chemCache.ne[k]);
+}
+/* ------- end ---------------------------- matchChemCache.c -------- */
+
+/* ------- begin -------------------------- scaleChemCache.c -------- */
+
+static void scaleChemCache(int k, int Nnuclei, double *n)
+{
+  register int i;
+
+  double fraction;
+
+  /* --- Cached solution at depth k scaled to the present nHtot: the
+         atomic densities linearly and each molecule with the power
+         of its number of nuclei, as in the Saha equations -- ------- */
+
+  fraction = atmos.nHtot[k] / chemCache.nHtot[k];
+
+  for (i = 0;  i < Nnuclei;  i++)
+    n[i] = chemCache.n[k][i] * fraction;
+  for (i = 0;  i < atmos.Nmolecule;  i++)
+    n[Nnuclei + i] = chemCache.n[k][Nnuclei + i] *
+      pow(fraction, atmos.molecules[i].Nnuclei);
+}
+/* ------- end ---------------------------- scaleChemCache.c -------- */
+
+/* ------- begin -------------------------- getChemEquilStats.c ----- */
+
+void getChemEquilStats(chemstat *stat, bool_t reset)
+{
+  /* --- Return counters of the chemical equilibrium solver
+         accumulated since the last reset --           -------------- */
+
+  if (stat) *stat = chemStats;
+
+  if (reset) {
+    chemStats.Ncall  = 0;
+    chemStats.Npoint = 0;
+    chemStats.Nskip  = 0;
+    chemStats.Nwarm  = 0;
+    chemStats.Niter  = 0;
+  }
+}
+/* ------- end ---------------------------- getChemEquilStats.c ----- */
+
 /* ------- begin -------------------------- partfunction.c ---------- */
 
 double partfunction(struct Molecule *molecule, double T)
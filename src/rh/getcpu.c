@@ -21,6 +21,7 @@
 #include <string.h>
 #include <time.h>
 #include <sys/times.h>
+#include <sys/time.h>
 #include <unistd.h>
 
 #if defined(SunOS5)
@@ -132,3 +133,17 @@ void printTotalCPU()
   /* 	  100*user/total, 100*system/total); */
 }
 /* ------- end ---------------------------- printTotalCPU ----------- */
+
+/* ------- begin -------------------------- getWallTime.c ----------- */
+
+double getWallTime(void)
+{
+  struct timeval tv;
+
+  /* --- Elapsed wall-clock time in seconds, used for the per-pixel
+         timers of the solver --                       -------------- */
+
+  gettimeofday(&tv, NULL);
+  return tv.tv_sec + tv.tv_usec * 1.0E-6;
+}
+/* ------- end ---------------------------- getWallTime.c ----------- */
@@ -77,17 +77,22 @@ typedef struct {
   bool_t magneto_optical, PRD_angle_dep, XRD, Eddington,
     backgr_pol, limit_memory, allow_passive_bb, NonICE,
     rlkscatter, xdr_endian, old_background, accelerate_mols,
-    prdh_limit_mem, RLK_explicit;
+    prdh_limit_mem, RLK_explicit, chemeq_cache, full_ray;
   enum   solution startJ;
   enum   StokesMode StokesMode;
   enum   S_interpol S_interpolation;
   enum   S_interpol_stokes S_interpolation_stokes;
   enum   order_3D interpolate_3D;
   enum   ne_solution solve_ne;
+  enum   VoigtTableOrder voigt_table;
+  enum   AccelMethod accel;
   int    isum, Ngdelay, Ngorder, Ngperiod, NmaxIter,
     PRD_NmaxIter, PRD_Ngdelay, PRD_Ngorder, PRD_Ngperiod,
-    NmaxScatter, Nthreads, NlambdaIter,CR_Nstep ;
+    NmaxScatter, Nthreads, NlambdaIter,CR_Nstep, voigt_table_Na,
+    voigt_table_Nv, Anderson_depth, Anderson_delay;
   double iterLimit, PRDiterLimit, metallicity, eos_iter_limit, ng_start_limit,CR_factor;
+  double profile_memory, chemeq_cache_tol;
+  double Anderson_beta, Anderson_restart;
 
   double crsw, crsw_ini;
   double prdswitch, prdsw;
@@ -113,6 +118,8 @@ void  setintValue(char *value, void *pointer);
 void  setdoubleValue(char *value, void *pointer);
 void  setstartValue(char *value, void *pointer);
 void  setnesolution(char *value, void *pointer);
+void  setVoigtTable(char *value, void *pointer);
+void  setAccelMethod(char *value, void *pointer);
 void  setPRDangle(char *value, void *pointer);
 void  setStokesMode(char *value, void *pointer);
 void  setThreadValue(char *value, void *pointer);
@@ -89,10 +89,11 @@ FORMAT(F11.4,F7.3,F6.2,F12.3,F5.2,1X,A10,F12.3,F5.2,1X,A10,
 
 /* --- Function prototypes --                          -------------- */
 
-double           RLKProfile(RLK_Line *rlk, int k, int mu, bool_t to_obs,
-			    double lambda,
+void             RLKProfile(RLK_Line *rlk, int mu, bool_t to_obs,
+			    double lambda, double *phi,
 			    double *phi_Q, double *phi_U, double *phi_V,
-			    double *psi_Q, double *psi_U, double *psi_V);
+			    double *psi_Q, double *psi_U, double *psi_V,
+			    double *work);
 void   RLKZeeman(RLK_Line *rlk);
 double RLKLande(RLK_level* level);
 
@@ -438,7 +439,7 @@ flags rlk_opacity(double lambda, int nspect, int mu, bool_t to_obs,
          Bijhc_4PI, twohnu3_c2, hc, fourPI, hc_4PI,
         *eta_Q, *eta_U, *eta_V, eta_l,
         *chi_Q, *chi_U, *chi_V, chi_l, *chip_Q, *chip_U, *chip_V,
-         phi, phi_Q, phi_U, phi_V, psi_Q, psi_U, psi_V,
+        *phi, *phi_Q, *phi_U, *phi_V, *psi_Q, *psi_U, *psi_V, *work,
          epsilon, C, C2_atom, C2_ion, C3, dE, x;
   Atom *metal;
   AtomicLine *line;
@@ -473,6 +474,17 @@ flags rlk_opacity(double lambda, int nspect, int mu, bool_t to_obs,
 
   pf = (double *) malloc(atmos.Nspace * sizeof(double));
 
+  /* --- Profiles are evaluated for all depths at once -- ----------- */
+
+  phi   = (double *) malloc(19*atmos.Nspace * sizeof(double));
+  phi_Q = phi + atmos.Nspace;
+  phi_U = phi + 2*atmos.Nspace;
+  phi_V = phi + 3*atmos.Nspace;
+  psi_Q = phi + 4*atmos.Nspace;
+  psi_U = phi + 5*atmos.Nspace;
+  psi_V = phi + 6*atmos.Nspace;
+  work  = phi + 7*atmos.Nspace;
+
   /* --- locate wavelength lambda in table of lines -- -------------- */
 
   Nwhite = 0;
@@ -584,12 +596,11 @@ flags rlk_opacity(double lambda, int nspect, int mu, bool_t to_obs,
         Linear(atmos.Npf, atmos.Tpf, element->pf[rlk->stage],
 	       atmos.Nspace, atmos.T, pf, hunt=TRUE);
 
-	for (k = 0;  k < atmos.Nspace;  k++) {
-	  phi = RLKProfile(rlk, k, mu, to_obs, lambda,
-			   &phi_Q, &phi_U, &phi_V,
-			   &psi_Q, &psi_U, &psi_V);
+	RLKProfile(rlk, mu, to_obs, lambda, phi,
+		   phi_Q, phi_U, phi_V, psi_Q, psi_U, psi_V, work);
 
-	  if (phi){
+	for (k = 0;  k < atmos.Nspace;  k++) {
+	  if (phi[k]) {
 	    kT    = 1.0 / (KBOLTZMANN * atmos.T[k]);
 	    ni_gi = element->n[rlk->stage][k] *
 	      exp(-rlk->level_i.E * kT - pf[k]);
@@ -603,27 +614,27 @@ flags rlk_opacity(double lambda, int nspect, int mu, bool_t to_obs,
 			       (atmos.ne[k] * 
 				pow(KBOLTZMANN * atmos.T[k] / dE, 1 + x)));
 
-              scatt[k] += (1.0 - epsilon) * chi_l * phi;
+              scatt[k] += (1.0 - epsilon) * chi_l * phi[k];
 	      chi_l    *= epsilon;
               eta_l    *= epsilon;
 	    }
 
-	    chi[k] += chi_l * phi;
-	    eta[k] += eta_l * phi;
+	    chi[k] += chi_l * phi[k];
+	    eta[k] += eta_l * phi[k];
 
 	    if (rlk->zm != NULL && rlk->Grad) {
-	      chi_Q[k] += chi_l * phi_Q;
-	      chi_U[k] += chi_l * phi_U;
-	      chi_V[k] += chi_l * phi_V;
+	      chi_Q[k] += chi_l * phi_Q[k];
+	      chi_U[k] += chi_l * phi_U[k];
+	      chi_V[k] += chi_l * phi_V[k];
 
-	      eta_Q[k] += eta_l * phi_Q;
-	      eta_U[k] += eta_l * phi_U;
-	      eta_V[k] += eta_l * phi_V;
+	      eta_Q[k] += eta_l * phi_Q[k];
+	      eta_U[k] += eta_l * phi_U[k];
+	      eta_V[k] += eta_l * phi_V[k];
 
 	      if (input.magneto_optical) {
-		chip_Q[k] += chi_l * psi_Q;
-		chip_U[k] += chi_l * psi_U;
-		chip_V[k] += chi_l * psi_V;
+		chip_Q[k] += chi_l * psi_Q[k];
+		chip_U[k] += chi_l * psi_U[k];
+		chip_V[k] += chi_l * psi_V[k];
 	      }
 	    }
 	  }
@@ -633,6 +644,7 @@ flags rlk_opacity(double lambda, int nspect, int mu, bool_t to_obs,
   }
 
   free(pf);
+  free(phi);
   return backgrflags;
 }
 /* ------- end ---------------------------- rlk_opacity.c ----------- */
@@ -669,103 +681,144 @@ bool_t RLKdeterminate_ac(char *labeli, char *labelj, RLK_Line *rlk)
 
 /* ------- begin -------------------------- RLKProfile.c ------------ */
 
-double RLKProfile(RLK_Line *rlk, int k, int mu, bool_t to_obs,
-                  double lambda,
-		  double *phi_Q, double *phi_U, double *phi_V,
-		  double *psi_Q, double *psi_U, double *psi_V)
+void RLKProfile(RLK_Line *rlk, int mu, bool_t to_obs, double lambda,
+		double *phi, double *phi_Q, double *phi_U, double *phi_V,
+		double *psi_Q, double *psi_U, double *psi_V, double *work)
 {
-  register int nz;
+  register int k, nz;
 
-  double v, phi_sm, phi_sp, phi_pi, psi_sm, psi_sp, psi_pi, adamp,
-         vB, H, F, sv, phi_sigma, phi_delta, sign, sin2_gamma, phi,
-         psi_sigma, psi_delta, vbroad, vtherm, GvdW, *np;
+  double *v, *adamp, *sv, *vk, *H, *F, *phi_sm, *phi_sp, *phi_pi,
+         *psi_sm, *psi_sp, *psi_pi, vB, phi_sigma, phi_delta, sign,
+          sin2_gamma, psi_sigma, psi_delta, vbroad, vtherm, GvdW,
+          strength, *np;
+  enum VoigtAlgorithm algorithm;
   Element *element;
 
-  /* --- Returns the normalized profile for a Kurucz line
-         and calculates the Stokes profile components if necessary -- */
+  /* --- Returns the normalized profile for a Kurucz line at all
+         depths and calculates the Stokes profile components if
+         necessary. The work array should hold 12*Nspace doubles -- */
+
+  v      = work;
+  adamp  = work + atmos.Nspace;
+  sv     = work + 2*atmos.Nspace;
+  vk     = work + 3*atmos.Nspace;
+  H      = work + 4*atmos.Nspace;
+  F      = work + 5*atmos.Nspace;
+  phi_sm = work + 6*atmos.Nspace;
+  phi_pi = work + 7*atmos.Nspace;
+  phi_sp = work + 8*atmos.Nspace;
+  psi_sm = work + 9*atmos.Nspace;
+  psi_pi = work + 10*atmos.Nspace;
+  psi_sp = work + 11*atmos.Nspace;
 
   element = &atmos.elements[rlk->pt_index - 1];
   vtherm  = 2.0*KBOLTZMANN/(AMU * element->weight);
-  vbroad  = sqrt(vtherm*atmos.T[k] + SQ(atmos.vturb[k]));
+  np = atmos.H->n[atmos.H->Nlevel-1];
 
-  v = (lambda/rlk->lambda0 - 1.0) * CLIGHT/vbroad;
-  if (atmos.moving) {
-    if (to_obs)
-      v += vproject(k, mu) / vbroad;
-    else
-      v -= vproject(k, mu) / vbroad;
-  }
-  sv = 1.0 / (SQRTPI * vbroad);
+  for (k = 0;  k < atmos.Nspace;  k++) {
+    vbroad = sqrt(vtherm*atmos.T[k] + SQ(atmos.vturb[k]));
 
-  if (rlk->Grad) {
-    switch (rlk->vdwaals) {
-    case UNSOLD:
-      GvdW = rlk->cross * pow(atmos.T[k], 0.3);
-      break;
+    v[k] = (lambda/rlk->lambda0 - 1.0) * CLIGHT/vbroad;
+    if (atmos.moving) {
+      if (to_obs)
+	v[k] += vproject(k, mu) / vbroad;
+      else
+	v[k] -= vproject(k, mu) / vbroad;
+    }
+    sv[k] = 1.0 / (SQRTPI * vbroad);
 
-    case BARKLEM:
-      GvdW = rlk->cross * pow(atmos.T[k], (1.0 - rlk->alpha)/2.0);
-      break;
+    if (rlk->Grad) {
+      switch (rlk->vdwaals) {
+      case UNSOLD:
+	GvdW = rlk->cross * pow(atmos.T[k], 0.3);
+	break;
 
-    default:
-      GvdW = rlk->GvdWaals;
-      break;
+      case BARKLEM:
+	GvdW = rlk->cross * pow(atmos.T[k], (1.0 - rlk->alpha)/2.0);
+	break;
+
+      default:
+	GvdW = rlk->GvdWaals;
+	break;
+      }
+      adamp[k] = (rlk->Grad + rlk->GStark * atmos.ne[k] + 
+		  GvdW * (atmos.nHtot[k] - np[k])) * 
+	(rlk->lambda0  * NM_TO_M) / (4.0*PI * vbroad);
     }
-    np = atmos.H->n[atmos.H->Nlevel-1];
-    adamp = (rlk->Grad + rlk->GStark * atmos.ne[k] + 
-	     GvdW * (atmos.nHtot[k] - np[k])) * 
-      (rlk->lambda0  * NM_TO_M) / (4.0*PI * vbroad);
-  } else {
-    phi = (fabs(v) <= MAX_GAUSS_DOPPLER) ? exp(-v*v) : 0.0;
-    return phi * sv;
+  }
+
+  if (!rlk->Grad) {
+    for (k = 0;  k < atmos.Nspace;  k++)
+      phi[k] = ((fabs(v[k]) <= MAX_GAUSS_DOPPLER) ?
+		exp(-v[k]*v[k]) : 0.0) * sv[k];
+    return;
   }
 
   if (rlk->polarizable) {
-    sin2_gamma = 1.0 - SQ(atmos.cos_gamma[mu][k]);
-    vB   = (LARMOR * rlk->lambda0) * atmos.B[k] / vbroad;
+    algorithm = (input.voigt_table != VOIGT_TABLE_NONE) ? LOOKUP : HUMLICEK;
     sign = (to_obs) ? 1.0 : -1.0;
 
-    phi_sm = phi_pi = phi_sp = 0.0;
-    psi_sm = psi_pi = psi_sp = 0.0;
-
+    for (k = 0;  k < atmos.Nspace;  k++) {
+      phi_sm[k] = phi_pi[k] = phi_sp[k] = 0.0;
+      psi_sm[k] = psi_pi[k] = psi_sp[k] = 0.0;
+    }
     for (nz = 0;  nz < rlk->zm->Ncomponent;  nz++) {
-      H = Voigt(adamp, v - rlk->zm->shift[nz]*vB, &F, HUMLICEK);
+      for (k = 0;  k < atmos.Nspace;  k++) {
+	vB    = (LARMOR * rlk->lambda0) * atmos.B[k] * SQRTPI * sv[k];
+	vk[k] = v[k] - rlk->zm->shift[nz]*vB;
+      }
+      VoigtN(atmos.Nspace, adamp, vk, H, F, algorithm);
 
+      strength = rlk->zm->strength[nz];
       switch (rlk->zm->q[nz]) {
       case -1:
-	phi_sm += rlk->zm->strength[nz] * H;
-	psi_sm += rlk->zm->strength[nz] * F;
+	for (k = 0;  k < atmos.Nspace;  k++) {
+	  phi_sm[k] += strength * H[k];
+	  psi_sm[k] += strength * F[k];
+	}
 	break;
       case  0:
-	phi_pi += rlk->zm->strength[nz] * H;
-	psi_pi += rlk->zm->strength[nz] * F;
+	for (k = 0;  k < atmos.Nspace;  k++) {
+	  phi_pi[k] += strength * H[k];
+	  psi_pi[k] += strength * F[k];
+	}
 	break;
       case  1:
-	phi_sp += rlk->zm->strength[nz] * H;
-	psi_sp += rlk->zm->strength[nz] * F;
+	for (k = 0;  k < atmos.Nspace;  k++) {
+	  phi_sp[k] += strength * H[k];
+	  psi_sp[k] += strength * F[k];
+	}
       }
     }
-    phi_sigma = phi_sp + phi_sm;
-    phi_delta = 0.5*phi_pi - 0.25*phi_sigma;
 
-    phi = (phi_delta*sin2_gamma + 0.5*phi_sigma) * sv;
+    for (k = 0;  k < atmos.Nspace;  k++) {
+      sin2_gamma = 1.0 - SQ(atmos.cos_gamma[mu][k]);
+      phi_sigma = phi_sp[k] + phi_sm[k];
+      phi_delta = 0.5*phi_pi[k] - 0.25*phi_sigma;
 
-    *phi_Q = sign * phi_delta * sin2_gamma * atmos.cos_2chi[mu][k] * sv;
-    *phi_U = phi_delta * sin2_gamma * atmos.sin_2chi[mu][k] * sv;
-    *phi_V = sign * 0.5*(phi_sp - phi_sm) * atmos.cos_gamma[mu][k] * sv;
+      phi[k] = (phi_delta*sin2_gamma + 0.5*phi_sigma) * sv[k];
 
-    if (input.magneto_optical) {
-      psi_sigma = psi_sp + psi_sm;
-      psi_delta = 0.5*psi_pi - 0.25*psi_sigma;
+      phi_Q[k] = sign * phi_delta * sin2_gamma * atmos.cos_2chi[mu][k] * sv[k];
+      phi_U[k] = phi_delta * sin2_gamma * atmos.sin_2chi[mu][k] * sv[k];
+      phi_V[k] = sign * 0.5*(phi_sp[k] - phi_sm[k]) *
+	atmos.cos_gamma[mu][k] * sv[k];
 
-      *psi_Q = sign * psi_delta * sin2_gamma * atmos.cos_2chi[mu][k] * sv;
-      *psi_U = psi_delta * sin2_gamma * atmos.sin_2chi[mu][k] * sv;
-      *psi_V = sign * 0.5*(psi_sp - psi_sm) * atmos.cos_gamma[mu][k] * sv;
+      if (input.magneto_optical) {
+	psi_sigma = psi_sp[k] + psi_sm[k];
+	psi_delta = 0.5*psi_pi[k] - 0.25*psi_sigma;
+
+	psi_Q[k] = sign * psi_delta * sin2_gamma *
+	  atmos.cos_2chi[mu][k] * sv[k];
+	psi_U[k] = psi_delta * sin2_gamma * atmos.sin_2chi[mu][k] * sv[k];
+	psi_V[k] = sign * 0.5*(psi_sp[k] - psi_sm[k]) *
+	  atmos.cos_gamma[mu][k] * sv[k];
+      }
     }
-  } else
-   phi = Voigt(adamp, v, NULL, ARMSTRONG) * sv;
-
-  return phi;
+  } else {
+    algorithm = (input.voigt_table != VOIGT_TABLE_NONE) ? LOOKUP : ARMSTRONG;
+    VoigtN(atmos.Nspace, adamp, v, H, NULL, algorithm);
+    for (k = 0;  k < atmos.Nspace;  k++) phi[k] = H[k] * sv[k];
+  }
 }
 /* ------- end ---------------------------- RLKProfile.c ------------ */
 
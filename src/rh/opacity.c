@@ -154,7 +154,7 @@ void Opacity(int nspect, int mu, bool_t to_obs, bool_t initialize)
 
         /* --- Required size of temporary profile array -- ---------- */
 
-	if (input.limit_memory) {
+	if (line->storage != PROFILE_DOUBLE) {
 	  if (solveStokes)
 	    Nrecphi = (input.magneto_optical) ? 7 : 4;
 	  else
@@ -167,7 +167,7 @@ void Opacity(int nspect, int mu, bool_t to_obs, bool_t initialize)
 	if (atmos.moving || solveStokes) {
 	  lamu = 2*(atmos.Nrays*la + mu) + to_obs;
 
-	  if (input.limit_memory) {
+	  if (line->storage != PROFILE_DOUBLE) {
 	    readProfile(line, lamu, phi);
 	    if (solveStokes) {
 	      phi_Q = phi + atmos.Nspace;
@@ -196,7 +196,7 @@ void Opacity(int nspect, int mu, bool_t to_obs, bool_t initialize)
 	    }
 	  }
 	} else {
-	  if (input.limit_memory)
+	  if (line->storage != PROFILE_DOUBLE)
 	    readProfile(line, la, phi);
 	  else
 	    phi = line->phi[la];
@@ -348,7 +348,8 @@ void Opacity(int nspect, int mu, bool_t to_obs, bool_t initialize)
 	  }
 	}
       }
-      if (as->art[nact][n].type == ATOMIC_LINE && input.limit_memory)
+      if (as->art[nact][n].type == ATOMIC_LINE &&
+	  as->art[nact][n].ptype.line->storage != PROFILE_DOUBLE)
 	free(phi);
     }
   }
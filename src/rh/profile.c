@@ -21,6 +21,13 @@
        allocations in the case of multi-dimensional geometry, at the
        cost of more I/O overhead.
 
+ Note: If a memory budget is given with keyword PROFILE_MEMORY
+       (in MB) setProfileStorage keeps the largest lines in single
+       precision in memory (line->storage == PROFILE_FLOAT) until the
+       profiles of all active lines fit in the budget. Such lines are
+       packed and unpacked through writeProfile and readProfile, just
+       like the profiles on file.
+
        Naming convention for the profile functions (see for instance
        J. Stenflo 1994, in "Solar Magnetic Fields", p. 108 & 115):
 
@@ -54,6 +61,7 @@
 /* --- Function prototypes --                          -------------- */
 
 void freeZeeman(ZeemanMultiplet *zm);
+static void freeDoubleProfiles(AtomicLine *line);
 
 
 /* --- Global variables --                             -------------- */
@@ -71,11 +79,13 @@ void Profile(AtomicLine *line)
   register int la, k, mu, n, to_obs, nz;
 
   char    filename[MAX_LINE_SIZE];
-  int     lamu, Nlamu, NrecStokes;
-  double *adamp = NULL, **v, **v_los, *vB, *sv, *vbroad, Larmor, H, F,
-          wlamu, vk, phi_pi, phi_sm, phi_sp, phi_delta, phi_sigma,
-          psi_pi, psi_sm, psi_sp, psi_delta, psi_sigma, sign, sin2_gamma,
+  int     lamu, Nlamu, NrecStokes = 1;
+  double *adamp = NULL, **v, **v_los, *vB, *sv, *vbroad, Larmor,
+          wlamu, *vk, *H, *F, *phi_pi, *phi_sm, *phi_sp, phi_delta,
+          phi_sigma, *psi_pi, *psi_sm, *psi_sp, psi_delta, psi_sigma,
+          sign, sin2_gamma, strength, *work,
          *phi, *phi_Q, *phi_U, *phi_V, *psi_Q, *psi_U, *psi_V;
+  enum VoigtAlgorithm algorithm, algorithm_Stokes;
 
   Atom *atom = line->atom;
   //ZeemanMultiplet *zm;
@@ -116,6 +126,26 @@ void Profile(AtomicLine *line)
   adamp  = (double *) calloc(atmos.Nspace, sizeof(double));
   if (line->Voigt) Damping(line, adamp);
 
+  /* --- Voigt functions are evaluated for all depths in one call,
+         from the shared lookup table if keyword VOIGT_TABLE is set - */
+
+  if (input.voigt_table != VOIGT_TABLE_NONE) {
+    algorithm = algorithm_Stokes = LOOKUP;
+  } else {
+    algorithm = ARMSTRONG;
+    algorithm_Stokes = HUMLICEK;
+  }
+  work = (double *) malloc(9*atmos.Nspace * sizeof(double));
+  vk = work;
+  H  = work + atmos.Nspace;
+  F  = work + 2*atmos.Nspace;
+  phi_pi = work + 3*atmos.Nspace;
+  phi_sm = work + 4*atmos.Nspace;
+  phi_sp = work + 5*atmos.Nspace;
+  psi_pi = work + 6*atmos.Nspace;
+  psi_sm = work + 7*atmos.Nspace;
+  psi_sp = work + 8*atmos.Nspace;
+
   if(!line->wphi) line->wphi = (double *) calloc(atmos.Nspace, sizeof(double));
   else memset(line->wphi, 0,atmos.Nspace*sizeof(double));
 
@@ -131,14 +161,16 @@ void Profile(AtomicLine *line)
 
   /* --- Initialize permanent storage for line profiles -- ---------- */
 
-  if (input.limit_memory) {
-    sprintf(filename, (atom->ID[1] == ' ') ?
-	    "profile.%.1s_%d-%d.dat" : "profile.%.2s_%d-%d.dat", atom->ID,
-	    line->j, line->i);
-    if ((line->fd_profile =
-	 open(filename, O_RDWR | O_CREAT, PERMISSIONS)) == -1) {
-      sprintf(messageStr, "Unable to open profile file %s", filename);
-      Error(ERROR_LEVEL_2, routineName, messageStr);
+  if (line->storage != PROFILE_DOUBLE) {
+    if (line->storage == PROFILE_FILE) {
+      sprintf(filename, (atom->ID[1] == ' ') ?
+	      "profile.%.1s_%d-%d.dat" : "profile.%.2s_%d-%d.dat", atom->ID,
+	      line->j, line->i);
+      if ((line->fd_profile =
+	   open(filename, O_RDWR | O_CREAT, PERMISSIONS)) == -1) {
+	sprintf(messageStr, "Unable to open profile file %s", filename);
+	Error(ERROR_LEVEL_2, routineName, messageStr);
+      }
     }
 
     if (line->polarizable && (input.StokesMode > FIELD_FREE)) {
@@ -160,7 +192,27 @@ void Profile(AtomicLine *line)
       NrecStokes = 1;
       phi = (double *) calloc(atmos.Nspace, sizeof(double));
     }
+
+    /* --- Single precision storage, one record of NrecStokes
+           profiles per wavelength and direction --    -------------- */
+
+    if (line->storage == PROFILE_FLOAT) {
+      freeDoubleProfiles(line);
+      if (line->phi_float) freeMatrix((void **) line->phi_float);
+
+      if (atmos.moving ||
+	  (line->polarizable && (input.StokesMode > FIELD_FREE)))
+	Nlamu = 2*atmos.Nrays*line->Nlambda;
+      else
+	Nlamu = line->Nlambda;
+      line->phi_float = matrix_float(Nlamu, NrecStokes*atmos.Nspace);
+    }
   } else {
+    if (line->phi_float) {
+      freeMatrix((void **) line->phi_float);
+      line->phi_float = NULL;
+    }
+
     if (atmos.moving || 
 	(line->polarizable && (input.StokesMode > FIELD_FREE))) {
       Nlamu = 2*atmos.Nrays*line->Nlambda;
@@ -241,7 +293,7 @@ void Profile(AtomicLine *line)
 	     option. In the normal case the call matrix_double
 	     initializes the whole array to zero -- ------------- */
 
-	  if (input.limit_memory) {
+	  if (line->storage != PROFILE_DOUBLE) {
 	    for (k = 0;  k< NrecStokes*atmos.Nspace;  k++) phi[k] = 0.0;
 	  } else {
 	    phi = line->phi[lamu];
@@ -259,47 +311,57 @@ void Profile(AtomicLine *line)
 	  }
 
 	  if (line->polarizable && (input.StokesMode > FIELD_FREE)) {
-	    for (k = 0;  k < atmos.Nspace;  k++) {
-	      sin2_gamma = 1.0 - SQ(atmos.cos_gamma[mu][k]);
-
-	      /* --- For the sign conventions to the phi and psi
-		 contributions depending on the direction along the ray
-
-		 See:
-		 -- A. van Ballegooijen: "Radiation in Strong Magnetic
-		    Fields", in Numerical Radiative Transfer, W. Kalkofen
-		    1987, p. 285 --                    -------------- */
-            
-              /* --- Sum over isotopes --              -------------- */
-
-	      for (n = 0;  n < line->Ncomponent;  n++) {
-		vk = v[k][n] + sign * v_los[mu][k];
-
-		phi_sm = phi_pi = phi_sp = 0.0;
-		psi_sm = psi_pi = psi_sp = 0.0;
-
-                /* --- Sum over Zeeman sub-levels --   -------------- */
-
-		for (nz = 0;  nz < line->zm->Ncomponent;  nz++) {
-		  H = Voigt(adamp[k], vk - line->zm->shift[nz]*vB[k],
-			    &F, HUMLICEK);
-
-		  switch (line->zm->q[nz]) {
-		  case -1:
-		    phi_sm += line->zm->strength[nz] * H;
-		    psi_sm += line->zm->strength[nz] * F;
-		    break;
-		  case  0:
-		    phi_pi += line->zm->strength[nz] * H;
-		    psi_pi += line->zm->strength[nz] * F;
-		    break;
-		  case  1:
-		    phi_sp += line->zm->strength[nz] * H;
-		    psi_sp += line->zm->strength[nz] * F;
+
+	    /* --- For the sign conventions to the phi and psi
+	       contributions depending on the direction along the ray
+
+	       See:
+	       -- A. van Ballegooijen: "Radiation in Strong Magnetic
+	          Fields", in Numerical Radiative Transfer, W. Kalkofen
+	          1987, p. 285 --                      -------------- */
+
+	    /* --- Sum over isotopes --                -------------- */
+
+	    for (n = 0;  n < line->Ncomponent;  n++) {
+	      for (k = 0;  k < atmos.Nspace;  k++) {
+		phi_sm[k] = phi_pi[k] = phi_sp[k] = 0.0;
+		psi_sm[k] = psi_pi[k] = psi_sp[k] = 0.0;
+	      }
+	      /* --- Sum over Zeeman sub-levels --     -------------- */
+
+	      for (nz = 0;  nz < line->zm->Ncomponent;  nz++) {
+		for (k = 0;  k < atmos.Nspace;  k++)
+		  vk[k] = v[k][n] + sign * v_los[mu][k] -
+		    line->zm->shift[nz]*vB[k];
+		VoigtN(atmos.Nspace, adamp, vk, H, F, algorithm_Stokes);
+
+		strength = line->zm->strength[nz];
+		switch (line->zm->q[nz]) {
+		case -1:
+		  for (k = 0;  k < atmos.Nspace;  k++) {
+		    phi_sm[k] += strength * H[k];
+		    psi_sm[k] += strength * F[k];
+		  }
+		  break;
+		case  0:
+		  for (k = 0;  k < atmos.Nspace;  k++) {
+		    phi_pi[k] += strength * H[k];
+		    psi_pi[k] += strength * F[k];
+		  }
+		  break;
+		case  1:
+		  for (k = 0;  k < atmos.Nspace;  k++) {
+		    phi_sp[k] += strength * H[k];
+		    psi_sp[k] += strength * F[k];
 		  }
 		}
-		phi_sigma = (phi_sp + phi_sm) * line->c_fraction[n];
-		phi_delta = 0.5*phi_pi * line->c_fraction[n] - 0.25*phi_sigma;
+	      }
+	      for (k = 0;  k < atmos.Nspace;  k++) {
+		sin2_gamma = 1.0 - SQ(atmos.cos_gamma[mu][k]);
+
+		phi_sigma = (phi_sp[k] + phi_sm[k]) * line->c_fraction[n];
+		phi_delta = 0.5*phi_pi[k] * line->c_fraction[n] -
+		  0.25*phi_sigma;
 
 		phi[k]   += (phi_delta*sin2_gamma + 0.5*phi_sigma) * sv[k];
 		phi_Q[k] += sign *
@@ -307,38 +369,43 @@ void Profile(AtomicLine *line)
 		phi_U[k] +=
 		  phi_delta * sin2_gamma * atmos.sin_2chi[mu][k] * sv[k];
 		phi_V[k] += sign *
-		  0.5*(phi_sp - phi_sm) * atmos.cos_gamma[mu][k] * sv[k];
+		  0.5*(phi_sp[k] - phi_sm[k]) * atmos.cos_gamma[mu][k] * sv[k];
 
 		if (input.magneto_optical) {
-		  psi_sigma = (psi_sp + psi_sm) * line->c_fraction[n];
-		  psi_delta = 0.5*psi_pi * line->c_fraction[n] -
+		  psi_sigma = (psi_sp[k] + psi_sm[k]) * line->c_fraction[n];
+		  psi_delta = 0.5*psi_pi[k] * line->c_fraction[n] -
 		    0.25*psi_sigma;
 
 		  psi_Q[k] += sign *
 		    psi_delta * sin2_gamma * atmos.cos_2chi[mu][k] * sv[k];
 		  psi_U[k] +=
 		    psi_delta * sin2_gamma * atmos.sin_2chi[mu][k] * sv[k];
-		  psi_V[k] += sign *
-		    0.5 * (psi_sp - psi_sm) * atmos.cos_gamma[mu][k] * sv[k];
+		  psi_V[k] += sign * 0.5 * (psi_sp[k] - psi_sm[k]) *
+		    atmos.cos_gamma[mu][k] * sv[k];
 		}
 	      }
-              /* --- Ensure proper normalization of the profile -- -- */
-  
-	      line->wphi[k] += wlamu * phi[k];
 	    }
+	    /* --- Ensure proper normalization of the profile -- ---- */
+
+	    for (k = 0;  k < atmos.Nspace;  k++)
+	      line->wphi[k] += wlamu * phi[k];
 	  } else {
 	    /* --- Field-free case --                  -------------- */
-            for (k = 0;  k < atmos.Nspace;  k++) {
-	      for (n = 0;  n < line->Ncomponent;  n++) {
-		vk = v[k][n] + sign * v_los[mu][k];
-	    
-		phi[k] += Voigt(adamp[k], vk, NULL, ARMSTRONG) *
-		  line->c_fraction[n] / (SQRTPI * atom->vbroad[k]);
-	      }
-	      line->wphi[k] += phi[k] * wlamu;
+
+	    for (n = 0;  n < line->Ncomponent;  n++) {
+	      for (k = 0;  k < atmos.Nspace;  k++)
+		vk[k] = v[k][n] + sign * v_los[mu][k];
+	      VoigtN(atmos.Nspace, adamp, vk, H, NULL, algorithm);
+
+	      for (k = 0;  k < atmos.Nspace;  k++)
+		phi[k] += H[k] * line->c_fraction[n] /
+		  (SQRTPI * atom->vbroad[k]);
 	    }
+	    for (k = 0;  k < atmos.Nspace;  k++)
+	      line->wphi[k] += phi[k] * wlamu;
 	  }
-	  if (input.limit_memory) writeProfile(line, lamu, phi);
+	  if (line->storage != PROFILE_DOUBLE)
+	    writeProfile(line, lamu, phi);
 	}
       }
     }
@@ -348,21 +415,22 @@ void Profile(AtomicLine *line)
 
     for (la = 0;  la < line->Nlambda;  la++) {
       wlamu = getwlambda_line(line, la);
-      if (input.limit_memory)
+      if (line->storage != PROFILE_DOUBLE)
 	for (k = 0;  k < atmos.Nspace;  k++) phi[k] = 0.0;
       else
 	phi = line->phi[la];
       
-      for (k = 0;  k < atmos.Nspace;  k++) {
-	for (n = 0;  n < line->Ncomponent;  n++) {
-	  vk = (line->lambda[la] - line->lambda0 - line->c_shift[n]) *
+      for (n = 0;  n < line->Ncomponent;  n++) {
+	for (k = 0;  k < atmos.Nspace;  k++)
+	  vk[k] = (line->lambda[la] - line->lambda0 - line->c_shift[n]) *
 	    CLIGHT / (line->lambda0 * atom->vbroad[k]);
-	  phi[k] += Voigt(adamp[k], vk, NULL, ARMSTRONG) *
-	    line->c_fraction[n] / (SQRTPI * atom->vbroad[k]);
-	}
-	line->wphi[k] += phi[k] * wlamu;
+	VoigtN(atmos.Nspace, adamp, vk, H, NULL, algorithm);
+
+	for (k = 0;  k < atmos.Nspace;  k++)
+	  phi[k] += H[k] * line->c_fraction[n] / (SQRTPI * atom->vbroad[k]);
       }
-      if (input.limit_memory) writeProfile(line, la, phi);
+      for (k = 0;  k < atmos.Nspace;  k++) line->wphi[k] += phi[k] * wlamu;
+      if (line->storage != PROFILE_DOUBLE) writeProfile(line, la, phi);
     }
   }
   /* --- Store the inverse of the profile normalization -- ---------- */
@@ -372,7 +440,8 @@ void Profile(AtomicLine *line)
   /* --- Clean up --                                     ------------ */
 
   free(adamp);
-  if (input.limit_memory) free(phi);
+  free(work);
+  if (line->storage != PROFILE_DOUBLE) free(phi);
 
 
   if(atmos.moving || (line->polarizable && (input.StokesMode > FIELD_FREE))){
@@ -394,6 +463,108 @@ void Profile(AtomicLine *line)
 }
 /* ------- end ---------------------------- Profile.c --------------- */
 
+/* ------- begin -------------------------- freeDoubleProfiles.c ---- */
+
+static void freeDoubleProfiles(AtomicLine *line)
+{
+  double ***profiles[7] = {&line->phi, &line->phi_Q, &line->phi_U,
+			   &line->phi_V, &line->psi_Q, &line->psi_U,
+			   &line->psi_V};
+  int n;
+
+  for (n = 0;  n < 7;  n++) {
+    if (*profiles[n] != NULL) {
+      freeMatrix((void **) *profiles[n]);
+      *profiles[n] = NULL;
+    }
+  }
+}
+/* ------- end ---------------------------- freeDoubleProfiles.c ---- */
+
+/* ------- begin -------------------------- setProfileStorage.c ----- */
+
+void setProfileStorage(void)
+{
+  const char routineName[] = "setProfileStorage";
+  register int nact, kr;
+
+  int     Nline, n, nmax, Nrec;
+  double  budget, total, Nlamu, *size, sizemax;
+  Atom   *atom;
+  AtomicLine *line, **lines;
+
+  /* --- Decide per active line whether its profiles are kept in
+         double or single precision, given the memory budget
+         input.profile_memory [MB]. Profiles on file (LIMIT_MEMORY)
+         are not affected --                           -------------- */
+
+  if (input.limit_memory) return;
+
+  Nline = 0;
+  for (nact = 0;  nact < atmos.Nactiveatom;  nact++)
+    Nline += atmos.activeatoms[nact]->Nline;
+  if (Nline == 0) return;
+
+  lines = (AtomicLine **) malloc(Nline * sizeof(AtomicLine *));
+  size  = (double *) malloc(Nline * sizeof(double));
+
+  total = 0.0;
+  n = 0;
+  for (nact = 0;  nact < atmos.Nactiveatom;  nact++) {
+    atom = atmos.activeatoms[nact];
+    for (kr = 0;  kr < atom->Nline;  kr++, n++) {
+      line = &atom->line[kr];
+
+      if (line->polarizable && (input.StokesMode > FIELD_FREE))
+	Nrec = (input.magneto_optical) ? 7 : 4;
+      else
+	Nrec = 1;
+      if (atmos.moving ||
+	  (line->polarizable && (input.StokesMode > FIELD_FREE)))
+	Nlamu = 2.0*atmos.Nrays*line->Nlambda;
+      else
+	Nlamu = line->Nlambda;
+
+      line->storage = PROFILE_DOUBLE;
+      lines[n] = line;
+      size[n]  = Nlamu * Nrec * atmos.Nspace * sizeof(double);
+      total   += size[n];
+    }
+  }
+
+  /* --- Move the largest lines to single precision until the
+         total fits --                                 -------------- */
+
+  budget = input.profile_memory * 1024.0 * 1024.0;
+  while (budget > 0.0 && total > budget) {
+    nmax = -1;
+    sizemax = 0.0;
+    for (n = 0;  n < Nline;  n++) {
+      if (lines[n]->storage == PROFILE_DOUBLE && size[n] > sizemax) {
+	sizemax = size[n];
+	nmax = n;
+      }
+    }
+    if (nmax < 0) {
+      sprintf(messageStr, "Line profiles need %.1f MB in single precision, "
+	      "more than PROFILE_MEMORY = %.1f MB", total / (1024.0*1024.0),
+	      input.profile_memory);
+      Error(WARNING, routineName, messageStr);
+      break;
+    }
+    lines[nmax]->storage = PROFILE_FLOAT;
+    total -= 0.5*size[nmax];
+
+    sprintf(messageStr, " -- Atom %2s, line %3d -> %3d: profiles stored "
+	    "in single precision\n", lines[nmax]->atom->ID,
+	    lines[nmax]->j, lines[nmax]->i);
+    Error(MESSAGE, routineName, messageStr);
+  }
+  free(lines);
+  free(size);
+}
+/* ------- end ---------------------------- setProfileStorage.c ----- */
+
 /* ------- begin -------------------------- MolecularProfile.c ------ */
 
 void MolecularProfile(MolecularLine *mrt)
@@ -509,6 +680,8 @@ void getProfiles(void)
 
   getCPU(2, TIME_START, NULL);
 
+  setProfileStorage();
+
   for (nact = 0;  nact < atmos.Nactiveatom;  nact++) {
     atom = atmos.activeatoms[nact];
     for (kr = 0;  kr < atom->Nline;  kr++) {
@@ -654,6 +654,8 @@ void initAtomicLine(AtomicLine *line)
   line->Rij = line->Rji = NULL;
   line->phi = line->phi_Q = line->phi_U = line->phi_V = NULL;
   line->psi_Q = line->psi_U = line->psi_V = NULL;
+  line->phi_float = NULL;
+  line->storage = (input.limit_memory) ? PROFILE_FILE : PROFILE_DOUBLE;
   line->wphi = line->Qelast = NULL;
   line->Grad = line->cStark = 0.0;
   for (n = 0;  n < 4;  n++) line->cvdWaals[n] = 0.0;
@@ -755,6 +757,7 @@ void freeAtomicLine(AtomicLine *line)
     if (line->psi_U != NULL) freeMatrix((void **) line->psi_U);
     if (line->psi_V != NULL) freeMatrix((void **) line->psi_V);
   }
+  if (line->phi_float != NULL)  freeMatrix((void **) line->phi_float);
   if (line->c_shift != NULL)    free(line->c_shift);
   if (line->c_fraction != NULL) free(line->c_fraction);
 
@@ -790,9 +793,10 @@ void readAtomicModels(void)
 
   char    filename[MAX_LINE_SIZE],
           actionKey[MAX_KEYWORD_SIZE], popsKey[MAX_KEYWORD_SIZE],
-          popsFile[MAX_LINE_SIZE], inputLine[MAX_LINE_SIZE], *atomID;
+          popsFile[MAX_LINE_SIZE], inputLine[MAX_LINE_SIZE], *atomID,
+          optLine[MAX_LINE_SIZE], *token;
   bool_t  active, exit_on_EOF;
-  int     Nread, Nrequired, checkPoint;
+  int     Nread, Nrequired, checkPoint, Ntoken;
   FILE   *fp_atoms;
   Atom   *atom;
   Element *element;
@@ -822,6 +826,7 @@ void readAtomicModels(void)
     Nread = sscanf(inputLine, "%s %s %s %s ",
 		   filename, actionKey, popsKey, popsFile);
     checkNread(Nread, Nrequired=3, routineName, checkPoint=2);
+    if (Nread == 4  &&  strchr(popsFile, '=')) Nread = 3;
 
     atomID = getAtomID(filename);
     if (n ==  0  &&  !strstr(atomID, "H ")) {
@@ -854,7 +859,8 @@ void readAtomicModels(void)
       atom->initial_solution = LTE_POPULATIONS;
     } else if (strstr(popsKey, "ZERO_RADIATION")) {
       atom->initial_solution = ZERO_RADIATION;
-    }else if(strstr(popsKey, "PESC")){
+    }else if(strstr(popsKey, "PESC") ||
+	     strstr(popsKey, "ESCAPE_PROBABILITY")){
       atom->initial_solution = PESC;
     }
     /* --- If popsKey is not recognized --             -------------- */
@@ -866,11 +872,45 @@ void readAtomicModels(void)
       Error(ERROR_LEVEL_2, routineName, messageStr);
     } 
 
+    /* --- Optional acceleration of the populations of this atom
+           after the population file, ACCEL=NG|ANDERSON and
+           ACCEL_ORDER=n (Ng order or Anderson depth). The defaults
+           are ACCELERATION and NG_ORDER/ANDERSON_DEPTH -- ---------- */
+
+    atom->accel = input.accel;
+    atom->accel_order = -1;
+    strcpy(optLine, inputLine);
+    for (token = strtok(optLine, " \t\n"), Ntoken = 0;  token != NULL;
+	 token = strtok(NULL, " \t\n"), Ntoken++) {
+      if (Ntoken < 3  ||  !strchr(token, '=')) continue;
+
+      if (!strncmp(token, "ACCEL_ORDER=", 12))
+	atom->accel_order = atoi(token + 12);
+      else if (!strncmp(token, "ACCEL=", 6))
+	setAccelMethod(token + 6, &atom->accel);
+      else {
+	sprintf(messageStr, "Unknown option %s for atom: %s\n",
+		token, atomID);
+	Error(ERROR_LEVEL_2, routineName, messageStr);
+      }
+    }
+    if (atom->accel_order < 0)
+      atom->accel_order = (atom->accel == ACCEL_ANDERSON) ?
+	input.Anderson_depth : input.Ngorder;
+
     /* --- If input.startJ == OLD_J then enforce OLD_POPULATIONAS - - */
 
     if (atom->active  &&  input.startJ == OLD_J)
       atom->initial_solution = OLD_POPULATIONS;
 
+    /* --- STARTING_J = ESCAPE_PROBABILITY starts all active atoms
+           that do not read old populations from escape probability
+           populations --                              -------------- */
+
+    if (atom->active  &&  input.startJ == PESC  &&
+	atom->initial_solution != OLD_POPULATIONS)
+      atom->initial_solution = PESC;
+
     /* --- Copy filename for old population numbers -- -------------- */
 
     if (atom->initial_solution == OLD_POPULATIONS) {
@@ -900,6 +940,12 @@ void readAtomicModels(void)
          atmosphere over the atmospheric Hydrogen model -- ---------- */
 
   distribute_nH();
+
+  /* --- Shared, read-only Voigt lookup table for the line profiles
+         (only if requested with keyword VOIGT_TABLE) -- ----------- */
+
+  initVoigtTable(input.voigt_table, input.voigt_table_Na,
+		 input.voigt_table_Nv);
   getCPU(2, TIME_POLL, "Read atomic input");
 }
 
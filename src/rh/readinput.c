@@ -84,6 +84,16 @@ void readInput()
      setintValue},
     {"NG_MOLECULES", "FALSE", FALSE, KEYWORD_DEFAULT, &input.accelerate_mols,
      setboolValue},
+    {"ACCELERATION", "NG", FALSE, KEYWORD_DEFAULT, &input.accel,
+     setAccelMethod},
+    {"ANDERSON_DEPTH", "6", FALSE, KEYWORD_OPTIONAL, &input.Anderson_depth,
+     setintValue},
+    {"ANDERSON_DELAY", "3", FALSE, KEYWORD_OPTIONAL, &input.Anderson_delay,
+     setintValue},
+    {"ANDERSON_MIXING", "1.0", FALSE, KEYWORD_OPTIONAL, &input.Anderson_beta,
+     setdoubleValue},
+    {"ANDERSON_RESTART", "1.0", FALSE, KEYWORD_OPTIONAL,
+     &input.Anderson_restart, setdoubleValue},
     {"PRD_N_MAX_ITER", "3", FALSE, KEYWORD_OPTIONAL, &input.PRD_NmaxIter,
      setintValue},
     {"PRD_ITER_LIMIT", "1.0E-2", FALSE, KEYWORD_OPTIONAL, &input.PRDiterLimit,
@@ -193,6 +203,20 @@ void readInput()
      setdoubleValue},   
     {"LIMIT_MEMORY", "FALSE", FALSE, KEYWORD_DEFAULT, &input.limit_memory,
      setboolValue},
+    {"PROFILE_MEMORY", "0.0", FALSE, KEYWORD_OPTIONAL, &input.profile_memory,
+     setdoubleValue},
+    {"CHEMEQ_CACHE", "TRUE", FALSE, KEYWORD_DEFAULT, &input.chemeq_cache,
+     setboolValue},
+    {"CHEMEQ_CACHE_TOL", "0.0", FALSE, KEYWORD_OPTIONAL,
+     &input.chemeq_cache_tol, setdoubleValue},
+    {"FULL_OUTPUT_RAY", "FALSE", FALSE, KEYWORD_DEFAULT, &input.full_ray,
+     setboolValue},
+    {"VOIGT_TABLE", "NONE", FALSE, KEYWORD_DEFAULT, &input.voigt_table,
+     setVoigtTable},
+    {"VOIGT_TABLE_NA", "0", FALSE, KEYWORD_OPTIONAL, &input.voigt_table_Na,
+     setintValue},
+    {"VOIGT_TABLE_NV", "0", FALSE, KEYWORD_OPTIONAL, &input.voigt_table_Nv,
+     setintValue},
     {"ALLOW_PASSIVE_BB", "TRUE", FALSE, KEYWORD_DEFAULT,
      &input.allow_passive_bb, setboolValue}
   };
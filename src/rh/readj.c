@@ -346,6 +346,7 @@ int writeBackground(int nspect, int mu, bool_t to_obs,
 void readProfile(AtomicLine *line, int lamu, double *phi)
 {
   const char routineName[] = "readProfile";
+  register int n;
 
   int    Nrecphi, NrecSkip;
   bool_t result = TRUE;
@@ -368,6 +369,15 @@ void readProfile(AtomicLine *line, int lamu, double *phi)
   } else
     Nrecphi = 1;
   
+  /* --- Profiles stored in single precision in memory -- ---------- */
+
+  if (line->storage == PROFILE_FLOAT) {
+    float *phi_float = line->phi_float[lamu];
+    for (n = 0;  n < Nrecphi*atmos.Nspace;  n++)
+      phi[n] = (double) phi_float[n];
+    return;
+  }
+
   recordsize = Nrecphi * atmos.Nspace * sizeof(double);
   offset     = NrecSkip * atmos.Nspace * sizeof(double) * lamu;
 
@@ -383,6 +393,7 @@ void readProfile(AtomicLine *line, int lamu, double *phi)
 void writeProfile(AtomicLine *line, int lamu, double *phi)
 {
   const char routineName[] = "writeProfile";
+  register int n;
 
   int    Nrecphi;
   bool_t result = TRUE;
@@ -397,6 +408,13 @@ void writeProfile(AtomicLine *line, int lamu, double *phi)
   } else
     Nrecphi = 1;
 
+  if (line->storage == PROFILE_FLOAT) {
+    float *phi_float = line->phi_float[lamu];
+    for (n = 0;  n < Nrecphi*atmos.Nspace;  n++)
+      phi_float[n] = (float) phi[n];
+    return;
+  }
+
   recordsize = Nrecphi * atmos.Nspace * sizeof(double);
   offset     = recordsize * lamu;
 
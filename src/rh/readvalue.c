@@ -411,6 +411,8 @@ void setstartValue(char *value, void *pointer)
     startvalue = NEW_J;
   else if (!strcmp(value, "OLD_J"))
     startvalue = OLD_J;
+  else if (!strcmp(value, "ESCAPE_PROBABILITY"))
+    startvalue = PESC;
   else {
     sprintf(messageStr,
              "Invalid value for keyword STARTING_J: %s", value);
@@ -447,6 +449,50 @@ void setnesolution(char *value, void *pointer)
 }
 /* ------- end ---------------------------- setnesolution.c --------- */
 
+/* ------- begin -------------------------- setVoigtTable.c ------- */
+
+void setVoigtTable(char *value, void *pointer)
+{
+  const char routineName[] = "setVoigtTable";
+
+  enum VoigtTableOrder order = VOIGT_TABLE_NONE;
+
+  if (!strcmp(value, "NONE"))
+    order = VOIGT_TABLE_NONE;
+  else if (!strcmp(value, "BILINEAR"))
+    order = VOIGT_TABLE_BILINEAR;
+  else if (!strcmp(value, "BICUBIC"))
+    order = VOIGT_TABLE_BICUBIC;
+  else {
+    sprintf(messageStr,
+	     "Invalid value for keyword VOIGT_TABLE: %s", value);
+    Error(ERROR_LEVEL_2, routineName, messageStr);
+  }
+  memcpy(pointer, &order, sizeof(enum_t));
+}
+/* ------- end ---------------------------- setVoigtTable.c ------- */
+
+/* ------- begin -------------------------- setAccelMethod.c ------ */
+
+void setAccelMethod(char *value, void *pointer)
+{
+  const char routineName[] = "setAccelMethod";
+
+  enum AccelMethod method = ACCEL_NG;
+
+  if (!strcmp(value, "NG"))
+    method = ACCEL_NG;
+  else if (!strcmp(value, "ANDERSON"))
+    method = ACCEL_ANDERSON;
+  else {
+    sprintf(messageStr,
+	     "Invalid value for keyword ACCELERATION: %s", value);
+    Error(ERROR_LEVEL_2, routineName, messageStr);
+  }
+  memcpy(pointer, &method, sizeof(enum_t));
+}
+/* ------- end ---------------------------- setAccelMethod.c ------ */
+
 /* ------- begin -------------------------- setPRDangle.c --------- */
 
 void setPRDangle(char *value, void *pointer)
@@ -28,6 +28,9 @@ enum solution       {UNKNOWN=-1, LTE_POPULATIONS, ZERO_RADIATION,
 enum StokesMode     {NO_STOKES, FIELD_FREE, POLARIZATION_FREE, FULL_STOKES};
 enum PRDangle       {PRD_ANGLE_INDEP, PRD_ANGLE_APPROX, PRD_ANGLE_DEP};
 enum VoigtAlgorithm {ARMSTRONG, RYBICKI, HUI_ETAL, HUMLICEK, LOOKUP};
+enum VoigtTableOrder {VOIGT_TABLE_NONE, VOIGT_TABLE_BILINEAR,
+                      VOIGT_TABLE_BICUBIC};
+enum AccelMethod    {ACCEL_NG, ACCEL_ANDERSON};
 
 
 #define  MAX_LINE_SIZE      512
@@ -127,6 +130,11 @@ double cubeconvol(int Nx, int Ny, double *f, double x, double y);
 
 void   GaussLeg(double x1, double x2, double *x, double *w, int n);
 double Voigt(double a, double v, double *F, enum VoigtAlgorithm algorithm);
+void   VoigtN(int N, double *a, double *v, double *H, double *F,
+	      enum VoigtAlgorithm algorithm);
+void   initVoigtTable(enum VoigtTableOrder order, int Na, int Nv);
+void   freeVoigtTable(void);
+void   VoigtTableAccuracy(double *maxerr_H, double *maxerr_F);
 double gammln(double xx);
      
 void   w2(double dtau, double *w);
@@ -94,6 +94,13 @@
        LTE populations and collisions, and chemical equilibria are
        evaluated.
 
+ Note: Background_ray_j is used for the output ray once the populations
+       have converged (calculateRay). The electron density, LTE
+       populations, collisions and chemical equilibria are those of the
+       converged solution, and only the wavelengths whose records depend
+       on the angle (background lines in a moving atmosphere or polarized
+       lines) are recomputed.
+
  Note: Record numbers stored in atmos.backgrrecno refer to records
        of the size atmos.Nspace. If a polarized line is present 9
        (4 + 4 + 1, no magneto-optical effects), or 12 (7 + 4 +1, with
@@ -139,6 +146,7 @@ extern BackgroundData bgdat;
 extern rhinfo io;
 extern rhbgmem *bmem;
 extern MPI_t mpi;
+extern rhstat rhStats;
 
 /* --- Routines to keep the background opacities in memory 
    Author: Jaime de la Cruz Rodriguez (ISP-SU 2015)
@@ -168,6 +176,22 @@ void allocateBack(int nspect){
     
     
   bmem[nspect].allocated = true;
+  bmem[nspect].Nspace = atmos.Nspace;
+}
+
+void freeBack(int nspect){
+
+  /* --- Release the records of one wavelength, the number of depth 
+     points can change between calls (adaptive depth grid) --- */
+  
+  if(bmem[nspect].chi_b  != NULL) freeMatrix((void **) bmem[nspect].chi_b);
+  if(bmem[nspect].eta_b  != NULL) freeMatrix((void **) bmem[nspect].eta_b);
+  if(bmem[nspect].sca_b  != NULL) freeMatrix((void **) bmem[nspect].sca_b);
+  if(bmem[nspect].chip_b != NULL) freeMatrix((void **) bmem[nspect].chip_b);
+
+  bmem[nspect].chi_b = bmem[nspect].eta_b = NULL;
+  bmem[nspect].sca_b = bmem[nspect].chip_b = NULL;
+  bmem[nspect].allocated = false;
 }
 
 
@@ -180,6 +204,9 @@ int writeBackground_j(int la, int mu, bool_t to_obs,
   long recnum =  2*mu + to_obs, reclen = atmos.Nspace*sizeof(double);
   int nstokes = 1;
 
+  if(bmem[la].allocated && (bmem[la].Nspace != atmos.Nspace))
+    freeBack(la);
+  
   if(!bmem[la].allocated)
     allocateBack(la);
 
@@ -310,7 +337,7 @@ void init_Background_j(){
 }
 
 
-void Background_j(bool_t write_analyze_output, bool_t equilibria_only)
+static void background_j(bool_t equilibria_only, bool_t ray_only)
 {
   const char routineName[] = "Background_j";
   register int k, nspect, n, mu, to_obs;
@@ -320,27 +347,34 @@ void Background_j(bool_t write_analyze_output, bool_t equilibria_only)
   int     index, Nfudge, NrecStokes;
   double *chi, *eta, *scatt, wavelength, *thomson, *chi_ai, *eta_ai, *sca_ai,
     Hmin_fudge, scatt_fudge, metal_fudge, *lambda_fudge, **fudge,
-    *Bnu, *chi_c, *eta_c, *sca_c, *chip, *chip_c;
+    *Bnu, *chi_c, *eta_c, *sca_c, *chip, *chip_c, t0;
   Atom   *He;
   Element *element;
   flags   backgrflags;
   char    file_background[MAX_MESSAGE_LENGTH], *fext = FILE_EXT;
 
 
+  /* --- Output ray: nothing depends on the angle in a static
+         atmosphere without magnetic fields --         -------------- */
+  
+  if (ray_only && !(atmos.moving || atmos.Stokes)) return;
+
   getCPU(2, TIME_START, NULL);
 
-  if (input.solve_ne == ONCE ) {
-    //    fromscratch = TRUE; //(input.solve_ne == ONCE  ||
-    Solve_ne(atmos.ne, TRUE);
-  }
-  SetLTEQuantities();
-
-  if (input.NonICE)
-    readMolecules(MOLECULAR_CONCENTRATION_FILE);
-  else{
-    ChemicalEquilibrium(N_MAX_CHEM_ITER, CHEM_ITER_LIMIT);
-    if(mpi.stop){
-      return;
+  if (!ray_only) {
+    if (input.solve_ne == ONCE ) {
+      //    fromscratch = TRUE; //(input.solve_ne == ONCE  ||
+      Solve_ne(atmos.ne, TRUE);
+    }
+    SetLTEQuantities();
+
+    if (input.NonICE)
+      readMolecules(MOLECULAR_CONCENTRATION_FILE);
+    else{
+      ChemicalEquilibrium(N_MAX_CHEM_ITER, CHEM_ITER_LIMIT);
+      if(mpi.stop){
+	return;
+      }
     }
   }
   if (equilibria_only) {
@@ -353,6 +387,7 @@ void Background_j(bool_t write_analyze_output, bool_t equilibria_only)
   }
 
   getCPU(3, TIME_START, NULL);
+  t0 = getWallTime();
 
   /* Get fudge data */
   lambda_fudge = bgdat.lambda_fudge;
@@ -435,6 +470,13 @@ void Background_j(bool_t write_analyze_output, bool_t equilibria_only)
          emissivity contributions. This is the main loop --  -------- */
 
   for (nspect = 0;  nspect < spectrum.Nspect;  nspect++) {
+
+    /* --- Output ray: keep the angle-independent records -- ------- */
+
+    if (ray_only && !(atmos.backgrflags[nspect].hasline &&
+		      (atmos.moving || atmos.backgrflags[nspect].ispolarized)))
+      continue;
+    
     wavelength = spectrum.lambda[nspect];
 
     /* --- The Planck function at this wavelength --   -------------- */
@@ -750,6 +792,7 @@ void Background_j(bool_t write_analyze_output, bool_t equilibria_only)
   
  
   getCPU(3, TIME_POLL, "Background Opacity");
+  rhStats.t_background += getWallTime() - t0;
 
   /* --- Free the temporary space allocated in the ff routines -- --- */
 
@@ -784,4 +827,14 @@ void Background_j(bool_t write_analyze_output, bool_t equilibria_only)
   
   getCPU(2, TIME_POLL, "Total Background");
 }
+
+void Background_j(bool_t write_analyze_output, bool_t equilibria_only)
+{
+  background_j(equilibria_only, FALSE);
+}
+
+void Background_ray_j(void)
+{
+  background_j(FALSE, TRUE);
+}
 /* ------- end ---------------------------- Background.c ------------ */
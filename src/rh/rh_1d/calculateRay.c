@@ -27,11 +27,37 @@ extern rhinfo io;
 
 extern void Bproject_los(void);
 
+/* --- Point the rows of a matrix allocated for at least Nrow x Ncol
+       elements to a stride of Ncol, without reallocating. initSolution_j
+       reallocates the intensities for atmos.Nrays at the next synthesis -- */
+
+static double **reshapeRays(double **M, int Nrow, int Ncol)
+{
+  register int i;
+
+  if (M == NULL) return matrix_double(Nrow, Ncol);
+  for (i = 1;  i < Nrow;  i++) M[i] = M[0] + i*Ncol;
+
+  return M;
+}
+
+static void freeRays(double ***M)
+{
+  if (*M != NULL) freeMatrix((void **) *M);
+  *M = NULL;
+}
+
 void calculateRay(void) {
-  /* performs necessary reallocations and inits, and solves for ray */
   
-  int i, nact, ierror, mu,k;
-  bool_t analyze_output, equilibria_only,prdh_limit_mem_save;
+  /* --- Emergent spectrum for the output ray once the populations
+         have converged. Populations, collisional rates and the
+         angle-independent background are kept, the profiles and
+         background records that depend on the angle are recomputed
+         for atmos.Nrays = 1 in the arrays allocated for the
+         iterations --                                 -------------- */
+  
+  int i, nact, mu,k;
+  bool_t prdh_limit_mem_save;
   Atom *atom;
   AtomicLine *line;
   
@@ -52,78 +78,43 @@ void calculateRay(void) {
     Bproject_los();
   }
   
-  /* Must calculate background opacity for new ray, need some prep first */
+  /* --- Line profiles for the new angle, only if they depend on it.
+         Profile() reuses the arrays allocated for the iterations.
+         With FULL_OUTPUT_RAY (reference for src/checks/check_ray)
+         all profiles are recomputed and the collisions freed -- */
+  
   for (nact = 0; nact < atmos.Nactiveatom; nact++) {
     atom = atmos.activeatoms[nact];
-    
-    /* Rewind atom files to point just before collisional data */
-    // if ((ierror = fseek(atom->fp_input, io.atom_file_pos[nact], SEEK_SET))) {
-    //  sprintf(messageStr, "Unable to rewind atom file for %s", atom->ID);
-    //  Error(ERROR_LEVEL_2, "rhf1df", messageStr);
-    // }
-	
-    /* Free collisions matrix, going to be re-allocated in background */
-    if (atom->C != NULL) {
+
+    if (input.full_ray && atom->C != NULL) {
       freeMatrix((void **) atom->C);
       atom->C = NULL;
     }
-	
-    /* Recalculate line profiles for new angle */
     for (i = 0; i < atom->Nline; i++) {
       line = &atom->line[i];
-	  
-      if (line->phi  != NULL) {
-	freeMatrix((void **) line->phi);
-	line->phi = NULL;
-      }
-      if (line->wphi != NULL) {
-	free(line->wphi);
-	line->wphi = NULL;
-      }
-      
-      if (atmos.moving && line->polarizable && (input.StokesMode>FIELD_FREE)) {
-	if (line->phi_Q != NULL) {
-	  freeMatrix((void **) line->phi_Q);
-	  line->phi_Q = NULL;
-	}
-	if (line->phi_U != NULL) {
-	  freeMatrix((void **) line->phi_U);
-	  line->phi_U = NULL;
-	}
-	if (line->phi_V != NULL) {
-	  freeMatrix((void **) line->phi_V);
-	  line->phi_V = NULL;
-	}
-	if (input.magneto_optical) {
-	  if (line->psi_Q != NULL) {
-	    freeMatrix((void **) line->psi_Q);
-	    line->psi_Q = NULL;
-	  }
-	  if (line->psi_U != NULL) {
-	    freeMatrix((void **) line->psi_U);
-	    line->psi_U = NULL;
-	  }
-	  if (line->psi_V != NULL) {
-	    freeMatrix((void **) line->psi_V);
-	    line->psi_V = NULL;
-	  }
-	}
-      }	  
-	  	  
-      Profile(line);  
+
+      if (input.full_ray || atmos.moving ||
+	  (line->polarizable && (input.StokesMode > FIELD_FREE)))
+	Profile(line);
     }
   }
       
-  /* reallocate intensities for correct number of rays */
-  if (spectrum.I != NULL) freeMatrix((void **) spectrum.I);
-  spectrum.I = matrix_double(spectrum.Nspect, atmos.Nrays);
+  /* --- Intensities of one ray in the storage of atmos.Nrays,
+         or freshly allocated with FULL_OUTPUT_RAY --  -------------- */
+
+  if (input.full_ray) {
+    freeRays(&spectrum.I);
+    if (atmos.Stokes || input.backgr_pol) {
+      freeRays(&spectrum.Stokes_Q);
+      freeRays(&spectrum.Stokes_U);
+      freeRays(&spectrum.Stokes_V);
+    }
+  }
+  spectrum.I = reshapeRays(spectrum.I, spectrum.Nspect, atmos.Nrays);
   if (atmos.Stokes || input.backgr_pol) {
-    if (spectrum.Stokes_Q != NULL) freeMatrix((void **) spectrum.Stokes_Q);
-    spectrum.Stokes_Q = matrix_double(spectrum.Nspect, atmos.Nrays);
-    if (spectrum.Stokes_U != NULL) freeMatrix((void **) spectrum.Stokes_U);
-    spectrum.Stokes_U = matrix_double(spectrum.Nspect, atmos.Nrays);
-    if (spectrum.Stokes_V != NULL) freeMatrix((void **) spectrum.Stokes_V);
-    spectrum.Stokes_V = matrix_double(spectrum.Nspect, atmos.Nrays);
+    spectrum.Stokes_Q = reshapeRays(spectrum.Stokes_Q, spectrum.Nspect, atmos.Nrays);
+    spectrum.Stokes_U = reshapeRays(spectrum.Stokes_U, spectrum.Nspect, atmos.Nrays);
+    spectrum.Stokes_V = reshapeRays(spectrum.Stokes_V, spectrum.Nspect, atmos.Nrays);
   }
 
   if (input.PRD_angle_dep == PRD_ANGLE_APPROX &&  atmos.NPRDactive > 0) {
@@ -146,8 +137,15 @@ void calculateRay(void) {
     input.prdh_limit_mem = TRUE;
     
   }
-      
-  Background_j(analyze_output=FALSE, equilibria_only=FALSE);
+
+  /* --- Background records of the wavelengths with angle-dependent
+         lines, without recomputing ne, LTE populations and collisions.
+         FULL_OUTPUT_RAY recomputes the whole background -- ---------- */
+  
+  if (input.full_ray)
+    Background_j(FALSE, FALSE);
+  else
+    Background_ray_j();
 
   /* --- Solve radiative transfer for ray --           -------------- */
   solveSpectrum(FALSE, FALSE, 0, TRUE);
@@ -18,7 +18,8 @@
                                zero radiation field
          OLD_POPULATIONS    -- Read old populations from file
          OLD_POPS_AND_J     -- Read both old populations and J from file
-         ESCAPE_PROBABILITY -- Not yet implemented
+         ESCAPE_PROBABILITY -- Iterate the statistical equilibrium with
+                               escape probability rates (see pesc.c)
          OLD_J              -- Use mean intensities from previous solution
                                (Only implemented for wavelength_table).
 
@@ -47,6 +48,8 @@
 //#include "mtime.h"
 
 #define IMU_FILE_TEMPLATE "scratch/Imu_p%d.dat"
+#define PESC_MAX_ITER     100
+#define PESC_MAX_CHANGE   1.0E-02
 
 /* --- Function prototypes --                          -------------- */
 #define min(a,b) (((a)<(b))?(a):(b))
@@ -545,7 +548,52 @@ void initSolution_alloc2(int myrank) {
 
 
 
-void initSolution_j( int myrank, int savepop)
+/* ------- begin -------------------------- initAtomSolution.c ------ */
+
+void initAtomSolution(Atom *atom, int nact, int warm_start)
+{
+  register int k, i;
+  int conv = 0;
+
+  /* --- Initial populations of active atom nact. Also used by
+         read_populations for the atoms that it cannot warm start -- */
+
+  switch(atom->initial_solution) {
+  case LTE_POPULATIONS:
+    for (i = 0;  i < atom->Nlevel;  i++) {
+      for (k = 0;  k < atmos.Nspace;  k++)
+	atom->n[i][k] = atom->nstar[i][k];
+    }
+    break;
+
+  case ZERO_RADIATION:
+    zeroRadiation(atom, nact);
+    break;
+
+  case PESC:
+
+    /* --- Escape probability iterations starting from the zero
+           radiation solution. Fall back to the latter if they do
+           not converge. Not needed when the populations of a
+           previous solution are copied in (warm_start) -- ------- */
+
+    zeroRadiation(atom, nact);
+    if (warm_start) break;
+
+    for (i = 0;  i < PESC_MAX_ITER;  i++) {
+      conv = pesc(atom, i, PESC_MAX_CHANGE);
+      if (conv) break;
+    }
+    if (conv != 1) zeroRadiation(atom, nact);
+    break;
+
+  default:;
+    break;
+  }
+}
+/* ------- end ---------------------------- initAtomSolution.c ------ */
+
+void initSolution_j( int myrank, int savepop, int warm_start)
 {
   const char routineName[] = "initSolution_j";
   register int k, i, ij, nspect, n, nact;
@@ -556,7 +604,6 @@ void initSolution_j( int myrank, int savepop)
   Atom       *atom;
   AtomicLine *line;
   AtomicContinuum *continuum;
-  int conv = 0;
   getCPU(2, TIME_START, NULL);
   
 
@@ -588,33 +635,7 @@ void initSolution_j( int myrank, int savepop)
       }
     }
 
-    switch(atom->initial_solution) {
-    case LTE_POPULATIONS:
-      for (i = 0;  i < atom->Nlevel;  i++) {
-	for (k = 0;  k < atmos.Nspace;  k++)
-	  atom->n[i][k] = atom->nstar[i][k];
-      }
-      break;
-
-    case ZERO_RADIATION:
-      zeroRadiation(atom, nact);
-	    
-      break;
-
-    case PESC:
-      //readPopulations(atom);
-      zeroRadiation(atom, nact);
-      for(i=0; i<100; i++){
-	conv = pesc(atom, i, 1.e-2);
-	//if(i>2)exit(0);
-	if(conv) break;
-      }
-      if(!conv) zeroRadiation(atom, nact);
-      break;
-
-    default:;
-    break;
-    }
+    initAtomSolution(atom, nact, warm_start);
   }
   /* --- Now the molecules that are active --          -------------- */
   
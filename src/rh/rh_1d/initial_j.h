@@ -3,7 +3,8 @@
 //#include "rh.h"
 //#include "atom.h"
 
-void initSolution_j( int myrank, int save_pop);
+void initSolution_j( int myrank, int save_pop, int warm_start);
+void initAtomSolution(Atom *atom, int nact, int warm_start);
 void initSolution_alloc2(int myrank);
 
   
@@ -14,7 +14,7 @@ void hermitian_interpolation(int n, double *x, double *y, int nn, double *xp, do
     
     for(k=0;k<n;k++) bla[k] = log(y[k]);
     linpol<double,double>(n, x, bla, nn, xp, yp);
-    for(k=0;k<n;k++) yp[k] = exp(yp[k]);
+    for(k=0;k<nn;k++) yp[k] = exp(yp[k]);
 
     free(bla);
   }else{
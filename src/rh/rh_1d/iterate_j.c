@@ -33,6 +33,8 @@ typedef struct {
 /* --- Function prototypes --                          -------------- */
 
 void *Formal_pthread(void *argument);
+static struct Ng *initAccel(int N, enum AccelMethod method, int Norder,
+			    double *solution);
 
 
 /* --- Global variables --                             -------------- */
@@ -43,6 +45,9 @@ extern InputData input;
 extern char messageStr[];
 extern MPI_t mpi;
 
+rhstat rhStats = {0, 0, 0.0, 0.0, 0.0, 0.0};
+static double rhDeadline = 0.0;
+
 
 /* ------- begin -------------------------- Iterate.c --------------- */
 
@@ -53,7 +58,7 @@ void Iterate_j(int NmaxIter, double iterLimit, double *dpopmax_out)
 
   bool_t    eval_operator, write_analyze_output, equilibria_only, old_ne_flag = FALSE;
   int       Ngorder, nsum = 0;
-  double    dpopsmax, PRDiterlimit, cswitch;
+  double    dpopsmax, PRDiterlimit, cswitch, t0;
   Atom     *atom;
   Molecule *molecule;
 
@@ -63,21 +68,27 @@ void Iterate_j(int NmaxIter, double iterLimit, double *dpopmax_out)
   /* --- Initialize structures for Ng acceleration of population
          convergence --                                  ------------ */
 
+  /* --- Atoms can choose Ng or Anderson and its order in the atoms
+         file, molecules and ne use the ACCELERATION keyword -- ---- */
+
+  Ngorder = (input.accel == ACCEL_ANDERSON) ? input.Anderson_depth :
+    input.Ngorder;
+
   for (nact = 0;  nact < atmos.Nactiveatom;  nact++) {
     atom = atmos.activeatoms[nact];
-    atom->Ng_n = NgInit(atom->Nlevel*atmos.Nspace, input.Ngdelay,
-			input.Ngorder, input.Ngperiod, atom->n[0]);
+    atom->Ng_n = initAccel(atom->Nlevel*atmos.Nspace, atom->accel,
+			   atom->accel_order, atom->n[0]);
   }
   for (nact = 0;  nact < atmos.Nactivemol;  nact++) {
     molecule = atmos.activemols[nact];
     //Ngorder  = (input.accelerate_mols) ? input.Ngorder : 0;
 
-    molecule->Ng_nv = NgInit(molecule->Nv*atmos.Nspace, input.Ngdelay,
-			     input.Ngorder, input.Ngperiod, molecule->nv[0]);
+    molecule->Ng_nv = initAccel(molecule->Nv*atmos.Nspace, input.accel,
+				Ngorder, molecule->nv[0]);
   }
   
   if(input.solve_ne >= ITERATION_EOS)
-    atmos.ng_ne = NgInit(atmos.Nspace, input.Ngdelay, input.Ngorder,input.Ngperiod, atmos.ne );
+    atmos.ng_ne = initAccel(atmos.Nspace, input.accel, Ngorder, atmos.ne);
 
   
   /* --- Start of the main iteration loop --             ------------ */
@@ -100,6 +111,7 @@ void Iterate_j(int NmaxIter, double iterLimit, double *dpopmax_out)
   while ((niter <= NmaxIter || niter < 3)) {
     getCPU(2, TIME_START, NULL);
     mpi.iter = niter;
+    rhStats.Niter++;
     
     for (nact = 0;  nact < atmos.Nactiveatom;  nact++)
       initGammaAtom(atmos.activeatoms[nact], cswitch);
@@ -116,18 +128,31 @@ void Iterate_j(int NmaxIter, double iterLimit, double *dpopmax_out)
       nsum = 1;
       if(input.solve_ne >= ITERATION_EOS && atmos.ne_flag) nsum = 4;
       
+      /* --- Anderson has its own safeguard, delay only Ng -- --- */
+      
       for(nact = 0;  nact < atmos.Nactiveatom;  nact++){
-	atmos.activeatoms[nact]->Ng_n->Ndelay += nsum;	
+	if(atmos.activeatoms[nact]->Ng_n->method == ACCEL_NG)
+	  atmos.activeatoms[nact]->Ng_n->Ndelay += nsum;	
       }
-      if(input.solve_ne >= ITERATION_EOS) atmos.ng_ne->Ndelay += nsum;
+      if(input.solve_ne >= ITERATION_EOS && atmos.ng_ne->method == ACCEL_NG)
+	atmos.ng_ne->Ndelay += nsum;
       input.Ngdelay+=nsum;
     }
     
     sprintf(messageStr, "\n -- Iteration %3d\n", niter);
     Error(MESSAGE, routineName, messageStr);
+    t0 = getWallTime();
     dpopsmax = updatePopulations(niter);
+    rhStats.t_stateq += getWallTime() - t0;
     if (mpi.stop) return;
 
+    /* --- Out of wall-clock time, give up as if not converged -- -- */
+
+    if ((rhDeadline > 0.0) && (getWallTime() > rhDeadline)) {
+      mpi.stop = TRUE;
+      return;
+    }
+
     
     old_ne_flag = atmos.ne_flag;
     
@@ -214,6 +239,23 @@ void Iterate_j(int NmaxIter, double iterLimit, double *dpopmax_out)
 }
 /* ------- end ---------------------------- Iterate.c --------------- */
 
+/* ------- begin -------------------------- initAccel.c ------------- */
+
+static struct Ng *initAccel(int N, enum AccelMethod method, int Norder,
+			    double *solution)
+{
+  /* --- Ng or Anderson acceleration of the population iteration,
+         Norder is the Ng order or the Anderson history depth -- --- */
+
+  if (method == ACCEL_ANDERSON)
+    return AndersonInit(N, input.Anderson_delay, Norder,
+			input.Anderson_beta, input.Anderson_restart,
+			solution);
+  else
+    return NgInit(N, input.Ngdelay, Norder, input.Ngperiod, solution);
+}
+/* ------- end ---------------------------- initAccel.c ------------- */
+
 /* ------- begin -------------------------- solveSpectrum.c --------- */
 
 double solveSpectrum(bool_t eval_operator, bool_t redistribute, int iter, bool_t synth_all)
@@ -221,7 +263,7 @@ double solveSpectrum(bool_t eval_operator, bool_t redistribute, int iter, bool_t
   register int nspect, n, nt, k;
 
   int         Nthreads, lambda_max;
-  double      dJ, dJmax;
+  double      dJ, dJmax, t0 = getWallTime();
   pthread_t  *thread_id;
   threadinfo *ti;
 
@@ -278,11 +320,43 @@ double solveSpectrum(bool_t eval_operator, bool_t redistribute, int iter, bool_t
 
   getCPU(3, TIME_POLL,
 	 (eval_operator) ? "Spectrum & Operator" : "Solve Spectrum");
+  rhStats.t_formal += getWallTime() - t0;
 
   return dJmax;
 }
 /* ------- end ---------------------------- solveSpectrum.c --------- */
 
+/* ------- begin -------------------------- getRHStats.c ------------ */
+
+void getRHStats(rhstat *stat, bool_t reset)
+{
+  /* --- Return iteration counters and the time spent in the main
+         parts of the solver since the last reset --   -------------- */
+
+  if (stat) *stat = rhStats;
+
+  if (reset) {
+    rhStats.Niter = 0;
+    rhStats.NPRDiter = 0;
+    rhStats.t_eos = 0.0;
+    rhStats.t_background = 0.0;
+    rhStats.t_formal = 0.0;
+    rhStats.t_stateq = 0.0;
+  }
+}
+/* ------- end ---------------------------- getRHStats.c ------------ */
+
+/* ------- begin -------------------------- setRHDeadline.c --------- */
+
+void setRHDeadline(double deadline)
+{
+  /* --- Wall-clock time (getWallTime) after which Iterate_j stops,
+         deadline <= 0 removes the limit --           -------------- */
+
+  rhDeadline = deadline;
+}
+/* ------- end ---------------------------- setRHDeadline.c --------- */
+
 /* ------- begin -------------------------- Formal_pthread.c -------- */
 
 void *Formal_pthread(void *argument)
@@ -33,6 +33,7 @@ extern CommandLine commandline;
 //extern MPI_data mpi;
 extern char messageStr[];
 extern MPI_t mpi;
+extern rhstat rhStats;
 
 /* ------- begin -------------------------- Redistribute.c ---------- */
 
@@ -72,6 +73,7 @@ void Redistribute_j(int NmaxIter, double iterLimit, double iprec)
 
   niter = 1;
   while (niter <= NmaxIter) {
+    rhStats.NPRDiter++;
 
     drhomaxa = 0.0;
     for (nact = 0;  nact < atmos.Nactiveatom;  nact++) {
@@ -104,6 +104,7 @@ bool_t rhf1d(float muz, int rhs_ndep, double *rhs_T, double *rhs_rho,
 {
   
   bool_t write_analyze_output, equilibria_only, quiet = ((iverbose <= 1)? TRUE : FALSE);
+  bool_t warm_start;
   int    niter, nact, i, sNgperiod, sNgdelay, sPRDNITER,k;
   static int save_Nrays;
   static double save_muz, save_mux, save_muy, save_wmu;
@@ -136,6 +137,7 @@ bool_t rhf1d(float muz, int rhs_ndep, double *rhs_T, double *rhs_rho,
   atmos.moving = TRUE;
   atmos.Stokes = FALSE;
   atmos.Nspace = rhs_ndep;
+  geometry.Ndep = rhs_ndep; // can change between calls (adaptive depth grid)
   
   /* --- Read input data and initialize --             -------------- */
 
@@ -218,7 +220,7 @@ bool_t rhf1d(float muz, int rhs_ndep, double *rhs_T, double *rhs_rho,
     if(atmos.atoms[0].active) atmos.ne_flag = TRUE;
     if(save_pop && save_pop->ne_dep){
       double *tmp1 = (double*)calloc(atmos.Nspace,sizeof(double));
-      hermitian_interpolation((int)atmos.Nspace, save_pop->tau_ref, save_pop->ne_dep,
+      hermitian_interpolation((int)save_pop->ndep, save_pop->tau_ref, save_pop->ne_dep,
 			      (int)atmos.Nspace, geometry.tau_ref, tmp1, 1);
       
       
@@ -241,7 +243,12 @@ bool_t rhf1d(float muz, int rhs_ndep, double *rhs_T, double *rhs_rho,
     /* --- Init profiles, populations and scattering --- */
     
     getProfiles();
-    initSolution_j( myrank, savpop);
+
+    /* --- The saved populations replace the initial solution -- --- */
+
+    warm_start = (computing_derivatives || (input.solve_ne < ITERATION_EOS)) &&
+      (save_pop->pop != NULL) && (save_pop->nactive == atmos.Nactiveatom);
+    initSolution_j( myrank, savpop, warm_start);
 
     if(computing_derivatives || (input.solve_ne < ITERATION_EOS))
        read_populations(save_pop,0);
@@ -558,15 +565,19 @@ void read_populations(crhpop *save_pop, int flag){
   for(nact=0;nact < save_pop->nactive;nact++){
     atom = atmos.activeatoms[nact];
     
-    /* --- Check dimensions --- */
-    if(atom->Nlevel != save_pop->pop[nact].nlevel || atmos.Nspace != save_pop->ndep){
+    /* --- Check dimensions, the depth grid can differ (adaptive grid in STiC).
+       An atom whose saved level count does not match starts cold --- */
+    if(atom->Nlevel != save_pop->pop[nact].nlevel){
+      fprintf(stderr,"read_populations: %s has %d levels, %d saved: not warm started\n",
+	      atom->ID, atom->Nlevel, save_pop->pop[nact].nlevel);
+      initAtomSolution(atom, nact, FALSE);
       continue;
     }
     copied += 1;
     
     
     for(j= 0; j < atom->Nlevel; j++ ){
-      hermitian_interpolation((int)atmos.Nspace, save_pop->tau_ref, &save_pop->pop[nact].n[j*atmos.Nspace],
+      hermitian_interpolation((int)save_pop->ndep, save_pop->tau_ref, &save_pop->pop[nact].n[j*save_pop->ndep],
       		      (int)atmos.Nspace, geometry.tau_ref, tmp1, 1);      
       
       for(k = 0; k < atmos.Nspace; k++){
@@ -608,7 +619,7 @@ void read_populations(crhpop *save_pop, int flag){
 	    //memcpy(&line->rho_prd[0][0], save_pop->pop[nact].line[kr].rho,
 	    // 		   line->Nlambda*atmos.Nspace*sizeof(double));
 	    for(la=0;la<line->Nlambda;la++){
-	      hermitian_interpolation((int)atmos.Nspace, save_pop->tau_ref, &save_pop->pop[nact].line[kr].rho[la*atmos.Nspace],
+	      hermitian_interpolation((int)save_pop->ndep, save_pop->tau_ref, &save_pop->pop[nact].line[kr].rho[la*save_pop->ndep],
 	      			      (int)atmos.Nspace, geometry.tau_ref, line->rho_prd[la],0);
 	    }
 	  }else{
@@ -630,15 +641,15 @@ void read_populations(crhpop *save_pop, int flag){
   
   /* --- Copy radiation field --- */
   
-  if(spectrum.Nspect == save_pop->nw || atmos.Nspace == save_pop->ndep){
+  if(spectrum.Nspect == save_pop->nw){
     for(la=0;la<spectrum.Nspect;la++){
-      hermitian_interpolation((int)atmos.Nspace, save_pop->tau_ref, &save_pop->J[la*atmos.Nspace],
+      hermitian_interpolation((int)save_pop->ndep, save_pop->tau_ref, &save_pop->J[la*save_pop->ndep],
       			      (int)atmos.Nspace, geometry.tau_ref, spectrum.J[la],0);
       //memcpy(spectrum.J[la], &save_pop->J[la*atmos.Nspace], atmos.Nspace*sizeof(double));
     
     
       if(input.backgr_pol){
-	hermitian_interpolation((int)atmos.Nspace, save_pop->tau_ref, &save_pop->J20[la*atmos.Nspace],
+	hermitian_interpolation((int)save_pop->ndep, save_pop->tau_ref, &save_pop->J20[la*save_pop->ndep],
 				      (int)atmos.Nspace, geometry.tau_ref, spectrum.J20[la],0);
 	//memcpy(spectrum.J20[la], &save_pop->J20[la*atmos.Nspace], atmos.Nspace*sizeof(double));
 	
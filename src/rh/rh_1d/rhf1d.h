@@ -13,6 +13,7 @@ extern "C" {
   
   typedef struct{
     bool_t allocated;
+    int Nspace;
     double **chi_b, **eta_b, **sca_b, **chip_b;
   } rhbgmem;
   
@@ -38,6 +39,15 @@ extern "C" {
     crhatom *pop;
   } crhpop;
   
+  typedef struct{
+    long Ncall, Npoint, Nskip, Nwarm, Niter;
+  } chemstat;
+
+  typedef struct{
+    long Niter, NPRDiter;
+    double t_eos, t_background, t_formal, t_stateq;
+  } rhstat;
+
   typedef struct{
     int rank, verb, iter;
     bool_t stop;
@@ -51,6 +61,9 @@ extern "C" {
   void UpdateAtmosDep(void);
   void Initvarious();
   void calculateRay(void);
+  void getChemEquilStats(chemstat *stat, bool_t reset);
+  void getRHStats(rhstat *stat, bool_t reset);
+  void setRHDeadline(double deadline);
 
   bool_t rhf1d(float muz, int rhs_ndep, double *rhs_T, double *rhs_rho, 
 	       double *rhs_nne, double *rhs_vturb, double *rhs_v, 
@@ -162,6 +162,7 @@ void init_info_lambda( )
     
     //    spectrum.Jgas = matrix_double(nwav, atmos.Nspace);
     spectrum.Jgas = d2dim(-1, nwav, 0, atmos.Nspace-1);
+    spectrum.NspaceJgas = atmos.Nspace;
     
     for(nlines=0; nlines<spectrum.nPRDlines; nlines++){
       lin = spectrum.PRDlines[nlines];
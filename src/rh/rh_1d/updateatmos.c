@@ -125,9 +125,11 @@ void UpdateAtmosDep(void) {
       atom->C = NULL;
     }
 
-    /* Allocate Gamma, as iterate released the memory */
-    if(atom->Gamma == NULL)
-      atom->Gamma = matrix_double(SQ(atom->Nlevel), atmos.Nspace);
+    /* Allocate Gamma, as iterate released the memory. It is still
+       there if the previous call stopped before iterating, and
+       Nspace may have changed since then */
+    if(atom->Gamma != NULL) freeMatrix((void **) atom->Gamma);
+    atom->Gamma = matrix_double(SQ(atom->Nlevel), atmos.Nspace);
 
     
     /* Initialise some continuum quantities */
@@ -151,6 +153,10 @@ void UpdateAtmosDep(void) {
 	freeMatrix((void **) line->phi);
 	line->phi = NULL;
       }
+      if (line->phi_float != NULL) {
+	freeMatrix((void **) line->phi_float);
+	line->phi_float = NULL;
+      }
       if (line->wphi != NULL) {
 	free(line->wphi);
 	line->wphi = NULL;
@@ -284,6 +290,7 @@ void UpdateAtmosDep(void) {
     
     if (molecule->active) {
       /* Allocate Gamma, as iterate released the memory */
+      if(molecule->Gamma != NULL) freeMatrix((void **) molecule->Gamma);
       molecule->Gamma = matrix_double(SQ(molecule->Nv), atmos.Nspace);
       
       LTEmolecule(molecule);
@@ -316,6 +323,17 @@ void UpdateAtmosDep(void) {
 
   }
 
+  /* --- Gas-frame mean intensity of the PRD lines. The rows are referenced 
+     by line->Jgas, so only the data block is reallocated --- */
+  
+  if (spectrum.Jgas != NULL && spectrum.NspaceJgas != atmos.Nspace) {
+    free(spectrum.Jgas[-1]);
+    spectrum.Jgas[-1] = (double *) calloc((spectrum.nJlam+2) * atmos.Nspace,
+					  sizeof(double));
+    for (la = 0;  la <= (int)spectrum.nJlam;  la++)
+      spectrum.Jgas[la] = spectrum.Jgas[la-1] + atmos.Nspace;
+    spectrum.NspaceJgas = atmos.Nspace;
+  }
 
   return;
 }
@@ -312,7 +312,8 @@ void PRDAngleScatter(AtomicLine *PRDline,
   int     Np, Nread, Nwrite, ij, lamu;
   double *v_emit, v0, vN, *v_abs = NULL, *vp = NULL, *wv = NULL,
          *rii = NULL, *adamp, *Jbar, cDop, *RIInorm, *I = NULL,
-        **Imup, *Ik, *Pj, *gamma, **v_los, *phi_emit, wmup, *sv;
+        **Imup, *Ik, *Pj, *gamma, **v_los, *phi_emit, wmup, *sv,
+        *phi_buf = NULL;
   Atom *atom;
   AtomicLine *line;
   AtomicContinuum *continuum;
@@ -370,6 +371,12 @@ void PRDAngleScatter(AtomicLine *PRDline,
   RIInorm = (double *) malloc(atmos.Nspace * sizeof(double));
   sv      = (double *) malloc(atmos.Nspace * sizeof(double));
 
+  /* --- Profiles not kept in double precision are unpacked into a
+         scratch buffer large enough for all Stokes records -- ----- */
+
+  if (PRDline->storage != PROFILE_DOUBLE)
+    phi_buf = (double *) malloc(7*atmos.Nspace * sizeof(double));
+
   /* --- Evaluate first the total rate Pj out of the line's upper level
          and then the coherency fraction gamma --      -------------- */
 
@@ -423,7 +430,14 @@ void PRDAngleScatter(AtomicLine *PRDline,
       for (to_obs = 0;  to_obs <= 1;  to_obs++) {
 	lamu = 2*(atmos.Nrays*la + mu) + to_obs;
 
-	if (atmos.moving ||
+	if (PRDline->storage != PROFILE_DOUBLE) {
+	  phi_emit = phi_buf;
+	  if (atmos.moving ||
+	      (PRDline->polarizable && input.StokesMode > FIELD_FREE))
+	    readProfile(PRDline, lamu, phi_emit);
+	  else
+	    readProfile(PRDline, la, phi_emit);
+	} else if (atmos.moving ||
 	    (PRDline->polarizable && input.StokesMode > FIELD_FREE))
 	  phi_emit = PRDline->phi[lamu];
 	else
@@ -596,6 +610,7 @@ void PRDAngleScatter(AtomicLine *PRDline,
   free(gamma);  free(Pj);
   free(wv);     free(I);       free(rii);
   free(vp);     free(Jbar);   free(RIInorm); free(sv);
+  if (phi_buf != NULL) free(phi_buf);
 
   sprintf(messageStr, "Scatter Int %5.1f", PRDline->lambda0);
   getCPU(3, TIME_POLL, messageStr);
@@ -52,6 +52,7 @@ typedef struct {
     **Jgas, **Ilast, **v_los;
   ActiveSet *as;
   unsigned int    *nc, *iprdh, nJlam;
+  int NspaceJgas;
   double *cprdh;
   double *Jlam;
   linf *linfo;
@@ -27,6 +27,7 @@ typedef struct {
 
 void getCPU(int level, enum CPUaction action, char *label);
 void printTotalCPU(void);
+double getWallTime(void);
 
 #endif /* !__STATISTICS_H__ */
 
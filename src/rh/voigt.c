@@ -28,7 +28,7 @@
           Relative accuracy 1.0E-04. Also calculates Faraday-Voigt
           function needed in Stokes radiative transfer.
 
-       -- Lookup table. 
+       -- Lookup table (see initVoigtTable and VoigtN below).
 
     Note: If a FORTRAN 90 compiler is available FORTRAN's builtin
           complex arithmatic can be used by defining HAVE_F90 and
@@ -70,7 +70,7 @@ complex Humlicek3(complex z);
 complex Humlicek4(complex z);
 #endif
 
-double VoigtLookup(double a, double v);
+double VoigtLookup(double a, double v, double *F);
 
 
 /* --- Global variables --                             -------------- */
@@ -98,7 +98,7 @@ double Voigt(double a, double v, double *F, enum VoigtAlgorithm algorithm)
     voigt = VoigtHumlicek(a, v, F);
     break;
   case LOOKUP:
-    voigt = VoigtLookup(a, v);
+    voigt = VoigtLookup(a, v, F);
     break;
   default:
     sprintf(messageStr, "Unregognized Voigt algorithm: %d", algorithm);
@@ -421,101 +421,208 @@ double VoigtHumlicek(double a, double v, double *F)
 
 /* ------- begin -------------------------- VoigtLookup.c ----------- */
 
-#define TABLE_ALGORITHM  RYBICKI
+/* --- Tabulated Voigt and Faraday-Voigt functions.
+
+       The table is built once by initVoigtTable (called from
+       readAtomicModels) and is read-only afterwards, so that it can be
+       shared by all threads. Interpolation is in log(a) and linear v,
+       either bilinear or with Keys' cubic convolution kernel (bicubic).
+       The grid is padded with one extra point on each side (two at the
+       upper end in v) so that the cubic stencil never needs boundary
+       handling. Symmetry H(a, -v) = H(a, v), F(a, -v) = -F(a, v) is used
+       to fold negative v. Outside the tabulated domain the Humlicek
+       approximation is evaluated directly (it is cheapest there).
+       --                                              -------------- */
+
+#define TABLE_A_MIN  1.0E-05
+#define TABLE_A_MAX  10.0
+#define TABLE_V_MAX  15.0
 
-#define A_MIN  1.0E-05
-#define A_MAX  1.0E-02
-#define N_A    50
+#define N_A_DEFAULT  160
+#define N_V_DEFAULT  1501
 
-#define V_MIN_LIN    0.0
-#define V_MAX_LIN    4.0
-#define N_V_LIN      400    
-#define V_MIN_LOG V_MAX_LIN
-#define V_MAX_LOG 1000.0
-#define N_V_LOG       30
-     
+typedef struct {
+  enum   VoigtTableOrder order;
+  int    Na, Nv, stride;
+  double log_a_min, dlog_a, dv, *H, *F;
+} VoigtTable;
 
-/* --- Compute lookup table of Voigt function when called
-       for the first time. With subsequent calls the lookup table is
-       interpolated (bi-linearly for the moment) --    -------------- */
+static VoigtTable voigtTable = {VOIGT_TABLE_NONE, 0, 0, 0,
+				0.0, 0.0, 0.0, NULL, NULL};
 
-double VoigtLookup(double a, double v)
+double VoigtLookup(double a, double v, double *F)
 {
-  const char routineName[] = "VoigtLookup";
-  register int n, m;
+  double H;
 
-  static bool_t initialize = TRUE, hunt;
-  static double *a_table, *v_table_lin, *v_table_log,
-               **table_lin, **table_log, voigt, log_a;
+  VoigtN(1, &a, &v, &H, F, LOOKUP);
+  return H;
+}
+/* ------- end ---------------------------- VoigtLookup.c ----------- */
 
-  double da, dv;
+/* ------- begin -------------------------- initVoigtTable.c -------- */
 
-  v = fabs(v);
+void initVoigtTable(enum VoigtTableOrder order, int Na, int Nv)
+{
+  const char routineName[] = "initVoigtTable";
+  register int n, m;
 
-  if (a < A_MIN || a > A_MAX || v > V_MAX_LOG) {
-    sprintf(messageStr,
-	    "Arguments (%E, %E) outside domain table", a, v);
-    Error(WARNING, routineName, messageStr);
+  double a, v, *H, *F, maxerr_H, maxerr_F;
+
+  if (order == VOIGT_TABLE_NONE || voigtTable.H != NULL) return;
 
-    return Voigt(a, v, NULL, TABLE_ALGORITHM);
+  if (Na <= 0) Na = N_A_DEFAULT;
+  if (Nv <= 0) Nv = N_V_DEFAULT;
+  if (Na < 4 || Nv < 4) {
+    sprintf(messageStr,
+	    "Voigt table needs at least 4 points in a and v (%d, %d)",
+	    Na, Nv);
+    Error(ERROR_LEVEL_2, routineName, messageStr);
+  }
+  voigtTable.Na = Na;
+  voigtTable.Nv = Nv;
+  voigtTable.stride = Nv + 3;
+  voigtTable.log_a_min = log(TABLE_A_MIN);
+  voigtTable.dlog_a = (log(TABLE_A_MAX) - voigtTable.log_a_min) / (Na - 1);
+  voigtTable.dv = TABLE_V_MAX / (Nv - 1);
+
+  voigtTable.H = (double *) malloc((Na + 3) * voigtTable.stride *
+				   sizeof(double));
+  voigtTable.F = (double *) malloc((Na + 3) * voigtTable.stride *
+				   sizeof(double));
+
+  /* --- Row n and column m hold a = a_min * exp((n-1) * dlog_a)
+         and v = (m-1) * dv --                         -------------- */
+
+  for (n = 0;  n < Na + 3;  n++) {
+    a = exp(voigtTable.log_a_min + (n - 1) * voigtTable.dlog_a);
+    H = voigtTable.H + n * voigtTable.stride;
+    F = voigtTable.F + n * voigtTable.stride;
+    for (m = 0;  m < Nv + 3;  m++) {
+      v = (m - 1) * voigtTable.dv;
+      H[m] = VoigtHumlicek(a, v, &F[m]);
+    }
   }
+  voigtTable.order = order;
+
+  VoigtTableAccuracy(&maxerr_H, &maxerr_F);
+  sprintf(messageStr, "Created %s Voigt lookup table (%d x %d), "
+	  "max. rel. error vs Humlicek: H %9.2E, F %9.2E\n",
+	  (order == VOIGT_TABLE_BICUBIC) ? "bicubic" : "bilinear",
+	  Na, Nv, maxerr_H, maxerr_F);
+  Error(MESSAGE, routineName, messageStr);
+}
+/* ------- end ---------------------------- initVoigtTable.c -------- */
 
-  /* --- Populate the lookup tables on initialization -- ------------ */
+/* ------- begin -------------------------- freeVoigtTable.c -------- */
 
-  if (initialize) {
-    a_table     = (double *) malloc(N_A * sizeof(double));
-    v_table_lin = (double *) malloc(N_V_LIN * sizeof(double));
-    v_table_log = (double *) malloc(N_V_LOG * sizeof(double));
-
-    table_lin = matrix_double(N_A, N_V_LIN);
-    table_log = matrix_double(N_A, N_V_LOG);
-
-    a_table[0]     = log(A_MIN);
-    a_table[N_A-1] = log(A_MAX);
-    da = (a_table[N_A-1] - a_table[0]) / (N_A - 1);
-    for (n = 1;  n < N_A-1;  n++)
-      a_table[n] = a_table[n-1] + da;
-
-    v_table_lin[0]         = V_MIN_LIN;
-    v_table_lin[N_V_LIN-1] = V_MAX_LIN;
-    dv = (v_table_lin[N_V_LIN-1] - v_table_lin[0]) / (N_V_LIN - 1);
-    for (m = 1;  m < N_V_LIN-1;  m++)
-      v_table_lin[m] = v_table_lin[m-1] + dv;
-
-    v_table_log[0]         = log(V_MIN_LOG);
-    v_table_log[N_V_LOG-1] = log(V_MAX_LOG);
-    dv = (v_table_log[N_V_LOG-1] - v_table_log[0]) / (N_V_LOG - 1);
-    for (m = 1;  m < N_V_LOG-1;  m++)
-      v_table_log[m] = v_table_log[m-1] + dv;
-
-    for (n = 0;  n < N_A;  n++) {
-      for (m = 0;  m < N_V_LIN;  m++) {
-        table_lin[n][m] = Voigt(exp(a_table[n]), v_table_lin[m],
-				NULL, TABLE_ALGORITHM);
-      }
-      for (m = 0;  m < N_V_LOG;  m++) {
-        table_log[n][m] = Voigt(exp(a_table[n]), exp(v_table_log[m]),
-				NULL, TABLE_ALGORITHM);
+void freeVoigtTable(void)
+{
+  if (voigtTable.H != NULL) free(voigtTable.H);
+  if (voigtTable.F != NULL) free(voigtTable.F);
+
+  voigtTable.H = voigtTable.F = NULL;
+  voigtTable.order = VOIGT_TABLE_NONE;
+}
+/* ------- end ---------------------------- freeVoigtTable.c -------- */
+
+/* ------- begin -------------------------- VoigtN.c ---------------- */
+
+/* --- Evaluates H(a[n], v[n]) and, if F != NULL, the Faraday-Voigt
+       function for N points in one call. With algorithm LOOKUP the
+       shared table is interpolated, otherwise Voigt() is called
+       pointwise --                                    -------------- */
+
+void VoigtN(int N, double *a, double *v, double *H, double *F,
+	    enum VoigtAlgorithm algorithm)
+{
+  register int n, i, j;
+
+  int    stride = voigtTable.stride, Na = voigtTable.Na,
+         Nv = voigtTable.Nv;
+  double x, y, s, t, sign, ux[4], uy[4], h, f, *Hc, *Fc;
+
+  if (algorithm != LOOKUP || voigtTable.H == NULL) {
+    if (algorithm == LOOKUP) algorithm = HUMLICEK;
+    for (n = 0;  n < N;  n++)
+      H[n] = Voigt(a[n], v[n], (F) ? &F[n] : NULL, algorithm);
+    return;
+  }
+
+  for (n = 0;  n < N;  n++) {
+    y = fabs(v[n]);
+    if (a[n] < TABLE_A_MIN || a[n] > TABLE_A_MAX || y >= TABLE_V_MAX) {
+      H[n] = VoigtHumlicek(a[n], v[n], (F) ? &F[n] : NULL);
+      continue;
+    }
+    sign = (v[n] < 0.0) ? -1.0 : 1.0;
+
+    x = (log(a[n]) - voigtTable.log_a_min) / voigtTable.dlog_a;
+    i = MIN((int) x, Na - 2);
+    s = x - i;
+    y /= voigtTable.dv;
+    j = MIN((int) y, Nv - 2);
+    t = y - j;
+
+    /* --- Offset by one for the padding row and column -- -------- */
+
+    Hc = voigtTable.H + (i + 1)*stride + (j + 1);
+    Fc = voigtTable.F + (i + 1)*stride + (j + 1);
+
+    if (voigtTable.order == VOIGT_TABLE_BICUBIC) {
+      cc_kernel(s, ux);
+      cc_kernel(t, uy);
+
+      Hc -= stride + 1;
+      Fc -= stride + 1;
+      h = f = 0.0;
+      for (i = 0;  i < 4;  i++, Hc += stride, Fc += stride) {
+	h += ux[i] * (uy[0]*Hc[0] + uy[1]*Hc[1] + uy[2]*Hc[2] + uy[3]*Hc[3]);
+	if (F)
+	  f += ux[i] * (uy[0]*Fc[0] + uy[1]*Fc[1] +
+			uy[2]*Fc[2] + uy[3]*Fc[3]);
       }
+    } else {
+      h = (1.0 - s) * ((1.0 - t)*Hc[0] + t*Hc[1]) +
+	s * ((1.0 - t)*Hc[stride] + t*Hc[stride + 1]);
+      if (F)
+	f = (1.0 - s) * ((1.0 - t)*Fc[0] + t*Fc[1]) +
+	  s * ((1.0 - t)*Fc[stride] + t*Fc[stride + 1]);
     }
-    sprintf(messageStr, "Created Voigt lookup tables\n");
-    Error(MESSAGE, routineName, messageStr);
-
-    initialize = FALSE;
+    H[n] = h;
+    if (F) F[n] = sign * f;
   }
-  /* --- There are two domains. Interpolation is always logarithmic
-         in damping parameter a. For large values of Doppler frequency
-         v it is also logarithmic in v, otherwise it is linear in v - */
+}
+/* ------- end ---------------------------- VoigtN.c ---------------- */
 
-  log_a = log(a);
+/* ------- begin -------------------------- VoigtTableAccuracy.c ---- */
 
-  if (v < V_MAX_LIN) {
-    voigt = BiLinear(N_A, a_table, log_a, N_V_LIN, v_table_lin, v,
-		     table_lin, hunt=TRUE);
-  } else {
-    voigt = BiLinear(N_A, a_table, log_a, N_V_LOG, v_table_log, log(v),
-		     table_log, hunt=FALSE);
+/* --- Accuracy benchmark of the lookup table against Humlicek,
+       evaluated halfway between the table nodes where interpolation
+       errors are largest. Relative errors are measured against
+       max(|H|, 1.0E-6) to avoid blowing up in the far wings -- ----- */
+
+void VoigtTableAccuracy(double *maxerr_H, double *maxerr_F)
+{
+  register int n, m;
+
+  double a, v, H, F, H_tab, F_tab, norm;
+
+  *maxerr_H = *maxerr_F = 0.0;
+  if (voigtTable.H == NULL) return;
+
+  for (n = 0;  n < voigtTable.Na - 1;  n++) {
+    a = exp(voigtTable.log_a_min + (n + 0.5) * voigtTable.dlog_a);
+    for (m = 0;  m < voigtTable.Nv - 1;  m++) {
+      v = (m + 0.5) * voigtTable.dv;
+
+      H = VoigtHumlicek(a, v, &F);
+      VoigtN(1, &a, &v, &H_tab, &F_tab, LOOKUP);
+
+      norm = MAX(fabs(H), 1.0E-6);
+      *maxerr_H = MAX(*maxerr_H, fabs(H_tab - H) / norm);
+      norm = MAX(fabs(F), 1.0E-6);
+      *maxerr_F = MAX(*maxerr_F, fabs(F_tab - F) / norm);
+    }
   }
-  return voigt;
 }
-/* ------- begin -------------------------- VoigtLookup.c ----------- */
+/* ------- end ---------------------------- VoigtTableAccuracy.c ---- */
@@ -391,6 +391,11 @@ void adjustStokesMode()
   if (oldMode == FIELD_FREE) {
     getCPU(2, TIME_START, NULL);
 
+    /* --- Polarized profiles need more storage, so the memory budget
+           has to be re-evaluated --                   -------------- */
+
+    setProfileStorage();
+
     for (nact = 0;  nact < atmos.Nactiveatom;  nact++) {
       atom = atmos.activeatoms[nact];
 
@@ -403,7 +408,7 @@ void adjustStokesMode()
 	  /* --- First free up the space used in field-free
                  calculation --                        -------------- */
 	  
-	  if (!input.limit_memory){
+	  if (line->phi != NULL) {
 	    freeMatrix((void **) line->phi);
 	    line->phi = NULL;
 	  }
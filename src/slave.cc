@@ -29,6 +29,7 @@
 #include "fpigen.h"
 #include "specrebin.h"
 #include "specprefilter.h"
+#include "master_sparse.h"
 
 using namespace std;
 //
@@ -56,6 +57,20 @@ void do_slave(int myrank, int nprocs, char hostname[]){
   input.myrank = myrank;
   if(input.mode == 1 || input.mode == 3) comm_send_weights(input, w);
 
+
+  /* --- Two-level master: this rank talks to rank 0 or to the sub-master of 
+     its group, or it is a sub-master itself --- */
+
+  int gslaves = 0, grank = 0;
+  MPI_Comm comm = comm_split_groups(input, myrank, nprocs, gslaves);
+  if(comm != MPI_COMM_WORLD) MPI_Comm_rank(comm, &grank);
+  
+  if((comm != MPI_COMM_WORLD) && (grank == 0)){
+    do_submaster(input, comm);
+    MPI_Comm_free(&comm);
+    return;
+  }
+
   
   /* --- Init atmosphere --- */
   atmos *atmos;
@@ -103,7 +118,7 @@ void do_slave(int myrank, int nprocs, char hostname[]){
     // Receive package from master, including action
     //
     int compute_derivatives = 0;
-    comm_slave_unpack_data(input, action, obs, pars, m, compute_derivatives);
+    comm_slave_unpack_data(input, action, obs, pars, m, compute_derivatives, comm);
     if(action == 0) break; // Exit while loop if action = 0
     
     //
@@ -124,12 +139,13 @@ void do_slave(int myrank, int nprocs, char hostname[]){
 	input.chi[pp] =
 	  atmos->fitModel2( m[pp], input.npar, &pars(pp,0),
 			    (int)(input.nw_tot*input.ns), &obs(pp,0,0), w);
+	input.tel[pp] = atmos->stats;
       }
 
       
       // Send back to master
       
-      comm_slave_pack_data(input, obs, pars, dobs, compute_derivatives, m);
+      comm_slave_pack_data(input, obs, pars, dobs, compute_derivatives, m, comm);
       
     }else if(input.mode == 2){
       
@@ -207,7 +223,7 @@ void do_slave(int myrank, int nprocs, char hostname[]){
       
       /* --- Send back profiles --- */
       
-      comm_slave_pack_data(input, obs, pars, dobs, compute_derivatives, m);
+      comm_slave_pack_data(input, obs, pars, dobs, compute_derivatives, m, comm);
       m.clear();
       
       
@@ -270,7 +286,7 @@ void do_slave(int myrank, int nprocs, char hostname[]){
       
       
       /* --- Send results back to master --- */
-      comm_slave_pack_data(input, obs, pars, dobs, compute_derivatives, m);
+      comm_slave_pack_data(input, obs, pars, dobs, compute_derivatives, m, comm);
 
       
       /* --- Clean-up ---*/
@@ -357,7 +373,7 @@ void do_slave(int myrank, int nprocs, char hostname[]){
       
       /* --- Send back profiles --- */
       
-      comm_slave_pack_data(input, obs, pars, dobs, compute_derivatives, m);
+      comm_slave_pack_data(input, obs, pars, dobs, compute_derivatives, m, comm);
       m.clear();
       
       
@@ -371,5 +387,6 @@ void do_slave(int myrank, int nprocs, char hostname[]){
   
   for(auto &it: inst)
     delete it;  
-  
+
+  if(comm != MPI_COMM_WORLD) MPI_Comm_free(&comm);
 }
@@ -86,7 +86,7 @@ void sparse2d::evalModel_mpi(mat<double> &x, mat<double> &syn, mat<double> &dsyn
   int iproc = 0;
   unsigned long ipix = 0;
   int tocom = ncom;
-  mat<double> dum; // dummy chi parameter
+  mat<double> dum; // dummy chi/telemetry parameter
 
 
   // Init slaves
@@ -110,7 +110,7 @@ void sparse2d::evalModel_mpi(mat<double> &x, mat<double> &syn, mat<double> &dsyn
   
   while(irec < ntot){
     // Receive processed data from any slave (iproc)
-    comm_master_unpack_data(iproc, iput, syn, x, dum, irec, dsyn, compute_gradient, m);
+    comm_master_unpack_data(iproc, iput, syn, x, dum, dum, irec, dsyn, compute_gradient, m);
     per = irec * pno;
 
     // Send more data to that same slave (iproc)
@@ -0,0 +1,68 @@
+/* ---
+   Per-pixel performance counters (telemetry). They are accumulated by
+   the slaves during the inversion of each pixel, shipped back to the
+   master in the result package and written as extra variables in the
+   output profiles file.
+
+   Modifications:
+           2026-10-18: Created.
+           2026-10-19: ps_timeout, pixels stopped by the watchdog (pixel_timeout).
+   --- */
+
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+#include <sys/time.h>
+
+/* --- Index of each counter --- */
+
+enum pixstat_type{
+  ps_wall = 0,     // wall time spent in the pixel [s]
+  ps_nsynth,       // calls to atmos::synth (including RFs)
+  ps_lm_iter,      // LM iterations
+  ps_lm_reject,    // LM rejected steps (lambda increased)
+  ps_ninv,         // inversion cycles used (nInv restarts)
+  ps_rh_iter,      // RH iterations in Iterate_j
+  ps_rh_prd_iter,  // RH PRD sub-iterations in Redistribute_j
+  ps_t_eos,        // time in the EOS (hydrostatic eq. + chemical eq.) [s]
+  ps_t_background, // time in the background/continuum opacities [s]
+  ps_t_formal,     // time in the formal solver [s]
+  ps_t_stateq,     // time solving the statistical equilibrium [s]
+  ps_timeout,      // 1 if the pixel was stopped by the watchdog (pixel_timeout)
+  ps_nstat
+};
+
+
+/* --- Names of the output variables, same order as pixstat_type --- */
+
+static const char * const pixstat_names[ps_nstat] = {"tel_wall", "tel_nsynth", "tel_lm_iter", "tel_lm_reject", "tel_ninv",
+						      "tel_rh_iter", "tel_rh_prd_iter", "tel_t_eos", "tel_t_background",
+						      "tel_t_formal", "tel_t_stateq", "tel_timeout"};
+
+
+/* --- Counters of one pixel --- */
+
+struct pixstat{
+  double d[ps_nstat];
+
+  pixstat(){reset();};
+
+  inline void reset(){for(int ii=0; ii<ps_nstat; ii++) d[ii] = 0.0;};
+  inline double &operator[](int ii){return d[ii];};
+  inline double operator[](int ii)const{return d[ii];};
+
+  inline pixstat &operator+=(const pixstat &in){
+    for(int ii=0; ii<ps_nstat; ii++) d[ii] += in.d[ii];
+    return *this;
+  }
+
+  static double getTime(double t0 = -1.0){
+    struct timeval dum;
+    gettimeofday(&dum, NULL);
+    if(t0 < 0.0) return dum.tv_sec + dum.tv_usec * 1.0E-6;
+    else return (dum.tv_sec + dum.tv_usec * 1.0E-6) - t0;
+  }
+};
+typedef pixstat pixstat_t;
+
+#endif
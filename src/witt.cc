@@ -13,6 +13,12 @@
                       reduce the amount of neutral and ionized Hydrogen and therefore
 		      it must be accounted for in rho.
 
+   2026-10-19: pe_from_pg solves Pgas(Pe) = Pgas with safeguarded Newton
+               iterations and analytical derivatives. The partition functions
+	       are computed once per call, not once per iteration, the solver
+	       can be warm-started and whole columns are solved by
+	       pe_from_pg_column.
+
    ---- */
 
 #include <cmath>
@@ -42,7 +48,7 @@ template <class T> T pow10(T x){return (T)exp(2.3025850929940459*x);};
 /* --------------------------------------------------------------------------------------- */
 
 const float witt::prec = 1.e-5; 
-const int   witt::ncontr = 28;
+const int   witt::ncontr;
 const double witt::saha_fac =  pow( (2.0 * phyc::PI * phyc::ME * phyc::BK) / (phyc::HH*phyc::HH), 1.5);
 
 /* --------------------------------------------------------------------------------------- */
@@ -315,29 +321,44 @@ template double eos::witt::getN_and_U(int, int, double, double, double, double&,
 
 /* --------------------------------------------------------------------------------------- */
 
-template <class T> T eos::witt::pe_from_pg(T temp, T Pgas, T *fe_out)
+template <class T> T eos::witt::pe_from_pg(T temp, T Pgas, T *fe_out, T Pe_guess)
 {
+  pe_factors f;
+  double fe = 0.0;
   
-  float dif = 1.1;
-  T Pe = 1.2 * init_pe_from_T_Pg<T>(temp, Pgas), oPe = Pe;
-  int it = 0;
+  get_pe_factors((double)temp, f);
+  T Pe = (T)pe_newton(f, (double)temp, (double)Pgas, (double)Pe_guess, fe);
+  
+  if(fe_out) fe_out[0] = (T)fe;
   
-  while((dif > prec) && (it++ < 250)){
-    if(dif > 0.5) Pe = (oPe + Pe)*0.5;
-    oPe = Pe;
-    Pe = pe_pg<T>(temp, Pe, Pgas, fe_out);
-    dif = 2.0 * fabs(float(Pe - oPe)/(Pe + oPe));
-  }
-
   return Pe;
 }
 
-template float  eos::witt::pe_from_pg (float, float, float*  );
-template double eos::witt::pe_from_pg (double, double, double*);
+template float  eos::witt::pe_from_pg (float, float, float*, float);
+template double eos::witt::pe_from_pg (double, double, double*, double);
 
 /* --------------------------------------------------------------------------------------- */
 
-template <class T> T eos::witt::rho_from_pg(T temp, T Pgas, T &Pe)
+void eos::witt::pe_from_pg_column(int ndep, const double *t, const double *pg, double *pe, double *fe)
+{
+
+  /* --- Each depth starts from the solution of the previous one, scaled 
+     with the gas pressure --- */
+  
+  pe_factors f;
+  double guess = -1.0;
+  
+  for(int k=0; k<ndep; k++){
+    if(k > 0) guess = pe[k-1] * pg[k] / pg[k-1];
+    
+    get_pe_factors(t[k], f);
+    pe[k] = pe_newton(f, t[k], pg[k], guess, fe[k]);
+  }
+}
+
+/* --------------------------------------------------------------------------------------- */
+
+template <class T> T eos::witt::rho_from_pg(T temp, T Pgas, T &Pe, T Pe_guess)
 {
 
   /* ---- 
@@ -347,15 +368,15 @@ template <class T> T eos::witt::rho_from_pg(T temp, T Pgas, T &Pe)
      --- */
   
   T fe_out = 0.0;
-  Pe = pe_from_pg<T>(temp, Pgas, &fe_out);
+  Pe = pe_from_pg<T>(temp, Pgas, &fe_out, Pe_guess);
   T rho = Pe * rho_from_H / (fe_out * temp);
 
   
   return rho;
 }
 
-template double  eos::witt::rho_from_pg (double, double, double&);
-template float   eos::witt::rho_from_pg (float, float, float&  );
+template double  eos::witt::rho_from_pg (double, double, double&, double);
+template float   eos::witt::rho_from_pg (float, float, float&, float);
 
 
 /* --------------------------------------------------------------------------------------- */
@@ -493,6 +514,164 @@ template double witt::pe_pg (double, double, double, double*);
 
 /* --------------------------------------------------------------------------------------- */
 
+void eos::witt::get_pe_factors(double temp, pe_factors &f)
+{
+
+  /* --- Same constants as in pe_pg, the saha ratios scale as 1/Pe --- */
+  
+  double cmol[2], dcmol[2], u0, u1, u2, du0, du1, du2, theta = 5040./temp;
+  
+  molecb<double>(theta, cmol, dcmol);
+  acota<double>(cmol[0], -30., -30.); acota<double>(cmol[1], -30., 30.);
+  
+  f.g4 = pow10<double>(cmol[0]);
+  f.g5 = pow10<double>(cmol[1]);
+
+  partition_f<double>(0, temp, u0, u1, u2, du0, du1, du2);
+  f.g2 = saha<double>(theta, phyc::EION1[0], u0, u1, 1.0); // p(h+)/p(h) * Pe
+  f.g3 = saha<double>(theta, 0.754, 1.0, u0, 1.0);         // p(h)/p(h-) * Pe
+
+  for(int i=1; i<ncontr; i++){
+    partition_f<double>(i, temp, u0, u1, u2, du0, du1, du2);
+    f.a[i] = saha<double>(theta, phyc::EION1[i], u0, u1, 1.0);
+    f.b[i] = saha<double>(theta, phyc::EION2[i], u1, u2, 1.0);
+    f.alf[i] = ABUND[i] / ABUND[0];
+  }
+}
+
+/* --------------------------------------------------------------------------------------- */
+
+double eos::witt::pg_dpg(const pe_factors &f, double Pe, double &dPg, double &fe)
+{
+
+  /* --- The system of pe_pg, written as Pgas(Pe) = Pe * (1 + sum(f) / fe). 
+     Every quantity "x" carries its derivative "dx" relative to Pe. 
+     The limits set by acota/acotasig have zero derivative --- */
+
+  double iPe = 1.0 / Pe;
+  
+  double g4 = f.g4 * Pe;
+  double g5 = f.g5 * Pe, dg5 = f.g5;
+  double g2 = f.g2 * iPe, dg2 = -g2 * iPe;
+  double g3 = f.g3 * iPe, dg3 = 1.0 / f.g3;
+  
+  double tmp = g3;
+  acota<double>(g3, 1.e-30, 1.e30);
+  if(tmp != g3) dg3 = 0.0;
+  g3 = 1.0 / g3;
+
+
+  /* --- Electrons from the other contributors --- */
+  
+  double g1 = 0.0, dg1 = 0.0;
+  
+  for(int i=1; i<ncontr; i++){
+    double a = f.a[i] * iPe, b = f.b[i] * iPe;
+    double num = a*(1.+2.*b), dnum = -(a + 4.*a*b) * iPe;
+    double den = 1.+a*(1.+b), dden = -(a + 2.*a*b) * iPe;
+    
+    g1  += f.alf[i] * num / den;
+    dg1 += f.alf[i] * (dnum*den - num*dden) / (den*den);
+  }
+
+  
+  /* --- Hydrogen, H- and H2 --- */
+  
+  double a = 1.+g2+g3, da = dg2+dg3;
+  double e = g2/g5*g4, de = dg2/g5*g4;
+  double b = 2.*(1.+e), db = 2.*de;
+  double c = g5, dc = dg5;
+  double d = g2-g3, dd = dg2-dg3;
+
+  tmp = a, acotasig<double>(a, 1.e-15, 1.e15);
+  if(tmp != a) da = 0.0;
+  tmp = d, acotasig<double>(d, 1.e-15, 1.e15);
+  if(tmp != d) dd = 0.0;
+
+  double c1 = c*b*b+a*d*b-e*a*a;
+  double dc1 = dc*b*b + 2.*c*b*db + da*d*b + a*dd*b + a*d*db - de*a*a - 2.*e*a*da;
+  double c2 = 2.*a*e-d*b+a*b*g1;
+  double dc2 = 2.*(da*e + a*de) - dd*b - d*db + (da*b + a*db)*g1 + a*b*dg1;
+  double c3 = -(e+b*g1), dc3 = -(de + db*g1 + b*dg1);
+
+  double h = 0.5*c2/c1, dh = 0.5*(dc2*c1 - c2*dc1)/(c1*c1);
+  double q = h*h-c3/c1, dq = 2.*h*dh - (dc3*c1 - c3*dc1)/(c1*c1);
+  double sq = sqrt(q), sg = sign<double>(1.,c1);
+  
+  double f1 = -h + sg*sq, df1 = -dh + sg*0.5*dq/sq;
+  double f5 = (1.-a*f1)/b, df5 = (-(da*f1 + a*df1) - f5*db)/b;
+  double f4 = e*f5, df4 = de*f5 + e*df5;
+  double f3 = g3*f1, df3 = dg3*f1 + g3*df1;
+  double f2 = g2*f1, df2 = dg2*f1 + g2*df1;
+  double dfe = df2-df3+df4+dg1;
+  fe = f2-f3+f4+g1;
+  
+  tmp = fe, acota<double>(fe, 1.e-30, 1.e30);
+  if(tmp != fe) dfe = 0.0;
+  double phtot = Pe/fe, dphtot = (fe - Pe*dfe)/(fe*fe);
+  
+  if(f5 < 1.e-4){
+    double const6 = f.g5*f1*f1, dconst6 = 2.*f.g5*f1*df1;
+    double const7 = f2-f3+g1, dconst7 = df2-df3+dg1;
+    
+    for(int ii =0; ii<5; ii++){
+      f5 = phtot*const6, df5 = dphtot*const6 + phtot*dconst6;
+      f4 = e*f5, df4 = de*f5 + e*df5;
+      fe = const7+f4, dfe = dconst7+df4;
+      phtot = Pe/fe, dphtot = (fe - Pe*dfe)/(fe*fe);
+    }
+  }
+
+  double sum = f1+f2+f3+f4+f5+Ab_others, dsum = df1+df2+df3+df4+df5;
+  
+  dPg = 1.0 + sum/fe + Pe*(dsum*fe - sum*dfe)/(fe*fe);
+  return Pe * (1.0 + sum/fe);
+}
+
+/* --------------------------------------------------------------------------------------- */
+
+double eos::witt::pe_newton(const pe_factors &f, double temp, double Pgas, double Pe, double &fe)
+{
+
+  /* --- Newton iterations of ln(Pgas(Pe)) - ln(Pgas) = 0 in ln(Pe).
+     The root is kept in a bracket [xlo, xhi], with Pe < Pgas. Steps that 
+     leave the bracket or are longer than a decade are replaced by a 
+     bisection, or by one decade if there is no lower bound yet --- */
+  
+  const int maxiter = 50;
+  const double tol = 1.e-10, decade = 2.3025850929940459;
+  
+  double xhi = log(Pgas), xlo = -1.e30, dPg = 0.0;
+
+  if(!(Pe > 0.0 && Pe < Pgas)) Pe = 1.2 * init_pe_from_T_Pg<double>(temp, Pgas);
+  double x = std::min(log(Pe), xhi - 0.1*decade);
+  
+  int it = 0;
+  while(it++ < maxiter){
+    Pe = exp(x);
+    
+    double Pg = pg_dpg(f, Pe, dPg, fe);
+    double F = log(Pg / Pgas), dF = Pe * dPg / Pg;
+
+    if(F > 0.0) xhi = x;
+    else        xlo = x;
+
+    double dx = (dF > 0.0) ? -F / dF : 0.0;
+    if((dF > 0.0) && (fabs(dx) < tol)) break;
+    
+    if(!(dF > 0.0) || (x+dx <= xlo) || (x+dx >= xhi) || (fabs(dx) > decade)){
+      if(xlo > -1.e29) dx = 0.5*(xlo+xhi) - x;
+      else dx = -decade;
+    }
+    
+    x += dx;
+  }
+  
+  return Pe;
+}
+
+/* --------------------------------------------------------------------------------------- */
+
 template <class T> T witt::pg_from_pe(T t, T Pe, T *fe_out)
 {
   //T p[99], dpp[99], dp[99];
@@ -2386,8 +2565,9 @@ void witt::witt::hydrostatic(int ndep, double *tau, double *t, double *Pg, doubl
 
 	//}
       
-      /* ---  Get opacity --- */
-      rho[k] = rho_from_pg<double>(t[k], Pg[k], pel[k]);
+      /* ---  Get opacity, Pe starts from the previous depth/iteration --- */
+      double guess = (iter == 0) ? pel[k-1] * Pg[k] / Pg[k-1] : pel[k];
+      rho[k] = rho_from_pg<double>(t[k], Pg[k], pel[k], guess);
       contOpacity<double>(t[k], Pg[k], pel[k], nw, &wav, &kappa);
       
       //contOpacity_TPg(t[k], Pg[k], nw, &wav, &kappa, &scat);
@@ -2440,9 +2620,12 @@ void witt::witt::fill_densities(int ndep, double *t, double *pgas, double *rho,
      --- */
   if((keep_nne == 0) && ((touse == 0) || (touse == 1))){
     if(touse == 0){
+      std::vector<double> fe(ndep);
+      pe_from_pg_column(ndep, t, pgas, pel, &fe[0]);
+      
       for(int k = 0; k<ndep; k++){
-	nne[k] = nne_from_T_Pg(t[k], pgas[k], rho[k]);
-	pel[k] = phyc::BK*nne[k]*t[k];
+	rho[k] = pel[k] * rho_from_H / (fe[k] * t[k]);
+	nne[k] = pel[k]/(phyc::BK*t[k]);
 	//store_partial_pressures(ndep, k, xna, xne);
       }
     }else if(touse == 1){
@@ -2457,8 +2640,11 @@ void witt::witt::fill_densities(int ndep, double *t, double *pgas, double *rho,
     }
   }else{
     if(touse == 0){
+      std::vector<double> pe(ndep), fe(ndep);
+      pe_from_pg_column(ndep, t, pgas, &pe[0], &fe[0]);
+      
       for(int k = 0; k<ndep; k++){
-	nne_from_T_Pg_nne(t[k], pgas[k], rho[k], nne[k]);
+	rho[k] = pe[k] * rho_from_H / (fe[k] * t[k]);
 	pel[k] = phyc::BK*nne[k]*t[k];
 	//store_partial_pressures(ndep, k, xna, xne);
       }
@@ -2600,7 +2786,7 @@ void eos::witt::hydrostatic_cmass(int ndep, double *tau, double *t, double *Pg,
 
 
     /* --- Fill other scales and variables --- */
-    rho[k] = rho_from_pg<double>(t[k], Pg[k], pel);
+    rho[k] = rho_from_pg<double>(t[k], Pg[k], pel, pel * Pg[k] / Pg[k-1]);
     contOpacity(t[k], Pg[k], pel, nw, &wav, &kappa);
     //rho[k] = RHOest, nel[k] = xne;
     nel[k] = pel/(t[k]*phyc::BK);
@@ -4,7 +4,8 @@
 
    Added interface routines to the background opacity code.
    
-   
+   2026-10-19: Newton solver of Pe(Pgas) with the saha factors computed once
+               per temperature, warm starts and a depth-column version.
 
    ---- */
 
@@ -42,9 +43,21 @@ namespace eos{
   class witt: public eoswrap{
   private:
     static const float prec;
-    static const int ncontr;
+    static const int ncontr = 28;
     double Ab_others;
 
+    
+    /* --- Pe-independent factors of pe_pg at one temperature: molecular constants
+       and saha ratios (at Pe = 1) of H, H- and the other contributors --- */
+    
+    struct pe_factors{
+      double g2, g3, g4, g5, a[ncontr], b[ncontr], alf[ncontr];
+    };
+    
+    void get_pe_factors(double temp, pe_factors &f);
+    double pg_dpg(const pe_factors &f, double Pe, double &dPg, double &fe);
+    double pe_newton(const pe_factors &f, double temp, double Pgas, double Pe, double &fe);
+
   public:
     double avweight, muH, rho_from_H, gravity;
     static const double saha_fac;
@@ -60,9 +73,9 @@ namespace eos{
     template <class T> void acota(T &x, T x0, T x1);
     template <class T> void acotasig(T &x, T x0, T x1);
     
-    template <class T> T pe_from_pg(T temp, T Pgas, T *fe_out = NULL);
+    template <class T> T pe_from_pg(T temp, T Pgas, T *fe_out = NULL, T Pe_guess = -1);
     template <class T> T pg_from_pe(T t, T Pe, T *fe_out = NULL);
-    template <class T> T rho_from_pg(T temp, T Pgas, T &Pe);
+    template <class T> T rho_from_pg(T temp, T Pgas, T &Pe, T Pe_guess = -1);
     template <class T> T rho_from_pe(T temp, T Pe, T &Pg);
     template <class T> T pg_from_rho(T temp, T rho, T &Pe);
 
@@ -82,6 +95,7 @@ namespace eos{
     template <class T> void contOpacity(T temp, T iPgas, T iPe, int nw, double *w, double *opac);
     template <class T> int getXpart(int iatom, T t, T Pgas, T Pe, T *xpa, T *u, T *ein,
 				    bool divide_by_u = false);
+    void pe_from_pg_column(int ndep, const double *t, const double *pg, double *pe, double *fe);
     
 
     /* --- Prototypes for eoswrap --- */
@@ -90,8 +104,8 @@ namespace eos{
     double Pg_from_Pe(double temp, double Pe, double *fe_out = NULL){return pg_from_pe(temp, Pe, fe_out);};
     double Pg_from_Rho(double temp, double rho, double &Pe){return pg_from_rho(temp, rho, Pe);};
     void unique(void){};
-    void store_partial_pressures(int ndep, int k, float na, float ne){};
-    void read_partial_pressures(int k, std::vector<float> &frac, std::vector<float> &part, float &xa, float &xe){};
+    void store_partial_pressures(int ndep, int k, double na, double ne){};
+    void read_partial_pressures(int k, std::vector<double> &frac, std::vector<double> &part, double &xa, double &xe){};
     
     /* --- header templates --- */
     
@@ -105,7 +119,7 @@ namespace eos{
     double nne_from_T_Pg    (double T,  double Pg,  double &rho, double iPe = -1.0)
     {
       double Pe = 0.0;
-      rho = rho_from_pg<double>(T, Pg, Pe);
+      rho = rho_from_pg<double>(T, Pg, Pe, iPe);
       return Pe/(T*phyc::BK);
     }
     double nne_from_T_rho   (double T, double &iPg,  double rho)
@@ -161,7 +175,7 @@ namespace eos{
 			   double *z, double *cmass, double *ltau, double &pgas_bound);
 
     void contOpacity        (double T, int nw, double *w,
-			     double *opac, double *scattering, std::vector<float> &frac, float na, float ne){}
+			     double *opac, double *scattering, std::vector<double> &frac, double na, double ne){}
 
 
 